@@ -226,7 +226,8 @@ int ObSyncPlanDriver::response_result(ObMySQLResultSet &result)
           ok_param.message_ = const_cast<char*>(result.get_message());
           ok_param.affected_rows_ = curr_affected_row;
           ok_param.is_partition_hit_ = session_.partition_hit().get_bool();
-          ok_param.has_more_result_ = !result.is_cursor_end();
+          // a batched run of multi stmt may be followed by other statements of the packet
+          ok_param.has_more_result_ = !result.is_cursor_end() || result.has_more_result();
           process_ok = true;
           if (OB_FAIL(sender_.send_ok_packet(session_, ok_param))) {
             LOG_WARN("send ok packet failed", K(ret), K(ok_param));
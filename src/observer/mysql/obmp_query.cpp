@@ -36,6 +36,7 @@
 #include "rpc/obmysql/packet/ompk_row.h"
 #include "sql/ob_sql_context.h"
 #include "sql/ob_sql.h"
+#include "sql/parser/ob_fast_parser.h"
 #include "sql/ob_sql_trans_util.h"
 #include "sql/session/ob_sql_session_mgr.h"
 #include "sql/resolver/cmd/ob_variable_set_stmt.h"
@@ -267,6 +268,7 @@ int ObMPQuery::process()
           */
           bool optimization_done = false;
           const char *p_normal_start = nullptr;
+          ObSEArray<int64_t, 1> run_ends;
           if (queries.count() > 1 && session.is_txn_free_route_temp()) {
             need_disconnect = false;
             need_response_error = true;
@@ -278,6 +280,9 @@ int ObMPQuery::process()
             && OB_FAIL(try_batched_multi_stmt_optimization(session,
                                                           queries,
                                                           parse_stat,
+                                                          sql_,
+                                                          0,
+                                                          false,
                                                           optimization_done,
                                                           async_resp_used,
                                                           need_disconnect,
@@ -291,8 +296,18 @@ int ObMPQuery::process()
             need_disconnect = false;
             need_response_error = true;
             LOG_WARN("explain batch statement failed", K(ret));
+          } else if (!optimization_done
+                     && OB_FAIL(get_batched_stmt_runs(session, queries, parse_stat, run_ends))) {
+            LOG_WARN("failed to get batched stmt runs", K(ret));
           } else if (!optimization_done) {
-            ARRAY_FOREACH(queries, i) {
+            // the whole packet is not batched, still try to batch each run of same dml in it,
+            // a run of the whole packet has been tried above
+            ObSEArray<ObString, 16> run_queries;
+            int64_t batch_tried_end = (run_ends.empty() || queries.count() == run_ends.at(0))
+                                      ? queries.count() : 0;
+            int64_t next_idx = 0;
+            for (int64_t i = 0; OB_SUCC(ret) && i < queries.count(); i = next_idx) {
+              next_idx = i + 1;
               // in multistmt sql, audit_record will record multistmt_start_ts_ when count over 1
               // queries.count()>1 -> batch,(m)sql1,(m)sql2,...    |    queries.count()=1 -> sql1
               if (i > 0) {
@@ -315,20 +330,53 @@ int ObMPQuery::process()
                 need_response_error = true;
                 break;
               } else {
-                has_more = (queries.count() > i + 1);
-                // 本来可以做成不管queries.count()是多少，最后一个query都可以异步回包的，
-                // 但是目前的代码实现难以在不同的线程处理同一个请求的回包，
-                // 因此这里只允许只有一个query的multi query请求异步回包。
-                force_sync_resp = queries.count() <= 1? false : true;
-                // is_part_of_multi 表示当前sql是 multi stmt 中的一条，
-                // 原来的值默认为true，会影响单条sql的二次路由，现在改为用 queries.count() 判断。
-                bool is_part_of_multi = queries.count() > 1 ? true : false;
-                ret = process_single_stmt(ObMultiStmtItem(is_part_of_multi, i, queries.at(i)),
-                                          session,
-                                          has_more,
-                                          force_sync_resp,
-                                          async_resp_used,
-                                          need_disconnect);
+                bool run_done = false;
+                if (i >= batch_tried_end && run_ends.at(i) > i + 1) {
+                  // a run is tried once, its statements are executed one by one if it fails
+                  batch_tried_end = run_ends.at(i);
+                  run_queries.reuse();
+                  for (int64_t j = i; OB_SUCC(ret) && j < batch_tried_end; j++) {
+                    if (OB_FAIL(run_queries.push_back(queries.at(j)))) {
+                      LOG_WARN("failed to push back query", K(ret));
+                    }
+                  }
+                  // statements of a run are slices of sql_, the run is audited with its own text
+                  const ObString &last_query = queries.at(batch_tried_end - 1);
+                  ObString run_sql(static_cast<int32_t>(last_query.ptr() + last_query.length()
+                                                        - queries.at(i).ptr()),
+                                   queries.at(i).ptr());
+                  if (OB_FAIL(ret)) {
+                  } else if (OB_FAIL(try_batched_multi_stmt_optimization(session,
+                                                                         run_queries,
+                                                                         parse_stat,
+                                                                         run_sql,
+                                                                         i,
+                                                                         queries.count() > batch_tried_end,
+                                                                         run_done,
+                                                                         async_resp_used,
+                                                                         need_disconnect,
+                                                                         false))) {
+                    LOG_WARN("failed to try multi-stmt-optimization", K(ret), K(i), K(batch_tried_end));
+                  } else if (run_done) {
+                    next_idx = batch_tried_end;
+                  }
+                }
+                if (OB_SUCC(ret) && !run_done) {
+                  has_more = (queries.count() > i + 1);
+                  // 本来可以做成不管queries.count()是多少，最后一个query都可以异步回包的，
+                  // 但是目前的代码实现难以在不同的线程处理同一个请求的回包，
+                  // 因此这里只允许只有一个query的multi query请求异步回包。
+                  force_sync_resp = queries.count() <= 1? false : true;
+                  // is_part_of_multi 表示当前sql是 multi stmt 中的一条，
+                  // 原来的值默认为true，会影响单条sql的二次路由，现在改为用 queries.count() 判断。
+                  bool is_part_of_multi = queries.count() > 1 ? true : false;
+                  ret = process_single_stmt(ObMultiStmtItem(is_part_of_multi, i, queries.at(i)),
+                                            session,
+                                            has_more,
+                                            force_sync_resp,
+                                            async_resp_used,
+                                            need_disconnect);
+                }
               }
             }
           }
@@ -418,16 +466,89 @@ int ObMPQuery::process()
  * Try to evaluate multiple update queries as a single query to optimize rpc cost
  * for details, please ref to
  */
+/*
+ * Multi statements sent by batching clients (e.g. jdbc rewriteBatchedStatements) may mix
+ * several dml shapes, which fails the batched optimization of the whole packet.
+ * Split the packet into runs of adjacent dml with the same parameterized text, each run
+ * of more than one statement can still be executed as one batched multi stmt.
+ * run_ends.at(i) is the end (exclusive) of the run starting from queries.at(i),
+ * run_ends is empty if the packet can not be batched at all.
+ */
+int ObMPQuery::get_batched_stmt_runs(ObSQLSessionInfo &session,
+                                     const ObIArray<ObString> &queries,
+                                     const ObMPParseStat &parse_stat,
+                                     ObIArray<int64_t> &run_ends)
+{
+  int ret = OB_SUCCESS;
+  run_ends.reset();
+  if (queries.count() <= 1 || parse_stat.parse_fail_) {
+    /*do nothing*/
+  } else if (!session.is_enable_batched_multi_statement()
+             || !session.get_local_ob_enable_plan_cache()
+             || ObSQLUtils::is_enable_explain_batched_multi_statement()) {
+    /*do nothing*/
+  } else {
+    ObArenaAllocator allocator("BatchStmtRuns");
+    FPContext fp_ctx(session.get_charsets4parser());
+    fp_ctx.enable_batched_multi_stmt_ = true;
+    fp_ctx.sql_mode_ = session.get_sql_mode();
+    ObSEArray<ObString, 16> no_param_sqls;
+    for (int64_t i = 0; OB_SUCC(ret) && i < queries.count(); i++) {
+      ObString query = queries.at(i);
+      query.trim();
+      ObString no_param_sql;
+      char *no_param_sql_ptr = NULL;
+      int64_t no_param_sql_len = 0;
+      ParamList *param_list = NULL;
+      int64_t param_num = 0;
+      bool is_dml = (query.length() > 6 && (0 == STRNCASECMP(query.ptr(), "insert", 6)
+                                            || 0 == STRNCASECMP(query.ptr(), "update", 6)
+                                            || 0 == STRNCASECMP(query.ptr(), "delete", 6)))
+                    || (query.length() > 7 && 0 == STRNCASECMP(query.ptr(), "replace", 7));
+      if (!is_dml) {
+        // executed alone
+      } else if (OB_FAIL(ObFastParser::parse(query, fp_ctx, allocator, no_param_sql_ptr,
+                                             no_param_sql_len, param_list, param_num))) {
+        // executed alone, the error is reported by the execution of the statement
+        LOG_TRACE("failed to fast parse query", K(ret), K(i));
+        ret = OB_SUCCESS;
+      } else if (param_num > 0) {
+        no_param_sql.assign_ptr(no_param_sql_ptr, static_cast<int32_t>(no_param_sql_len));
+      }
+      if (OB_SUCC(ret) && OB_FAIL(no_param_sqls.push_back(no_param_sql))) {
+        LOG_WARN("failed to push back no param sql", K(ret));
+      }
+    }
+    if (OB_FAIL(ret)) {
+    } else if (OB_FAIL(run_ends.prepare_allocate(queries.count()))) {
+      LOG_WARN("failed to prepare allocate run ends", K(ret));
+    } else {
+      for (int64_t i = queries.count() - 1; i >= 0; i--) {
+        if (i + 1 < queries.count()
+            && !no_param_sqls.at(i).empty()
+            && no_param_sqls.at(i) == no_param_sqls.at(i + 1)) {
+          run_ends.at(i) = run_ends.at(i + 1);
+        } else {
+          run_ends.at(i) = i + 1;
+        }
+      }
+    }
+  }
+  return ret;
+}
+
 int ObMPQuery::try_batched_multi_stmt_optimization(sql::ObSQLSessionInfo &session,
                                                    common::ObIArray<ObString> &queries,
                                                    const ObMPParseStat &parse_stat,
+                                                   const ObString &batch_sql,
+                                                   int64_t seq_num,
+                                                   bool has_more,
                                                    bool &optimization_done,
                                                    bool &async_resp_used,
                                                    bool &need_disconnect,
                                                    bool is_ins_multi_val_opt)
 {
   int ret = OB_SUCCESS;
-  bool has_more = false;
   bool force_sync_resp = true;
   bool enable_batch_opt = session.is_enable_batched_multi_statement();
   bool use_plan_cache = session.get_local_ob_enable_plan_cache();
@@ -438,7 +559,8 @@ int ObMPQuery::try_batched_multi_stmt_optimization(sql::ObSQLSessionInfo &sessio
     // 未打开batch开关
   } else if (!use_plan_cache) {
     // 不打开plan_cache开关，则优化不支持
-  } else if (OB_FAIL(process_single_stmt(ObMultiStmtItem(false, 0, sql_, &queries, is_ins_multi_val_opt),
+  } else if (OB_FAIL(process_single_stmt(ObMultiStmtItem(seq_num > 0, seq_num, batch_sql, &queries,
+                                                         is_ins_multi_val_opt),
                                          session,
                                          has_more,
                                          force_sync_resp,
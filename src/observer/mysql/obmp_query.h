@@ -95,9 +95,16 @@ private:
     const share::schema::ObTableSchema &table_schema,
     const share::ObPartitionLocation &partition_loc,
     share::ObFBPartitionParam &param);
+  int get_batched_stmt_runs(sql::ObSQLSessionInfo &session,
+                            const common::ObIArray<ObString> &queries,
+                            const ObMPParseStat &parse_stat,
+                            common::ObIArray<int64_t> &run_ends);
   int try_batched_multi_stmt_optimization(sql::ObSQLSessionInfo &session,
                                           common::ObIArray<ObString> &queries,
                                           const ObMPParseStat &parse_stat,
+                                          const ObString &batch_sql,
+                                          int64_t seq_num,
+                                          bool has_more,
                                           bool &optimization_done,
                                           bool &async_resp_used,
                                           bool &need_disconnect,
@@ -115,18 +115,21 @@ int ObAllPlanCacheStat::fill_cells(ObPlanCache &plan_cache)
       break;
     }
     case ACCESS_COUNT: {
-      cells[i].set_int(pc_stat.access_count_);
+      cells[i].set_int(pc_stat.get_access_count());
       break;
     }
     case HIT_COUNT: {
-      cells[i].set_int(pc_stat.hit_count_);
+      cells[i].set_int(pc_stat.get_hit_count());
       break;
     }
     //hit_rate
     case HIT_RATE: {
-      if (pc_stat.access_count_ !=0) {
-        cells[i].set_int(pc_stat.hit_count_*100/pc_stat.access_count_);
-        SERVER_LOG(DEBUG, "rate:", "hit_count", pc_stat.hit_count_, "access_count", pc_stat.access_count_);
+      // hit count is summed after access count, it may be a little larger than the latter
+      const int64_t access_count = pc_stat.get_access_count();
+      const int64_t hit_count = std::min(pc_stat.get_hit_count(), access_count);
+      if (access_count != 0) {
+        cells[i].set_int(hit_count * 100 / access_count);
+        SERVER_LOG(DEBUG, "rate:", K(hit_count), K(access_count));
       } else {
         cells[i].set_int(0);
       }
@@ -13,6 +13,7 @@
 #include "storage/meta_mem/ob_tenant_meta_mem_mgr.h"
 #include "storage/compaction/ob_medium_compaction_mgr.h"
 #include "storage/compaction/ob_medium_compaction_func.h"
+#include "storage/ob_tenant_tablet_stat_mgr.h"
 
 using namespace oceanbase;
 using namespace common;
@@ -162,6 +163,7 @@ int ObAllVirtualTabletCompactionInfo::process_curr_tenant(common::ObNewRow *&row
   } else {
     const int64_t col_count = output_column_ids_.count();
     int64_t max_sync_medium_scn = 0;
+    ObTabletStat tablet_stat;
     for (int64_t i = 0; OB_SUCC(ret) && i < col_count; ++i) {
       uint64_t col_id = output_column_ids_.at(i);
       switch (col_id) {
@@ -213,6 +215,20 @@ int ObAllVirtualTabletCompactionInfo::process_curr_tenant(common::ObNewRow *&row
           }
           cur_row_.cells_[i].set_collation_type(ObCharset::get_default_collation(ObCharset::get_default_charset()));
           break;
+        case WRITE_AMPLIFICATION:
+          // accumulated over all the buckets kept by the tablet stat mgr (400 minutes), the latest
+          // 16 minutes window rarely holds both the mini compactions and the minor compaction of them
+          if (OB_SUCCESS == MTL(ObTenantTabletStatMgr *)->get_accumulated_tablet_stat(
+              tablet->get_tablet_meta().ls_id_, tablet->get_tablet_meta().tablet_id_, tablet_stat)) {
+            cur_row_.cells_[i].set_double(tablet_stat.get_write_amplification());
+          } else {
+            cur_row_.cells_[i].set_double(0);
+          }
+          break;
+        case READ_AMPLIFICATION:
+          // sstables to be merged by one read: all minor sstables and the latest major sstable
+          cur_row_.cells_[i].set_int(tablet->get_minor_table_count() + MIN(tablet->get_major_table_count(), 1));
+          break;
         default:
           ret = OB_ERR_UNEXPECTED;
           SERVER_LOG(WARN, "invalid col_id", K(ret), K(col_id));
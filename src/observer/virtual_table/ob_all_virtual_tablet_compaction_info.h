@@ -42,6 +42,8 @@ class ObAllVirtualTabletCompactionInfo : public common::ObVirtualTableScannerIte
     WAIT_CHECK_SCN,
     MAX_RECEIVED_SCN,
     SERIALIZE_SCN_LIST,
+    WRITE_AMPLIFICATION,
+    READ_AMPLIFICATION,
   };
 public:
   ObAllVirtualTabletCompactionInfo();
@@ -61,6 +61,16 @@ SQL_MONITOR_STATNAME_DEF(SSTABLE_INSERT_CG_ROW_COUNT, sql_monitor_statname::INT,
 SQL_MONITOR_STATNAME_DEF(IO_READ_BYTES, sql_monitor_statname::CAPACITY, "total io bytes read from disk", "total io bytes read from storage")
 SQL_MONITOR_STATNAME_DEF(TOTAL_READ_BYTES, sql_monitor_statname::CAPACITY, "total bytes processed by storage", "total bytes processed by storage, including memtable")
 SQL_MONITOR_STATNAME_DEF(TOTAL_READ_ROW_COUNT, sql_monitor_statname::INT, "total rows processed by storage", "total rows processed by storage, including memtable")
+// adaptive group by
+SQL_MONITOR_STATNAME_DEF(GROUPBY_LOCAL_REDUCTION_RATIO, sql_monitor_statname::INT, "local reduction ratio", "percent of rows reduced by partial aggregation in first round of this worker")
+SQL_MONITOR_STATNAME_DEF(GROUPBY_GLOBAL_REDUCTION_RATIO, sql_monitor_statname::INT, "global reduction ratio", "percent of rows reduced by partial aggregation of all workers in dfo")
+SQL_MONITOR_STATNAME_DEF(GROUPBY_BYPASS_ROW_COUNT, sql_monitor_statname::INT, "bypass row count", "rows sent without partial aggregation")
+// DTL columnar encoding
+SQL_MONITOR_STATNAME_DEF(DTL_ENCODE_SAVED_BYTES, sql_monitor_statname::CAPACITY, "dtl encode saved bytes", "bytes saved by columnar encoding of sent dtl buffers")
+// GI granule split
+SQL_MONITOR_STATNAME_DEF(GRANULE_BUSY_TIME, sql_monitor_statname::INT, "granule busy time", "time spent on scanning granules by this worker")
+SQL_MONITOR_STATNAME_DEF(GRANULE_IDLE_TIME, sql_monitor_statname::INT, "granule idle time", "time spent on fetching and splitting granules by this worker")
+SQL_MONITOR_STATNAME_DEF(SPLIT_GRANULE_COUNT, sql_monitor_statname::INT, "split granule count", "granules split by this worker in the tail of scan")
 
 //end
 SQL_MONITOR_STATNAME_DEF(MONITOR_STATNAME_END, sql_monitor_statname::INVALID, "monitor end", "monitor stat name end")
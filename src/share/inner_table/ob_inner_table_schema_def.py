@@ -12430,7 +12430,9 @@ def_table_schema(
       ('finished_scn', 'int'),
       ('wait_check_scn', 'int'),
       ('max_received_scn', 'int'),
-      ('serialize_scn_list', 'varchar:OB_MAX_VARCHAR_LENGTH')
+      ('serialize_scn_list', 'varchar:OB_MAX_VARCHAR_LENGTH'),
+      ('write_amplification', 'double'),
+      ('read_amplification', 'int')
     ],
     partition_columns = ['svr_ip', 'svr_port'],
     vtable_route_policy = 'distributed',
@@ -440,6 +440,21 @@ DEF_BOOL(_px_message_compression, OB_TENANT_PARAMETER, "True",
         "Enable DTL send message with compression"
         "Value: True: enable compression False: disable compression",
         ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_px_message_columnar_encoding, OB_TENANT_PARAMETER, "False",
+        "Enable columnar encoding of vectorized DTL data messages sent by rpc, "
+        "all observers should be able to decode it before enabling. "
+        "Value: True: enable columnar encoding False: disable columnar encoding",
+        ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_px_pipelined_dfo_scheduling, OB_TENANT_PARAMETER, "False",
+        "Enable starting the next leaf DFO of the schedule order ahead of time "
+        "when the admitted PX workers are not used up by the running DFOs. "
+        "Value: True: enable pipelined scheduling False: disable pipelined scheduling",
+        ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_px_share_groupby_reduction_ratio, OB_TENANT_PARAMETER, "False",
+        "Enable sharing the reduction ratio of adaptive pushdown hash group by among the PX workers "
+        "of a DFO through datahub, all observers should be able to handle the message before enabling. "
+        "Value: True: enable sharing False: disable sharing",
+        ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 DEF_INT(_px_chunklist_count_ratio, OB_CLUSTER_PARAMETER, "1", "[1, 128]",
         "the ratio of the dtl buffer manager list. Range: [1, 128]",
         ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
@@ -974,6 +989,11 @@ DEF_INT(_fast_commit_callback_count, OB_CLUSTER_PARAMETER, "10000", "[0,)"
 DEF_INT(_minor_compaction_amplification_factor, OB_TENANT_PARAMETER, "0", "[0,100]",
         "thre L1 compaction write amplification factor, 0 means default 25, Range: [0,100] in integer",
         ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_INT(_minor_compaction_size_ratio, OB_TENANT_PARAMETER, "0", "[0,1000]",
+        "the size ratio in percentage of size-tiered minor compaction, an older sstable joins the minor compaction "
+        "only if its size is not larger than (100 + ratio)% of the total size of newer ones. "
+        "0 means the size-tiered policy is disabled, Range: [0,1000] in integer",
+        ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 DEF_INT(major_compact_trigger, OB_TENANT_PARAMETER, "0", "[0,65535]",
         "specifies how many minor freeze should be triggered between two major freeze, Range: [0,65535] in integer",
         ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
@@ -1342,6 +1362,10 @@ DEF_INT(open_cursors, OB_TENANT_PARAMETER, "50", "[0,65535]",
 DEF_BOOL(_enable_px_batch_rescan, OB_TENANT_PARAMETER, "True",
          "enable px batch rescan for nlj or subplan filter",
          ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_enable_px_granule_split, OB_TENANT_PARAMETER, "False",
+         "enable splitting the granules left in the tail of parallel scan at macro block boundary, "
+         "so that idle px workers can take over the work of stragglers",
+         ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 DEF_BOOL(_enable_spf_batch_rescan, OB_TENANT_PARAMETER, "False",
          "enable das batch rescan for subplan filter",
          ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
@@ -451,6 +451,9 @@ private:
   int check_not_support_cmp_type(
     const ObSortCollations &collations,
     const ObIArray<ObExpr*> &sort_exprs);
+  int fill_sort_compress_type(ObLogSort &op,
+                              int64_t &compact_level,
+                              ObCompressorType &compress_type);
   int recursive_get_column_expr(const ObColumnRefRawExpr *&column, const TableItem &table_item);
   int fill_aggr_infos(ObLogGroupBy &op,
                       ObGroupBySpec &spec,
@@ -467,6 +467,14 @@ int ObTscCgService::generate_tsc_filter(const ObLogTableScan &op, ObTableScanSpe
       LOG_WARN("generate filter expr failed", K(ret));
     }
   }
+  if (OB_SUCC(ret) && share::schema::EXTERNAL_TABLE == op.get_table_type()
+      && scan_pushdown_filters.empty() && !nonpushdown_filters.empty()) {
+    // filters of external table are still evaluated by the scan operator, they are passed to
+    // the access service to skip data by file statistics only, e.g. row groups of parquet.
+    if (OB_FAIL(cg_.generate_rt_exprs(nonpushdown_filters, scan_ctdef.pd_expr_spec_.pushdown_filters_))) {
+      LOG_WARN("generate external table prune filters failed", K(ret));
+    }
+  }
   return ret;
 }
 
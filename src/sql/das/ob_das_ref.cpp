@@ -346,19 +346,34 @@ bool ObDASRef::check_rcode_can_retry(int ret)
 int ObDASRef::wait_executing_tasks()
 {
   int ret = OB_SUCCESS;
-  {
-    ObThreadCondGuard guard(cond_);
-    while (OB_SUCC(ret) && get_current_concurrency() < max_das_task_concurrency_) {
-      // we cannot use ObCond here because it can not explicitly lock mutex, causing concurrency problem.
-      if (OB_FAIL(cond_.wait())) {
-        LOG_WARN("failed to wait all das tasks to be finished.", K(ret));
+  int save_ret = OB_SUCCESS;
+  bool all_finished = false;
+  // process remote responses as soon as they arrive instead of after the slowest server,
+  // so that decoding the results of one server overlaps with waiting for the others.
+  while (OB_SUCC(ret) && !all_finished) {
+    {
+      ObThreadCondGuard guard(cond_);
+      while (OB_SUCC(ret)
+             && get_current_concurrency() < max_das_task_concurrency_
+             && !has_unprocessed_remote_resp()) {
+        // we cannot use ObCond here because it can not explicitly lock mutex, causing concurrency problem.
+        if (OB_FAIL(cond_.wait())) {
+          LOG_WARN("failed to wait all das tasks to be finished.", K(ret));
+        }
+      }
+      all_finished = get_current_concurrency() >= max_das_task_concurrency_;
+    }
+    if (OB_SUCC(ret)) {
+      int tmp_ret = OB_SUCCESS;
+      if (OB_TMP_FAIL(process_remote_task_resp())) {
+        LOG_WARN("failed to process remote task resp", K(tmp_ret));
+        save_ret = COVER_SUCC(tmp_ret);
       }
     }
   }
   if (OB_SUCC(ret)) {
-    if (OB_FAIL(process_remote_task_resp())) {
-      LOG_WARN("failed to process remote task resp", K(ret));
-    }
+    async_cb_list_.clear();  // no need to hold async cb anymore. destructor would be called in das factory.
+    ret = save_ret;
   }
   return ret;
 }
@@ -399,11 +414,27 @@ void ObDASRef::remove_async_das_cb(ObRpcDasAsyncAccessCallBack *das_async_cb)
   }
 }
 
+bool ObDASRef::has_unprocessed_remote_resp()
+{
+  bool bret = false;
+  DLIST_FOREACH_X(curr, async_cb_list_.get_obj_list(), !bret) {
+    ObDasAsyncRpcCallBackContext *context = curr->get_obj()->get_async_cb_context();
+    bret = context->is_finished() && !context->is_processed();
+  }
+  return bret;
+}
+
+// process the responses received so far, each response is processed only once.
 int ObDASRef::process_remote_task_resp()
 {
   int ret = OB_SUCCESS;
   int save_ret = OB_SUCCESS;
   DLIST_FOREACH_X(curr, async_cb_list_.get_obj_list(), OB_SUCC(ret)) {
+    ObDasAsyncRpcCallBackContext *context = curr->get_obj()->get_async_cb_context();
+    if (!context->is_finished() || context->is_processed()) {
+      continue;
+    }
+    context->set_processed();
     const sql::ObDASTaskResp &task_resp = curr->get_obj()->get_task_resp();
     const common::ObSEArray<ObIDASTaskOp*, 2> &task_ops = curr->get_obj()->get_task_ops();
     if (OB_UNLIKELY(OB_SUCCESS != task_resp.get_err_code())) {
@@ -422,7 +453,6 @@ int ObDASRef::process_remote_task_resp()
       OB_ASSERT(OB_SUCCESS == task_resp.get_err_code());
     }
   }
-  async_cb_list_.clear();  // no need to hold async cb anymore. destructor would be called in das factory.
   ret = COVER_SUCC(save_ret);
   return ret;
 }
@@ -617,9 +647,10 @@ void ObDASRef::inc_concurrency_limit()
 void ObDASRef::inc_concurrency_limit_with_signal()
 {
   ObThreadCondGuard guard(cond_);
-  if (__sync_add_and_fetch(&das_task_concurrency_limit_, 1) == max_das_task_concurrency_) {
-    cond_.signal();
-  }
+  ATOMIC_INC(&das_task_concurrency_limit_);
+  // wake up the sql thread on every response, it is waiting for either a free execution
+  // resource or a response to process.
+  cond_.signal();
 }
 
 int ObDASRef::dec_concurrency_limit()
@@ -651,13 +682,20 @@ int ObDASRef::acquire_task_execution_resource()
     LOG_WARN("failed to acquire das execution resource", K(ret), K(get_current_concurrency()));
   }
   if (OB_UNLIKELY(OB_SIZE_OVERFLOW == ret)) {
-    ret = OB_SUCCESS;
+    // every finished remote task signals, so retry under the lock until a resource is released,
+    // the release may also happen between the failed attempt above and taking the lock.
     ObThreadCondGuard guard(cond_);
-    if (OB_FAIL(cond_.wait(get_exec_ctx().get_my_session()->get_query_timeout_ts() -
-        ObTimeUtility::current_time()))) {
-      LOG_WARN("failed to acquire das task execution resource", K(ret), K(get_current_concurrency()));
-    } else if (OB_FAIL(dec_concurrency_limit())) {
-      LOG_WARN("failed to acquire das execution resource", K(ret), K(get_current_concurrency()));
+    while (OB_SIZE_OVERFLOW == ret) {
+      if (OB_FAIL(dec_concurrency_limit())) {
+        if (OB_SIZE_OVERFLOW != ret) {
+          LOG_WARN("failed to acquire das execution resource", K(ret), K(get_current_concurrency()));
+        } else if (OB_FAIL(cond_.wait(get_exec_ctx().get_my_session()->get_query_timeout_ts() -
+            ObTimeUtility::current_time()))) {
+          LOG_WARN("failed to acquire das task execution resource", K(ret), K(get_current_concurrency()));
+        } else {
+          ret = OB_SIZE_OVERFLOW;
+        }
+      }
     }
   }
   return ret;
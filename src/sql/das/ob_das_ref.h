@@ -158,6 +158,7 @@ private:
   int move_local_tasks_to_last();
   int wait_executing_tasks();
   int process_remote_task_resp();
+  bool has_unprocessed_remote_resp();
   bool check_rcode_can_retry(int ret);
 private:
   typedef common::ObObjNode<ObIDASTaskOp*> DasOpNode;
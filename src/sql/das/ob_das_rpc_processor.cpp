@@ -233,6 +233,7 @@ void ObRpcDasAsyncAccessCallBack::on_timeout()
   LOG_WARN("das async task timeout", KR(ret), K(get_task_ops()));
   result_.set_err_code(ret);
   result_.get_op_results().reuse();
+  context_->set_finished();
   context_->get_das_ref().inc_concurrency_limit_with_signal();
 }
 
@@ -243,6 +244,7 @@ void ObRpcDasAsyncAccessCallBack::on_invalid()
   LOG_WARN("das async task invalid", K(get_task_ops()));
   result_.set_err_code(OB_INVALID_ERROR);
   result_.get_op_results().reuse();
+  context_->set_finished();
   context_->get_das_ref().inc_concurrency_limit_with_signal();
 }
 
@@ -261,6 +263,7 @@ int ObRpcDasAsyncAccessCallBack::process()
     result_.get_op_results().reuse();
     LOG_WARN("das async rpc execution failed", K(get_rcode()), K_(result));
   }
+  context_->set_finished();
   context_->get_das_ref().inc_concurrency_limit_with_signal();
   return ret;
 }
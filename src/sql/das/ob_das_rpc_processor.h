@@ -88,18 +88,27 @@ public:
   ObDasAsyncRpcCallBackContext(ObDASRef &das_ref,
                                const common::ObSEArray<ObIDASTaskOp*, 2> &task_ops,
                                int64_t timeout_ts)
-      : das_ref_(das_ref), task_ops_(task_ops), alloc_(), timeout_ts_(timeout_ts) {}
+      : das_ref_(das_ref), task_ops_(task_ops), alloc_(), timeout_ts_(timeout_ts),
+        is_finished_(false), is_processed_(false) {}
   ~ObDasAsyncRpcCallBackContext() = default;
   int init(const ObMemAttr &attr);
   ObDASRef &get_das_ref() { return das_ref_; };
   const common::ObSEArray<ObIDASTaskOp*, 2> &get_task_ops() const { return task_ops_; };
   common::ObArenaAllocator &get_alloc() { return alloc_; };
   int64_t get_timeout_ts() const { return timeout_ts_; }
+  // set by the rpc thread once the response is received, before the das ref is signaled
+  void set_finished() { ATOMIC_STORE(&is_finished_, true); }
+  bool is_finished() const { return ATOMIC_LOAD(&is_finished_); }
+  // response is processed by the sql thread, no need to be atomic
+  void set_processed() { is_processed_ = true; }
+  bool is_processed() const { return is_processed_; }
 private:
   ObDASRef &das_ref_;
   const common::ObSEArray<ObIDASTaskOp*, 2> task_ops_;
   common::ObArenaAllocator alloc_;  // used for async rpc result allocation.
   int64_t timeout_ts_;
+  bool is_finished_;
+  bool is_processed_;
 };
 
 class ObRpcDasAsyncAccessCallBack
@@ -614,7 +614,7 @@ int ObDtlBasicChannel::process1(
               // only increase the statist
               free_buffer_count();
             } else {
-              free_buf(buffer);
+              recycle_buf(buffer);
             }
             buffer = nullptr;
             // 测试发现每次一个channel读数据，性能更好，将之前由读一个buffer改为读一个channel所有buffer
@@ -107,6 +107,8 @@ static DtlWriterType msg_writer_map[] =
   VECTOR_WRITER,  //PX_VECTOR,
   VECTOR_FIXED_WRITER, //PX_FIXED_VECTOR
   VECTOR_ROW_WRITER,  //PX_VECTOR_ROW,
+  CONTROL_WRITER, // DH_GROUPBY_RATIO_PIECE_MSG,
+  CONTROL_WRITER, // DH_GROUPBY_RATIO_WHOLE_MSG,
 
 };
 
@@ -701,7 +703,7 @@ public:
   int switch_writer(const ObDtlMsg &msg);
 
   int mock_eof_buffer(int64_t timeout_ts);
-  ObDtlLinkedBuffer *alloc_buf(const int64_t payload_size);
+  virtual ObDtlLinkedBuffer *alloc_buf(const int64_t payload_size);
   
   void set_bc_service(ObDtlBcastService *bc_service) { bc_service_ = bc_service; }
 
@@ -723,6 +725,8 @@ protected:
   int inner_write_msg(const ObDtlMsg &msg, int64_t timeout_ts, ObEvalCtx *eval_ctx, bool is_eof);
 
   void free_buf(ObDtlLinkedBuffer *buf);
+  // release the buffer consumed by receiver
+  virtual void recycle_buf(ObDtlLinkedBuffer *buf) { free_buf(buf); }
 
   int send_buffer(ObDtlLinkedBuffer *&buffer);
 
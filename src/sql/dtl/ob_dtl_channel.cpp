@@ -46,6 +46,7 @@ ObDtlChannel::ObDtlChannel(uint64_t id, const common::ObAddr &peer, DtlChannelTy
       register_dm_info_(),
       loop_idx_(OB_INVALID_INDEX_INT64),
       compressor_type_(common::ObCompressorType::NONE_COMPRESSOR),
+      vectors_encode_(false),
       owner_mod_(DTLChannelOwner::INVALID_OWNER),
       thread_id_(0),
       enable_channel_sync_(false),
@@ -235,6 +235,7 @@ public:
   OB_INLINE ObDtlChannelWatcher *get_msg_watcher() { return msg_watcher_; }
 
   void set_compression_type(const common::ObCompressorType &type) { compressor_type_ = type; }
+  void set_vectors_encode(bool vectors_encode) { vectors_encode_ = vectors_encode; }
 
   void set_batch_id(int64_t batch_id) { batch_id_ = batch_id; }
   int64_t get_batch_id() { return batch_id_; }
@@ -288,6 +289,8 @@ protected:
   int64_t loop_idx_;
 
   common::ObCompressorType compressor_type_;
+  // columnar encode PX_VECTOR/PX_VECTOR_FIXED payload before sending by rpc
+  bool vectors_encode_;
 
   DTLChannelOwner owner_mod_;
   int64_t thread_id_;
@@ -156,6 +156,20 @@ ObDtlLinkedBuffer *ObDtlChannelMemManager::alloc(int64_t chid, int64_t size)
   return allocated_buf;
 }
 
+// Rebuild a recycled buffer in place, the memory is still accounted as allocated.
+ObDtlLinkedBuffer *ObDtlChannelMemManager::reuse(ObDtlLinkedBuffer *buf, int64_t size)
+{
+  ObDtlLinkedBuffer *reused_buf = nullptr;
+  if (nullptr != buf && size <= size_per_buffer_) {
+    const int64_t chid = buf->allocated_chid();
+    buf->~ObDtlLinkedBuffer();
+    reused_buf = new (buf) ObDtlLinkedBuffer(
+      reinterpret_cast<char *>(buf) + sizeof (ObDtlLinkedBuffer), size_per_buffer_);
+    reused_buf->allocated_chid() = chid;
+  }
+  return reused_buf;
+}
+
 int ObDtlChannelMemManager::free(ObDtlLinkedBuffer *buf, bool auto_free)
 {
   int ret = OB_SUCCESS;
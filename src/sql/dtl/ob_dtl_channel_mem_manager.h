@@ -42,6 +42,11 @@ public:
 public:
   ObDtlLinkedBuffer *alloc(int64_t chid, int64_t size);
   int free(ObDtlLinkedBuffer *buf, bool auto_free = true);
+  // Buffers of the fixed size can be handed back to the allocating channel directly
+  // (see ObDtlLocalChannel) instead of going through free_queue_.
+  OB_INLINE bool is_recyclable(const ObDtlLinkedBuffer &buf) const
+  { return buf.size() <= size_per_buffer_; }
+  ObDtlLinkedBuffer *reuse(ObDtlLinkedBuffer *buf, int64_t size);
 
   void set_seqno(int64_t seqno) { seqno_ = seqno; }
   int64_t get_seqno() { return seqno_; }
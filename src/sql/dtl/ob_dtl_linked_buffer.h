@@ -23,6 +23,8 @@ namespace sql {
 namespace dtl {
 
 #define DTL_BROADCAST (1ULL)
+// payload is serialized vectors encoded by ObDtlVectorsCodec
+#define DTL_VECTORS_ENCODED (1ULL << 1)
 
 struct ObDtlMsgHeader;
 class ObDtlChannel;
@@ -270,6 +272,10 @@ public:
     remove_flag(DTL_BROADCAST);
   }
 
+  bool is_vectors_encoded() const {
+    return has_flag(DTL_VECTORS_ENCODED);
+  }
+
   uint64_t enable_channel_sync() const { return enable_channel_sync_; }
   void set_enable_channel_sync(const bool enable_channel_sync) { enable_channel_sync_ = enable_channel_sync; }
 
@@ -279,6 +285,10 @@ public:
   //不包含allocated_chid_ copy，谁申请谁释放
   static void assign(const ObDtlLinkedBuffer &src, ObDtlLinkedBuffer *dst) {
     MEMCPY(dst->buf_, src.buf_, src.size_);
+    assign_header(src, dst);
+  }
+
+  static void assign_header(const ObDtlLinkedBuffer &src, ObDtlLinkedBuffer *dst) {
     dst->size_ = src.size_;
     dst->is_data_msg_ = src.is_data_msg_;
     dst->seq_no_ = src.seq_no_;
@@ -349,7 +359,7 @@ public:
     flags_ &= ~attri;
   }
   void set_use_interm_result(bool flag) { use_interm_result_ = flag; }
-  bool use_interm_result() { return use_interm_result_; }
+  bool use_interm_result() const { return use_interm_result_; }
 
   bool is_batch_info_valid() { return batch_info_valid_; }
   int add_batch_info(int64_t batch_id, int64_t rows);
@@ -30,7 +30,7 @@ ObDtlLocalChannel::ObDtlLocalChannel(
     const uint64_t id,
     const ObAddr &peer,
     DtlChannelType type)
-    : ObDtlBasicChannel(tenant_id, id, peer, type)
+    : ObDtlBasicChannel(tenant_id, id, peer, type), recycle_ring_(), recycled_buf_(nullptr)
 {}
 
 ObDtlLocalChannel::ObDtlLocalChannel(
@@ -39,7 +39,8 @@ ObDtlLocalChannel::ObDtlLocalChannel(
     const ObAddr &peer,
     const int64_t hash_val,
     DtlChannelType type)
-    : ObDtlBasicChannel(tenant_id, id, peer, hash_val, type)
+    : ObDtlBasicChannel(tenant_id, id, peer, hash_val, type), recycle_ring_(),
+      recycled_buf_(nullptr)
 {}
 
 ObDtlLocalChannel::~ObDtlLocalChannel()
@@ -60,6 +61,53 @@ int ObDtlLocalChannel::init()
 
 void ObDtlLocalChannel::destroy()
 {
+  // the peer can't take buffers back any more, since the channel is unregistered
+  ObDtlLinkedBuffer *buf = nullptr;
+  while (nullptr != (buf = pop_recycled_buf())) {
+    release_recycled_buf(buf);
+  }
+  if (nullptr != recycled_buf_) {
+    release_recycled_buf(recycled_buf_);
+    recycled_buf_ = nullptr;
+  }
+}
+
+ObDtlLinkedBuffer *ObDtlLocalChannel::alloc_buf(const int64_t payload_size)
+{
+  ObDtlLinkedBuffer *buf = nullptr;
+  if (nullptr != recycled_buf_) {
+    ObDtlTenantMemManager *tenant_mem_mgr = DTL.get_dfc_server().get_tenant_mem_manager(tenant_id_);
+    if (nullptr != tenant_mem_mgr
+        && nullptr != (buf = tenant_mem_mgr->reuse(recycled_buf_, payload_size))) {
+      recycled_buf_ = nullptr;
+      alloc_buffer_count();
+    }
+  }
+  if (nullptr == buf) {
+    buf = ObDtlBasicChannel::alloc_buf(payload_size);
+  }
+  return buf;
+}
+
+void ObDtlLocalChannel::recycle_buf(ObDtlLinkedBuffer *buf)
+{
+  ObDtlTenantMemManager *tenant_mem_mgr = DTL.get_dfc_server().get_tenant_mem_manager(tenant_id_);
+  if (nullptr != buf
+      && !buf->is_bcast()
+      && nullptr != tenant_mem_mgr
+      && tenant_mem_mgr->is_recyclable(*buf)
+      && recycle_ring_.push(buf)) {
+    free_buffer_count();
+  } else {
+    free_buf(buf);
+  }
+}
+
+// the buffer in ring has been counted as freed by the receiver
+void ObDtlLocalChannel::release_recycled_buf(ObDtlLinkedBuffer *buf)
+{
+  alloc_buffer_count();
+  free_buf(buf);
 }
 
 // 共享内存方式
@@ -114,6 +162,9 @@ int ObDtlLocalChannel::send_shared_message(ObDtlLinkedBuffer *&buf)
       }
     } else {
       ObDtlLocalChannel *local_chan = reinterpret_cast<ObDtlLocalChannel*>(chan);
+      if (nullptr == recycled_buf_ && !is_eof) {
+        recycled_buf_ = local_chan->pop_recycled_buf();
+      }
       if (OB_FAIL(local_chan->feedup(buf))) {
         LOG_WARN("feed up DTL channel fail", KP(peer_id_), "peer", get_peer(), K(ret));
       } else if (OB_ISNULL(local_chan->get_dfc())) {
@@ -46,8 +46,55 @@ public:
   
   virtual int feedup(ObDtlLinkedBuffer *&buffer) override;
   virtual int send_message(ObDtlLinkedBuffer *&buf);
+  virtual ObDtlLinkedBuffer *alloc_buf(const int64_t payload_size) override;
+protected:
+  virtual void recycle_buf(ObDtlLinkedBuffer *buf) override;
 private:
   int send_shared_message(ObDtlLinkedBuffer *&buf);
+  ObDtlLinkedBuffer *pop_recycled_buf() { return recycle_ring_.pop(); }
+  void release_recycled_buf(ObDtlLinkedBuffer *buf);
+
+private:
+  // Buffers are handed over to the peer channel by pointer in the same process, the receiver
+  // returns the consumed ones through this ring, and the sender of the channel pair takes them
+  // back while it pins the receive channel, so that the buffers are reused without going
+  // through the free queue of ObDtlChannelMemManager, which is shared by many channels.
+  // Single producer: the receive worker, single consumer: the send worker of the peer.
+  // Keep it small, at most CAPACITY + 1 idle buffers are held by a channel pair.
+  class RecycleRing
+  {
+  public:
+    static const uint64_t CAPACITY = 2;
+    RecycleRing() : head_(0), tail_(0) { MEMSET(slots_, 0, sizeof(slots_)); }
+    bool push(ObDtlLinkedBuffer *buf)
+    {
+      bool pushed = false;
+      const uint64_t tail = tail_;
+      if (tail - ATOMIC_LOAD_ACQ(&head_) < CAPACITY) {
+        slots_[tail & (CAPACITY - 1)] = buf;
+        ATOMIC_STORE_REL(&tail_, tail + 1);
+        pushed = true;
+      }
+      return pushed;
+    }
+    ObDtlLinkedBuffer *pop()
+    {
+      ObDtlLinkedBuffer *buf = nullptr;
+      const uint64_t head = head_;
+      if (head != ATOMIC_LOAD_ACQ(&tail_)) {
+        buf = slots_[head & (CAPACITY - 1)];
+        ATOMIC_STORE_REL(&head_, head + 1);
+      }
+      return buf;
+    }
+  private:
+    uint64_t head_ CACHE_ALIGNED;
+    uint64_t tail_ CACHE_ALIGNED;
+    ObDtlLinkedBuffer *slots_[CAPACITY];
+  };
+  RecycleRing recycle_ring_;
+  // buffer taken back from the peer, reused by the next alloc_buf
+  ObDtlLinkedBuffer *recycled_buf_;
 };
 
 }  // dtl
@@ -53,6 +53,8 @@ enum ObDtlMsgType {
   PX_VECTOR,
   PX_VECTOR_FIXED,
   PX_VECTOR_ROW,
+  DH_GROUPBY_RATIO_PIECE_MSG,
+  DH_GROUPBY_RATIO_WHOLE_MSG,  //45
   MAX
 };
 
@@ -177,7 +177,9 @@ ObDtlRpcChannel::ObDtlRpcChannel(
     const uint64_t id,
     const ObAddr &peer,
     DtlChannelType type)
-    : ObDtlBasicChannel(tenant_id, id, peer, type), recv_sqc_fin_res_(false)
+    : ObDtlBasicChannel(tenant_id, id, peer, type), recv_sqc_fin_res_(false),
+      encode_raw_bytes_(0), encode_bytes_(0), encode_buffer_cnt_(0), encode_buf_(nullptr),
+      encode_buf_cap_(0)
 {}
 
 ObDtlRpcChannel::ObDtlRpcChannel(
@@ -186,7 +188,9 @@ ObDtlRpcChannel::ObDtlRpcChannel(
     const ObAddr &peer,
     const int64_t hash_val,
     DtlChannelType type)
-    : ObDtlBasicChannel(tenant_id, id, peer, hash_val, type), recv_sqc_fin_res_(false)
+    : ObDtlBasicChannel(tenant_id, id, peer, hash_val, type), recv_sqc_fin_res_(false),
+      encode_raw_bytes_(0), encode_bytes_(0), encode_buffer_cnt_(0), encode_buf_(nullptr),
+      encode_buf_cap_(0)
 {}
 
 ObDtlRpcChannel::~ObDtlRpcChannel()
@@ -207,6 +211,7 @@ int ObDtlRpcChannel::init()
 void ObDtlRpcChannel::destroy()
 {
   recv_sqc_fin_res_ = false;
+  free_encode_buf();
 }
 
 int ObDtlRpcChannel::feedup(ObDtlLinkedBuffer *&buffer)
@@ -229,11 +234,18 @@ int ObDtlRpcChannel::feedup(ObDtlLinkedBuffer *&buffer)
       }
     } else if (is_drain()) {
       // do nothing
+    } else if (buffer->is_vectors_encoded()) {
+      if (OB_FAIL(decode_vectors(*buffer, linked_buffer))) {
+        LOG_WARN("failed to decode vectors", K(ret));
+      }
     } else if (OB_ISNULL(linked_buffer = alloc_buf(buffer->size()))){
       ret = OB_ALLOCATE_MEMORY_FAILED;
       LOG_WARN("failed to allocate buffer", K(ret));
     } else {
       ObDtlLinkedBuffer::assign(*buffer, linked_buffer);
+    }
+    if (OB_FAIL(ret) || nullptr == linked_buffer) {
+    } else {
       if (1 == linked_buffer->seq_no() && linked_buffer->is_data_msg()
           && 0 != get_recv_buffer_cnt()) {
         ret = OB_ERR_UNEXPECTED;
@@ -315,15 +327,20 @@ int ObDtlRpcChannel::send_message(ObDtlLinkedBuffer *&buf)
     // we wait first message return and retry until peer setup.
     int64_t timeout_us = buf->timeout_ts() - ObTimeUtility::current_time();
     SendMsgCB cb(msg_response_, *cur_trace_id, buf->timeout_ts());
+    ObDtlLinkedBuffer encoded_msg;
+    bool encoded = false;
     if (timeout_us <= 0) {
       ret = OB_TIMEOUT;
       LOG_WARN("send dtl message timeout", K(ret), K(peer_),
           K(buf->timeout_ts()));
+    } else if (OB_FAIL(encode_vectors(*buf, encoded_msg, encoded))) {
+      LOG_WARN("failed to encode vectors", K(ret));
     } else if (OB_FAIL(msg_response_.start())) {
       LOG_WARN("start message process fail", K(ret));
     } else if (OB_FAIL(DTL.get_rpc_proxy().to(peer_).timeout(timeout_us)
-        .compressed(compressor_type_)
-        .ap_send_message(ObDtlSendArgs{peer_id_, *buf}, &cb))) {
+        // strings are already compressed by the columnar encoding
+        .compressed(encoded ? ObCompressorType::NONE_COMPRESSOR : compressor_type_)
+        .ap_send_message(ObDtlSendArgs{peer_id_, encoded ? encoded_msg : *buf}, &cb))) {
       LOG_WARN("send message failed", K_(peer), K(ret));
       int tmp_ret = msg_response_.on_start_fail();
       if (OB_SUCCESS != tmp_ret) {
@@ -350,6 +367,131 @@ int ObDtlRpcChannel::send_message(ObDtlLinkedBuffer *&buf)
   return ret;
 }
 
+int ObDtlRpcChannel::encode_vectors(const ObDtlLinkedBuffer &buf, ObDtlLinkedBuffer &send_buf,
+                                    bool &encoded)
+{
+  int ret = OB_SUCCESS;
+  int64_t raw_size = 0;
+  // encoded payload larger than this is not worth sending, give up early
+  int64_t encode_cap = 0;
+  encoded = false;
+  if (!vectors_encode_ || !buf.is_data_msg() || buf.use_interm_result()
+      || (PX_VECTOR != buf.msg_type() && PX_VECTOR_FIXED != buf.msg_type())) {
+    // do nothing
+  } else if (FALSE_IT(raw_size = PX_VECTOR == buf.msg_type()
+                                 ? buf.get_serialize_vector_size()
+                                 : buf.get_serialize_fixed_vector_size())) {
+  } else if (raw_size < ObDtlVectorsCodec::MIN_ENCODE_SIZE) {
+    // do nothing
+  } else if (FALSE_IT(encode_cap = raw_size * VECTORS_ENCODE_MAX_RATIO / 100)) {
+  } else if (OB_FAIL(prepare_encode_buf(raw_size + encode_cap))) {
+    LOG_WARN("failed to prepare encode buffer", K(ret), K(raw_size));
+  } else {
+    // serialized vectors first, followed by encoded data
+    char *raw_data = encode_buf_->buf();
+    char *encoded_data = encode_buf_->buf() + raw_size;
+    int64_t encoded_size = 0;
+    if (PX_VECTOR == buf.msg_type()) {
+      ret = buf.serialize_vector(raw_data, 0, raw_size);
+    } else {
+      ret = buf.serialize_fixed_vector(raw_data, 0, raw_size);
+    }
+    if (OB_FAIL(ret)) {
+      LOG_WARN("failed to serialize vectors", K(ret), K(raw_size));
+    } else if (OB_FAIL(ObDtlVectorsCodec::encode(raw_data, raw_size, encoded_data, encode_cap,
+                                                 encoded_size))) {
+      if (OB_SIZE_OVERFLOW == ret) {
+        ret = OB_SUCCESS;
+        encoded_size = raw_size;
+      } else {
+        LOG_WARN("failed to encode vectors", K(ret), K(raw_size));
+      }
+    }
+    if (OB_SUCC(ret)) {
+      encoded = encoded_size < raw_size;
+      if (encoded) {
+        send_buf.shallow_copy(buf);
+        send_buf.set_buf(encoded_data);
+        send_buf.set_size(encoded_size);
+        send_buf.add_flag(DTL_VECTORS_ENCODED);
+        metric_.add_saved_bytes(raw_size - encoded_size);
+      }
+      encode_raw_bytes_ += raw_size;
+      encode_bytes_ += encoded_size;
+      encode_buffer_cnt_ += 1;
+      if (encode_buffer_cnt_ >= VECTORS_ENCODE_PROBE_CNT
+          && encode_bytes_ * 100 > encode_raw_bytes_ * VECTORS_ENCODE_MAX_RATIO) {
+        vectors_encode_ = false;
+        LOG_TRACE("disable vectors encode for poor ratio", KP(get_id()), K(encode_raw_bytes_),
+                  K(encode_bytes_), K(encode_buffer_cnt_));
+      }
+    }
+  }
+  if (OB_FAIL(ret)) {
+    // encoding is only an optimization, the raw buffer is always sent on failure
+    LOG_WARN("failed to encode vectors, send raw buffer", K(ret), KP(get_id()), K(raw_size));
+    if (OB_ALLOCATE_MEMORY_FAILED != ret) {
+      vectors_encode_ = false;
+    }
+    encoded = false;
+    ret = OB_SUCCESS;
+  }
+  if (!vectors_encode_) {
+    free_encode_buf();
+  }
+  return ret;
+}
+
+int ObDtlRpcChannel::prepare_encode_buf(const int64_t size)
+{
+  int ret = OB_SUCCESS;
+  if (nullptr != encode_buf_ && encode_buf_cap_ >= size) {
+    // reuse, the message is serialized into rpc packet before send_message returns
+  } else {
+    free_encode_buf();
+    if (OB_ISNULL(encode_buf_ = alloc_buf(size))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("failed to allocate encode buffer", K(ret), K(size));
+    } else {
+      encode_buf_cap_ = size;
+    }
+  }
+  return ret;
+}
+
+void ObDtlRpcChannel::free_encode_buf()
+{
+  if (nullptr != encode_buf_) {
+    free_buf(encode_buf_);
+    encode_buf_ = nullptr;
+    encode_buf_cap_ = 0;
+  }
+}
+
+int ObDtlRpcChannel::decode_vectors(const ObDtlLinkedBuffer &buf, ObDtlLinkedBuffer *&decode_buf)
+{
+  int ret = OB_SUCCESS;
+  int64_t raw_size = 0;
+  int64_t decoded_size = 0;
+  decode_buf = nullptr;
+  if (OB_FAIL(ObDtlVectorsCodec::get_decoded_size(buf.buf(), buf.size(), raw_size))) {
+    LOG_WARN("failed to get decoded size", K(ret), K(buf));
+  } else if (OB_ISNULL(decode_buf = alloc_buf(raw_size))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("failed to allocate buffer", K(ret), K(raw_size));
+  } else if (OB_FAIL(ObDtlVectorsCodec::decode(buf.buf(), buf.size(), decode_buf->buf(),
+                                               raw_size, decoded_size))) {
+    LOG_WARN("failed to decode vectors", K(ret), K(buf));
+    free_buf(decode_buf);
+    decode_buf = nullptr;
+  } else {
+    ObDtlLinkedBuffer::assign_header(buf, decode_buf);
+    decode_buf->set_size(decoded_size);
+    decode_buf->remove_flag(DTL_VECTORS_ENCODED);
+  }
+  return ret;
+}
+
 }  // dtl
 }  // sql
 }  // oceanbase
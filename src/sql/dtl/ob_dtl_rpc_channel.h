@@ -25,6 +25,7 @@
 #include "observer/ob_server_struct.h"
 #include "sql/dtl/ob_dtl_rpc_proxy.h"
 #include "sql/dtl/ob_dtl_basic_channel.h"
+#include "sql/dtl/ob_dtl_vectors_codec.h"
 
 namespace oceanbase {
 
@@ -101,7 +102,23 @@ public:
 
   bool recv_sqc_fin_res() { return recv_sqc_fin_res_; }
 private:
+  // encode vectors payload of %buf into encode_buf_, %send_buf refers to it if %encoded.
+  // %buf is sent as is if encoding fails.
+  int encode_vectors(const ObDtlLinkedBuffer &buf, ObDtlLinkedBuffer &send_buf, bool &encoded);
+  int prepare_encode_buf(const int64_t size);
+  void free_encode_buf();
+  int decode_vectors(const ObDtlLinkedBuffer &buf, ObDtlLinkedBuffer *&decode_buf);
+private:
+  // stop encoding if the first buffers are not compressed well
+  static const int64_t VECTORS_ENCODE_PROBE_CNT = 8;
+  static const int64_t VECTORS_ENCODE_MAX_RATIO = 80;
   bool recv_sqc_fin_res_;
+  int64_t encode_raw_bytes_;
+  int64_t encode_bytes_;
+  int64_t encode_buffer_cnt_;
+  // reused by all sends of the channel, allocated on the first encoded send
+  ObDtlLinkedBuffer *encode_buf_;
+  int64_t encode_buf_cap_;
 };
 
 }  // dtl
@@ -170,6 +170,28 @@ int ObDtlTenantMemManager::free(ObDtlLinkedBuffer *buf)
   return ret;
 }
 
+bool ObDtlTenantMemManager::is_recyclable(const ObDtlLinkedBuffer &buf)
+{
+  bool recyclable = false;
+  int64_t hash_val = hash(buf.allocated_chid());
+  if (0 <= hash_val && hash_val < hash_cnt_) {
+    recyclable = mem_mgrs_.at(hash_val)->is_recyclable(buf);
+  }
+  return recyclable;
+}
+
+ObDtlLinkedBuffer *ObDtlTenantMemManager::reuse(ObDtlLinkedBuffer *buf, int64_t size)
+{
+  ObDtlLinkedBuffer *reused_buf = nullptr;
+  if (nullptr != buf) {
+    int64_t hash_val = hash(buf->allocated_chid());
+    if (0 <= hash_val && hash_val < hash_cnt_) {
+      reused_buf = mem_mgrs_.at(hash_val)->reuse(buf, size);
+    }
+  }
+  return reused_buf;
+}
+
 int64_t ObDtlTenantMemManager::avg_alloc_times()
 {
   int64_t avg = 0;
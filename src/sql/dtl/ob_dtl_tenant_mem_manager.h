@@ -37,6 +37,8 @@ public:
 public:
   ObDtlLinkedBuffer *alloc(int64_t chid, int64_t size);
   int free(ObDtlLinkedBuffer *buf);
+  bool is_recyclable(const ObDtlLinkedBuffer &buf);
+  ObDtlLinkedBuffer *reuse(ObDtlLinkedBuffer *buf, int64_t size);
   int64_t hash(int64_t chid);
   static int64_t hash(int64_t chid, int64_t ratio);
 
@@ -0,0 +1,467 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL_DTL
+
+#include "ob_dtl_vectors_codec.h"
+#include "lib/compress/ob_compressor_pool.h"
+#include "sql/dtl/ob_dtl_vectors_buffer.h"
+
+using namespace oceanbase::common;
+
+namespace oceanbase {
+namespace sql {
+namespace dtl {
+
+namespace
+{
+const int64_t VECTOR_HEADER_SIZE = 3 * sizeof(int32_t);
+
+template <typename T>
+OB_INLINE void write_val(char *buf, int64_t &pos, const T val)
+{
+  MEMCPY(buf + pos, &val, sizeof(T));
+  pos += sizeof(T);
+}
+
+template <typename T>
+OB_INLINE T read_val(const char *buf, int64_t &pos)
+{
+  T val;
+  MEMCPY(&val, buf + pos, sizeof(T));
+  pos += sizeof(T);
+  return val;
+}
+
+// bit packing of values narrower than ObDtlVectorsCodec::MAX_PACK_WIDTH, lowest bit first
+class BitPacker
+{
+public:
+  explicit BitPacker(char *buf) : buf_(buf), acc_(0), bits_(0), pos_(0) {}
+  OB_INLINE void append(const uint64_t val, const int64_t width)
+  {
+    acc_ |= val << bits_;
+    bits_ += width;
+    while (bits_ >= 8) {
+      buf_[pos_++] = static_cast<char>(acc_ & 0xFF);
+      acc_ >>= 8;
+      bits_ -= 8;
+    }
+  }
+  OB_INLINE void flush()
+  {
+    if (bits_ > 0) {
+      buf_[pos_++] = static_cast<char>(acc_ & 0xFF);
+      acc_ = 0;
+      bits_ = 0;
+    }
+  }
+private:
+  char *buf_;
+  uint64_t acc_;
+  int64_t bits_;
+  int64_t pos_;
+};
+
+class BitUnpacker
+{
+public:
+  explicit BitUnpacker(const char *buf) : buf_(buf), acc_(0), bits_(0), pos_(0) {}
+  OB_INLINE uint64_t next(const int64_t width)
+  {
+    while (bits_ < width) {
+      acc_ |= static_cast<uint64_t>(static_cast<uint8_t>(buf_[pos_++])) << bits_;
+      bits_ += 8;
+    }
+    const uint64_t val = acc_ & ((1ULL << width) - 1);
+    acc_ >>= width;
+    bits_ -= width;
+    return val;
+  }
+private:
+  const char *buf_;
+  uint64_t acc_;
+  int64_t bits_;
+  int64_t pos_;
+};
+
+OB_INLINE int64_t read_fixed(const char *data, const int64_t fixed_len, const int64_t idx)
+{
+  int64_t val = 0;
+  if (sizeof(int32_t) == fixed_len) {
+    int32_t v = 0;
+    MEMCPY(&v, data + idx * sizeof(int32_t), sizeof(int32_t));
+    val = v;
+  } else {
+    MEMCPY(&val, data + idx * sizeof(int64_t), sizeof(int64_t));
+  }
+  return val;
+}
+
+OB_INLINE void write_fixed(char *data, const int64_t fixed_len, const int64_t idx,
+                           const int64_t val)
+{
+  if (sizeof(int32_t) == fixed_len) {
+    const int32_t v = static_cast<int32_t>(val);
+    MEMCPY(data + idx * sizeof(int32_t), &v, sizeof(int32_t));
+  } else {
+    MEMCPY(data + idx * sizeof(int64_t), &val, sizeof(int64_t));
+  }
+}
+
+OB_INLINE int64_t column_end(const VectorInfo *infos, const int64_t col_idx,
+                             const int64_t col_cnt, const int64_t raw_size)
+{
+  return col_idx + 1 < col_cnt ? infos[col_idx + 1].nulls_offset_ : raw_size;
+}
+}
+
+int ObDtlVectorsCodec::encode(const char *src, const int64_t src_size,
+                              char *dst, const int64_t dst_cap, int64_t &dst_size)
+{
+  int ret = OB_SUCCESS;
+  dst_size = 0;
+  if (OB_ISNULL(src) || OB_ISNULL(dst) || src_size < VECTOR_HEADER_SIZE || src_size > INT32_MAX
+      || ObDtlVectorsBuffer::MAGIC != *reinterpret_cast<const int32_t *>(src)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), KP(src), KP(dst), K(src_size));
+  } else {
+    const int64_t col_cnt = *reinterpret_cast<const int32_t *>(src + sizeof(int32_t));
+    const int64_t row_cnt = *reinterpret_cast<const int32_t *>(src + 2 * sizeof(int32_t));
+    const bool has_data = col_cnt > 0 && row_cnt > 0;
+    const int64_t raw_header_size = VECTOR_HEADER_SIZE
+                                    + (has_data ? col_cnt * sizeof(VectorInfo) : 0);
+    const int64_t nulls_size = ObBitVector::memory_size(row_cnt);
+    const VectorInfo *infos = reinterpret_cast<const VectorInfo *>(src + VECTOR_HEADER_SIZE);
+    int64_t pos = 0;
+    if (2 * sizeof(int32_t) + raw_header_size > dst_cap || raw_header_size > src_size) {
+      ret = OB_SIZE_OVERFLOW;
+    } else {
+      write_val<int32_t>(dst, pos, MAGIC);
+      write_val<int32_t>(dst, pos, static_cast<int32_t>(src_size));
+      MEMCPY(dst + pos, src, raw_header_size);
+      pos += raw_header_size;
+    }
+    for (int64_t i = 0; OB_SUCC(ret) && has_data && i < col_cnt; ++i) {
+      const VectorInfo &info = infos[i];
+      const int64_t col_begin = info.nulls_offset_;
+      const int64_t col_size = column_end(infos, i, col_cnt, src_size) - col_begin;
+      const int64_t col_pos = pos;
+      ColumnMethod method = RAW;
+      if (VEC_FIXED == info.format_
+          && (sizeof(int32_t) == info.fixed_len_ || sizeof(int64_t) == info.fixed_len_)) {
+        method = FOR_FIXED;
+      } else if (VEC_CONTINUOUS == info.format_) {
+        method = LZ4_CONTINUOUS;
+      }
+      if (col_begin < raw_header_size || col_size < nulls_size || col_begin + col_size > src_size) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("unexpected column layout", K(ret), K(i), K(info), K(col_size), K(src_size));
+      } else if (RAW != method) {
+        if (pos + 1 + nulls_size > dst_cap) {
+          ret = OB_SIZE_OVERFLOW;
+        } else {
+          write_val<uint8_t>(dst, pos, static_cast<uint8_t>(method));
+          MEMCPY(dst + pos, src + col_begin, nulls_size);
+          pos += nulls_size;
+          if (FOR_FIXED == method) {
+            ret = encode_for_fixed(src + info.data_offset_, info.fixed_len_, row_cnt,
+                                   dst, dst_cap, pos);
+          } else {
+            ret = encode_continuous(src,
+                                    reinterpret_cast<const uint32_t *>(src + info.offsets_offset_),
+                                    row_cnt, dst, dst_cap, pos);
+          }
+        }
+        // poor ratio or not enough space, keep the column as is
+        if ((OB_SUCC(ret) && pos - col_pos > col_size) || OB_SIZE_OVERFLOW == ret) {
+          ret = OB_SUCCESS;
+          pos = col_pos;
+          method = RAW;
+        }
+      }
+      if (OB_SUCC(ret) && RAW == method) {
+        if (pos + 1 + col_size > dst_cap) {
+          ret = OB_SIZE_OVERFLOW;
+        } else {
+          write_val<uint8_t>(dst, pos, static_cast<uint8_t>(RAW));
+          MEMCPY(dst + pos, src + col_begin, col_size);
+          pos += col_size;
+        }
+      }
+    }
+    if (OB_SUCC(ret)) {
+      dst_size = pos;
+    }
+  }
+  return ret;
+}
+
+int ObDtlVectorsCodec::get_decoded_size(const char *src, const int64_t src_size, int64_t &raw_size)
+{
+  int ret = OB_SUCCESS;
+  int64_t pos = 0;
+  if (OB_ISNULL(src) || src_size < 2 * sizeof(int32_t)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), KP(src), K(src_size));
+  } else if (MAGIC != read_val<int32_t>(src, pos)) {
+    ret = OB_INVALID_DATA;
+    LOG_WARN("invalid encoded vectors magic", K(ret));
+  } else {
+    raw_size = read_val<int32_t>(src, pos);
+  }
+  return ret;
+}
+
+int ObDtlVectorsCodec::decode(const char *src, const int64_t src_size,
+                              char *dst, const int64_t dst_cap, int64_t &dst_size)
+{
+  int ret = OB_SUCCESS;
+  int64_t raw_size = 0;
+  int64_t pos = 2 * sizeof(int32_t);
+  dst_size = 0;
+  if (OB_ISNULL(dst)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret));
+  } else if (OB_FAIL(get_decoded_size(src, src_size, raw_size))) {
+    LOG_WARN("failed to get decoded size", K(ret));
+  } else if (raw_size > dst_cap || raw_size < VECTOR_HEADER_SIZE
+             || pos + VECTOR_HEADER_SIZE > src_size) {
+    ret = OB_INVALID_DATA;
+    LOG_WARN("invalid encoded vectors", K(ret), K(raw_size), K(dst_cap), K(src_size));
+  } else {
+    const int64_t col_cnt = *reinterpret_cast<const int32_t *>(src + pos + sizeof(int32_t));
+    const int64_t row_cnt = *reinterpret_cast<const int32_t *>(src + pos + 2 * sizeof(int32_t));
+    const bool has_data = col_cnt > 0 && row_cnt > 0;
+    const int64_t raw_header_size = VECTOR_HEADER_SIZE
+                                    + (has_data ? col_cnt * sizeof(VectorInfo) : 0);
+    const int64_t nulls_size = ObBitVector::memory_size(row_cnt);
+    const VectorInfo *infos = reinterpret_cast<const VectorInfo *>(dst + VECTOR_HEADER_SIZE);
+    if (pos + raw_header_size > src_size || raw_header_size > raw_size) {
+      ret = OB_INVALID_DATA;
+      LOG_WARN("invalid encoded vectors", K(ret), K(raw_header_size), K(src_size), K(raw_size));
+    } else {
+      MEMCPY(dst, src + pos, raw_header_size);
+      pos += raw_header_size;
+    }
+    for (int64_t i = 0; OB_SUCC(ret) && has_data && i < col_cnt; ++i) {
+      const VectorInfo &info = infos[i];
+      const int64_t col_begin = info.nulls_offset_;
+      const int64_t col_size = column_end(infos, i, col_cnt, raw_size) - col_begin;
+      ColumnMethod method = RAW;
+      if (pos + 1 > src_size || col_begin < raw_header_size || col_size < nulls_size
+          || col_begin + col_size > raw_size) {
+        ret = OB_INVALID_DATA;
+        LOG_WARN("invalid encoded column", K(ret), K(i), K(info), K(pos), K(src_size));
+      } else if (FALSE_IT(method = static_cast<ColumnMethod>(read_val<uint8_t>(src, pos)))) {
+      } else if (RAW == method) {
+        if (pos + col_size > src_size) {
+          ret = OB_INVALID_DATA;
+          LOG_WARN("invalid raw column", K(ret), K(i), K(col_size), K(pos), K(src_size));
+        } else {
+          MEMCPY(dst + col_begin, src + pos, col_size);
+          pos += col_size;
+        }
+      } else if (pos + nulls_size > src_size) {
+        ret = OB_INVALID_DATA;
+        LOG_WARN("invalid encoded column nulls", K(ret), K(i), K(pos), K(src_size));
+      } else {
+        MEMCPY(dst + col_begin, src + pos, nulls_size);
+        pos += nulls_size;
+        if (FOR_FIXED == method) {
+          if (info.data_offset_ + info.fixed_len_ * row_cnt > raw_size) {
+            ret = OB_INVALID_DATA;
+            LOG_WARN("invalid fixed column", K(ret), K(i), K(info), K(raw_size));
+          } else {
+            ret = decode_for_fixed(src, src_size, pos, info.fixed_len_, row_cnt,
+                                   dst + info.data_offset_);
+          }
+        } else if (LZ4_CONTINUOUS == method) {
+          if (info.offsets_offset_ + (row_cnt + 1) * sizeof(uint32_t) > raw_size) {
+            ret = OB_INVALID_DATA;
+            LOG_WARN("invalid continuous column", K(ret), K(i), K(info), K(raw_size));
+          } else {
+            ret = decode_continuous(src, src_size, pos, row_cnt, info.data_offset_,
+                                    reinterpret_cast<uint32_t *>(dst + info.offsets_offset_),
+                                    dst, raw_size);
+          }
+        } else {
+          ret = OB_INVALID_DATA;
+          LOG_WARN("unknown column encoding method", K(ret), K(i), K(method));
+        }
+      }
+    }
+    if (OB_SUCC(ret)) {
+      dst_size = raw_size;
+    }
+  }
+  return ret;
+}
+
+int ObDtlVectorsCodec::encode_for_fixed(const char *data, const int64_t fixed_len,
+                                        const int64_t row_cnt, char *dst, const int64_t dst_cap,
+                                        int64_t &pos)
+{
+  int ret = OB_SUCCESS;
+  int64_t min_val = read_fixed(data, fixed_len, 0);
+  int64_t max_val = min_val;
+  for (int64_t i = 1; i < row_cnt; ++i) {
+    const int64_t val = read_fixed(data, fixed_len, i);
+    min_val = std::min(min_val, val);
+    max_val = std::max(max_val, val);
+  }
+  // null rows are encoded as well, the payload is restored byte by byte
+  const int64_t width = calc_width(static_cast<uint64_t>(max_val) - static_cast<uint64_t>(min_val));
+  if (width > MAX_PACK_WIDTH || width >= fixed_len * 8
+      || pos + sizeof(int64_t) + 1 + packed_size(width, row_cnt) > dst_cap) {
+    ret = OB_SIZE_OVERFLOW;
+  } else {
+    write_val<int64_t>(dst, pos, min_val);
+    write_val<uint8_t>(dst, pos, static_cast<uint8_t>(width));
+    BitPacker packer(dst + pos);
+    for (int64_t i = 0; i < row_cnt; ++i) {
+      packer.append(static_cast<uint64_t>(read_fixed(data, fixed_len, i))
+                    - static_cast<uint64_t>(min_val), width);
+    }
+    packer.flush();
+    pos += packed_size(width, row_cnt);
+  }
+  return ret;
+}
+
+int ObDtlVectorsCodec::decode_for_fixed(const char *src, const int64_t src_size, int64_t &pos,
+                                        const int64_t fixed_len, const int64_t row_cnt,
+                                        char *data)
+{
+  int ret = OB_SUCCESS;
+  int64_t base = 0;
+  int64_t width = 0;
+  if (pos + sizeof(int64_t) + 1 > src_size) {
+    ret = OB_INVALID_DATA;
+    LOG_WARN("invalid fixed column", K(ret), K(pos), K(src_size));
+  } else if (FALSE_IT(base = read_val<int64_t>(src, pos))) {
+  } else if (FALSE_IT(width = read_val<uint8_t>(src, pos))) {
+  } else if (width > MAX_PACK_WIDTH || pos + packed_size(width, row_cnt) > src_size) {
+    ret = OB_INVALID_DATA;
+    LOG_WARN("invalid fixed column", K(ret), K(width), K(row_cnt), K(pos), K(src_size));
+  } else {
+    BitUnpacker unpacker(src + pos);
+    for (int64_t i = 0; i < row_cnt; ++i) {
+      write_fixed(data, fixed_len, i,
+                  static_cast<int64_t>(static_cast<uint64_t>(base) + unpacker.next(width)));
+    }
+    pos += packed_size(width, row_cnt);
+  }
+  return ret;
+}
+
+int ObDtlVectorsCodec::encode_continuous(const char *vector_head, const uint32_t *offsets,
+                                         const int64_t row_cnt, char *dst, const int64_t dst_cap,
+                                         int64_t &pos)
+{
+  int ret = OB_SUCCESS;
+  ObCompressor *compressor = nullptr;
+  int64_t max_overflow_size = 0;
+  int64_t compressed_size = 0;
+  uint32_t min_len = UINT32_MAX;
+  uint32_t max_len = 0;
+  for (int64_t i = 0; i < row_cnt; ++i) {
+    const uint32_t len = offsets[i + 1] - offsets[i];
+    min_len = std::min(min_len, len);
+    max_len = std::max(max_len, len);
+  }
+  const int64_t width = calc_width(max_len - min_len);
+  const int64_t data_size = offsets[row_cnt] - offsets[0];
+  if (OB_FAIL(ObCompressorPool::get_instance().get_compressor(LZ4_COMPRESSOR, compressor))) {
+    LOG_WARN("failed to get compressor", K(ret));
+  } else if (OB_FAIL(compressor->get_max_overflow_size(data_size, max_overflow_size))) {
+    LOG_WARN("failed to get max overflow size", K(ret), K(data_size));
+  } else if (pos + sizeof(int64_t) + 1 + packed_size(width, row_cnt) + sizeof(int32_t)
+             + data_size + max_overflow_size > dst_cap) {
+    ret = OB_SIZE_OVERFLOW;
+  } else {
+    write_val<int64_t>(dst, pos, min_len);
+    write_val<uint8_t>(dst, pos, static_cast<uint8_t>(width));
+    BitPacker packer(dst + pos);
+    for (int64_t i = 0; i < row_cnt; ++i) {
+      packer.append(offsets[i + 1] - offsets[i] - min_len, width);
+    }
+    packer.flush();
+    pos += packed_size(width, row_cnt);
+    if (OB_FAIL(compressor->compress(vector_head + offsets[0], data_size,
+                                     dst + pos + sizeof(int32_t),
+                                     dst_cap - pos - sizeof(int32_t), compressed_size))) {
+      LOG_WARN("failed to compress continuous data", K(ret), K(data_size));
+    } else {
+      write_val<int32_t>(dst, pos, static_cast<int32_t>(compressed_size));
+      pos += compressed_size;
+    }
+  }
+  return ret;
+}
+
+int ObDtlVectorsCodec::decode_continuous(const char *src, const int64_t src_size, int64_t &pos,
+                                         const int64_t row_cnt, const int64_t data_offset,
+                                         uint32_t *offsets, char *vector_head,
+                                         const int64_t raw_size)
+{
+  int ret = OB_SUCCESS;
+  ObCompressor *compressor = nullptr;
+  int64_t min_len = 0;
+  int64_t width = 0;
+  int64_t compressed_size = 0;
+  int64_t data_size = 0;
+  if (pos + sizeof(int64_t) + 1 > src_size) {
+    ret = OB_INVALID_DATA;
+    LOG_WARN("invalid continuous column", K(ret), K(pos), K(src_size));
+  } else if (FALSE_IT(min_len = read_val<int64_t>(src, pos))) {
+  } else if (FALSE_IT(width = read_val<uint8_t>(src, pos))) {
+  } else if (width > MAX_PACK_WIDTH
+             || pos + packed_size(width, row_cnt) + sizeof(int32_t) > src_size) {
+    ret = OB_INVALID_DATA;
+    LOG_WARN("invalid continuous column", K(ret), K(width), K(row_cnt), K(pos), K(src_size));
+  } else {
+    BitUnpacker unpacker(src + pos);
+    offsets[0] = static_cast<uint32_t>(data_offset);
+    for (int64_t i = 0; i < row_cnt; ++i) {
+      offsets[i + 1] = offsets[i] + static_cast<uint32_t>(min_len + unpacker.next(width));
+    }
+    pos += packed_size(width, row_cnt);
+    compressed_size = read_val<int32_t>(src, pos);
+    data_size = offsets[row_cnt] - offsets[0];
+    if (compressed_size < 0 || pos + compressed_size > src_size
+        || data_offset + data_size > raw_size) {
+      ret = OB_INVALID_DATA;
+      LOG_WARN("invalid continuous data", K(ret), K(compressed_size), K(data_size), K(pos),
+               K(src_size), K(raw_size));
+    } else if (OB_FAIL(ObCompressorPool::get_instance().get_compressor(LZ4_COMPRESSOR,
+                                                                       compressor))) {
+      LOG_WARN("failed to get compressor", K(ret));
+    } else {
+      int64_t decompressed_size = 0;
+      if (OB_FAIL(compressor->decompress(src + pos, compressed_size, vector_head + data_offset,
+                                         data_size, decompressed_size))) {
+        LOG_WARN("failed to decompress continuous data", K(ret), K(compressed_size));
+      } else if (OB_UNLIKELY(decompressed_size != data_size)) {
+        ret = OB_INVALID_DATA;
+        LOG_WARN("unexpected decompressed size", K(ret), K(decompressed_size), K(data_size));
+      } else {
+        pos += compressed_size;
+      }
+    }
+  }
+  return ret;
+}
+
+}  // dtl
+}  // sql
+}  // oceanbase
@@ -0,0 +1,86 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OB_DTL_VECTORS_CODEC_H
+#define OB_DTL_VECTORS_CODEC_H
+
+#include "lib/ob_define.h"
+
+namespace oceanbase {
+namespace sql {
+namespace dtl {
+
+/*
+Lightweight columnar encoding of the serialized vector payload (PX_VECTOR / PX_VECTOR_FIXED,
+see ObDtlLinkedBuffer::serialize_vector), used to shrink the data shuffled by rpc channels.
+
+encoded layout:
+magic : 4
+raw size : 4
+raw header : magic, col cnt, row cnt, VectorInfo * col_cnt (copied as is)
+(method : 1 + column data) * col_cnt
+  RAW :            nulls, offsets and data copied as is
+  FOR_FIXED :      nulls + base : 8 + bit width : 1 + bit packed (value - base) of each row
+  LZ4_CONTINUOUS : nulls + base : 8 + bit width : 1 + bit packed (length - base) of each row
+                   + compressed size : 4 + lz4 compressed data
+Decoding restores the raw payload byte by byte, so the receive side is not aware of it.
+*/
+class ObDtlVectorsCodec
+{
+public:
+  static const int32_t MAGIC = 0x56454344; // "DCEV"
+  // buffers below this size are not worth encoding
+  static const int64_t MIN_ENCODE_SIZE = 1024;
+
+  // Returns OB_SIZE_OVERFLOW if the encoded payload does not fit in %dst_cap,
+  // the caller should send the raw payload then.
+  static int encode(const char *src, const int64_t src_size,
+                    char *dst, const int64_t dst_cap, int64_t &dst_size);
+  static int get_decoded_size(const char *src, const int64_t src_size, int64_t &raw_size);
+  static int decode(const char *src, const int64_t src_size,
+                    char *dst, const int64_t dst_cap, int64_t &dst_size);
+
+private:
+  enum ColumnMethod
+  {
+    RAW = 0,
+    FOR_FIXED = 1,
+    LZ4_CONTINUOUS = 2,
+  };
+  // keep the bit writer accumulator in 64 bits
+  static const int64_t MAX_PACK_WIDTH = 56;
+
+  static int encode_for_fixed(const char *data, const int64_t fixed_len, const int64_t row_cnt,
+                              char *dst, const int64_t dst_cap, int64_t &pos);
+  static int decode_for_fixed(const char *src, const int64_t src_size, int64_t &pos,
+                              const int64_t fixed_len, const int64_t row_cnt, char *data);
+  static int encode_continuous(const char *vector_head, const uint32_t *offsets,
+                               const int64_t row_cnt, char *dst, const int64_t dst_cap,
+                               int64_t &pos);
+  static int decode_continuous(const char *src, const int64_t src_size, int64_t &pos,
+                               const int64_t row_cnt, const int64_t data_offset,
+                               uint32_t *offsets, char *vector_head, const int64_t raw_size);
+  static int64_t calc_width(const uint64_t range)
+  {
+    return 0 == range ? 0 : 64 - __builtin_clzll(range);
+  }
+  static int64_t packed_size(const int64_t width, const int64_t row_cnt)
+  {
+    return (width * row_cnt + 7) / 8;
+  }
+};
+
+}  // dtl
+}  // sql
+}  // oceanbase
+
+#endif /* OB_DTL_VECTORS_CODEC_H */
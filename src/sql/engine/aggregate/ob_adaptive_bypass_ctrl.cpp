@@ -41,6 +41,23 @@ void ObAdaptiveByPassCtrl::gby_process_state(int64_t probe_cnt,
     if (!in_l3_cache(row_cnt, mem_size)) {
       state_ = STATE_ANALYZE;
     }
+  } else if (STATE_ANALYZE == state_ && global_ratio_fetched_) {
+    // all workers of the dfo follow the global ratio
+    ++round_times_;
+    if (global_by_pass_) {
+      state_ = STATE_PROCESS_HT;
+      set_max_rebuild_times();
+    } else {
+      rebuild_times_ = 0;
+      if (global_ratio_ >= MIN_RATIO_FOR_L3 && in_l3_cache(row_cnt, mem_size)) {
+        state_ = STATE_L3_INSERT;
+        need_resize_hash_table_ = true;
+      } else {
+        state_ = STATE_PROCESS_HT;
+      }
+    }
+    LOG_TRACE("adaptive groupby follow global ratio", K(state_), K(global_ratio_), K(op_id_),
+                                                      K(row_cnt), K(probe_cnt), K(processed_cnt_));
   } else if (STATE_ANALYZE == state_) {
     double ratio = MIN_RATIO_FOR_L3;
     probe_cnt_for_period_[round_times_ % MAX_REBUILD_TIMES] = probe_cnt;
@@ -104,6 +121,26 @@ void ObAdaptiveByPassCtrl::gby_process_state(int64_t probe_cnt,
   }
 }
 
+void ObAdaptiveByPassCtrl::set_local_ratio(int64_t probe_cnt, int64_t row_cnt)
+{
+  local_ratio_ = probe_cnt <= 0 ? 0 : 1 - static_cast<double> (row_cnt) / probe_cnt;
+  ratio_reported_ = true;
+}
+
+void ObAdaptiveByPassCtrl::set_global_ratio(double ratio)
+{
+  global_ratio_ = ratio;
+  global_ratio_fetched_ = true;
+  global_by_pass_ = ratio < 1 - (1 / static_cast<double> (cut_ratio_));
+  if (global_by_pass_) {
+    // switch to by pass at the end of current round
+    set_max_rebuild_times();
+  } else {
+    reset_rebuild_times();
+  }
+  LOG_TRACE("adaptive groupby get global ratio", K(global_ratio_), K(local_ratio_),
+                                                 K(global_by_pass_), K(cut_ratio_), K(op_id_));
+}
 
 } // end namespace sql
 } // end namespace oceanbase
\ No newline at end of file
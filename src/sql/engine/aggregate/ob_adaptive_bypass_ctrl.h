@@ -42,7 +42,9 @@ public:
                          period_cnt_(MIN_PERIOD_CNT), probe_cnt_(0), exists_cnt_(0),
                          rebuild_times_(0), cut_ratio_(INIT_CUT_RATIO), by_pass_ctrl_enabled_(false),
                          small_row_cnt_(0), op_id_(-1), need_resize_hash_table_(false),
-                         round_times_(0) {}
+                         round_times_(0), need_sync_ratio_(false), ratio_reported_(false),
+                         global_ratio_fetched_(false), global_by_pass_(false),
+                         local_ratio_(0), global_ratio_(0), by_pass_row_cnt_(0) {}
   inline void reset() {
     by_pass_ = false;
     processed_cnt_ = 0;
@@ -52,6 +54,14 @@ public:
     exists_cnt_ = 0;
     rebuild_times_ = 0;
     need_resize_hash_table_ = false;
+    // the ratio is synced once per execution of the dfo, a rescan decides by its local ratio
+    need_sync_ratio_ = false;
+    ratio_reported_ = false;
+    global_ratio_fetched_ = false;
+    global_by_pass_ = false;
+    local_ratio_ = 0;
+    global_ratio_ = 0;
+    by_pass_row_cnt_ = 0;
   }
   inline void reset_state() { state_ = STATE_L2_INSERT; }
   inline void start_process_ht() { state_ = STATE_PROCESS_HT; }
@@ -79,6 +89,18 @@ public:
   inline void set_op_id(int64_t op_id) { op_id_ = op_id; }
   inline void set_small_row_cnt(int64_t row_cnt) { small_row_cnt_ = row_cnt; }
   inline int64_t get_small_row_cnt() const { return small_row_cnt_; }
+  // The reduction ratio of the first round is reported to QC through datahub, all workers
+  // of the dfo take the same bypass decision once the global ratio is fetched.
+  // Datahub is only used as a hint here, workers never wait for the global ratio.
+  inline void open_global_ratio_sync() { need_sync_ratio_ = true; }
+  inline bool need_report_ratio() const { return need_sync_ratio_ && !ratio_reported_; }
+  inline bool need_fetch_global_ratio() const
+  {
+    return need_sync_ratio_ && ratio_reported_ && !global_ratio_fetched_;
+  }
+  void set_local_ratio(int64_t probe_cnt, int64_t row_cnt);
+  void set_global_ratio(double ratio);
+  inline void inc_by_pass_row_cnt(int64_t row_cnt) { by_pass_row_cnt_ += row_cnt; }
   bool by_pass_;
   int64_t processed_cnt_;
   ByPassState state_;
@@ -94,6 +116,13 @@ public:
   int64_t probe_cnt_for_period_[MAX_REBUILD_TIMES];
   int64_t ndv_cnt_for_period_[MAX_REBUILD_TIMES];
   int64_t round_times_;
+  bool need_sync_ratio_;
+  bool ratio_reported_;
+  bool global_ratio_fetched_;
+  bool global_by_pass_;
+  double local_ratio_;
+  double global_ratio_;
+  int64_t by_pass_row_cnt_;
 };
 
 } // end namespace sql
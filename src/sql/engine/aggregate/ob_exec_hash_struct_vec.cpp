@@ -57,7 +57,7 @@ int ObExtendHashTableVec<GroupRowBucket>::get(const int64_t batch_idx, uint64_t
   bool result = false;
   locate_bucket_ = nullptr;
   ++probe_cnt_;
-  locate_bucket_ = const_cast<GroupRowBucket *> (&locate_bucket(*buckets_, hash_val));
+  locate_bucket_ = const_cast<GroupRowBucket *> (&locate_bucket(hash_val, locate_pos_));
   if (locate_bucket_->is_valid()) {
     ObGroupRowItemVec *it = &locate_bucket_->get_item();
     while (OB_SUCC(ret) && nullptr != it) {
@@ -107,7 +107,7 @@ int ObExtendHashTableVec<GroupRowBucket>::append(const common::ObIArray<ObExpr *
       SQL_ENG_LOG(WARN, "extend failed", K(ret));
     } else {
       //relocate bucket
-      locate_bucket_ = const_cast<GroupRowBucket *>(&locate_bucket(*buckets_, hash_value));
+      locate_bucket_ = const_cast<GroupRowBucket *>(&locate_bucket(hash_value, locate_pos_));
     }
   }
   LOG_DEBUG("append new row", "new row",
@@ -117,8 +117,7 @@ int ObExtendHashTableVec<GroupRowBucket>::append(const common::ObIArray<ObExpr *
       ret = OB_ERR_UNEXPECTED;
       LOG_WARN("failed to get locate bucket", K(ret));
     } else if (!locate_bucket_->is_valid()) {
-      locate_bucket_->set_hash(hash_value);
-      locate_bucket_->set_valid();
+      set_bucket_valid(*locate_bucket_, locate_pos_, hash_value);
       locate_bucket_->set_bkt_seq(size_);
       static_cast<ObGroupRowItemVec &> (srow[0]).set_next(nullptr, group_store_.get_row_meta());
       locate_bucket_->set_item(static_cast<ObGroupRowItemVec &> (srow[0]));
@@ -160,10 +159,10 @@ int ObExtendHashTableVec<GroupRowBucket>::set_unique_batch(const common::ObIArra
     }
     ObCompactRow &srow = const_cast<ObCompactRow &> (share::aggregate::Processor::
                         get_groupby_stored_row(group_store_.get_row_meta(), batch_new_rows[i]));
-    GroupRowBucket *bucket = const_cast<GroupRowBucket *> (&locate_bucket(*buckets_, hash_values[i]));
+    int64_t pos = 0;
+    GroupRowBucket *bucket = const_cast<GroupRowBucket *> (&locate_bucket(hash_values[i], pos));
     if (!bucket->is_valid()) {
-      bucket->set_hash(hash_values[i]);
-      bucket->set_valid();
+      set_bucket_valid(*bucket, pos, hash_values[i]);
       bucket->set_bkt_seq(size_);
       static_cast<ObGroupRowItemVec &> (srow).set_next(nullptr, group_store_.get_row_meta());
       bucket->set_item(static_cast<ObGroupRowItemVec &> (srow));
@@ -216,8 +215,8 @@ int ObExtendHashTableVec<GroupRowBucket>::append_batch(const common::ObIArray<Ob
         ret = OB_ERR_UNEXPECTED;
         LOG_WARN("failed to get locate bucket", K(ret), K(new_row_selector_.at(i)));
       } else if (!curr_bkt->is_valid()) {
-        curr_bkt->set_hash(hash_values[new_row_selector_.at(i)]);
-        curr_bkt->set_valid();
+        set_bucket_valid(*curr_bkt, locate_bucket_pos_[new_row_selector_.at(i)],
+                         hash_values[new_row_selector_.at(i)]);
         curr_bkt->set_bkt_seq(size_ + i);
         static_cast<ObGroupRowItemVec &> (*curr_row).set_next(nullptr, group_store_.get_row_meta());
         curr_bkt->set_item(static_cast<ObGroupRowItemVec &> (*curr_row));
@@ -278,6 +277,12 @@ int ObExtendHashTableVec<GroupRowBucket>::process_batch(const common::ObIArray<O
         LOG_WARN("failed to alloc bucket ptrs", K(ret), K(max_batch_size_));
       }
     }
+    if (OB_SUCC(ret) && OB_ISNULL(locate_bucket_pos_)) {
+      if (OB_ISNULL(locate_bucket_pos_ = static_cast<int64_t *> (allocator_.alloc(sizeof(int64_t) * max_batch_size_)))) {
+        ret = OB_ALLOCATE_MEMORY_FAILED;
+        LOG_WARN("failed to alloc bucket pos", K(ret), K(max_batch_size_));
+      }
+    }
     if (OB_SUCC(ret) && OB_ISNULL(srows_)) {
       if (OB_ISNULL(srows_ = static_cast<ObCompactRow **> (allocator_.alloc(sizeof(ObCompactRow *) * max_batch_size_)))) {
         ret = OB_ALLOCATE_MEMORY_FAILED;
@@ -296,7 +301,8 @@ int ObExtendHashTableVec<GroupRowBucket>::process_batch(const common::ObIArray<O
                 && !bloom_filter->exist(ObGroupRowBucketBase::HASH_VAL_MASK & hash_values[curr_idx]))) {
           continue;
         }
-        locate_buckets_[curr_idx] = const_cast<GroupRowBucket *> (&locate_bucket(*buckets_, hash_values[curr_idx]));
+        locate_buckets_[curr_idx] = const_cast<GroupRowBucket *> (&locate_bucket(hash_values[curr_idx],
+                                                                                 locate_bucket_pos_[curr_idx]));
         if (locate_buckets_[curr_idx]->is_valid()) {
           ++probe_cnt_;
           ++agg_row_cnt;
@@ -455,7 +461,9 @@ int ObExtendHashTableVec<GroupRowBucket>::init(ObIAllocator *allocator,
       ret = OB_ALLOCATE_MEMORY_FAILED;
       SQL_ENG_LOG(WARN, "failed to allocate memory", K(ret));
     } else {
-      if (!nullable && all_int64) {
+      if (!nullable && all_int64 && 1 == hash_expr_cnt && nullptr != gby_exprs.at(0)) {
+        likely_equal_function_ = &ObExtendHashTableVec<GroupRowBucket>::likely_equal_one_fixed64;
+      } else if (!nullable && all_int64) {
         likely_equal_function_ = &ObExtendHashTableVec<GroupRowBucket>::likely_equal_fixed64;
       } else if (!nullable) {
         likely_equal_function_ = &ObExtendHashTableVec<GroupRowBucket>::likely_equal;
@@ -509,7 +517,8 @@ int ObExtendHashTableVec<GroupRowBucket>::set_distinct(const RowMeta &row_meta,
       }
       is_inited_vec_ = true;
     }
-    bucket = const_cast<GroupRowBucket *> (&locate_bucket(*buckets_, hash_value));
+    int64_t pos = 0;
+    bucket = const_cast<GroupRowBucket *> (&locate_bucket(hash_value, pos));
     if (bucket->is_valid()) {
       RowItemType *it = &(bucket->get_item());
       while (OB_SUCC(ret) && nullptr != it) {
@@ -537,8 +546,7 @@ int ObExtendHashTableVec<GroupRowBucket>::set_distinct(const RowMeta &row_meta,
       if (OB_FAIL(sf(vector_ptrs_, &batch_idx, 1, &srow))) {
         LOG_WARN("failed to store row", K(ret));
       } else {
-        bucket->set_hash(hash_value);
-        bucket->set_valid();
+        set_bucket_valid(*bucket, pos, hash_value);
         bucket->set_item(static_cast<RowItemType&> (srow[0]));
         ++size_;
       }
@@ -573,6 +581,12 @@ int ObExtendHashTableVec<GroupRowBucket>::set_distinct_batch(const RowMeta &row_
       LOG_WARN("failed to alloc bucket ptrs", K(ret), K(max_batch_size_));
     }
   }
+  if (OB_SUCC(ret) && OB_ISNULL(locate_bucket_pos_)) {
+    if (OB_ISNULL(locate_bucket_pos_ = static_cast<int64_t *> (allocator_.alloc(sizeof(int64_t) * max_batch_size_)))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("failed to alloc bucket pos", K(ret), K(max_batch_size_));
+    }
+  }
   if (OB_SUCC(ret) && OB_ISNULL(srows_)) {
     if (OB_ISNULL(srows_ = static_cast<ObCompactRow **> (allocator_.alloc(sizeof(ObCompactRow *) * max_batch_size_)))) {
       ret = OB_ALLOCATE_MEMORY_FAILED;
@@ -597,7 +611,8 @@ int ObExtendHashTableVec<GroupRowBucket>::set_distinct_batch(const RowMeta &row_
           my_skip.set(curr_idx);
           continue;
         }
-        locate_buckets_[curr_idx] = const_cast<GroupRowBucket *> (&locate_bucket(*buckets_, hash_values[curr_idx]));
+        locate_buckets_[curr_idx] = const_cast<GroupRowBucket *> (&locate_bucket(hash_values[curr_idx],
+                                                                                 locate_bucket_pos_[curr_idx]));
         if (locate_buckets_[curr_idx]->is_valid()) {
           bool result = false;
           RowItemType *it = &(locate_buckets_[curr_idx]->get_item());
@@ -629,8 +644,7 @@ int ObExtendHashTableVec<GroupRowBucket>::set_distinct_batch(const RowMeta &row_
       } else {
         for (int64_t i = 0; i < new_row_selector_cnt_; ++i) {
           int64_t idx = new_row_selector_.at(i);
-          locate_buckets_[idx]->set_hash(hash_values[idx]);
-          locate_buckets_[idx]->set_valid();
+          set_bucket_valid(*locate_buckets_[idx], locate_bucket_pos_[idx], hash_values[idx]);
           locate_buckets_[idx]->set_item(static_cast<RowItemType&> (*srows_[i]));
           ++size_;
         }
@@ -647,8 +661,7 @@ int ObExtendHashTableVec<GroupRowBucket>::set_distinct_batch(const RowMeta &row_
         } else {
            for (int64_t i = 0; i < new_row_selector_cnt_; ++i) {
             int64_t idx = new_row_selector_.at(i);
-            locate_buckets_[idx]->set_hash(hash_values[idx]);
-            locate_buckets_[idx]->set_valid();
+            set_bucket_valid(*locate_buckets_[idx], locate_bucket_pos_[idx], hash_values[idx]);
             locate_buckets_[idx]->set_item(static_cast<RowItemType&> (*srows_[i]));
             ++size_;
           }
@@ -713,6 +726,32 @@ int ObExtendHashTableVec<GroupRowBucket>::likely_equal_fixed64(const RowMeta &ro
   return ret;
 }
 
+// single not null fixed length group by column, the most common case of group by.
+template <typename GroupRowBucket>
+int ObExtendHashTableVec<GroupRowBucket>::likely_equal_one_fixed64(const RowMeta &row_meta,
+                                                                   const ObCompactRow &left_row,
+                                                                   const int64_t right_idx,
+                                                                   bool &result) const
+{
+  int ret = OB_SUCCESS;
+  ObExpr *expr = gby_exprs_->at(0);
+  ObIVector *r_vec = expr->get_vector(*eval_ctx_);
+  const char *l_payload = left_row.get_cell_payload(row_meta, 0);
+  // fixed length memcmp is inlined as one 8 bytes compare
+  if (0 == memcmp(l_payload, r_vec->get_payload(right_idx), 8)) {
+    result = true;
+  } else {
+    // binary different values may be equal, e.g.: -0.0 and 0.0
+    int cmp_res = 0;
+    if (OB_FAIL(r_vec->null_last_cmp(*expr, right_idx, false, l_payload, 8, cmp_res))) {
+      LOG_WARN("failed to cmp left and right", K(ret));
+    } else {
+      result = (0 == cmp_res);
+    }
+  }
+  return ret;
+}
+
 template <typename GroupRowBucket>
 int ObExtendHashTableVec<GroupRowBucket>::likely_equal_fixed64_nullable(const RowMeta &row_meta,
                                                                         const ObCompactRow &left_row,
@@ -842,6 +881,14 @@ void ObExtendHashTableVec<GroupRowBucket>::prefetch(const ObBatchRows &brs, uint
 {
   if (!sstr_aggr_.is_valid()) {
     auto mask = get_bucket_num() - 1;
+    if (bucket_ctrl_.is_valid()) {
+      for(auto i = 0; i < brs.size_; i++) {
+        if (brs.skip_->at(i)) {
+          continue;
+        }
+        bucket_ctrl_.prefetch((ObGroupRowBucketBase::HASH_VAL_MASK & hash_vals[i]) & mask);
+      }
+    }
     for(auto i = 0; i < brs.size_; i++) {
       if (brs.skip_->at(i)) {
         continue;
@@ -24,6 +24,9 @@
 #include "sql/engine/aggregate/ob_aggregate_processor.h"
 #include "sql/engine/basic/ob_compact_row.h"
 #include "sql/engine/basic/ob_temp_row_store.h"
+#if defined(__x86_64__)
+#include <emmintrin.h>
+#endif
 
 namespace oceanbase
 {
@@ -183,6 +186,89 @@ struct ObGroupRowBucket : public ObGroupRowBucketBase
   CompactRowItem *item_;
 };
 
+// Swiss table style control bytes of the hash table buckets.
+//
+// One byte per bucket: EMPTY_CTRL if the bucket is not valid (empty, or occupied by the batch
+// being processed), otherwise 7 bits tag of the hash value. Probing compares a group of
+// GROUP_WIDTH control bytes at once and only touches the buckets with the same tag, instead of
+// loading the buckets one by one. The first GROUP_WIDTH bytes are mirrored after the last one,
+// so a group never wraps around.
+struct ObGroupRowBucketCtrl
+{
+  static const uint8_t EMPTY_CTRL = 0x80;
+  static const int64_t GROUP_WIDTH = 16;
+  static const int64_t TAG_SHIFT = ObGroupRowBucketBase::HASH_VAL_BIT - 7;
+  ObGroupRowBucketCtrl() : ctrl_(nullptr), bucket_num_(0) {}
+  static OB_INLINE uint8_t tag(const uint64_t mask_hash)
+  {
+    return static_cast<uint8_t>((mask_hash >> TAG_SHIFT) & 0x7F);
+  }
+  // too small table has no control bytes, and is probed bucket by bucket
+  bool is_valid() const { return nullptr != ctrl_; }
+  int64_t mem_used() const { return is_valid() ? bucket_num_ + GROUP_WIDTH : 0; }
+  int init(common::ModulePageAllocator &alloc, const lib::ObMemAttr &attr, const int64_t bucket_num)
+  {
+    int ret = common::OB_SUCCESS;
+    destroy(alloc);
+    if (bucket_num >= GROUP_WIDTH) {
+      if (OB_ISNULL(ctrl_ = static_cast<uint8_t *>(alloc.alloc(bucket_num + GROUP_WIDTH, attr)))) {
+        ret = common::OB_ALLOCATE_MEMORY_FAILED;
+        SQL_ENG_LOG(WARN, "failed to allocate control bytes", K(ret), K(bucket_num));
+      } else {
+        bucket_num_ = bucket_num;
+        reuse();
+      }
+    }
+    return ret;
+  }
+  void reuse()
+  {
+    if (is_valid()) {
+      MEMSET(ctrl_, EMPTY_CTRL, bucket_num_ + GROUP_WIDTH);
+    }
+  }
+  void destroy(common::ModulePageAllocator &alloc)
+  {
+    if (nullptr != ctrl_) {
+      alloc.free(ctrl_);
+      ctrl_ = nullptr;
+    }
+    bucket_num_ = 0;
+  }
+  OB_INLINE void set(const int64_t pos, const uint64_t hash_val)
+  {
+    if (is_valid()) {
+      const uint8_t t = tag(hash_val & ObGroupRowBucketBase::HASH_VAL_MASK);
+      ctrl_[pos] = t;
+      if (pos < GROUP_WIDTH) {
+        ctrl_[bucket_num_ + pos] = t;
+      }
+    }
+  }
+  // bit i of result is set if control byte of bucket (%pos + i) equals to %v
+  OB_INLINE uint32_t match(const int64_t pos, const uint8_t v) const
+  {
+#if defined(__x86_64__)
+    __m128i group = _mm_loadu_si128(reinterpret_cast<const __m128i *>(ctrl_ + pos));
+    return static_cast<uint32_t>(
+        _mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8(static_cast<char>(v)))));
+#else
+    uint32_t mask = 0;
+    for (int64_t i = 0; i < GROUP_WIDTH; ++i) {
+      mask |= static_cast<uint32_t>(ctrl_[pos + i] == v) << i;
+    }
+    return mask;
+#endif
+  }
+  OB_INLINE void prefetch(const int64_t pos) const
+  {
+    __builtin_prefetch(ctrl_ + pos, 0/* read */, 2 /*high temp locality*/);
+  }
+
+  uint8_t *ctrl_;
+  int64_t bucket_num_;
+};
+
 class ShortStringAggregator
 {
 public:
@@ -553,10 +639,13 @@ public:
       eval_ctx_(nullptr),
       vector_ptrs_(),
       locate_bucket_(nullptr),
+      locate_pos_(0),
       iter_(*this, group_store_.get_row_meta()),
       probe_cnt_(0),
       max_batch_size_(0),
       locate_buckets_(nullptr),
+      locate_bucket_pos_(nullptr),
+      bucket_ctrl_(),
       new_row_selector_(),
       new_row_selector_cnt_(0),
       change_valid_idx_(),
@@ -760,6 +849,7 @@ public:
       if (OB_FAIL(buckets_->init(bucket_num))) {
         SQL_ENG_LOG(ERROR, "resize bucket array failed", K(size_), K(bucket_num), K(get_bucket_num()));
       }
+      bucket_ctrl_.reuse();
     }
     size_ = 0;
     group_store_.reset();
@@ -784,6 +874,11 @@ public:
       allocator_.free(locate_buckets_);
       locate_buckets_ = nullptr;
     }
+    if (NULL != locate_bucket_pos_) {
+      allocator_.free(locate_bucket_pos_);
+      locate_bucket_pos_ = nullptr;
+    }
+    bucket_ctrl_.destroy(allocator_);
     if (nullptr != srows_) {
       allocator_.free(srows_);
       srows_ = nullptr;
@@ -800,7 +895,7 @@ public:
   }
   int64_t mem_used() const
   {
-    return NULL == buckets_ ? 0 : buckets_->mem_used();
+    return NULL == buckets_ ? 0 : buckets_->mem_used() + bucket_ctrl_.mem_used();
   }
 
   inline int64_t get_bucket_num() const
@@ -860,23 +955,68 @@ public:
                                     const ObCompactRow &left,
                                     const int64_t right_idx,
                                     bool &result) const;
+  int likely_equal_one_fixed64(const RowMeta &row_meta,
+                               const ObCompactRow &left,
+                               const int64_t right_idx,
+                               bool &result) const;
   int extend(const int64_t new_bucket_num);
   const BucketArray *get_buckets() const { return buckets_; }
 protected:
-  // Locate the bucket with the same hash value, or empty bucket if not found.
+  // Locate the position of bucket with the same hash value, or empty bucket if not found.
   // The returned empty bucket is the insert position for the %hash_val
-  OB_INLINE const GroupRowBucket &locate_bucket(const BucketArray &buckets,
-                                                const uint64_t hash_val) const
+  OB_INLINE int64_t locate_bucket_pos(const BucketArray &buckets,
+                                      const ObGroupRowBucketCtrl &ctrl,
+                                      const uint64_t hash_val) const
   {
     const int64_t cnt = buckets.count();
     uint64_t mask_hash = (hash_val & ObGroupRowBucketBase::HASH_VAL_MASK);
     int64_t pos = mask_hash & (cnt - 1);
-    const GroupRowBucket *bucket = &buckets.at(pos);
     // The extend logical make sure the bucket never full, loop count will always less than %cnt
-    while (!bucket->check_hash(mask_hash) && bucket->is_valid()) {
-      bucket = &buckets.at((++pos) & (cnt - 1));
+    if (ctrl.is_valid()) {
+      const uint8_t tag = ObGroupRowBucketCtrl::tag(mask_hash);
+      bool found = false;
+      while (!found) {
+        const uint32_t empty = ctrl.match(pos, ObGroupRowBucketCtrl::EMPTY_CTRL);
+        // probe sequence ends at the first not valid bucket
+        uint32_t candidates = ctrl.match(pos, tag)
+                              & (0 == empty ? UINT16_MAX : ((empty & (~empty + 1)) - 1));
+        for (; !found && 0 != candidates; candidates &= candidates - 1) {
+          const int64_t cur = (pos + __builtin_ctz(candidates)) & (cnt - 1);
+          if (buckets.at(cur).check_hash(mask_hash)) {
+            pos = cur;
+            found = true;
+          }
+        }
+        if (found) {
+        } else if (0 != empty) {
+          pos = (pos + __builtin_ctz(empty)) & (cnt - 1);
+          found = true;
+        } else {
+          pos = (pos + ObGroupRowBucketCtrl::GROUP_WIDTH) & (cnt - 1);
+        }
+      }
+    } else {
+      while (!buckets.at(pos).check_hash(mask_hash) && buckets.at(pos).is_valid()) {
+        pos = (pos + 1) & (cnt - 1);
+      }
     }
-    return *bucket;
+    return pos;
+  }
+  OB_INLINE const GroupRowBucket &locate_bucket(const uint64_t hash_val, int64_t &pos) const
+  {
+    pos = locate_bucket_pos(*buckets_, bucket_ctrl_, hash_val);
+    return buckets_->at(pos);
+  }
+  OB_INLINE const GroupRowBucket &locate_bucket(const uint64_t hash_val) const
+  {
+    int64_t pos = 0;
+    return locate_bucket(hash_val, pos);
+  }
+  OB_INLINE void set_bucket_valid(GroupRowBucket &bucket, const int64_t pos, const uint64_t hash_val)
+  {
+    bucket.set_hash(hash_val);
+    bucket.set_valid();
+    bucket_ctrl_.set(pos, hash_val);
   }
 
 protected:
@@ -899,10 +1039,13 @@ protected:
   static const int64_t HASH_BUCKET_PREFETCH_MAGIC_NUM = 4 * 1024;
   common::ObFixedArray<ObIVector *, common::ObIAllocator> vector_ptrs_;
   GroupRowBucket *locate_bucket_;
+  int64_t locate_pos_;
   Iterator iter_;
   int64_t probe_cnt_;
   int64_t max_batch_size_;
   GroupRowBucket **locate_buckets_;
+  int64_t *locate_bucket_pos_;
+  ObGroupRowBucketCtrl bucket_ctrl_;
   common::ObFixedArray<uint16_t, common::ObIAllocator> new_row_selector_;
   int64_t new_row_selector_cnt_;
   common::ObFixedArray<uint16_t, common::ObIAllocator> change_valid_idx_;
@@ -923,6 +1066,7 @@ int ObExtendHashTableVec<GroupRowBucket>::resize(ObIAllocator *allocator, int64_
       allocator_.free(buckets_);
       buckets_ = NULL;
     }
+    bucket_ctrl_.destroy(allocator_);
     size_ = 0;
     initial_bucket_num_ = 0;
     item_alloc_.reset();
@@ -965,6 +1109,7 @@ int ObExtendHashTableVec<GroupRowBucket>::extend(const int64_t new_bucket_num)
   } else {
     iter_.reset();
     BucketArray *new_buckets = NULL;
+    ObGroupRowBucketCtrl new_ctrl;
     void *buckets_buf = NULL;
     if (OB_ISNULL(buckets_buf = allocator_.alloc(sizeof(BucketArray), mem_attr_))) {
       ret = OB_ALLOCATE_MEMORY_FAILED;
@@ -979,12 +1124,16 @@ int ObExtendHashTableVec<GroupRowBucket>::extend(const int64_t new_bucket_num)
       SQL_ENG_LOG(WARN, "invalid argument", K(ret), K(buckets_));
     } else if (OB_FAIL(new_buckets->init(new_bucket_num))) {
       SQL_ENG_LOG(WARN, "resize bucket array failed", K(ret), K(new_bucket_num));
+    } else if (OB_FAIL(new_ctrl.init(allocator_, mem_attr_, new_bucket_num))) {
+      SQL_ENG_LOG(WARN, "init bucket control bytes failed", K(ret), K(new_bucket_num));
     } else {
       const int64_t size = get_bucket_num();
       for (int64_t i = 0; i < size; i++) {
         const GroupRowBucket &old = buckets_->at(i);
         if (old.is_valid()) {
-          const_cast<GroupRowBucket &>(locate_bucket(*new_buckets, old.get_hash())) = old;
+          int64_t pos = locate_bucket_pos(*new_buckets, new_ctrl, old.get_hash());
+          new_buckets->at(pos) = old;
+          new_ctrl.set(pos, old.get_hash());
         } else if (old.is_occupyed()) {
           ret = OB_ERR_UNEXPECTED;
           LOG_WARN("extend is prepare allocated", K(old.get_hash()));
@@ -995,8 +1144,12 @@ int ObExtendHashTableVec<GroupRowBucket>::extend(const int64_t new_bucket_num)
 
       buckets_ = new_buckets;
       buckets_->set_tenant_id(tenant_id_);
+      bucket_ctrl_.destroy(allocator_);
+      bucket_ctrl_ = new_ctrl;
+      new_ctrl.ctrl_ = nullptr;
     }
     if (OB_FAIL(ret)) {
+      new_ctrl.destroy(allocator_);
       if (buckets_ == new_buckets) {
         SQL_ENG_LOG(ERROR, "unexpected status: failed allocate new bucket", K(ret));
       } else if (nullptr != new_buckets) {
@@ -1038,7 +1191,7 @@ int ObExtendHashTableVec<GroupRowBucket>::get(const RowMeta &row_meta,
   if (OB_UNLIKELY(NULL == buckets_)) {
     // do nothing
   } else {
-    bucket = const_cast<GroupRowBucket *> (&locate_bucket(*buckets_, hash_val));
+    bucket = const_cast<GroupRowBucket *> (&locate_bucket(hash_val));
     if (bucket->is_valid()) {
       RowItemType *it = &(bucket->get_item());
       while (OB_SUCC(ret) && nullptr != it) {
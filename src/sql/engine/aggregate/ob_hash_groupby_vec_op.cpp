@@ -14,6 +14,7 @@
 
 #include "sql/engine/aggregate/ob_hash_groupby_vec_op.h"
 #include "sql/engine/px/ob_px_util.h"
+#include "sql/engine/px/ob_px_sqc_handler.h"
 #include "observer/omt/ob_tenant_config_mgr.h"
 #include "lib/charset/ob_charset.h"
 #include "src/sql/engine/expr/ob_expr_util.h"
@@ -59,6 +60,31 @@ int ObHashGroupByVecSpec::add_group_expr(ObExpr *expr)
   return ret;
 }
 
+int ObHashGroupByVecSpec::register_to_datahub(ObExecContext &ctx) const
+{
+  int ret = OB_SUCCESS;
+  if (by_pass_enabled_) {
+    if (OB_ISNULL(ctx.get_sqc_handler())) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("null unexpected", K(ret));
+    } else {
+      void *buf = ctx.get_allocator().alloc(sizeof(ObGroupByRatioWholeMsg::WholeMsgProvider));
+      if (OB_ISNULL(buf)) {
+        ret = OB_ALLOCATE_MEMORY_FAILED;
+      } else {
+        ObGroupByRatioWholeMsg::WholeMsgProvider *provider =
+          new (buf)ObGroupByRatioWholeMsg::WholeMsgProvider();
+        ObSqcCtx &sqc_ctx = ctx.get_sqc_handler()->get_sqc_ctx();
+        if (OB_FAIL(sqc_ctx.add_whole_msg_provider(get_id(), dtl::DH_GROUPBY_RATIO_WHOLE_MSG,
+                                                   *provider))) {
+          LOG_WARN("fail add whole msg provider", K(ret));
+        }
+      }
+    }
+  }
+  return ret;
+}
+
 void ObHashGroupByVecOp::reset(bool for_rescan)
 {
   curr_group_id_ = common::OB_INVALID_INDEX;
@@ -1206,6 +1232,9 @@ int ObHashGroupByVecOp::load_data_batch(int64_t max_row_cnt)
     cur_part = NULL;
   }
   IGNORE_RETURN sql_mem_processor_.update_used_mem_size(get_mem_used_size());
+  if (OB_SUCC(ret) && MY_SPEC.by_pass_enabled_ && OB_FAIL(sync_by_pass_ratio())) {
+    LOG_WARN("failed to sync by pass ratio", K(ret));
+  }
 
   return ret;
 }
@@ -1922,6 +1951,9 @@ int ObHashGroupByVecOp::by_pass_prepare_one_batch(const int64_t batch_size)
       brs_.all_rows_active_ = (aggr_cnt == brs_.size_);
       agged_row_cnt_ += aggr_cnt;
       agged_group_cnt_ += aggr_cnt;
+      bypass_ctrl_.inc_by_pass_row_cnt(aggr_cnt);
+      op_monitor_info_.otherstat_6_value_ += aggr_cnt;
+      op_monitor_info_.otherstat_6_id_ = ObSqlMonitorStatIds::GROUPBY_BYPASS_ROW_COUNT;
     }
   }
   return ret;
@@ -2033,6 +2065,65 @@ int ObHashGroupByVecOp::init_by_pass_op()
     // to avoid performance decrease, at least deduplicate 2/3
     bypass_ctrl_.set_cut_ratio(std::max(cut_ratio, default_cut_ratio));
     bypass_ctrl_.set_op_id(MY_SPEC.id_);
+    if (NULL != ctx_.get_sqc_handler() && !force_by_pass_) {
+      // groupby ratio datahub messages are only sent when every observer can handle them
+      omt::ObTenantConfigGuard tenant_config(TENANT_CONF(
+                                        ctx_.get_my_session()->get_effective_tenant_id()));
+      if (tenant_config.is_valid() && tenant_config->_px_share_groupby_reduction_ratio) {
+        bypass_ctrl_.open_global_ratio_sync();
+      }
+    }
+  }
+  return ret;
+}
+
+// Report the reduction ratio of the first round to QC, and pick up the global ratio of all
+// workers once it arrives. Never wait for the global ratio: a worker which never opens this
+// operator (e.g. probe side of a hash join with empty build side) would block the others.
+int ObHashGroupByVecOp::sync_by_pass_ratio()
+{
+  int ret = OB_SUCCESS;
+  ObPxSqcHandler *handler = ctx_.get_sqc_handler();
+  const int64_t timeout_ts = ctx_.get_physical_plan_ctx()->get_timeout_timestamp();
+  if (OB_ISNULL(handler)) {
+    // not in px, nothing to sync
+  } else if (bypass_ctrl_.need_report_ratio()) {
+    ObPxSQCProxy &proxy = handler->get_sqc_proxy();
+    ObGroupByRatioPieceMsg piece;
+    const ObGroupByRatioWholeMsg *whole_msg = NULL;
+    piece.op_id_ = MY_SPEC.id_;
+    piece.thread_id_ = GETTID();
+    piece.source_dfo_id_ = proxy.get_dfo_id();
+    piece.target_dfo_id_ = proxy.get_dfo_id();
+    piece.ratio_info_.probe_cnt_ = local_group_rows_.get_probe_cnt();
+    piece.ratio_info_.ndv_cnt_ = local_group_rows_.size();
+    piece.ratio_info_.task_cnt_ = 1;
+    if (OB_FAIL(proxy.get_dh_msg(MY_SPEC.id_, dtl::DH_GROUPBY_RATIO_WHOLE_MSG, piece, whole_msg,
+                                 timeout_ts, true /* send piece */, false /* wait whole msg */))) {
+      LOG_WARN("fail to send groupby ratio piece msg", K(ret));
+    } else {
+      bypass_ctrl_.set_local_ratio(piece.ratio_info_.probe_cnt_, piece.ratio_info_.ndv_cnt_);
+      op_monitor_info_.otherstat_4_value_ = static_cast<int64_t>(bypass_ctrl_.local_ratio_ * 100);
+      op_monitor_info_.otherstat_4_id_ = ObSqlMonitorStatIds::GROUPBY_LOCAL_REDUCTION_RATIO;
+    }
+  } else if (bypass_ctrl_.need_fetch_global_ratio()) {
+    const ObGroupByRatioWholeMsg *whole_msg = NULL;
+    if (OB_FAIL(handler->get_sqc_proxy().try_get_dh_msg(MY_SPEC.id_,
+                                                        dtl::DH_GROUPBY_RATIO_WHOLE_MSG,
+                                                        whole_msg, timeout_ts))) {
+      if (OB_EAGAIN == ret) {
+        ret = OB_SUCCESS;
+      } else {
+        LOG_WARN("fail to get groupby ratio whole msg", K(ret));
+      }
+    } else if (OB_ISNULL(whole_msg)) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("whole msg is unexpected", K(ret));
+    } else {
+      bypass_ctrl_.set_global_ratio(whole_msg->ratio_info_.get_ratio());
+      op_monitor_info_.otherstat_5_value_ = static_cast<int64_t>(bypass_ctrl_.global_ratio_ * 100);
+      op_monitor_info_.otherstat_5_id_ = ObSqlMonitorStatIds::GROUPBY_GLOBAL_REDUCTION_RATIO;
+    }
   }
   return ret;
 }
@@ -22,6 +22,7 @@
 #include "sql/engine/basic/ob_vector_result_holder.h"
 #include "sql/engine/aggregate/ob_groupby_vec_op.h"
 #include "sql/engine/basic/ob_hp_infras_vec_op.h"
+#include "sql/engine/px/datahub/components/ob_dh_groupby_ratio.h"
 
 namespace oceanbase
 {
@@ -57,6 +58,8 @@ public:
   }
   int add_group_expr(ObExpr *expr);
   inline void set_est_group_cnt(const int64_t cnt) { est_group_cnt_ = cnt; }
+  // share the reduction ratio of adaptive group by between workers
+  virtual int register_to_datahub(ObExecContext &ctx) const override;
 private:
   // disallow copy
   DISALLOW_COPY_AND_ASSIGN(ObHashGroupByVecSpec);
@@ -310,6 +313,7 @@ private:
                                          const ObBatchRows *child_brs, ObBatchRows &my_brs,
                                          const int64_t batch_size, bool &insert_group_ht);
   int init_by_pass_op();
+  int sync_by_pass_ratio();
   // Alloc one batch group_row_item at a time
   static const int64_t BATCH_GROUP_ITEM_SIZE = 16;
   // const int64_t EXTEND_BKT_NUM_PUSH_DOWN = INIT_L3_CACHE_SIZE / ObExtendHashTableVec<ObGroupRowBucket>::get_sizeof_aggr_row();
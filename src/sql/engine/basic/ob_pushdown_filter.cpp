@@ -2197,6 +2197,7 @@ int ObDynamicFilterExecutor::init_evaluated_datums()
       static_cast<sql::ObExprJoinFilter::ObExprJoinFilterContext *>(join_filter_ctx_);
   if (is_data_prepared_ && OB_NOT_NULL(join_filter_ctx) && join_filter_ctx->is_partition_wise_jf_) {
     is_data_prepared_ = false;
+    is_in_params_sorted_ = false;
     batch_cnt_ = 0;
     datum_params_.clear();
   }
@@ -2236,6 +2237,20 @@ int ObDynamicFilterExecutor::check_runtime_filter(bool &is_needed)
   return ret;
 }
 
+int ObDynamicFilterExecutor::prepare_skipping_index_data()
+{
+  int ret = OB_SUCCESS;
+  if (is_first_check_) {
+    locate_join_filter_ctx();
+    is_first_check_ = false;
+  }
+  if (!is_data_prepared() && (0 == ((batch_cnt_++) % DEFAULT_CHECK_INTERVAL)) &&
+      OB_FAIL(try_preparing_data())) {
+    LOG_WARN("Failed to try preparing data for skipping index", K(ret));
+  }
+  return ret;
+}
+
 void ObDynamicFilterExecutor::locate_join_filter_ctx()
 {
   const uint64_t op_id = get_filter_node().expr_->expr_ctx_id_;
@@ -2260,6 +2275,8 @@ int ObDynamicFilterExecutor::try_preparing_data()
   } else if (is_data_prepared_) {
     if (OB_FAIL(datum_params_.assign(runtime_filter_params))) {
       LOG_WARN("Failed to assing params for white filter", K(runtime_filter_params));
+    } else if (WHITE_OP_IN == filter_.get_op_type() && OB_FAIL(sort_in_params())) {
+      LOG_WARN("Failed to sort in params", K(ret));
     } else {
       // runtime filter with null equal condition will not be pushed down as white filter,
       // so it's not need to check null params.
@@ -2269,6 +2286,39 @@ int ObDynamicFilterExecutor::try_preparing_data()
   return ret;
 }
 
+// Sorted IN params let the skip index check a block by binary search on [min, max]
+// instead of comparing with every value of the IN list.
+// The params come from the build side, so only sort them if they have the same type
+// as the column, otherwise cmp_func_ (column vs param) can not compare two params.
+int ObDynamicFilterExecutor::sort_in_params()
+{
+  int ret = OB_SUCCESS;
+  is_in_params_sorted_ = false;
+  const ObObjMeta val_meta = get_filter_val_meta();
+  const ObExpr *col_expr = filter_.column_exprs_.count() > 0 ? filter_.column_exprs_.at(0) : nullptr;
+  if (OB_ISNULL(cmp_func_) || OB_ISNULL(col_expr) || datum_params_.count() < 2) {
+  } else if (val_meta.get_type() != col_expr->datum_meta_.type_ ||
+             val_meta.get_collation_type() != col_expr->datum_meta_.cs_type_) {
+  } else {
+    int cmp_ret = OB_SUCCESS;
+    ObDatumCmpFuncType cmp_func = cmp_func_;
+    std::sort(&datum_params_.at(0), &datum_params_.at(0) + datum_params_.count(),
+              [cmp_func, &cmp_ret](const ObDatum &l, const ObDatum &r) {
+                int cmp_res = 0;
+                if (OB_SUCCESS == cmp_ret) {
+                  cmp_ret = cmp_func(l, r, cmp_res);
+                }
+                return cmp_res < 0;
+              });
+    if (OB_FAIL(cmp_ret)) {
+      LOG_WARN("Failed to compare in params", K(ret));
+    } else {
+      is_in_params_sorted_ = true;
+    }
+  }
+  return ret;
+}
+
 //--------------------- end filter executor ----------------------------
 
 
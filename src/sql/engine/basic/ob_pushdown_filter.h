@@ -853,10 +853,14 @@ public:
         join_filter_ctx_(nullptr),
         is_first_check_(true),
         build_obj_type_(ObNullType),
-        filter_action_(DO_FILTER)
+        filter_action_(DO_FILTER),
+        is_in_params_sorted_(false)
   {}
   virtual int init_evaluated_datums() override;
   int check_runtime_filter(bool &is_needed);
+  // Try to fetch the runtime filter data before any micro block is filtered,
+  // so that the skip index can prune blocks as soon as the filter arrives.
+  int prepare_skipping_index_data();
   void filter_on_bypass(ObPushdownFilterExecutor* parent_filter);
   void filter_on_success(ObPushdownFilterExecutor* parent_filter);
   int64_t get_col_idx() const
@@ -877,8 +881,10 @@ public:
   inline bool is_pass_all_data() { return DynamicFilterAction::PASS_ALL == filter_action_; }
   inline bool is_check_all_data() { return DynamicFilterAction::DO_FILTER == filter_action_; }
   inline bool is_data_prepared() const { return is_data_prepared_; }
+  // datum params of the IN runtime filter are sorted by cmp_func_
+  inline bool is_in_params_sorted() const { return is_in_params_sorted_; }
   INHERIT_TO_STRING_KV("ObDynamicFilterExecutor", ObWhiteFilterExecutor, K_(is_data_prepared),
-                       K_(batch_cnt), KP_(join_filter_ctx));
+                       K_(batch_cnt), KP_(join_filter_ctx), K_(is_in_params_sorted));
 public:
   using ObRuntimeFilterParams = common::ObSEArray<common::ObDatum, 4>;
   typedef int (*PreparePushdownDataFunc) (const ObExpr &expr,
@@ -890,6 +896,7 @@ public:
       PREPARE_PD_DATA_FUNCS[PreparePushdownDataFuncType::MAX_PREPARE_DATA_FUNC_TYPE];
 private:
   int try_preparing_data();
+  int sort_in_params();
   void update_rf_slide_window();
 private:
   bool is_data_prepared_;
@@ -898,6 +905,7 @@ private:
   bool is_first_check_;
   ObObjType build_obj_type_; // for runtime filter, the datum_params_ are from the build table
   DynamicFilterAction filter_action_;
+  bool is_in_params_sorted_;
 };
 
 class ObFilterExecutorConstructor
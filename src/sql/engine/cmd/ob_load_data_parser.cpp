@@ -30,6 +30,7 @@ const char INVALID_TERM_CHAR = '\xff';
 
 const char * FORMAT_TYPE_STR[] = {
   "CSV",
+  "PARQUET",
 };
 static_assert(array_elements(FORMAT_TYPE_STR) == ObExternalFileFormat::MAX_FORMAT, "Not enough initializer for ObExternalFileFormat");
 
@@ -105,6 +106,17 @@ int ObCSVGeneralParser::init_opt_variables()
         && !opt_param_.is_same_escape_enclosed_
         && format_.field_enclosed_char_ == INT64_MAX;
 
+    // tail bytes of gbk, gb18030 and utf16 chars may be the same as ascii special chars
+    opt_param_.can_skip_plain_bytes_ = common::CHARSET_UTF8MB4 == format_.cs_type_
+        || common::CHARSET_BINARY == format_.cs_type_
+        || common::CHARSET_LATIN1 == format_.cs_type_;
+    opt_param_.stop_at_non_ascii_ = common::CHARSET_UTF8MB4 == format_.cs_type_;
+    opt_param_.special_chars_[0] = opt_param_.field_term_c_;
+    opt_param_.special_chars_[1] = opt_param_.line_term_c_;
+    opt_param_.special_chars_[2] = format_.field_escaped_char_ == INT64_MAX
+        ? opt_param_.field_term_c_ : static_cast<char>(format_.field_escaped_char_);
+    opt_param_.special_chars_[3] = format_.field_enclosed_char_ == INT64_MAX
+        ? opt_param_.field_term_c_ : static_cast<char>(format_.field_enclosed_char_);
   }
 
   if (OB_SUCC(ret) && OB_FAIL(fields_per_line_.prepare_allocate(format_.file_column_nums_))) {
@@ -346,6 +358,8 @@ int64_t ObExternalFileFormat::to_string(char *buf, const int64_t buf_len) const
       pos += csv_format_.to_json_kv_string(buf + pos, buf_len - pos);
       pos += origin_file_format_str_.to_json_kv_string(buf + pos, buf_len - pos);
       break;
+    case PARQUET_FORMAT:
+      break;
     default:
       pos = 0;
   }
@@ -389,6 +403,8 @@ int ObExternalFileFormat::load_from_string(const ObString &str, ObIAllocator &al
           OZ (csv_format_.load_from_json_data(format_type_node, allocator));
           OZ (origin_file_format_str_.load_from_json_data(format_type_node, allocator));
           break;
+        case PARQUET_FORMAT:
+          break;
         default:
           ret = OB_ERR_UNEXPECTED;
           LOG_WARN("invalid format type", K(ret), K(format_type_str));
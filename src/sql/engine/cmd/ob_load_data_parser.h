@@ -19,6 +19,10 @@
 #ifndef _OB_LOAD_DATA_PARSER_H_
 #define _OB_LOAD_DATA_PARSER_H_
 
+#if defined(__x86_64__)
+#include <emmintrin.h>
+#endif
+
 namespace oceanbase
 {
 namespace sql
@@ -106,11 +110,15 @@ public:
     TO_STRING_KV(KP(ptr_), K(len_), K(flags_), "string", common::ObString(len_, ptr_));
   };
   struct OptParams {
+    static const int64_t SPECIAL_CHAR_CNT = 4;
     OptParams() : line_term_c_(0), field_term_c_(0),
       is_filling_zero_to_empty_field_(false),
       is_line_term_by_counting_field_(false),
       is_same_escape_enclosed_(false),
-      is_simple_format_(false)
+      is_simple_format_(false),
+      can_skip_plain_bytes_(false),
+      stop_at_non_ascii_(false),
+      special_chars_()
     {}
     char line_term_c_;
     char field_term_c_;
@@ -118,6 +126,12 @@ public:
     bool is_line_term_by_counting_field_;
     bool is_same_escape_enclosed_;
     bool is_simple_format_;
+    // bytes other than special chars can be skipped in batch if a char never contains special
+    // chars in its tail bytes, non ascii bytes are not skipped if the char may be multi-byte
+    bool can_skip_plain_bytes_;
+    bool stop_at_non_ascii_;
+    // first byte of field term and line term, escaped char and enclosed char
+    char special_chars_[SPECIAL_CHAR_CNT];
   };
 public:
   ObCSVGeneralParser() {}
@@ -236,6 +250,41 @@ private:
     }
   }
 
+  // return the first byte at or after str which may be a special char
+  inline const char *skip_plain_bytes(const char *str, const char *end) const {
+#if defined(__x86_64__)
+    const __m128i c0 = _mm_set1_epi8(opt_param_.special_chars_[0]);
+    const __m128i c1 = _mm_set1_epi8(opt_param_.special_chars_[1]);
+    const __m128i c2 = _mm_set1_epi8(opt_param_.special_chars_[2]);
+    const __m128i c3 = _mm_set1_epi8(opt_param_.special_chars_[3]);
+    const int non_ascii_mask = opt_param_.stop_at_non_ascii_ ? 0xFFFF : 0;
+    bool found = false;
+    while (!found && str + sizeof(__m128i) <= end) {
+      const __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i *>(str));
+      const int mask = _mm_movemask_epi8(_mm_or_si128(
+          _mm_or_si128(_mm_cmpeq_epi8(data, c0), _mm_cmpeq_epi8(data, c1)),
+          _mm_or_si128(_mm_cmpeq_epi8(data, c2), _mm_cmpeq_epi8(data, c3))))
+          | (_mm_movemask_epi8(data) & non_ascii_mask);
+      if (0 != mask) {
+        str += __builtin_ctz(mask);
+        found = true;
+      } else {
+        str += sizeof(__m128i);
+      }
+    }
+#endif
+    while (str < end && !is_special_byte(*str)) {
+      str++;
+    }
+    return str;
+  }
+
+  inline bool is_special_byte(const char c) const {
+    return opt_param_.special_chars_[0] == c || opt_param_.special_chars_[1] == c
+           || opt_param_.special_chars_[2] == c || opt_param_.special_chars_[3] == c
+           || (opt_param_.stop_at_non_ascii_ && static_cast<unsigned char>(c) >= 0x80);
+  }
+
   inline bool is_escape_next(const bool is_enclosed, const char cur, const char next) {
     // 1. the next char escaped by escape_char "A\tB" => A  B
     // 2. enclosed char escaped by another enclosed char in enclosed field. E.g. "A""B" => A"B
@@ -353,6 +402,12 @@ int ObCSVGeneralParser::scan_proto(const char *&str,
         str++;
       }
       while (str < end && !is_term) {
+        if (opt_param_.can_skip_plain_bytes_) {
+          str = skip_plain_bytes(str, end);
+          if (str >= end) {
+            break;
+          }
+        }
         const char *next = str + 1;
         if (next < end && is_escape_next(is_enclosed, *str, *next)) {
           if (NEED_ESCAPED_RESULT) {
@@ -495,6 +550,7 @@ struct ObExternalFileFormat
   enum FormatType {
     INVALID_FORMAT = -1,
     CSV_FORMAT,
+    PARQUET_FORMAT,
     MAX_FORMAT
   };
 
@@ -75,6 +75,8 @@ int JoinHashTable::init(JoinTableCtx &hjt_ctx, ObIAllocator &allocator)
     LOG_WARN("fail to new hash table", K(ret));
   } else if (OB_FAIL(hash_table_->init(allocator, hjt_ctx.max_batch_size_))) {
     LOG_WARN("alloc bucket array failed", K(ret));
+  } else {
+    alloc_ = &allocator;
   }
   return ret;
 }
@@ -83,10 +85,61 @@ int JoinHashTable::build_prepare(int64_t row_count, int64_t bucket_count) {
   return hash_table_->build_prepare(row_count, bucket_count);
 }
 
+// Shared hash table is built by all threads of sqc concurrently, the allocator of the
+// table is not thread safe, so radix build is only used for the private hash table.
+bool JoinHashTable::use_radix_build(JoinTableCtx &ctx)
+{
+  return !ctx.is_shared_
+         && NULL != alloc_
+         && ObHJRadixPartitioner::need_radix_build(hash_table_->get_nbuckets(),
+                                                   hash_table_->get_one_bucket_size());
+}
+
 int JoinHashTable::build(JoinPartitionRowIter &iter, JoinTableCtx &ctx) {
   int ret = OB_SUCCESS;
   int64_t used_buckets = 0;
   int64_t collisions = 0;
+  if (use_radix_build(ctx)) {
+    ret = radix_build(iter, ctx);
+  } else {
+    while (OB_SUCC(ret)) {
+      int64_t read_size = 0;
+      if (OB_FAIL(iter.get_next_batch(ctx.stored_rows_,
+                                      ctx.max_batch_size_,
+                                      read_size))) {
+        if (OB_ITER_END != ret) {
+          LOG_WARN("get next batch failed", K(ret));
+        }
+      } else if (OB_FAIL(hash_table_->insert_batch(ctx,
+              const_cast<ObHJStoredRow **>(ctx.stored_rows_), read_size, used_buckets, collisions))) {
+        LOG_WARN("fail to insert batch", K(ret));
+      }
+      LOG_DEBUG("build hash join table", K(read_size), K(ret));
+    }
+    hash_table_->set_diag_info(used_buckets, collisions);
+
+    if (OB_ITER_END == ret) {
+      ret = OB_SUCCESS;
+    }
+  }
+
+  return ret;
+}
+
+// Radix partitioned build:
+//   1. buffer all build rows of the iterator
+//   2. scatter rows by the high bits of bucket position, each partition covers L2 size buckets
+//   3. insert rows partition by partition, so the bucket writes are cache resident
+int JoinHashTable::radix_build(JoinPartitionRowIter &iter, JoinTableCtx &ctx)
+{
+  int ret = OB_SUCCESS;
+  int64_t used_buckets = 0;
+  int64_t collisions = 0;
+  ObHJRadixPartitioner partitioner(*alloc_);
+  partitioner.set_callback(ctx.mem_callback_);
+  if (OB_FAIL(partitioner.init(hash_table_->get_nbuckets(), hash_table_->get_one_bucket_size()))) {
+    LOG_WARN("failed to init radix partitioner", K(ret));
+  }
   while (OB_SUCC(ret)) {
     int64_t read_size = 0;
     if (OB_FAIL(iter.get_next_batch(ctx.stored_rows_,
@@ -95,18 +148,33 @@ int JoinHashTable::build(JoinPartitionRowIter &iter, JoinTableCtx &ctx) {
       if (OB_ITER_END != ret) {
         LOG_WARN("get next batch failed", K(ret));
       }
-    } else if (OB_FAIL(hash_table_->insert_batch(ctx,
-            const_cast<ObHJStoredRow **>(ctx.stored_rows_), read_size, used_buckets, collisions))) {
-      LOG_WARN("fail to insert batch", K(ret));
+    } else if (OB_FAIL(partitioner.add_batch(ctx.stored_rows_, read_size))) {
+      LOG_WARN("failed to add batch to radix partitioner", K(ret));
     }
-    LOG_DEBUG("build hash join table", K(read_size), K(ret));
   }
-  hash_table_->set_diag_info(used_buckets, collisions);
-
   if (OB_ITER_END == ret) {
     ret = OB_SUCCESS;
   }
-
+  if (OB_FAIL(ret)) {
+  } else if (OB_FAIL(partitioner.partition(ctx.build_row_meta_))) {
+    LOG_WARN("failed to radix partition build rows", K(ret));
+  } else {
+    for (int64_t part_idx = 0; OB_SUCC(ret) && part_idx < partitioner.get_part_count(); part_idx++) {
+      ObHJRadixPartitioner::RowPtr *rows = NULL;
+      int64_t row_cnt = 0;
+      partitioner.get_part(part_idx, rows, row_cnt);
+      for (int64_t start = 0; OB_SUCC(ret) && start < row_cnt; start += ctx.max_batch_size_) {
+        int64_t size = std::min(ctx.max_batch_size_, row_cnt - start);
+        if (OB_FAIL(hash_table_->insert_batch(ctx,
+                const_cast<ObHJStoredRow **>(rows + start), size, used_buckets, collisions))) {
+          LOG_WARN("fail to insert batch", K(ret), K(part_idx));
+        }
+      }
+    }
+  }
+  hash_table_->set_diag_info(used_buckets, collisions);
+  LOG_TRACE("radix build hash join table", K(ret), K(partitioner),
+            K(hash_table_->get_nbuckets()), K(used_buckets), K(collisions));
   return ret;
 }
 
@@ -14,6 +14,7 @@
 #define SRC_SQL_ENGINE_JOIN_HASH_JOIN_JOIN_HASH_TABLE_H_
 
 #include "sql/engine/join/hash_join/hash_table.h"
+#include "sql/engine/join/hash_join/ob_hj_radix_partitioner.h"
 
 namespace oceanbase
 {
@@ -22,12 +23,13 @@ namespace sql
 
 class JoinHashTable {
 public:
-  JoinHashTable() : hash_table_(NULL)
+  JoinHashTable() : hash_table_(NULL), alloc_(NULL)
   {}
   int init(JoinTableCtx &hjt_ctx, ObIAllocator &allocator);
   bool use_normalized_ht(JoinTableCtx &hjt_ctx);
   int build_prepare(int64_t row_count, int64_t bucket_count);
   int build(JoinPartitionRowIter &iter, JoinTableCtx &jt_ctx);
+  bool use_radix_build(JoinTableCtx &jt_ctx);
   int probe_prepare(JoinTableCtx &ctx, OutputInfo &output_info);
   int probe_batch(JoinTableCtx &ctx, OutputInfo &output_info);
   int project_matched_rows(JoinTableCtx &ctx, OutputInfo &output_info) {
@@ -53,8 +55,13 @@ public:
   int64_t get_nbuckets() { return hash_table_->get_nbuckets(); }
   int64_t get_collisions() { return hash_table_->get_collisions(); }
 
+private:
+  int radix_build(JoinPartitionRowIter &iter, JoinTableCtx &jt_ctx);
+
 private:
   IHashTable *hash_table_;
+  // used for temporary memory of radix partitioned build
+  ObIAllocator *alloc_;
 };
 
 } // end namespace sql
@@ -18,6 +18,7 @@
 #include "share/ob_define.h"
 #include "sql/ob_sql_define.h"
 #include "sql/engine/basic/ob_compact_row.h"
+#include "sql/engine/basic/ob_sql_mem_callback.h"
 #include "sql/engine/ob_batch_rows.h"
 #include "sql/engine/expr/ob_expr.h"
 #include "sql/engine/ob_bit_vector.h"
@@ -214,7 +215,7 @@ public:
                    build_key_proj_(NULL), probe_key_proj_(NULL), cur_bkid_(-1),
                    cur_tuple_(reinterpret_cast<void *>(END_ITEM)), max_output_cnt_(NULL),
                    cur_items_(NULL), stored_rows_(NULL), max_batch_size_(0),
-                   output_info_(NULL), probe_batch_rows_(NULL)
+                   output_info_(NULL), probe_batch_rows_(NULL), mem_callback_(NULL)
   {}
   void reuse() {
     cur_bkid_ = -1;
@@ -275,6 +276,8 @@ public:
 
   OutputInfo *output_info_;
   ProbeBatchRows *probe_batch_rows_;
+  // temporary memory of building hash table is reported to the sql memory manager
+  ObSqlMemoryCallback *mem_callback_;
 };
 
 struct ObHJSharedTableInfo
@@ -314,6 +314,7 @@ int ObHashJoinVecOp::init_join_table_ctx()
     jt_ctx_.output_info_ = &output_info_;
     jt_ctx_.probe_batch_rows_ = &probe_batch_rows_;
     jt_ctx_.probe_opt_ = MY_SPEC.can_prob_opt_;
+    jt_ctx_.mem_callback_ = &sql_mem_processor_;
   }
   jt_ctx_.contain_ns_equal_ = false;
   for (int64_t i = 0; !jt_ctx_.contain_ns_equal_ && i < MY_SPEC.is_ns_equal_cond_.count(); i++) {
@@ -0,0 +1,154 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL_ENG
+
+#include "sql/engine/join/hash_join/ob_hj_radix_partitioner.h"
+
+namespace oceanbase
+{
+namespace sql
+{
+
+int64_t ObHJRadixPartitioner::calc_radix_bits(const int64_t nbuckets, const int64_t bucket_size)
+{
+  int64_t bits = 0;
+  const int64_t l2_size = get_level2_cache_size();
+  if (nbuckets > 0 && bucket_size > 0 && l2_size > 0) {
+    int64_t part_cnt = nbuckets * bucket_size / l2_size;
+    while ((1L << (bits + 1)) <= part_cnt
+           && bits < MAX_RADIX_BITS
+           && (1L << (bits + 1)) <= nbuckets) {
+      ++bits;
+    }
+  }
+  return bits;
+}
+
+int ObHJRadixPartitioner::init(const int64_t nbuckets, const int64_t bucket_size)
+{
+  int ret = OB_SUCCESS;
+  if (nbuckets <= 0 || 0 != (nbuckets & (nbuckets - 1))) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid bucket number", K(ret), K(nbuckets));
+  } else {
+    reset();
+    radix_bits_ = calc_radix_bits(nbuckets, bucket_size);
+    bucket_mask_ = nbuckets - 1;
+    shift_ = __builtin_ctzll(nbuckets) - radix_bits_;
+  }
+  return ret;
+}
+
+int ObHJRadixPartitioner::add_batch(const ObHJStoredRow **rows, const int64_t size)
+{
+  int ret = OB_SUCCESS;
+  if (row_cnt_ + size > row_cap_) {
+    int64_t new_cap = std::max(row_cap_ * 2, std::max(row_cnt_ + size, INIT_ROW_CAPACITY));
+    RowPtr *new_rows = static_cast<RowPtr *>(alloc_mem(sizeof(RowPtr) * new_cap));
+    if (OB_ISNULL(new_rows)) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("failed to alloc row array", K(ret), K(new_cap));
+    } else {
+      if (row_cnt_ > 0) {
+        MEMCPY(new_rows, rows_, sizeof(RowPtr) * row_cnt_);
+      }
+      free_mem(rows_, sizeof(RowPtr) * row_cap_);
+      rows_ = new_rows;
+      row_cap_ = new_cap;
+    }
+  }
+  if (OB_SUCC(ret) && size > 0) {
+    MEMCPY(rows_ + row_cnt_, rows, sizeof(RowPtr) * size);
+    row_cnt_ += size;
+  }
+  return ret;
+}
+
+int ObHJRadixPartitioner::partition(const RowMeta &row_meta)
+{
+  int ret = OB_SUCCESS;
+  const int64_t part_cnt = get_part_count();
+  const int64_t swwc_cnt = ObRadixScatter<RowPtr>::SWWC_CNT;
+  const int64_t rows_size = sizeof(RowPtr) * row_cnt_ + CACHE_ALIGN_SIZE;
+  const int64_t offsets_size = sizeof(int64_t) * (part_cnt + 1);
+  const int64_t scratch_size = sizeof(RowPtr) * part_cnt * swwc_cnt + sizeof(int64_t) * part_cnt;
+  char *scratch = NULL;
+  if (OB_ISNULL(part_rows_buf_ = alloc_mem(rows_size))
+      || FALSE_IT(part_rows_buf_size_ = rows_size)
+      || OB_ISNULL(part_offsets_ = static_cast<int64_t *>(alloc_mem(offsets_size)))
+      || OB_ISNULL(scratch = static_cast<char *>(alloc_mem(scratch_size)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("failed to alloc radix partition memory", K(ret), K(row_cnt_), K(part_cnt));
+  } else {
+    part_rows_ = reinterpret_cast<RowPtr *>(
+        upper_align_buf(static_cast<char *>(part_rows_buf_), CACHE_ALIGN_SIZE));
+    RowPtr *bufs = reinterpret_cast<RowPtr *>(scratch);
+    int64_t *pos = reinterpret_cast<int64_t *>(scratch + sizeof(RowPtr) * part_cnt * swwc_cnt);
+    GetPart get_part(row_meta, bucket_mask_, shift_);
+    // histogram to exclusive prefix sum
+    MEMSET(part_offsets_, 0, offsets_size);
+    ObRadixScatter<RowPtr>::histogram(rows_, row_cnt_, get_part, part_offsets_ + 1);
+    for (int64_t i = 1; i <= part_cnt; i++) {
+      part_offsets_[i] += part_offsets_[i - 1];
+    }
+    ObRadixScatter<RowPtr>::scatter(rows_, row_cnt_, get_part, part_cnt,
+                                    part_offsets_, bufs, pos, part_rows_);
+  }
+  free_mem(scratch, scratch_size);
+  // arrival order rows are useless from now on
+  free_mem(rows_, sizeof(RowPtr) * row_cap_);
+  rows_ = NULL;
+  row_cap_ = 0;
+  LOG_TRACE("radix partition build rows", K(ret), K(*this));
+  return ret;
+}
+
+void ObHJRadixPartitioner::reset()
+{
+  free_mem(rows_, sizeof(RowPtr) * row_cap_);
+  rows_ = NULL;
+  free_mem(part_rows_buf_, part_rows_buf_size_);
+  part_rows_buf_ = NULL;
+  part_rows_buf_size_ = 0;
+  free_mem(part_offsets_, sizeof(int64_t) * (get_part_count() + 1));
+  part_offsets_ = NULL;
+  part_rows_ = NULL;
+  row_cnt_ = 0;
+  row_cap_ = 0;
+}
+
+void *ObHJRadixPartitioner::alloc_mem(const int64_t size)
+{
+  void *buf = alloc_.alloc(size);
+  if (OB_NOT_NULL(buf)) {
+    mem_used_ += size;
+    if (OB_NOT_NULL(callback_)) {
+      callback_->alloc(size);
+    }
+  }
+  return buf;
+}
+
+void ObHJRadixPartitioner::free_mem(void *buf, const int64_t size)
+{
+  if (OB_NOT_NULL(buf)) {
+    alloc_.free(buf);
+    mem_used_ -= size;
+    if (OB_NOT_NULL(callback_)) {
+      callback_->free(size);
+    }
+  }
+}
+
+} // end namespace sql
+} // end namespace oceanbase
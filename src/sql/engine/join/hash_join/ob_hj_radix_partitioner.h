@@ -0,0 +1,175 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef SRC_SQL_ENGINE_JOIN_HASH_JOIN_OB_HJ_RADIX_PARTITIONER_H_
+#define SRC_SQL_ENGINE_JOIN_HASH_JOIN_OB_HJ_RADIX_PARTITIONER_H_
+
+#include "lib/allocator/ob_allocator.h"
+#include "lib/utility/utility.h"
+#include "sql/engine/basic/ob_sql_mem_callback.h"
+#include "sql/engine/join/hash_join/ob_hash_join_struct.h"
+
+namespace oceanbase
+{
+namespace sql
+{
+
+// Radix scatter with software write-combining buffers.
+//
+// Every partition owns one cache line of buffered elements, an output cache line is written
+// only when the buffer is full, so the scatter touches at most one line per partition
+// instead of one random line per element.
+//
+// %dst must be aligned to CACHE_ALIGN_SIZE, %offsets is the start position of each partition
+// in %dst (exclusive prefix sum of the histogram).
+template <typename T>
+struct ObRadixScatter
+{
+  static const int64_t SWWC_CNT = CACHE_ALIGN_SIZE / sizeof(T);
+  STATIC_ASSERT(0 == (SWWC_CNT & (SWWC_CNT - 1)), "write combining buffer must be power of 2");
+
+  template <typename GetPart>
+  static void histogram(const T *src, const int64_t cnt, GetPart &get_part, int64_t *hist)
+  {
+    for (int64_t i = 0; i < cnt; i++) {
+      hist[get_part(src[i])] += 1;
+    }
+  }
+
+  // %bufs: part_cnt * SWWC_CNT elements, %pos: part_cnt elements, both are scratch memory.
+  template <typename GetPart>
+  static void scatter(const T *src,
+                      const int64_t cnt,
+                      GetPart &get_part,
+                      const int64_t part_cnt,
+                      const int64_t *offsets,
+                      T *bufs,
+                      int64_t *pos,
+                      T *dst)
+  {
+    const int64_t mask = SWWC_CNT - 1;
+    for (int64_t p = 0; p < part_cnt; p++) {
+      pos[p] = offsets[p];
+    }
+    for (int64_t i = 0; i < cnt; i++) {
+      const int64_t p = get_part(src[i]);
+      T *buf = bufs + p * SWWC_CNT;
+      buf[pos[p] & mask] = src[i];
+      pos[p] += 1;
+      if (0 == (pos[p] & mask)) {
+        // the first line of a partition may be shared with the previous partition
+        const int64_t line_start = std::max(pos[p] - SWWC_CNT, offsets[p]);
+        const int64_t slot = line_start & mask;
+        MEMCPY(dst + line_start, buf + slot, (SWWC_CNT - slot) * sizeof(T));
+      }
+    }
+    // flush the remaining partial lines
+    for (int64_t p = 0; p < part_cnt; p++) {
+      const int64_t line_start = std::max(pos[p] & ~mask, offsets[p]);
+      if (pos[p] > line_start) {
+        const int64_t slot = line_start & mask;
+        MEMCPY(dst + line_start, bufs + p * SWWC_CNT + slot, (pos[p] - line_start) * sizeof(T));
+      }
+    }
+  }
+};
+
+// Radix partitioned build of the in-memory hash table.
+//
+// When the bucket array is much larger than the last level cache, inserting build rows in
+// arrival order touches one random bucket per row and the build is bound by cache misses.
+// The partitioner buffers the build rows and scatters them by the high bits of their bucket
+// position, so every partition covers a bucket range of about the L2 cache size and the rows
+// can be inserted partition by partition. The hash table layout is unchanged.
+class ObHJRadixPartitioner
+{
+public:
+  typedef const ObHJStoredRow * RowPtr;
+  // each partition covers about L2 size of buckets
+  static const int64_t MAX_RADIX_BITS = 10;
+  static const int64_t INIT_ROW_CAPACITY = 1024;
+
+  explicit ObHJRadixPartitioner(common::ObIAllocator &alloc)
+    : alloc_(alloc), callback_(NULL), mem_used_(0), radix_bits_(0), shift_(0), bucket_mask_(0),
+      rows_(NULL), row_cnt_(0), row_cap_(0),
+      part_rows_(NULL), part_rows_buf_(NULL), part_rows_buf_size_(0), part_offsets_(NULL)
+  {}
+  ~ObHJRadixPartitioner() { reset(); }
+
+  // radix build pays off only if the bucket array is larger than the last level cache
+  static bool need_radix_build(const int64_t nbuckets, const int64_t bucket_size)
+  {
+    return nbuckets * bucket_size > get_level3_cache_size()
+           && calc_radix_bits(nbuckets, bucket_size) > 0;
+  }
+  static int64_t calc_radix_bits(const int64_t nbuckets, const int64_t bucket_size);
+
+  int init(const int64_t nbuckets, const int64_t bucket_size);
+  // the row arrays are reported to %callback, the sql memory manager of the join
+  void set_callback(ObSqlMemoryCallback *callback) { callback_ = callback; }
+  int add_batch(const ObHJStoredRow **rows, const int64_t size);
+  int partition(const RowMeta &row_meta);
+  int64_t get_part_count() const { return 1L << radix_bits_; }
+  int64_t get_row_count() const { return row_cnt_; }
+  int64_t get_mem_used() const { return mem_used_; }
+  void get_part(const int64_t part_idx, RowPtr *&rows, int64_t &row_cnt) const
+  {
+    rows = part_rows_ + part_offsets_[part_idx];
+    row_cnt = part_offsets_[part_idx + 1] - part_offsets_[part_idx];
+  }
+  void reset();
+
+  TO_STRING_KV(K_(radix_bits), K_(shift), K_(row_cnt), K_(row_cap), K_(mem_used));
+
+private:
+  struct GetPart
+  {
+    GetPart(const RowMeta &row_meta, const uint64_t bucket_mask, const int64_t shift)
+      : row_meta_(row_meta), bucket_mask_(bucket_mask), shift_(shift)
+    {}
+    OB_INLINE int64_t operator()(RowPtr row) const
+    {
+      return (row->get_hash_value(row_meta_) & bucket_mask_) >> shift_;
+    }
+    const RowMeta &row_meta_;
+    const uint64_t bucket_mask_;
+    const int64_t shift_;
+  };
+
+private:
+  void *alloc_mem(const int64_t size);
+  void free_mem(void *buf, const int64_t size);
+
+private:
+  common::ObIAllocator &alloc_;
+  ObSqlMemoryCallback *callback_;
+  int64_t mem_used_;
+  int64_t radix_bits_;
+  int64_t shift_;
+  uint64_t bucket_mask_;
+  // build rows in arrival order
+  RowPtr *rows_;
+  int64_t row_cnt_;
+  int64_t row_cap_;
+  // build rows clustered by partition, cache aligned
+  RowPtr *part_rows_;
+  void *part_rows_buf_;
+  int64_t part_rows_buf_size_;
+  // part_count + 1 elements, start offset of each partition in %part_rows_
+  int64_t *part_offsets_;
+  DISALLOW_COPY_AND_ASSIGN(ObHJRadixPartitioner);
+};
+
+} // end namespace sql
+} // end namespace oceanbase
+
+#endif /* SRC_SQL_ENGINE_JOIN_HASH_JOIN_OB_HJ_RADIX_PARTITIONER_H_*/
@@ -0,0 +1,105 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL_ENG
+#include "sql/engine/px/datahub/components/ob_dh_groupby_ratio.h"
+#include "sql/engine/px/datahub/ob_dh_msg_ctx.h"
+#include "sql/engine/px/ob_dfo.h"
+#include "sql/engine/px/ob_px_util.h"
+#include "sql/engine/px/datahub/ob_dh_msg.h"
+
+using namespace oceanbase::sql;
+using namespace oceanbase::common;
+
+OB_SERIALIZE_MEMBER(ObGroupByRatioInfo, probe_cnt_, ndv_cnt_, task_cnt_);
+OB_SERIALIZE_MEMBER((ObGroupByRatioPieceMsg, ObDatahubPieceMsg), ratio_info_);
+OB_SERIALIZE_MEMBER((ObGroupByRatioWholeMsg, ObDatahubWholeMsg), ratio_info_);
+
+int ObGroupByRatioPieceMsgListener::on_message(
+    ObGroupByRatioPieceMsgCtx &ctx,
+    common::ObIArray<ObPxSqcMeta *> &sqcs,
+    const ObGroupByRatioPieceMsg &pkt)
+{
+  int ret = OB_SUCCESS;
+  if (pkt.op_id_ != ctx.op_id_) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("unexpected piece msg", K(pkt), K(ctx));
+  } else if (ctx.received_ >= ctx.task_cnt_) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("should not receive any more pkt. already get all pkt expected",
+             K(pkt), K(ctx));
+  } else {
+    ctx.whole_msg_.ratio_info_.merge(pkt.ratio_info_);
+    ctx.received_++;
+    LOG_TRACE("got a groupby ratio piece msg", "all_got", ctx.received_,
+              "expected", ctx.task_cnt_, K(pkt));
+  }
+  if (OB_SUCC(ret) && ctx.received_ == ctx.task_cnt_) {
+    if (OB_FAIL(ctx.send_whole_msg(sqcs))) {
+      LOG_WARN("fail to send whole msg", K(ret));
+    }
+    IGNORE_RETURN ctx.reset_resource();
+  }
+  return ret;
+}
+
+int ObGroupByRatioPieceMsgCtx::alloc_piece_msg_ctx(const ObGroupByRatioPieceMsg &pkt,
+                                                   ObPxCoordInfo &,
+                                                   ObExecContext &ctx,
+                                                   int64_t task_cnt,
+                                                   ObPieceMsgCtx *&msg_ctx)
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(ctx.get_physical_plan_ctx())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("physical plan ctx is null", K(ret));
+  } else {
+    void *buf = ctx.get_allocator().alloc(sizeof(ObGroupByRatioPieceMsgCtx));
+    if (OB_ISNULL(buf)) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+    } else {
+      msg_ctx = new (buf) ObGroupByRatioPieceMsgCtx(pkt.op_id_, task_cnt,
+          ctx.get_physical_plan_ctx()->get_timeout_timestamp());
+    }
+  }
+  return ret;
+}
+
+int ObGroupByRatioPieceMsgCtx::send_whole_msg(common::ObIArray<ObPxSqcMeta *> &sqcs)
+{
+  int ret = OB_SUCCESS;
+  whole_msg_.op_id_ = op_id_;
+  ARRAY_FOREACH_X(sqcs, idx, cnt, OB_SUCC(ret)) {
+    dtl::ObDtlChannel *ch = sqcs.at(idx)->get_qc_channel();
+    if (OB_ISNULL(ch)) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("null expected", K(ret));
+    } else if (OB_FAIL(ch->send(whole_msg_, timeout_ts_))) {
+      LOG_WARN("fail push data to channel", K(ret));
+    } else if (OB_FAIL(ch->flush(true, false))) {
+      LOG_WARN("fail flush dtl data", K(ret));
+    } else {
+      LOG_DEBUG("dispatched groupby ratio whole msg",
+                K(idx), K(cnt), K(whole_msg_), K(*ch));
+    }
+  }
+  if (OB_SUCC(ret) && OB_FAIL(ObPxChannelUtil::sqcs_channles_asyn_wait(sqcs))) {
+    LOG_WARN("failed to wait response", K(ret));
+  }
+  return ret;
+}
+
+void ObGroupByRatioPieceMsgCtx::reset_resource()
+{
+  whole_msg_.reset();
+  received_ = 0;
+}
@@ -0,0 +1,139 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef __OB_SQL_ENG_PX_DH_GROUPBY_RATIO_H__
+#define __OB_SQL_ENG_PX_DH_GROUPBY_RATIO_H__
+
+#include "sql/engine/px/datahub/ob_dh_msg.h"
+#include "sql/engine/px/datahub/ob_dh_dtl_proc.h"
+#include "sql/engine/px/datahub/ob_dh_msg_ctx.h"
+#include "sql/engine/px/datahub/ob_dh_msg_provider.h"
+
+namespace oceanbase
+{
+namespace sql
+{
+
+class ObGroupByRatioPieceMsg;
+class ObGroupByRatioWholeMsg;
+typedef ObPieceMsgP<ObGroupByRatioPieceMsg> ObGroupByRatioPieceMsgP;
+typedef ObWholeMsgP<ObGroupByRatioWholeMsg> ObGroupByRatioWholeMsgP;
+class ObGroupByRatioPieceMsgListener;
+class ObGroupByRatioPieceMsgCtx;
+class ObPxCoordInfo;
+
+// Reduction info of the partial (pushdown) hash group by of one worker,
+// probe_cnt_ rows are probed and aggregated to ndv_cnt_ groups.
+struct ObGroupByRatioInfo
+{
+  OB_UNIS_VERSION_V(1);
+public:
+  ObGroupByRatioInfo() : probe_cnt_(0), ndv_cnt_(0), task_cnt_(0) {}
+  void reset()
+  {
+    probe_cnt_ = 0;
+    ndv_cnt_ = 0;
+    task_cnt_ = 0;
+  }
+  void merge(const ObGroupByRatioInfo &other)
+  {
+    probe_cnt_ += other.probe_cnt_;
+    ndv_cnt_ += other.ndv_cnt_;
+    task_cnt_ += other.task_cnt_;
+  }
+  // ratio of rows eliminated by partial aggregation
+  double get_ratio() const
+  {
+    return probe_cnt_ <= 0 ? 0 : 1 - static_cast<double>(ndv_cnt_) / probe_cnt_;
+  }
+  TO_STRING_KV(K_(probe_cnt), K_(ndv_cnt), K_(task_cnt));
+
+  int64_t probe_cnt_;
+  int64_t ndv_cnt_;
+  int64_t task_cnt_;
+};
+
+class ObGroupByRatioPieceMsg
+  : public ObDatahubPieceMsg<dtl::ObDtlMsgType::DH_GROUPBY_RATIO_PIECE_MSG>
+{
+  OB_UNIS_VERSION_V(1);
+public:
+  using PieceMsgListener = ObGroupByRatioPieceMsgListener;
+  using PieceMsgCtx = ObGroupByRatioPieceMsgCtx;
+public:
+  ObGroupByRatioPieceMsg() : ratio_info_() {}
+  ~ObGroupByRatioPieceMsg() = default;
+  void reset() { ratio_info_.reset(); }
+  INHERIT_TO_STRING_KV("meta", ObDatahubPieceMsg<dtl::ObDtlMsgType::DH_GROUPBY_RATIO_PIECE_MSG>,
+                       K_(op_id), K_(ratio_info));
+public:
+  ObGroupByRatioInfo ratio_info_;
+};
+
+class ObGroupByRatioWholeMsg
+  : public ObDatahubWholeMsg<dtl::ObDtlMsgType::DH_GROUPBY_RATIO_WHOLE_MSG>
+{
+  OB_UNIS_VERSION_V(1);
+public:
+  using WholeMsgProvider = ObWholeMsgProvider<ObGroupByRatioWholeMsg>;
+public:
+  ObGroupByRatioWholeMsg() : ratio_info_() {}
+  ~ObGroupByRatioWholeMsg() = default;
+  int assign(const ObGroupByRatioWholeMsg &other)
+  {
+    ratio_info_ = other.ratio_info_;
+    return common::OB_SUCCESS;
+  }
+  void reset() { ratio_info_.reset(); }
+  VIRTUAL_TO_STRING_KV(K_(ratio_info));
+  // sum of all workers of the dfo
+  ObGroupByRatioInfo ratio_info_;
+};
+
+class ObGroupByRatioPieceMsgCtx : public ObPieceMsgCtx
+{
+public:
+  ObGroupByRatioPieceMsgCtx(uint64_t op_id, int64_t task_cnt, int64_t timeout_ts)
+    : ObPieceMsgCtx(op_id, task_cnt, timeout_ts), received_(0), whole_msg_() {}
+  ~ObGroupByRatioPieceMsgCtx() = default;
+  INHERIT_TO_STRING_KV("meta", ObPieceMsgCtx, K_(received));
+  virtual int send_whole_msg(common::ObIArray<ObPxSqcMeta *> &sqcs) override;
+  virtual void reset_resource() override;
+  static int alloc_piece_msg_ctx(const ObGroupByRatioPieceMsg &pkt,
+                                 ObPxCoordInfo &coord_info,
+                                 ObExecContext &ctx,
+                                 int64_t task_cnt,
+                                 ObPieceMsgCtx *&msg_ctx);
+public:
+  int64_t received_; // 已经收到的 piece 数量
+  ObGroupByRatioWholeMsg whole_msg_;
+private:
+  DISALLOW_COPY_AND_ASSIGN(ObGroupByRatioPieceMsgCtx);
+};
+
+class ObGroupByRatioPieceMsgListener
+{
+public:
+  ObGroupByRatioPieceMsgListener() = default;
+  ~ObGroupByRatioPieceMsgListener() = default;
+  static int on_message(
+      ObGroupByRatioPieceMsgCtx &ctx,
+      common::ObIArray<ObPxSqcMeta *> &sqcs,
+      const ObGroupByRatioPieceMsg &pkt);
+private:
+  DISALLOW_COPY_AND_ASSIGN(ObGroupByRatioPieceMsgListener);
+};
+
+}
+}
+#endif /* __OB_SQL_ENG_PX_DH_GROUPBY_RATIO_H__ */
+//// end of header file
@@ -97,6 +97,7 @@ ObPxMSCoordOp::ObPxMSCoordOp(ObExecContext &exec_ctx, const ObOpSpec &spec, ObOp
   init_channel_piece_msg_proc_(exec_ctx, msg_proc_),
   reporting_wf_piece_msg_proc_(exec_ctx, msg_proc_),
   opt_stats_gather_piece_msg_proc_(exec_ctx, msg_proc_),
+  groupby_ratio_piece_msg_proc_(exec_ctx, msg_proc_),
   store_rows_(),
   last_pop_row_(nullptr),
   row_heap_(),
@@ -175,6 +176,7 @@ int ObPxMSCoordOp::setup_loop_proc()
       .register_processor(init_channel_piece_msg_proc_)
       .register_processor(reporting_wf_piece_msg_proc_)
       .register_processor(opt_stats_gather_piece_msg_proc_)
+      .register_processor(groupby_ratio_piece_msg_proc_)
       .register_interrupt_processor(interrupt_proc_);
   msg_loop_.set_tenant_id(ctx_.get_my_session()->get_effective_tenant_id());
   return ret;
@@ -424,6 +426,7 @@ int ObPxMSCoordOp::inner_get_next_row()
         case ObDtlMsgType::DH_INIT_CHANNEL_PIECE_MSG:
         case ObDtlMsgType::DH_SECOND_STAGE_REPORTING_WF_PIECE_MSG:
         case ObDtlMsgType::DH_OPT_STATS_GATHER_PIECE_MSG:
+        case ObDtlMsgType::DH_GROUPBY_RATIO_PIECE_MSG:
           // 这几种消息都在 process 回调函数里处理了
           break;
         default:
@@ -30,6 +30,7 @@
 #include "lib/container/ob_iarray.h"
 #include "sql/engine/px/datahub/components/ob_dh_init_channel.h"
 #include "sql/engine/px/datahub/components/ob_dh_second_stage_reporting_wf.h"
+#include "sql/engine/px/datahub/components/ob_dh_groupby_ratio.h"
 #include "sql/engine/basic/ob_compact_row.h"
 #include "sql/engine/basic/ob_temp_row_store.h"
 
@@ -169,6 +170,7 @@ private:
   ObInitChannelPieceMsgP init_channel_piece_msg_proc_;
   ObReportingWFPieceMsgP reporting_wf_piece_msg_proc_;
   ObOptStatsGatherPieceMsgP opt_stats_gather_piece_msg_proc_;
+  ObGroupByRatioPieceMsgP groupby_ratio_piece_msg_proc_;
   // 存储merge sort的每一路的当前行
   ObArray<LastCompactRow *> store_rows_;
   LastCompactRow *last_pop_row_;
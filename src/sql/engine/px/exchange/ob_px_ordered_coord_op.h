@@ -28,6 +28,7 @@
 #include "sql/engine/px/datahub/components/ob_dh_sample.h"
 #include "sql/engine/px/datahub/components/ob_dh_init_channel.h"
 #include "sql/engine/px/datahub/components/ob_dh_second_stage_reporting_wf.h"
+#include "sql/engine/px/datahub/components/ob_dh_groupby_ratio.h"
 namespace oceanbase
 {
 namespace sql
@@ -148,6 +149,7 @@ private:
   ObInitChannelPieceMsgP init_channel_piece_msg_proc_;
   ObReportingWFPieceMsgP reporting_wf_piece_msg_proc_;
   ObOptStatsGatherPieceMsgP opt_stats_gather_piece_msg_proc_;
+  ObGroupByRatioPieceMsgP groupby_ratio_piece_msg_proc_;
   ObReceiveRowReader *readers_;
   ObOrderedReceiveFilter receive_order_;
   int64_t reader_cnt_;
@@ -420,6 +420,7 @@ int ObPxTransmitOp::init_channel(ObPxTransmitOpInput &trans_input)
         ch->set_enable_channel_sync(true);
         ch->set_batch_id(px_batch_id);
         ch->set_compression_type(dfc_.get_compressor_type());
+        ch->set_vectors_encode(dfc_.enable_vectors_encode());
         ch->set_operator_owner();
         ch->set_thread_id(thread_id);
       }
@@ -528,12 +529,18 @@ int ObPxTransmitOp::inner_close()
   }
   ObDtlBasicChannel *ch = nullptr;
   int64_t recv_cnt = 0;
+  int64_t saved_bytes = 0;
   for (int i = 0; i < task_channels_.count(); ++i) {
     ch = static_cast<ObDtlBasicChannel *>(task_channels_.at(i));
     recv_cnt += ch->get_send_buffer_cnt();
+    saved_bytes += ch->get_op_metric().get_saved_bytes();
   }
   op_monitor_info_.otherstat_3_id_ = ObSqlMonitorStatIds::DTL_SEND_RECV_COUNT;
   op_monitor_info_.otherstat_3_value_ = recv_cnt;
+  if (saved_bytes > 0) {
+    op_monitor_info_.otherstat_4_id_ = ObSqlMonitorStatIds::DTL_ENCODE_SAVED_BYTES;
+    op_monitor_info_.otherstat_4_value_ = saved_bytes;
+  }
   int release_channel_ret = loop_.unregister_all_channel();
   if (release_channel_ret != common::OB_SUCCESS) {
     // the following unlink actions is not safe is any unregister failure happened
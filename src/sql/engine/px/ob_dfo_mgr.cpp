@@ -28,6 +28,7 @@
 #include "share/detect/ob_detect_manager_utils.h"
 #include "sql/engine/px/ob_px_coord_op.h"
 #include "sql/engine/basic/ob_material_vec_op.h"
+#include "observer/omt/ob_tenant_config_mgr.h"
 
 using namespace oceanbase::common;
 using namespace oceanbase::sql;
@@ -412,6 +413,8 @@ void ObDfoMgr::destroy()
   // release root dfo
   ObDfo::reset_resource(root_dfo_);
   root_dfo_ = nullptr;
+  admited_worker_count_ = 0;
+  enable_pipelined_sched_ = false;
   inited_ = false;
 }
 
@@ -451,6 +454,12 @@ int ObDfoMgr::init(ObExecContext &exec_ctx,
   } else if (OB_FAIL(ObDfoWorkerAssignment::assign_worker(*this, px_expected, px_minimal, px_admited))) {
     LOG_WARN("fail assign worker to dfos", K(ret),  K(px_expected), K(px_minimal), K(px_admited));
   } else {
+    omt::ObTenantConfigGuard tenant_config(TENANT_CONF(MTL_ID()));
+    // admited 为 0 时（rpc worker、fast dfo 等场景）没有可供提前调度的 worker 余量
+    admited_worker_count_ = px_admited;
+    enable_pipelined_sched_ = tenant_config.is_valid()
+                              && tenant_config->_px_pipelined_dfo_scheduling
+                              && px_admited > 0;
     inited_ = true;
   }
   return ret;
@@ -894,6 +903,16 @@ int ObDfoMgr::get_ready_dfos(ObIArray<ObDfo*> &dfos) const
           }
         }
       }
+      // 流水线调度：edge 已经调度起来，在等待它完成期间，如果它没有占满 admission
+      // 分到的 worker（已完成的 dfo 会释放 worker），提前调度按顺序排在它后面的叶子 edge。
+      // 注意：sibling、depend parent、root dfo 的调度优先于本分支，保证它们的 worker 不被挤占
+      if (OB_SUCC(ret) && !got_pair_dfo && enable_pipelined_sched_ && edge->is_active()) {
+        if (OB_FAIL(get_pipelined_dfos(i, dfos))) {
+          LOG_WARN("fail get pipelined dfos", K(ret));
+        } else {
+          got_pair_dfo = !dfos.empty();
+        }
+      }
       // 每次只迭代一对儿结果返回出去
       //
       // 如果：
@@ -901,6 +920,7 @@ int ObDfoMgr::get_ready_dfos(ObIArray<ObDfo*> &dfos) const
       //   - 也没有 sibling edge 需要调度，
       //   - 没有 depend parent edge 需要调度
       //   - root dfo 也不需要调度
+      //   - 也没有可以提前调度的叶子 edge
       // 则返回 dfos 空集，继续等待
       break;
     }
@@ -911,6 +931,89 @@ int ObDfoMgr::get_ready_dfos(ObIArray<ObDfo*> &dfos) const
   return ret;
 }
 
+/*
+ * 以 bushy tree 为例，edges 顺序为 (1,3) (2,3) (3,7) (4,6) (5,6) (6,7) (7,root)：
+ *
+ *              dfo7
+ *            /      \
+ *         dfo3      dfo6
+ *        /   \     /    \
+ *     dfo1  dfo2 dfo4  dfo5
+ *
+ * 普通调度下 (4,6) 要等 dfo3 完成才调度，两棵子树的 hash join build 是串行的。
+ * 若 (3,7) 运行期间 worker 还有富余，就提前把 (4,6) 调度起来，让 dfo6 和 dfo7
+ * 同时 build。同理 (1,3) 运行期间可以提前调度 (2,3)，让 probe 端尽早开始扫描。
+ *
+ * 只向后看紧邻的一条未完成 edge，而且它必须是叶子：叶子不依赖任何 dfo，
+ * 它本来就是 edge 完成之后第一个要调度的，提前调度只是把它的开始时间前移，
+ * 不改变其余 dfo 的调度次序，也就不会引入新的等待关系。
+ */
+int ObDfoMgr::get_pipelined_dfos(const int64_t edge_idx, ObIArray<ObDfo*> &dfos) const
+{
+  int ret = OB_SUCCESS;
+  ObDfo *edge = edges_.at(edge_idx);
+  ObDfo *next_edge = NULL;
+  for (int64_t i = edge_idx + 1; NULL == next_edge && i < edges_.count(); ++i) {
+    if (!edges_.at(i)->is_thread_finish()) {
+      next_edge = edges_.at(i);
+    }
+  }
+  ObDfo *parent = NULL == next_edge ? NULL : next_edge->parent();
+  if (edge->has_depend_sibling()) {
+    // sibling 仍会陆续调度，不要占用它们的 worker
+  } else if (NULL == next_edge || next_edge->is_active() || NULL == parent) {
+    // nop
+  } else if (next_edge->has_child_dfo()
+             || next_edge->has_depend_sibling()
+             || is_depend_sibling(next_edge)
+             || parent == root_dfo_
+             || parent->force_bushy()
+             || parent->has_dml_op()
+             || next_edge->is_earlier_sched()
+             || parent->is_earlier_sched()
+             || next_edge->has_temp_table_scan()
+             || parent->has_temp_table_scan()) {
+    // 这些 dfo 依赖别的 dfo 先执行（runtime filter、temp table、sibling 链等），保持原调度次序
+  } else {
+    int64_t used_worker_count = 0;
+    for (int64_t i = 0; i < edges_.count(); ++i) {
+      const ObDfo *dfo = edges_.at(i);
+      if (dfo->is_scheduled() && !dfo->is_thread_finish()) {
+        used_worker_count += dfo->get_assigned_worker_count();
+      }
+    }
+    const int64_t need_worker_count = next_edge->get_assigned_worker_count()
+        + (parent->is_scheduled() ? 0 : parent->get_assigned_worker_count());
+    if (used_worker_count + need_worker_count > admited_worker_count_) {
+      // 等运行中的 dfo 完成、释放 worker
+    } else if (OB_FAIL(dfos.push_back(next_edge))) {
+      LOG_WARN("fail push dfo", K(ret));
+    } else if (OB_FAIL(dfos.push_back(parent))) {
+      LOG_WARN("fail push dfo", K(ret));
+    } else {
+      next_edge->set_active();
+      LOG_TRACE("dfo do pipelined scheduling", K(*next_edge), K(*parent),
+                K(used_worker_count), K(need_worker_count), K_(admited_worker_count));
+    }
+  }
+  return ret;
+}
+
+bool ObDfoMgr::is_depend_sibling(const ObDfo *edge) const
+{
+  bool found = false;
+  for (int64_t i = 0; !found && i < edges_.count(); ++i) {
+    if (edges_.at(i)->has_depend_sibling()) {
+      for (const ObDfo *sibling = edges_.at(i)->depend_sibling();
+           !found && NULL != sibling;
+           sibling = sibling->depend_sibling()) {
+        found = (sibling == edge);
+      }
+    }
+  }
+  return found;
+}
+
 int ObDfoMgr::add_dfo_edge(ObDfo *edge)
 {
   int ret = OB_SUCCESS;
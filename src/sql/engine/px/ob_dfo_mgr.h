@@ -27,7 +27,7 @@ class ObDfoMgr
 public:
   explicit ObDfoMgr(common::ObIAllocator &allocator) :
       allocator_(allocator), inited_(false),
-      root_dfo_(NULL)
+      root_dfo_(NULL), admited_worker_count_(0), enable_pipelined_sched_(false)
   {}
   virtual ~ObDfoMgr() = default;
   void destroy();
@@ -64,11 +64,16 @@ private:
   int create_dfo(common::ObIAllocator &allocator,
                  const ObOpSpec *dfo_root_op,
                  ObDfo *&dfo) const;
+  // 当前 edge 等待完成时，若 admission 分到的 worker 还有剩余，提前调度紧随其后的叶子 edge
+  int get_pipelined_dfos(const int64_t edge_idx, common::ObIArray<ObDfo *> &dfos) const;
+  bool is_depend_sibling(const ObDfo *edge) const;
 protected:
   common::ObIAllocator &allocator_;
   bool inited_;
   ObDfo *root_dfo_;
   common::ObSEArray<ObDfo *, 2> edges_;
+  int64_t admited_worker_count_;
+  bool enable_pipelined_sched_;
 private:
   DISALLOW_COPY_AND_ASSIGN(ObDfoMgr);
 };
@@ -16,6 +16,7 @@
 #include "sql/engine/ob_physical_plan.h"
 #include "sql/engine/ob_exec_context.h"
 #include "sql/engine/px/ob_granule_pump.h"
+#include "sql/das/ob_das_simple_op.h"
 #include "sql/executor/ob_task_spliter.h"
 #include "sql/engine/dml/ob_table_insert_op.h"
 #include "sql/engine/expr/ob_expr_join_filter.h"
@@ -177,6 +178,10 @@ ObGranuleIteratorOp::ObGranuleIteratorOp(ObExecContext &exec_ctx, const ObOpSpec
   pwj_rescan_task_infos_(),
   filter_count_(0),
   total_count_(0),
+  busy_time_(0),
+  idle_time_(0),
+  task_begin_ts_(0),
+  split_granule_cnt_(0),
   rf_msg_(NULL),
   rf_key_(),
   rf_start_wait_time_(0),
@@ -187,6 +192,9 @@ ObGranuleIteratorOp::ObGranuleIteratorOp(ObExecContext &exec_ctx, const ObOpSpec
 {
   op_monitor_info_.otherstat_1_id_ = ObSqlMonitorStatIds::FILTERED_GRANULE_COUNT;
   op_monitor_info_.otherstat_2_id_ = ObSqlMonitorStatIds::TOTAL_GRANULE_COUNT;
+  op_monitor_info_.otherstat_3_id_ = ObSqlMonitorStatIds::GRANULE_BUSY_TIME;
+  op_monitor_info_.otherstat_4_id_ = ObSqlMonitorStatIds::GRANULE_IDLE_TIME;
+  op_monitor_info_.otherstat_5_id_ = ObSqlMonitorStatIds::SPLIT_GRANULE_COUNT;
 }
 
 void ObGranuleIteratorOp::destroy()
@@ -230,7 +238,7 @@ int ObGranuleIteratorOp::try_pruning_repart_partition(
   if (OB_INVALID_ID == ctx_.get_gi_pruning_info().get_part_id()) {
     ret = OB_ERR_UNEXPECTED;
     LOG_WARN("pruning id is not set", K(ret));
-  } else if (OB_FAIL(taskset.get_task_at_pos(info, pos))) {
+  } else if (OB_FAIL(pump_->get_task_at_pos(taskset, info, pos))) {
     LOG_WARN("get task info failed", K(ret));
   } else {
     partition_pruned = repart_partition_pruned(info);
@@ -301,17 +309,69 @@ int ObGranuleIteratorOp::try_fetch_task(ObGranuleTaskInfo &info)
           LOG_WARN("taskset changed", K(ret));
         }
       }
+      if (OB_SUCC(ret) && from_share_pool) {
+        int tmp_ret = OB_SUCCESS;
+        if (OB_SUCCESS != (tmp_ret = try_split_granule_task(*taskset, pos))) {
+          LOG_WARN("failed to split granule task, ignore", K(tmp_ret), K(pos));
+        }
+      }
     }
   }
 
   if(OB_FAIL(ret)) {
-  } else if (OB_FAIL(taskset->get_task_at_pos(info, pos))) {
+  } else if (OB_FAIL(pump_->get_task_at_pos(*taskset, info, pos))) {
     LOG_WARN("get task info failed", K(ret));
   } else {
     info.task_id_ = worker_id_;
   }
   return ret;
 }
+// In the tail of scan, split the granule just taken from the shared pool into two at a macro
+// block boundary (by ObPartitionRangeSpliter through das), this worker scans the first half and
+// the second half is put back to the pool for the idle workers.
+int ObGranuleIteratorOp::try_split_granule_task(const ObGITaskSet &taskset, const int64_t pos)
+{
+  int ret = OB_SUCCESS;
+  ObGranuleTaskInfo info;
+  if (MY_SPEC.nlj_with_param_down_ || !pump_->need_split_granule_task(tsc_op_id_)) {
+    // do nothing
+  } else if (OB_FAIL(pump_->get_task_at_pos(taskset, info, pos))) {
+    LOG_WARN("get task info failed", K(ret), K(pos));
+  } else if (1 != info.ranges_.count() || OB_ISNULL(info.tablet_loc_)
+             || info.ranges_.at(0).is_physical_rowid_range_) {
+    // only granule of one rowkey range is split
+  } else {
+    ObSEArray<ObStoreRange, 1> store_ranges;
+    ObArrayArray<ObStoreRange> split_array;
+    ObStoreRange store_range;
+    ObNewRange first;
+    ObNewRange second;
+    bool split = false;
+    store_range.assign(info.ranges_.at(0));
+    if (OB_FAIL(store_ranges.push_back(store_range))) {
+      LOG_WARN("failed to push back store range", K(ret));
+    } else if (OB_FAIL(ObDASSimpleUtils::split_multi_ranges(ctx_,
+                                                            info.tablet_loc_,
+                                                            store_ranges,
+                                                            2,
+                                                            split_array))) {
+      LOG_WARN("failed to split granule range", K(ret), K(info));
+    } else if (2 != split_array.count() || 1 != split_array.count(0)
+               || 1 != split_array.count(1)) {
+      // too small to split
+    } else {
+      split_array.at(0, 0).to_new_range(first);
+      split_array.at(1, 0).to_new_range(second);
+      if (OB_FAIL(pump_->add_split_granule_task(tsc_op_id_, pos, first, second, split))) {
+        LOG_WARN("failed to add split granule task", K(ret), K(first), K(second));
+      } else if (split) {
+        split_granule_cnt_++;
+      }
+    }
+  }
+  return ret;
+}
+
 //GI has its own rescan
 int ObGranuleIteratorOp::rescan()
 {
@@ -504,13 +564,25 @@ int ObGranuleIteratorOp::try_get_rows(const int64_t max_row_cnt)
       break;
     }
     case GI_GET_NEXT_GRANULE_TASK : {
+      const int64_t fetch_begin_ts = ObTimeUtility::current_time();
+      if (task_begin_ts_ > 0) {
+        busy_time_ += fetch_begin_ts - task_begin_ts_;
+        task_begin_ts_ = 0;
+      }
       if (OB_FAIL(get_next_granule_task())) {
+        idle_time_ += ObTimeUtility::current_time() - fetch_begin_ts;
         if (ret != OB_ITER_END) {
           LOG_WARN("fail to get next granule task", K(ret));
         } else {
           op_monitor_info_.otherstat_1_value_ = filter_count_;
           op_monitor_info_.otherstat_2_value_ = total_count_;
+          op_monitor_info_.otherstat_3_value_ = busy_time_;
+          op_monitor_info_.otherstat_4_value_ = idle_time_;
+          op_monitor_info_.otherstat_5_value_ = split_granule_cnt_;
         }
+      } else {
+        task_begin_ts_ = ObTimeUtility::current_time();
+        idle_time_ += task_begin_ts_ - fetch_begin_ts;
       }
     }
     break;
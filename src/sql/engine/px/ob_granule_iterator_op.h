@@ -175,6 +175,7 @@ private:
   // 非full partition wise获得task的方式
   // TODO: jiangting.lk 重构下函数名字
   int try_fetch_task(ObGranuleTaskInfo &info);
+  int try_split_granule_task(const ObGITaskSet &taskset, const int64_t pos);
   /**
    * @brief
    * full partition wise的模式下，通过op ids获得对应的task infos
@@ -256,6 +257,11 @@ private:
    //for partition pruning
   int64_t filter_count_; // filtered part count when part pruning activated
   int64_t total_count_; // total partition count or block count processed, rescan included
+  // for granule split in the tail of scan
+  int64_t busy_time_; // time spent on scanning granules
+  int64_t idle_time_; // time spent on fetching and splitting granules
+  int64_t task_begin_ts_;
+  int64_t split_granule_cnt_;
   ObP2PDatahubMsgBase *rf_msg_;
   ObP2PDhKey rf_key_;
   int64_t rf_start_wait_time_;
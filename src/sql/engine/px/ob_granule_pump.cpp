@@ -18,6 +18,7 @@
 #include "sql/engine/px/ob_px_util.h"
 #include "sql/session/ob_basic_session_info.h"
 #include "share/config/ob_server_config.h"
+#include "observer/omt/ob_tenant_config_mgr.h"
 #include "share/schema/ob_part_mgr_util.h"
 #include "sql/engine/dml/ob_table_modify_op.h"
 #include "sql/engine/ob_engine_op_traits.h"
@@ -628,6 +629,155 @@ int ObGranulePump::add_new_gi_task(ObGranulePumpArgs &args)
                                        random_type,
                                        partition_granule))) {
       LOG_WARN("failed to prepare random gi task", K(ret), K(partition_granule));
+    } else if (!partition_granule && OB_FAIL(prepare_granule_split(args, random_type))) {
+      LOG_WARN("failed to prepare granule split", K(ret));
+    }
+  }
+  return ret;
+}
+
+int ObGranulePump::prepare_granule_split(ObGranulePumpArgs &args,
+                                         ObGITaskSet::ObGIRandomType random_type)
+{
+  int ret = OB_SUCCESS;
+  bool enable_split = false;
+  ObIArray<const ObTableScanSpec *> &scan_ops = args.op_info_.get_scan_ops();
+  omt::ObTenantConfigGuard tenant_config(TENANT_CONF(MTL_ID()));
+  if (tenant_config.is_valid()) {
+    enable_split = tenant_config->_enable_px_granule_split;
+  }
+  // ordered scan and randomized tasks of ddl/pdml keep the granules as they are
+  enable_split = enable_split
+                 && ObGITaskSet::GI_RANDOM_NONE == random_type
+                 && !ObGranuleUtil::asc_order(args.gi_attri_flag_)
+                 && !ObGranuleUtil::desc_order(args.gi_attri_flag_)
+                 && !ObGranuleUtil::with_param_down(args.gi_attri_flag_)
+                 && args.parallelism_ > 1;
+  parallelism_ = args.parallelism_;
+  if (enable_split) {
+    split_range_alloc_.set_attr(ObMemAttr(MTL_ID(), "GISplitRange"));
+  }
+  for (int64_t i = 0; enable_split && OB_SUCC(ret) && i < scan_ops.count(); ++i) {
+    const ObTableScanSpec *tsc = scan_ops.at(i);
+    ObGITaskArray *taskset_array = nullptr;
+    if (OB_ISNULL(tsc)) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("get a null tsc ptr", K(ret));
+    } else if (tsc->tsc_ctdef_.scan_ctdef_.is_external_table_
+               || is_virtual_table(tsc->get_scan_key_id())) {
+      // do nothing
+    } else if (OB_FAIL(find_taskset_by_tsc_id(tsc->get_id(), taskset_array))) {
+      LOG_WARN("the tsc_op_id do not have task set", K(ret), K(tsc->get_id()));
+    } else if (OB_ISNULL(taskset_array) || taskset_array->count() < OB_GRANULE_SHARED_POOL_POS + 1) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("taskset array is invalid", K(ret), KP(taskset_array));
+    } else {
+      // Reserve the space of split granules, the task array must not be reallocated, because
+      // the taskset is returned to the workers by pointer.
+      common::ObArray<ObGITaskSet::ObGITaskInfo> &tasks =
+          taskset_array->at(OB_GRANULE_SHARED_POOL_POS).gi_task_set_;
+      if (OB_FAIL(tasks.reserve(tasks.count() + args.parallelism_))) {
+        LOG_WARN("failed to reserve granule tasks", K(ret), K(tasks.count()));
+      } else {
+        for (int64_t j = 0; j < gi_task_array_map_.count(); ++j) {
+          if (gi_task_array_map_.at(j).tsc_op_id_ == tsc->get_id()) {
+            gi_task_array_map_.at(j).can_split_ = true;
+            enable_granule_split_ = true;
+          }
+        }
+      }
+    }
+  }
+  return ret;
+}
+
+int ObGranulePump::get_task_at_pos(const ObGITaskSet &taskset,
+                                   ObGranuleTaskInfo &info,
+                                   const int64_t pos)
+{
+  int ret = OB_SUCCESS;
+  if (enable_granule_split_) {
+    ObLockGuard<ObSpinLock> lock_guard(lock_);
+    ret = taskset.get_task_at_pos(info, pos);
+  } else {
+    ret = taskset.get_task_at_pos(info, pos);
+  }
+  return ret;
+}
+
+bool ObGranulePump::need_split_granule_task(uint64_t tsc_op_id)
+{
+  bool need_split = false;
+  if (GIT_RANDOM == splitter_type_ && !no_more_task_from_shared_pool_) {
+    ObLockGuard<ObSpinLock> lock_guard(lock_);
+    for (int64_t i = 0; i < gi_task_array_map_.count(); ++i) {
+      const GITaskArrayItem &item = gi_task_array_map_.at(i);
+      if (item.tsc_op_id_ == tsc_op_id) {
+        if (item.can_split_ && item.taskset_array_.count() > OB_GRANULE_SHARED_POOL_POS) {
+          const ObGITaskSet &taskset = item.taskset_array_.at(OB_GRANULE_SHARED_POOL_POS);
+          const int64_t left_cnt = taskset.gi_task_set_.count() - taskset.cur_pos_;
+          need_split = left_cnt < parallelism_
+                       && taskset.gi_task_set_.count() < taskset.gi_task_set_.get_capacity();
+        }
+        break;
+      }
+    }
+  }
+  return need_split;
+}
+
+// Replace the range of the granule at %pos with %first, and append %second as a new granule.
+int ObGranulePump::add_split_granule_task(uint64_t tsc_op_id,
+                                          int64_t pos,
+                                          const ObNewRange &first,
+                                          const ObNewRange &second,
+                                          bool &split)
+{
+  int ret = OB_SUCCESS;
+  split = false;
+  ObNewRange first_copy;
+  ObGITaskSet::ObGITaskInfo task_info;
+  // copy the ranges before taking %lock_, the workers reading granules are not blocked by the
+  // allocation. The copies are left in the arena if the granule is not split at last.
+  if (OB_FAIL(deep_copy_range(split_range_safe_alloc_, first, first_copy))) {
+    LOG_WARN("failed to deep copy range", K(ret));
+  } else if (OB_FAIL(deep_copy_range(split_range_safe_alloc_, second, task_info.range_))) {
+    LOG_WARN("failed to deep copy range", K(ret));
+  } else {
+    ObLockGuard<ObSpinLock> lock_guard(lock_);
+    GITaskArrayItem *item = nullptr;
+    for (int64_t i = 0; nullptr == item && i < gi_task_array_map_.count(); ++i) {
+      if (gi_task_array_map_.at(i).tsc_op_id_ == tsc_op_id) {
+        item = &gi_task_array_map_.at(i);
+      }
+    }
+    if (OB_ISNULL(item) || item->taskset_array_.count() < OB_GRANULE_SHARED_POOL_POS + 1) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("the tsc_op_id do not have task set", K(ret), K(tsc_op_id));
+    } else {
+      ObGITaskSet &taskset = item->taskset_array_.at(OB_GRANULE_SHARED_POOL_POS);
+      common::ObArray<ObGITaskSet::ObGITaskInfo> &tasks = taskset.gi_task_set_;
+      if (pos < 0 || pos >= tasks.count()) {
+        ret = OB_INVALID_ARGUMENT;
+        LOG_WARN("invalid granule pos", K(ret), K(pos), K(tasks.count()));
+      } else if (!item->can_split_ || tasks.count() >= tasks.get_capacity()
+                 || (pos + 1 < tasks.count() && tasks.at(pos + 1).idx_ == tasks.at(pos).idx_)) {
+        // no space left or a multi range granule, keep it as it is
+      } else {
+        task_info.tablet_loc_ = tasks.at(pos).tablet_loc_;
+        task_info.ss_range_ = tasks.at(pos).ss_range_;
+        // original granules have non-negative idx
+        task_info.idx_ = -1 - item->split_cnt_;
+        if (OB_FAIL(tasks.push_back(task_info))) {
+          LOG_WARN("failed to push back granule", K(ret));
+        } else {
+          tasks.at(pos).range_ = first_copy;
+          item->split_cnt_ += 1;
+          no_more_task_from_shared_pool_ = false;
+          split = true;
+          LOG_TRACE("split granule", K(tsc_op_id), K(pos), K(first_copy), K(task_info));
+        }
+      }
     }
   }
   return ret;
@@ -678,11 +828,14 @@ void ObGranulePump::destroy()
 {
   gi_task_array_map_.reset();
   pump_args_.reset();
+  split_range_alloc_.reset();
+  enable_granule_split_ = false;
 }
 
 void ObGranulePump::reset_task_array()
 {
   gi_task_array_map_.reset();
+  enable_granule_split_ = false;
 }
 
 int ObGranulePump::get_first_tsc_range_cnt(int64_t &cnt)
@@ -176,12 +176,16 @@ typedef common::ObIArray<ObGITaskSet> GITaskIArray;
 
 struct GITaskArrayItem
 {
-  TO_STRING_KV(K(tsc_op_id_), K(taskset_array_));
+  GITaskArrayItem() : tsc_op_id_(0), taskset_array_(), can_split_(false), split_cnt_(0) {}
+  TO_STRING_KV(K(tsc_op_id_), K(taskset_array_), K(can_split_), K(split_cnt_));
   // table scan operator id or insert op id
   // TODO: jiangting.lk 先不修改变量名字，后期统一调整
   uint64_t tsc_op_id_;
   // gi task set array
   ObGITaskArray taskset_array_;
+  // granules of the shared pool can be split in the tail of scan
+  bool can_split_;
+  int64_t split_cnt_;
 };
 
 typedef common::ObArray<GITaskArrayItem> GITaskArrayMap;
@@ -491,7 +495,10 @@ public:
   pruning_table_locations_(),
   pump_version_(0),
   is_taskset_reset_(false),
-  fetch_task_ret_(OB_SUCCESS)
+  fetch_task_ret_(OB_SUCCESS),
+  split_range_alloc_("GISplitRange"),
+  split_range_safe_alloc_(split_range_alloc_),
+  enable_granule_split_(false)
   {
   }
 
@@ -534,6 +541,20 @@ public:
                           const ObIArray<int64_t> &op_ids,
                           int64_t worker_id);
 
+  // Tail granule splitting of the shared pool (GIT_RANDOM).
+  // When less granules than workers are left, the worker which takes a granule splits it into
+  // two at a macro block boundary and puts the second half back to the pool, so that the idle
+  // workers steal the remaining work of the straggler instead of quitting.
+  bool need_split_granule_task(uint64_t tsc_op_id);
+  int add_split_granule_task(uint64_t tsc_op_id,
+                             int64_t pos,
+                             const common::ObNewRange &first,
+                             const common::ObNewRange &second,
+                             bool &split);
+  // Read the granule at %pos of %taskset. Once granules can be split, the shared pool is
+  // appended and its ranges are rewritten under %lock_, so it is read under the lock as well.
+  int get_task_at_pos(const ObGITaskSet &taskset, ObGranuleTaskInfo &info, const int64_t pos);
+
   int64_t get_pump_version() const { return pump_version_; }
   bool is_taskset_reset() const { return is_taskset_reset_; }
   DECLARE_TO_STRING;
@@ -584,6 +605,7 @@ private:
                uint64_t gi_attri_flag);
 
   int check_can_randomize(ObGranulePumpArgs &args, bool &can_randomize);
+  int prepare_granule_split(ObGranulePumpArgs &args, ObGITaskSet::ObGIRandomType random_type);
 
 private:
   //TODO::muhang 自旋锁还是阻塞锁，又或者按静态划分任务避免锁竞争？
@@ -606,6 +628,11 @@ private:
   // when granule tasks are fetched concurrently, if one thread failed to fetch task,
   // others should not fetch tasks any more.
   int fetch_task_ret_;
+  // ranges of split granules, they are copied before %lock_ is taken
+  common::ObArenaAllocator split_range_alloc_;
+  common::ObSafeArenaAllocator split_range_safe_alloc_;
+  // some shared pool can be split, set before the workers start
+  bool enable_granule_split_;
 };
 
 }//sql
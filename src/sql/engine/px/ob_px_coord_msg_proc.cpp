@@ -147,3 +147,10 @@ int ObPxSubCoordMsgProc::on_whole_msg(
   ObDhWholeeMsgProc<ObOptStatsGatherWholeMsg> proc;
   return proc.on_whole_msg(sqc_ctx_, dtl::DH_OPT_STATS_GATHER_WHOLE_MSG, pkt);
 }
+
+int ObPxSubCoordMsgProc::on_whole_msg(
+    const ObGroupByRatioWholeMsg &pkt) const
+{
+  ObDhWholeeMsgProc<ObGroupByRatioWholeMsg> proc;
+  return proc.on_whole_msg(sqc_ctx_, dtl::DH_GROUPBY_RATIO_WHOLE_MSG, pkt);
+}
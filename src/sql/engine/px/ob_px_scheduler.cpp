@@ -507,6 +507,14 @@ int ObPxMsgProc::on_piece_msg(
   return proc.on_piece_msg(coord_info_, ctx, pkt);
 }
 
+int ObPxMsgProc::on_piece_msg(
+    ObExecContext &ctx,
+    const ObGroupByRatioPieceMsg &pkt)
+{
+  ObDhPieceMsgProc<ObGroupByRatioPieceMsg> proc;
+  return proc.on_piece_msg(coord_info_, ctx, pkt);
+}
+
 int ObPxMsgProc::on_eof_row(ObExecContext &ctx)
 {
   int ret = OB_SUCCESS;
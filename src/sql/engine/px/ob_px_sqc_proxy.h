@@ -144,6 +144,13 @@ public:
       bool send_piece = true,
       bool need_wait_whole_msg = true);
 
+  // peek whole msg without waiting, return OB_EAGAIN if the whole msg is not arrived yet.
+  // used by operators which only take the whole msg as a hint and never block on it.
+  template <class WholeMsg>
+  int try_get_dh_msg(uint64_t op_id,
+      dtl::ObDtlMsgType msg_type,
+      const WholeMsg *&whole,
+      int64_t timeout_ts);
 
   // 用于 worker 汇报执行结果
   int report_task_finish_status(int64_t task_idx, int rc);
@@ -250,6 +257,38 @@ int ObPxSQCProxy::get_dh_msg(uint64_t op_id,
                           need_wait_whole_msg);
 }
 
+template <class WholeMsg>
+int ObPxSQCProxy::try_get_dh_msg(uint64_t op_id,
+    dtl::ObDtlMsgType msg_type,
+    const WholeMsg *&whole,
+    int64_t timeout_ts)
+{
+  int ret = common::OB_SUCCESS;
+  ObPxDatahubDataProvider *provider = nullptr;
+  if (OB_FAIL(get_whole_msg_provider(op_id, msg_type, provider))) {
+    SQL_LOG(WARN, "fail get provider", K(ret));
+  } else {
+    typename WholeMsg::WholeMsgProvider *p = static_cast<typename WholeMsg::WholeMsgProvider *>(provider);
+    const dtl::ObDtlMsg *msg = nullptr;
+    {
+      ObSqcLeaderTokenGuard guard(leader_token_lock_, msg_ready_cond_);
+      if (guard.hold_token()) {
+        ret = process_dtl_msg(timeout_ts);
+      }
+    }
+    if (OB_FAIL(ret)) {
+      SQL_LOG(WARN, "fail process dtl msg", K(ret));
+    } else if (OB_FAIL(p->get_msg_nonblock(msg, timeout_ts))) {
+      if (common::OB_EAGAIN != ret) {
+        SQL_LOG(WARN, "fail get msg", K(timeout_ts), K(ret));
+      }
+    } else {
+      whole = static_cast<const WholeMsg *>(msg);
+    }
+  }
+  return ret;
+}
+
 template <class PieceMsg, class WholeMsg>
 int ObPxSQCProxy::inner_get_dh_msg(
     uint64_t op_id,
@@ -31,6 +31,7 @@
 #include "sql/engine/px/datahub/components/ob_dh_second_stage_reporting_wf.h"
 #include "sql/dtl/ob_dtl_msg_type.h"
 #include "sql/engine/px/datahub/components/ob_dh_opt_stats_gather.h"
+#include "sql/engine/px/datahub/components/ob_dh_groupby_ratio.h"
 
 namespace oceanbase
 {
@@ -106,6 +107,7 @@ public:
   ObPxBloomfilterChProvider bf_ch_provider_;
   ObPxCreateBloomFilterChannelMsgP px_bloom_filter_msg_proc_;
   ObOptStatsGatherWholeMsgP opt_stats_gather_whole_msg_proc_;
+  ObGroupByRatioWholeMsgP groupby_ratio_whole_msg_proc_;
   // 用于 datahub 中保存 whole msg provider，一般情况下一个子计划里不会
   // 超过一个算子会使用 datahub，所以大小默认为 1 即可
   common::ObSEArray<ObPxDatahubDataProvider *, 1> whole_msg_provider_list_;
@@ -0,0 +1,240 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_SQL_ENGINE_SORT_SORT_MSD_RADIX_VEC_OP_H_
+#define OCEANBASE_SQL_ENGINE_SORT_SORT_MSD_RADIX_VEC_OP_H_
+
+#include "lib/container/ob_iarray.h"
+#include "lib/allocator/ob_allocator.h"
+#include "sql/engine/basic/ob_compact_row.h"
+#include "sql/engine/basic/ob_sql_mem_callback.h"
+
+namespace oceanbase
+{
+namespace sql
+{
+
+// MSD (most significant digit first) radix sort over the order preserving encoded sort key.
+//
+// The encoded key is compared byte by byte with memcmp and a shorter key is less than
+// a longer key with the same prefix, so the rows can be distributed by one key byte per
+// pass without any comparison:
+//   bucket 0 holds the keys end before the current byte,
+//   bucket 1 + b holds the keys whose current byte is b.
+// Buckets are sorted recursively on the next byte, small buckets are finished by insertion
+// sort, and a bucket shared by all the keys (common prefix) is skipped without scattering.
+//
+// Compared to the adaptive quick sort, the number of passes depends on the length of the
+// distinguishing prefix rather than log(N), it pays off for large inputs.
+template <typename Store_Row>
+class ObMSDRadixSort
+{
+public:
+  struct MSDItem
+  {
+    const unsigned char *key_ptr_;
+    Store_Row *row_ptr_;
+    uint32_t len_;
+    MSDItem() : key_ptr_(nullptr), row_ptr_(nullptr), len_(0)
+    {}
+    TO_STRING_KV(K_(len), KP(key_ptr_), KP(row_ptr_));
+  };
+
+  // below this row count the adaptive quick sort is faster
+  static const int64_t MIN_RADIX_SORT_ROWS = 1L << 12;
+  static const int64_t INSERTION_SORT_THRESHOLD = 32;
+  // depth of recursion with bucket histogram on stack, fallback to comparison sort beyond it
+  static const int64_t MAX_RECURSION_DEPTH = 16;
+  static const int64_t BUCKET_CNT = 257;
+
+  ObMSDRadixSort(common::ObIArray<Store_Row *> &sort_rows, const RowMeta &row_meta,
+                 common::ObIAllocator &alloc)
+    : row_meta_(row_meta), orig_sort_rows_(sort_rows), alloc_(alloc),
+      callback_(nullptr), items_(nullptr), tmp_items_(nullptr), item_cnt_(0), mem_size_(0)
+  {}
+  ~ObMSDRadixSort()
+  {
+    reset();
+  }
+  static bool need_radix_sort(const int64_t row_cnt)
+  {
+    return row_cnt >= MIN_RADIX_SORT_ROWS;
+  }
+  // the items buffer is reported to %callback, the sql memory manager of the sort
+  void set_callback(ObSqlMemoryCallback *callback) { callback_ = callback; }
+  // %can_encode is set to false if any sort key is null (encoding failed at runtime),
+  // the caller should fall back to compare the sort keys with collation.
+  int init(int64_t rows_begin, int64_t rows_end, bool &can_encode)
+  {
+    int ret = OB_SUCCESS;
+    can_encode = true;
+    reset();
+    const int64_t cnt = rows_end - rows_begin;
+    if (cnt <= 0) {
+      // do nothing
+    } else if (rows_begin < 0 || rows_end > orig_sort_rows_.count()) {
+      ret = OB_INVALID_ARGUMENT;
+      SQL_ENG_LOG(WARN, "invalid argument", K(rows_begin), K(rows_end),
+                  K(orig_sort_rows_.count()), K(ret));
+    } else if (OB_ISNULL(items_ = static_cast<MSDItem *>(
+                             alloc_.alloc(sizeof(MSDItem) * cnt * 2)))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      SQL_ENG_LOG(WARN, "failed to alloc radix sort items", K(ret), K(cnt));
+    } else {
+      // items and the scratch items of scatter share one buffer
+      tmp_items_ = items_ + cnt;
+      item_cnt_ = cnt;
+      mem_size_ = sizeof(MSDItem) * cnt * 2;
+      if (nullptr != callback_) {
+        callback_->alloc(mem_size_);
+      }
+      for (int64_t i = 0; can_encode && i < cnt; i++) {
+        Store_Row *row = orig_sort_rows_.at(i + rows_begin);
+        if (row->is_null(0)) {
+          can_encode = false;
+        } else {
+          MSDItem &item = items_[i];
+          item.key_ptr_ = reinterpret_cast<const unsigned char *>(
+              row->get_cell_payload(row_meta_, 0));
+          item.len_ = row->get_length(row_meta_, 0);
+          item.row_ptr_ = row;
+        }
+      }
+    }
+    return ret;
+  }
+  void sort(int64_t rows_begin, int64_t rows_end)
+  {
+    sort_items(items_, tmp_items_, item_cnt_, 0, 0);
+    for (int64_t i = 0; i < item_cnt_ && i < (rows_end - rows_begin); ++i) {
+      orig_sort_rows_.at(i + rows_begin) = items_[i].row_ptr_;
+    }
+  }
+  void reset()
+  {
+    if (nullptr != items_) {
+      alloc_.free(items_);
+      items_ = nullptr;
+      if (nullptr != callback_) {
+        callback_->free(mem_size_);
+      }
+    }
+    tmp_items_ = nullptr;
+    item_cnt_ = 0;
+    mem_size_ = 0;
+  }
+
+  // Sort %cnt items whose first %depth key bytes are equal, %tmp is scratch memory of
+  // the same size.
+  static void sort_items(MSDItem *items, MSDItem *tmp, int64_t cnt, int64_t depth,
+                         int64_t level)
+  {
+    int64_t hist[BUCKET_CNT];
+    bool skip_byte = true;
+    // skip the common prefix without scattering
+    while (skip_byte) {
+      skip_byte = false;
+      if (cnt < INSERTION_SORT_THRESHOLD) {
+        insertion_sort(items, cnt, depth);
+      } else if (level >= MAX_RECURSION_DEPTH) {
+        std::sort(items, items + cnt, ItemLess(depth));
+      } else {
+        MEMSET(hist, 0, sizeof(hist));
+        for (int64_t i = 0; i < cnt; i++) {
+          hist[bucket_of(items[i], depth)] += 1;
+        }
+        const int64_t first_bucket = bucket_of(items[0], depth);
+        if (hist[first_bucket] == cnt) {
+          // all keys share the current byte, go to the next one,
+          // or all keys end here and they are equal
+          if (0 != first_bucket) {
+            depth += 1;
+            skip_byte = true;
+          }
+        } else {
+          // exclusive prefix sum, after scatter hist[b] is the end of bucket b
+          int64_t start = 0;
+          for (int64_t b = 0; b < BUCKET_CNT; b++) {
+            const int64_t bucket_cnt = hist[b];
+            hist[b] = start;
+            start += bucket_cnt;
+          }
+          for (int64_t i = 0; i < cnt; i++) {
+            tmp[hist[bucket_of(items[i], depth)]++] = items[i];
+          }
+          MEMCPY(items, tmp, sizeof(MSDItem) * cnt);
+          // bucket 0 holds equal keys, no need to sort
+          for (int64_t b = 1; b < BUCKET_CNT; b++) {
+            start = hist[b - 1];
+            if (hist[b] - start > 1) {
+              sort_items(items + start, tmp + start, hist[b] - start, depth + 1, level + 1);
+            }
+          }
+        }
+      }
+    }
+  }
+
+private:
+  struct ItemLess
+  {
+    explicit ItemLess(const int64_t depth) : depth_(depth) {}
+    bool operator()(const MSDItem &l, const MSDItem &r) const
+    {
+      return compare(l, r, depth_) < 0;
+    }
+    int64_t depth_;
+  };
+
+  OB_INLINE static int64_t bucket_of(const MSDItem &item, const int64_t depth)
+  {
+    return depth < item.len_ ? 1 + item.key_ptr_[depth] : 0;
+  }
+  OB_INLINE static int compare(const MSDItem &l, const MSDItem &r, const int64_t depth)
+  {
+    const int64_t l_len = l.len_ - depth;
+    const int64_t r_len = r.len_ - depth;
+    int cmp = MEMCMP(l.key_ptr_ + depth, r.key_ptr_ + depth, std::min(l_len, r_len));
+    if (0 == cmp) {
+      cmp = l_len < r_len ? -1 : (l_len > r_len ? 1 : 0);
+    }
+    return cmp;
+  }
+  static void insertion_sort(MSDItem *items, const int64_t cnt, const int64_t depth)
+  {
+    for (int64_t i = 1; i < cnt; i++) {
+      MSDItem item = items[i];
+      int64_t j = i;
+      while (j > 0 && compare(item, items[j - 1], depth) < 0) {
+        items[j] = items[j - 1];
+        j--;
+      }
+      items[j] = item;
+    }
+  }
+
+private:
+  const RowMeta &row_meta_;
+  common::ObIArray<Store_Row *> &orig_sort_rows_;
+  common::ObIAllocator &alloc_;
+  ObSqlMemoryCallback *callback_;
+  MSDItem *items_;
+  MSDItem *tmp_items_;
+  int64_t item_cnt_;
+  int64_t mem_size_;
+  DISALLOW_COPY_AND_ASSIGN(ObMSDRadixSort);
+};
+
+} // end namespace sql
+} // end namespace oceanbase
+
+#endif /* OCEANBASE_SQL_ENGINE_SORT_SORT_MSD_RADIX_VEC_OP_H_ */
@@ -35,7 +35,7 @@ public:
                        K_(topk_offset_expr), K_(prefix_pos), K_(minimum_row_count),
                        K_(topk_precision), K_(prefix_pos), K_(is_local_merge_sort),
                        K_(prescan_enabled), K_(enable_encode_sortkey_opt), K_(has_addon),
-                       K_(part_cnt));
+                       K_(part_cnt), K_(compress_type));
 
 public:
   ObExpr *topn_expr_;
@@ -57,6 +57,8 @@ public:
   bool has_addon_;
   // if use, all_exprs_ is : hash(part_by) + part_by + order_by.
   int64_t part_cnt_;
+  // compressor of the dumped sort runs
+  ObCompressorType compress_type_;
 };
 
 class ObSortVecOp : public ObOperator
@@ -14,6 +14,7 @@
 #define OCEANBASE_SQL_ENGINE_SORT_SORT_VEC_OP_CONTEXT_H_
 
 #include "lib/container/ob_array.h"
+#include "lib/compress/ob_compress_util.h"
 #include "sql/engine/sort/ob_sort_basic_info.h"
 
 namespace oceanbase {
@@ -24,11 +25,11 @@ struct ObSortVecOpContext
     tenant_id_(UINT64_MAX), sk_exprs_(nullptr), addon_exprs_(nullptr), sk_collations_(nullptr),
     base_sk_collations_(nullptr), addon_collations_(nullptr), eval_ctx_(nullptr),
     exec_ctx_(nullptr), op_(nullptr), prefix_pos_(0), part_cnt_(0), topn_cnt_(INT64_MAX),
-    sort_row_cnt_(nullptr), flag_(0)
+    sort_row_cnt_(nullptr), compress_type_(common::NONE_COMPRESSOR), flag_(0)
   {}
   TO_STRING_KV(K_(tenant_id), KP_(sk_exprs), KP_(addon_exprs), KP_(sk_collations),
                KP_(base_sk_collations), KP_(addon_collations), K_(prefix_pos), K_(part_cnt),
-               K_(topn_cnt), KP_(sort_row_cnt), K_(flag));
+               K_(topn_cnt), KP_(sort_row_cnt), K_(compress_type), K_(flag));
 
   uint64_t tenant_id_;
   const ObIArray<ObExpr *> *sk_exprs_;
@@ -43,6 +44,8 @@ struct ObSortVecOpContext
   int64_t part_cnt_;
   int64_t topn_cnt_;
   int64_t *sort_row_cnt_;
+  // compressor of the dumped sort runs
+  common::ObCompressorType compress_type_;
   union
   {
     struct
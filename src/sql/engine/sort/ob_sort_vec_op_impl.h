@@ -20,10 +20,12 @@
 #include "sql/engine/sort/ob_sort_basic_info.h"
 #include "sql/engine/sort/ob_i_sort_vec_op_impl.h"
 #include "sql/engine/sort/ob_sort_adaptive_qs_vec_op.h"
+#include "sql/engine/sort/ob_sort_msd_radix_vec_op.h"
 #include "sql/engine/sort/ob_sort_compare_vec_op.h"
 #include "sql/engine/sort/ob_sort_key_vec_op.h"
 #include "sql/engine/sort/ob_sort_key_fetcher_vec_op.h"
 #include "sql/engine/sort/ob_sort_vec_op_eager_filter.h"
+#include "sql/engine/sort/ob_sort_vec_op_loser_tree.h"
 #include "sql/engine/sort/ob_sort_vec_op_store_row_factory.h"
 #include "observer/omt/ob_tenant_config_mgr.h"
 
@@ -60,7 +62,7 @@ public:
     ties_array_pos_(0), ties_array_(), sorted_dumped_rows_ptrs_(), last_ties_row_(nullptr), rows_(nullptr),
     sort_exprs_getter_(allocator_),
     store_row_factory_(allocator_, sql_mem_processor_, sk_row_meta_, addon_row_meta_, inmem_row_size_, topn_cnt_),
-    topn_filter_(nullptr), is_topn_filter_enabled_(false)
+    topn_filter_(nullptr), is_topn_filter_enabled_(false), compress_type_(NONE_COMPRESSOR)
   {}
   virtual ~ObSortVecOpImpl()
   {
@@ -96,7 +98,8 @@ public:
   int init_temp_row_store(const common::ObIArray<ObExpr *> &exprs, const int64_t mem_limit,
                           const int64_t batch_size, const bool need_callback,
                           const bool enable_dump, const int64_t extra_size,
-                          ObTempRowStore &row_store);
+                          ObTempRowStore &row_store,
+                          const common::ObCompressorType compressor_type = NONE_COMPRESSOR);
   int init_sort_temp_row_store(const int64_t batch_size);
   int init_store_row_factory();
   int init_eager_topn_filter(const common::ObIArray<Store_Row *> *dumped_rows, const int64_t max_batch_size);
@@ -221,6 +224,11 @@ protected:
                     bool &is_equal);
   int do_partition_sort(const RowMeta &row_meta, common::ObIArray<Store_Row *> &rows,
                         const int64_t rows_begin, const int64_t rows_end);
+  // sort rows by the order preserving encoded sort key, MSD radix sort for large input and
+  // adaptive quick sort for small input. %can_encode is false if the key is not encoded.
+  int sort_encoded_rows(const RowMeta &row_meta, common::ObIArray<Store_Row *> &rows,
+                        const int64_t rows_begin, const int64_t rows_end,
+                        common::ObIAllocator &alloc, bool &can_encode);
   void set_blk_holder(ObTempRowStore::BlockHolder *blk_holder);
   // for topn sort
   int add_heap_sort_row(const Store_Row *&store_row);
@@ -282,12 +290,12 @@ protected:
       SQL_ENG_LOG(WARN, "allocate memory failed", K(ret));
     } else if (OB_FAIL(init_temp_row_store(*sk_exprs_, 1, eval_ctx_->max_batch_size_, true,
                                            true /*enable dump*/, Store_Row::get_extra_size(true),
-                                           chunk->sk_store_))) {
+                                           chunk->sk_store_, compress_type_))) {
       SQL_ENG_LOG(WARN, "failed to init temp row store", K(ret));
     } else if (has_addon
                && OB_FAIL(init_temp_row_store(
                     *addon_exprs_, 1, eval_ctx_->max_batch_size_, true, true /*enable dump*/,
-                    Store_Row::get_extra_size(false), chunk->addon_store_))) {
+                    Store_Row::get_extra_size(false), chunk->addon_store_, compress_type_))) {
       SQL_ENG_LOG(WARN, "failed to init temp row store", K(ret));
     } else {
       while (OB_SUCC(ret)) {
@@ -372,7 +380,7 @@ protected:
   static const int64_t MAX_MERGE_WAYS = 256;
   static const int64_t INMEMORY_MERGE_SORT_WARN_WAYS = 10000;
   typedef common::ObBinaryHeap<Store_Row **, Compare, 16> IMMSHeap;
-  typedef common::ObBinaryHeap<SortVecOpChunk *, Compare, MAX_MERGE_WAYS> EMSHeap;
+  typedef ObSortVecOpLoserTree<SortVecOpChunk *, Compare, MAX_MERGE_WAYS> EMSHeap;
   typedef common::ObBinaryHeap<Store_Row *, Compare> TopnHeap;
 
   union
@@ -415,7 +423,7 @@ protected:
   bool heap_iter_begin_;
   // heap for in-memory merge sort local order rows
   IMMSHeap *imms_heap_;
-  // heap for external merge sort
+  // loser tree for external merge sort
   EMSHeap *ems_heap_;
   NextStoredRowFunc next_stored_row_func_;
   ObExecContext *exec_ctx_;
@@ -443,6 +451,7 @@ protected:
   ObSortVecOpStoreRowFactory<Store_Row, has_addon> store_row_factory_;
   ObSortVecOpEagerFilter<Compare, Store_Row, has_addon> *topn_filter_;
   bool is_topn_filter_enabled_;
+  common::ObCompressorType compress_type_;
 };
 
 } // end namespace sql
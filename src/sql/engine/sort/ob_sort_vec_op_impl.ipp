@@ -37,6 +37,7 @@ void ObSortVecOpImpl<Compare, Store_Row, has_addon>::reset()
   topn_cnt_ = INT64_MAX;
   outputted_rows_cnt_ = 0;
   is_fetch_with_ties_ = false;
+  compress_type_ = NONE_COMPRESSOR;
   rows_ = nullptr;
   ties_array_pos_ = 0;
   sort_exprs_getter_.reset();
@@ -163,14 +164,15 @@ template <typename Compare, typename Store_Row, bool has_addon>
 int ObSortVecOpImpl<Compare, Store_Row, has_addon>::init_temp_row_store(
   const common::ObIArray<ObExpr *> &exprs, const int64_t mem_limit, const int64_t batch_size,
   const bool need_callback, const bool enable_dump, const int64_t extra_size,
-  ObTempRowStore &row_store)
+  ObTempRowStore &row_store, const common::ObCompressorType compressor_type)
 {
   int ret = OB_SUCCESS;
   const bool enable_trunc = true;
   const bool reorder_fixed_expr = true;
   ObMemAttr mem_attr(tenant_id_, ObModIds::OB_SQL_SORT_ROW, ObCtxIds::WORK_AREA);
   if (OB_FAIL(row_store.init(exprs, batch_size, mem_attr, mem_limit, enable_dump,
-                             extra_size /* row_extra_size */, reorder_fixed_expr, enable_trunc))) {
+                             extra_size /* row_extra_size */, reorder_fixed_expr, enable_trunc,
+                             compressor_type))) {
     SQL_ENG_LOG(WARN, "init row store failed", K(ret));
   } else {
     row_store.set_dir_id(sql_mem_processor_.get_dir_id());
@@ -270,6 +272,7 @@ int ObSortVecOpImpl<Compare, Store_Row, has_addon>::init(ObSortVecOpContext &ctx
     topn_cnt_ = ctx.topn_cnt_;
     use_heap_sort_ = is_topn_sort();
     is_fetch_with_ties_ = ctx.is_fetch_with_ties_;
+    compress_type_ = ctx.compress_type_;
     int64_t batch_size = eval_ctx_->max_batch_size_;
     if (OB_FAIL(merge_sk_addon_exprs(sk_exprs_, addon_exprs_))) {
       SQL_ENG_LOG(WARN, "failed to merge sort key and addon exprs", K(ret));
@@ -1244,6 +1247,32 @@ void ObSortVecOpImpl<Compare, Store_Row, has_addon>::set_blk_holder(
   }
 }
 
+template <typename Compare, typename Store_Row, bool has_addon>
+int ObSortVecOpImpl<Compare, Store_Row, has_addon>::sort_encoded_rows(
+  const RowMeta &row_meta, common::ObIArray<Store_Row *> &rows, const int64_t rows_begin,
+  const int64_t rows_end, common::ObIAllocator &alloc, bool &can_encode)
+{
+  int ret = OB_SUCCESS;
+  can_encode = true;
+  if (ObMSDRadixSort<Store_Row>::need_radix_sort(rows_end - rows_begin)) {
+    ObMSDRadixSort<Store_Row> msd(rows, row_meta, alloc);
+    msd.set_callback(&sql_mem_processor_);
+    if (OB_FAIL(msd.init(rows_begin, rows_end, can_encode))) {
+      SQL_ENG_LOG(WARN, "failed to init msd radix sort", K(ret));
+    } else if (can_encode) {
+      msd.sort(rows_begin, rows_end);
+    }
+  } else {
+    ObAdaptiveQS<Store_Row> aqs(rows, row_meta, alloc);
+    if (OB_FAIL(aqs.init(rows, alloc, rows_begin, rows_end, can_encode))) {
+      SQL_ENG_LOG(WARN, "failed to init aqs", K(ret));
+    } else if (can_encode) {
+      aqs.sort(rows_begin, rows_end);
+    }
+  }
+  return ret;
+}
+
 template <typename Compare, typename Store_Row, bool has_addon>
 int ObSortVecOpImpl<Compare, Store_Row, has_addon>::do_partition_sort(
   const RowMeta &row_meta, common::ObIArray<Store_Row *> &rows, const int64_t rows_begin,
@@ -1373,12 +1402,10 @@ int ObSortVecOpImpl<Compare, Store_Row, has_addon>::do_partition_sort(
       if (comp_.cmp_start_ != comp_.cmp_end_) {
         if (enable_encode_sortkey_) {
           bool can_encode = true;
-          ObAdaptiveQS<Store_Row> aqs(rows, row_meta, allocator_);
-          if (OB_FAIL(aqs.init(rows, allocator_, rows_last, rows_idx, can_encode))) {
-            SQL_ENG_LOG(WARN, "failed to init aqs", K(ret));
-          } else if (can_encode) {
-            aqs.sort(rows_last, rows_idx);
-          } else {
+          if (OB_FAIL(sort_encoded_rows(row_meta, rows, rows_last, rows_idx, allocator_,
+                                        can_encode))) {
+            SQL_ENG_LOG(WARN, "failed to sort encoded rows", K(ret));
+          } else if (!can_encode) {
             enable_encode_sortkey_ = false;
             comp_.fallback_to_disable_encode_sortkey();
             std::sort(&rows.at(0) + rows_last, &rows.at(0) + rows_idx, CopyableComparer(comp_));
@@ -1419,13 +1446,10 @@ int ObSortVecOpImpl<Compare, Store_Row, has_addon>::sort_inmem_data()
         do_partition_sort(*sk_row_meta_, *rows_, begin, rows_->count());
       } else if (enable_encode_sortkey_) {
         bool can_encode = true;
-        ObAdaptiveQS<Store_Row> aqs(*rows_, *sk_row_meta_, mem_context_->get_malloc_allocator());
-        if (OB_FAIL(aqs.init(*rows_, mem_context_->get_malloc_allocator(), begin, rows_->count(),
-                             can_encode))) {
-          SQL_ENG_LOG(WARN, "failed to init aqs", K(ret));
-        } else if (can_encode) {
-          aqs.sort(begin, rows_->count());
-        } else {
+        if (OB_FAIL(sort_encoded_rows(*sk_row_meta_, *rows_, begin, rows_->count(),
+                                      mem_context_->get_malloc_allocator(), can_encode))) {
+          SQL_ENG_LOG(WARN, "failed to sort encoded rows", K(ret));
+        } else if (!can_encode) {
           enable_encode_sortkey_ = false;
           comp_.fallback_to_disable_encode_sortkey();
           std::sort(&rows_->at(begin), &rows_->at(0) + rows_->count(), CopyableComparer(comp_));
@@ -1700,8 +1724,7 @@ int ObSortVecOpImpl<Compare, Store_Row, has_addon>::build_ems_heap(int64_t &merg
     }
 
     if (nullptr == ems_heap_) {
-      if (OB_ISNULL(ems_heap_ = OB_NEWx(EMSHeap, (&mem_context_->get_malloc_allocator()), comp_,
-                                        &mem_context_->get_malloc_allocator()))) {
+      if (OB_ISNULL(ems_heap_ = OB_NEWx(EMSHeap, (&mem_context_->get_malloc_allocator()), comp_))) {
         ret = OB_ALLOCATE_MEMORY_FAILED;
         SQL_ENG_LOG(WARN, "allocate memory failed", K(ret));
       }
@@ -0,0 +1,161 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_SQL_ENGINE_SORT_SORT_VEC_OP_LOSER_TREE_H_
+#define OCEANBASE_SQL_ENGINE_SORT_SORT_VEC_OP_LOSER_TREE_H_
+
+#include <utility>
+#include "lib/utility/ob_macro_utils.h"
+#include "lib/oblog/ob_log_module.h"
+#include "lib/ob_errno.h"
+
+namespace oceanbase
+{
+namespace sql
+{
+
+// Tree of losers for k-way merge of the external merge sort.
+//
+// Same interface and comparator as common::ObBinaryHeap (the comparator returns true if
+// %l is after %r, the top is the minimum), so it can replace the merge heap directly.
+// Replacing the top player replays one leaf to root path, which costs log(k) comparisons
+// instead of the 2 * log(k) comparisons of heap sift down.
+//
+// Players are collected by push() and the tree is built lazily on the first top().
+template <typename T, typename Compare, int64_t MAX_PLAYER_CNT>
+class ObSortVecOpLoserTree
+{
+public:
+  explicit ObSortVecOpLoserTree(Compare &cmp)
+    : cmp_(cmp), player_cnt_(0), active_cnt_(0), need_build_(false)
+  {}
+  ~ObSortVecOpLoserTree() { reset(); }
+
+  int push(const T &player)
+  {
+    int ret = common::OB_SUCCESS;
+    if (player_cnt_ >= MAX_PLAYER_CNT) {
+      ret = common::OB_SIZE_OVERFLOW;
+      SQL_ENG_LOG(WARN, "too many players", K(ret), K(player_cnt_));
+    } else {
+      players_[player_cnt_] = player;
+      exhausted_[player_cnt_] = false;
+      player_cnt_ += 1;
+      active_cnt_ += 1;
+      need_build_ = true;
+    }
+    return ret;
+  }
+  T &top()
+  {
+    if (need_build_) {
+      build();
+    }
+    return players_[tree_[0]];
+  }
+  // the top player is exhausted
+  int pop()
+  {
+    int ret = common::OB_SUCCESS;
+    if (OB_UNLIKELY(empty())) {
+      ret = common::OB_EMPTY_RESULT;
+      SQL_ENG_LOG(WARN, "loser tree is empty", K(ret));
+    } else {
+      if (need_build_) {
+        build();
+      }
+      const int64_t winner = tree_[0];
+      exhausted_[winner] = true;
+      active_cnt_ -= 1;
+      replay(winner);
+    }
+    return ret;
+  }
+  // the top player moves to its next row
+  int replace_top(const T &player)
+  {
+    int ret = common::OB_SUCCESS;
+    if (OB_UNLIKELY(empty())) {
+      ret = common::OB_EMPTY_RESULT;
+      SQL_ENG_LOG(WARN, "loser tree is empty", K(ret));
+    } else {
+      if (need_build_) {
+        build();
+      }
+      const int64_t winner = tree_[0];
+      players_[winner] = player;
+      replay(winner);
+    }
+    return ret;
+  }
+  bool empty() const { return 0 == active_cnt_; }
+  int64_t count() const { return active_cnt_; }
+  void reset()
+  {
+    player_cnt_ = 0;
+    active_cnt_ = 0;
+    need_build_ = false;
+  }
+
+private:
+  // a exhausted player always loses
+  OB_INLINE bool beat(const int64_t l, const int64_t r)
+  {
+    return exhausted_[r] || (!exhausted_[l] && !cmp_(players_[l], players_[r]));
+  }
+  // Leaf of player i is node (player_cnt_ + i), the parent of node n is n / 2,
+  // internal node n in [1, player_cnt_) keeps the loser of its match, tree_[0] is the winner.
+  void build()
+  {
+    int64_t winners[MAX_PLAYER_CNT * 2];
+    for (int64_t i = 0; i < player_cnt_; i++) {
+      winners[player_cnt_ + i] = i;
+    }
+    for (int64_t n = player_cnt_ - 1; n >= 1; n--) {
+      const int64_t l = winners[2 * n];
+      const int64_t r = winners[2 * n + 1];
+      if (beat(l, r)) {
+        winners[n] = l;
+        tree_[n] = r;
+      } else {
+        winners[n] = r;
+        tree_[n] = l;
+      }
+    }
+    tree_[0] = player_cnt_ > 1 ? winners[1] : 0;
+    need_build_ = false;
+  }
+  void replay(int64_t winner)
+  {
+    for (int64_t n = (player_cnt_ + winner) / 2; n >= 1; n /= 2) {
+      if (beat(tree_[n], winner)) {
+        std::swap(tree_[n], winner);
+      }
+    }
+    tree_[0] = winner;
+  }
+
+private:
+  Compare &cmp_;
+  int64_t player_cnt_;
+  int64_t active_cnt_;
+  bool need_build_;
+  T players_[MAX_PLAYER_CNT];
+  bool exhausted_[MAX_PLAYER_CNT];
+  int64_t tree_[MAX_PLAYER_CNT];
+  DISALLOW_COPY_AND_ASSIGN(ObSortVecOpLoserTree);
+};
+
+} // end namespace sql
+} // end namespace oceanbase
+
+#endif /* OCEANBASE_SQL_ENGINE_SORT_SORT_VEC_OP_LOSER_TREE_H_ */
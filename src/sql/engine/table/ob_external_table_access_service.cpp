@@ -348,6 +348,12 @@ int ObExternalTableAccessService::table_scan(
         LOG_WARN("alloc memory failed", K(ret));
       }
       break;
+    case ObExternalFileFormat::PARQUET_FORMAT:
+      if (OB_ISNULL(row_iter = OB_NEWx(ObParquetTableRowIterator, (scan_param.allocator_)))) {
+        ret = OB_ALLOCATE_MEMORY_FAILED;
+        LOG_WARN("alloc memory failed", K(ret));
+      }
+      break;
     default:
       ret = OB_ERR_UNEXPECTED;
       LOG_WARN("unexpected format", K(ret), "format", param.external_file_format_.format_type_);
@@ -376,6 +382,7 @@ int ObExternalTableAccessService::table_rescan(ObVTableScanParam &param, ObNewRo
   } else {
     switch (param.external_file_format_.format_type_) {
       case ObExternalFileFormat::CSV_FORMAT:
+      case ObExternalFileFormat::PARQUET_FORMAT:
         result->reset();
         break;
       default:
@@ -478,7 +485,7 @@ int ObCSVTableRowIterator::expand_buf()
   return ret;
 }
 
-int ObCSVTableRowIterator::init_exprs(const storage::ObTableScanParam *scan_param)
+int ObExternalTableRowIterator::init_exprs(const storage::ObTableScanParam *scan_param)
 {
   int ret = OB_SUCCESS;
   if (OB_ISNULL(scan_param)) {
@@ -868,6 +875,535 @@ void ObCSVTableRowIterator::reset()
   state_.reuse();
 }
 
+ObParquetTableRowIterator::ObParquetTableRowIterator()
+  : bit_vector_cache_(NULL), file_meta_(file_allocator_), column_readers_(NULL)
+{
+}
+
+ObParquetTableRowIterator::~ObParquetTableRowIterator()
+{
+  if (nullptr != column_readers_) {
+    for (int64_t i = 0; i < file_column_idxs_.count(); ++i) {
+      column_readers_[i].~ObParquetColumnReader();
+    }
+    allocator_.free(column_readers_);
+    column_readers_ = nullptr;
+  }
+  if (nullptr != bit_vector_cache_) {
+    allocator_.free(bit_vector_cache_);
+  }
+  file_meta_.reset();
+}
+
+int ObParquetTableRowIterator::init(const storage::ObTableScanParam *scan_param)
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(scan_param)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("scan param is null", K(ret));
+  } else {
+    lib::ObMemAttr attr(scan_param->tenant_id_, "ParquetRowIter");
+    const int64_t file_column_cnt = scan_param->ext_file_column_exprs_->count();
+    void *mem = nullptr;
+    allocator_.set_attr(attr);
+    file_allocator_.set_attr(attr);
+    row_group_allocator_.set_attr(attr);
+    batch_allocator_.set_attr(attr);
+    OZ (ObExternalTableRowIterator::init(scan_param));
+    OZ (init_exprs(scan_param));
+    OZ (data_access_driver_.init(scan_param_->external_file_location_, scan_param->external_file_access_info_));
+    OZ (init_prune_filters());
+    OZ (init_native_columns());
+    OZ (file_column_idxs_.prepare_allocate(file_column_cnt));
+    if (OB_SUCC(ret) && file_column_cnt > 0) {
+      if (OB_ISNULL(mem = allocator_.alloc(sizeof(ObParquetColumnReader) * file_column_cnt))) {
+        ret = OB_ALLOCATE_MEMORY_FAILED;
+        LOG_WARN("fail to alloc column readers", K(ret), K(file_column_cnt));
+      } else {
+        column_readers_ = static_cast<ObParquetColumnReader *>(mem);
+        for (int64_t i = 0; i < file_column_cnt; ++i) {
+          new (column_readers_ + i) ObParquetColumnReader();
+        }
+      }
+    }
+  }
+  return ret;
+}
+
+static const ObExpr *find_file_column_expr(const ObExpr *expr)
+{
+  const ObExpr *file_column_expr = nullptr;
+  if (OB_ISNULL(expr)) {
+  } else if (T_PSEUDO_EXTERNAL_FILE_COL == expr->type_) {
+    file_column_expr = expr;
+  } else if (T_FUN_COLUMN_CONV == expr->type_ || T_FUN_SYS_CAST == expr->type_) {
+    // other arguments of column conv and cast are constants
+    for (int64_t i = 0; nullptr == file_column_expr && i < expr->arg_cnt_; ++i) {
+      file_column_expr = find_file_column_expr(expr->args_[i]);
+    }
+  }
+  return file_column_expr;
+}
+
+int ObParquetTableRowIterator::init_prune_filters()
+{
+  int ret = OB_SUCCESS;
+  prune_filters_.reuse();
+  if (OB_NOT_NULL(scan_param_->op_filters_)) {
+    const ObExprPtrIArray &filters = *scan_param_->op_filters_;
+    for (int64_t i = 0; OB_SUCC(ret) && i < filters.count(); ++i) {
+      const ObExpr *filter = filters.at(i);
+      ObItemType cmp_type = OB_ISNULL(filter) ? T_INVALID : filter->type_;
+      if ((T_OP_EQ == cmp_type || T_OP_LT == cmp_type || T_OP_LE == cmp_type
+           || T_OP_GT == cmp_type || T_OP_GE == cmp_type) && 2 == filter->arg_cnt_) {
+        ObExpr *column_expr = filter->args_[0];
+        ObExpr *value_expr = filter->args_[1];
+        int64_t column_idx = -1;
+        const ObExpr *file_column_expr = nullptr;
+        if (column_expr->is_const_expr() && !value_expr->is_const_expr()) {
+          std::swap(column_expr, value_expr);
+          cmp_type = T_OP_LT == cmp_type ? T_OP_GT
+              : T_OP_LE == cmp_type ? T_OP_GE
+              : T_OP_GT == cmp_type ? T_OP_LT
+              : T_OP_GE == cmp_type ? T_OP_LE : cmp_type;
+        }
+        for (int64_t j = 0; -1 == column_idx && j < column_exprs_.count(); ++j) {
+          if (column_exprs_.at(j) == column_expr) {
+            column_idx = j;
+          }
+        }
+        if (column_idx >= 0 && value_expr->is_const_expr()
+            && column_expr->datum_meta_.type_ == value_expr->datum_meta_.type_
+            && OB_NOT_NULL(file_column_expr = find_file_column_expr(
+                             scan_param_->ext_column_convert_exprs_->at(column_idx)))) {
+          PruneFilter prune_filter;
+          prune_filter.cmp_type_ = cmp_type;
+          prune_filter.file_column_idx_ = file_column_expr->extra_ - 1;
+          prune_filter.value_type_ = value_expr->datum_meta_.type_;
+          prune_filter.value_expr_ = value_expr;
+          OZ (prune_filters_.push_back(prune_filter));
+        }
+      }
+    }
+    LOG_DEBUG("parquet prune filters", K(ret), K(prune_filters_));
+  }
+  return ret;
+}
+
+static int64_t count_expr_refs(const ObExpr *expr, const ObExpr *target)
+{
+  int64_t cnt = 0;
+  if (OB_ISNULL(expr)) {
+  } else if (expr == target) {
+    cnt = 1;
+  } else {
+    for (int64_t i = 0; i < expr->arg_cnt_; ++i) {
+      cnt += count_expr_refs(expr->args_[i], target);
+    }
+  }
+  return cnt;
+}
+
+// A column is filled directly by the parquet reader if its convert expr is
+// column_conv(file column) or column_conv(cast(file column)) of a nullable column and the
+// file column is not referred by other convert exprs. column_conv of a not null column
+// rejects null values, which the native path skips.
+int ObParquetTableRowIterator::init_native_columns()
+{
+  int ret = OB_SUCCESS;
+  const ExprFixedArray &file_column_exprs = *(scan_param_->ext_file_column_exprs_);
+  const ExprFixedArray &convert_exprs = *(scan_param_->ext_column_convert_exprs_);
+  ObEvalCtx &eval_ctx = scan_param_->op_->get_eval_ctx();
+  native_column_idxs_.reuse();
+  is_native_columns_.reuse();
+  for (int64_t i = 0; OB_SUCC(ret) && i < file_column_exprs.count(); ++i) {
+    OZ (native_column_idxs_.push_back(-1));
+  }
+  for (int64_t j = 0; OB_SUCC(ret) && j < convert_exprs.count(); ++j) {
+    const ObExpr *convert_expr = convert_exprs.at(j);
+    const ObExpr *value_expr = nullptr;
+    ObDatum *nullable_datum = nullptr;
+    OZ (is_native_columns_.push_back(false));
+    if (OB_FAIL(ret)) {
+    } else if (OB_NOT_NULL(convert_expr) && T_FUN_COLUMN_CONV == convert_expr->type_
+               && convert_expr->arg_cnt_ > 4) {
+      // args of column_conv: type, collation, accuracy, nullable, value[, column info]
+      if (OB_FAIL(convert_expr->args_[3]->eval(eval_ctx, nullable_datum))) {
+        LOG_WARN("fail to eval nullable of column conv", K(ret), K(j));
+      } else if (!nullable_datum->is_null() && 0 != nullable_datum->get_int()) {
+        value_expr = convert_expr->args_[4];
+        if (OB_NOT_NULL(value_expr) && T_FUN_SYS_CAST == value_expr->type_) {
+          value_expr = value_expr->args_[0];
+        }
+      }
+    }
+    if (OB_NOT_NULL(value_expr) && T_PSEUDO_EXTERNAL_FILE_COL == value_expr->type_) {
+      for (int64_t i = 0; OB_SUCC(ret) && i < file_column_exprs.count(); ++i) {
+        if (file_column_exprs.at(i) == value_expr) {
+          int64_t ref_cnt = 0;
+          for (int64_t k = 0; k < convert_exprs.count(); ++k) {
+            ref_cnt += count_expr_refs(convert_exprs.at(k), value_expr);
+          }
+          if (1 == ref_cnt) {
+            native_column_idxs_.at(i) = j;
+          }
+        }
+      }
+    }
+  }
+  LOG_DEBUG("parquet native columns", K(ret), K(native_column_idxs_));
+  return ret;
+}
+
+int ObParquetTableRowIterator::read_fully(char *buf, const int64_t len, const int64_t offset)
+{
+  int ret = OB_SUCCESS;
+  int64_t total_size = 0;
+  while (OB_SUCC(ret) && total_size < len) {
+    int64_t read_size = 0;
+    if (OB_FAIL(data_access_driver_.pread(buf + total_size, len - total_size,
+                                          offset + total_size, read_size))) {
+      LOG_WARN("fail to read file", K(ret), K(url_), K(offset), K(len));
+    } else if (OB_UNLIKELY(read_size <= 0)) {
+      ret = OB_INVALID_DATA;
+      LOG_WARN("unexpected end of file", K(ret), K(url_), K(offset), K(len), K(total_size));
+    } else {
+      total_size += read_size;
+    }
+  }
+  return ret;
+}
+
+int ObParquetTableRowIterator::read_file_meta()
+{
+  int ret = OB_SUCCESS;
+  const int64_t file_size = state_.file_size_;
+  const int64_t read_len = MIN(file_size, FOOTER_PREFETCH_SIZE);
+  char *buf = nullptr;
+  const char *tail = nullptr;
+  const char *footer = nullptr;
+  int64_t footer_len = 0;
+  file_meta_.reset();
+  file_allocator_.reuse();
+  if (OB_UNLIKELY(file_size < ObParquetDef::MAGIC_LEN + ObParquetDef::FOOTER_TAIL_LEN)) {
+    ret = OB_INVALID_DATA;
+    LOG_WARN("file is too small to be parquet", K(ret), K(url_), K(file_size));
+  } else if (OB_ISNULL(buf = static_cast<char *>(file_allocator_.alloc(read_len)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("fail to alloc memory", K(ret), K(read_len));
+  } else if (OB_FAIL(read_fully(buf, read_len, file_size - read_len))) {
+    LOG_WARN("fail to read file tail", K(ret), K(url_));
+  } else if (FALSE_IT(tail = buf + read_len - ObParquetDef::FOOTER_TAIL_LEN)) {
+  } else if (OB_UNLIKELY(0 != MEMCMP(tail + sizeof(uint32_t), ObParquetDef::MAGIC, ObParquetDef::MAGIC_LEN))) {
+    ret = OB_INVALID_DATA;
+    LOG_WARN("invalid parquet magic", K(ret), K(url_));
+  } else if (FALSE_IT(footer_len = *reinterpret_cast<const uint32_t *>(tail))) {
+  } else if (OB_UNLIKELY(footer_len > file_size - ObParquetDef::MAGIC_LEN - ObParquetDef::FOOTER_TAIL_LEN)) {
+    ret = OB_INVALID_DATA;
+    LOG_WARN("invalid parquet footer length", K(ret), K(url_), K(footer_len), K(file_size));
+  } else if (footer_len + ObParquetDef::FOOTER_TAIL_LEN <= read_len) {
+    footer = tail - footer_len;
+  } else if (OB_ISNULL(buf = static_cast<char *>(file_allocator_.alloc(footer_len)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("fail to alloc memory", K(ret), K(footer_len));
+  } else if (OB_FAIL(read_fully(buf, footer_len, file_size - ObParquetDef::FOOTER_TAIL_LEN - footer_len))) {
+    LOG_WARN("fail to read footer", K(ret), K(url_));
+  } else {
+    footer = buf;
+  }
+  if (OB_SUCC(ret) && OB_FAIL(file_meta_.parse(footer, footer_len))) {
+    LOG_WARN("fail to parse parquet footer", K(ret), K(url_));
+  }
+  return ret;
+}
+
+int ObParquetTableRowIterator::open_next_file()
+{
+  int ret = OB_SUCCESS;
+  ObString location = scan_param_->external_file_location_;
+  const ExprFixedArray &file_column_exprs = *(scan_param_->ext_file_column_exprs_);
+
+  if (data_access_driver_.is_opened()) {
+    data_access_driver_.close();
+  }
+
+  do {
+    ObString file_url;
+    int64_t start_line = 0;
+    int64_t end_line = 0;
+    int64_t task_idx = state_.file_idx_++;
+    url_.reuse();
+    if (task_idx >= scan_param_->key_ranges_.count()) {
+      ret = OB_ITER_END;
+    } else if (OB_FAIL(ObExternalTableUtils::resolve_line_number_range(
+                                                              scan_param_->key_ranges_.at(task_idx),
+                                                              ObExternalTableUtils::LINE_NUMBER,
+                                                              start_line,
+                                                              end_line))) {
+      LOG_WARN("failed to resolve range in external table", K(ret));
+    } else {
+      const ObObj *start_key = scan_param_->key_ranges_.at(task_idx).get_start_key().get_obj_ptr();
+      file_url = start_key[ObExternalTableUtils::FILE_URL].get_string();
+      state_.cur_file_name_ = file_url;
+      state_.cur_file_id_ = start_key[ObExternalTableUtils::FILE_ID].get_int();
+      // line numbers [3, 7] are rows [2, 7)
+      state_.cur_row_idx_ = start_line - MIN_EXTERNAL_TABLE_LINE_NUMBER;
+      state_.end_row_idx_ = end_line;
+      const char *split_char = "/";
+      OZ (url_.append_fmt("%.*s%s%.*s", location.length(), location.ptr(),
+                                        (location.empty() || location[location.length() - 1] == '/') ? "" : split_char,
+                                        file_url.length(), file_url.ptr()));
+      OZ (data_access_driver_.get_file_size(url_.string(), state_.file_size_));
+    }
+    LOG_DEBUG("try next file", K(ret), K(url_), K(file_url), K(state_));
+  } while (OB_SUCC(ret) && 0 >= state_.file_size_); //skip empty file
+  OZ (data_access_driver_.open(url_.string()), url_);
+  OZ (read_file_meta());
+  if (OB_SUCC(ret)) {
+    for (int64_t i = 0; i < file_column_exprs.count(); ++i) {
+      const int64_t column_idx = file_column_exprs.at(i)->extra_ - 1;
+      file_column_idxs_.at(i) = (column_idx >= 0 && column_idx < file_meta_.get_column_count()) ? column_idx : -1;
+    }
+    state_.row_group_idx_ = 0;
+    state_.row_group_end_idx_ = state_.cur_row_idx_;
+  }
+
+  LOG_DEBUG("open external parquet file", K(ret), K(url_), K(state_), K(file_meta_));
+
+  return ret;
+}
+
+int ObParquetTableRowIterator::can_skip_row_group(const int64_t row_group_idx, bool &can_skip)
+{
+  int ret = OB_SUCCESS;
+  ObEvalCtx &eval_ctx = scan_param_->op_->get_eval_ctx();
+  can_skip = false;
+  for (int64_t i = 0; OB_SUCC(ret) && !can_skip && i < prune_filters_.count(); ++i) {
+    const PruneFilter &filter = prune_filters_.at(i);
+    ObDatum *value = nullptr;
+    if (filter.file_column_idx_ < 0 || filter.file_column_idx_ >= file_meta_.get_column_count()) {
+      // the column is filled with null
+    } else if (OB_FAIL(filter.value_expr_->eval(eval_ctx, value))) {
+      LOG_WARN("fail to eval filter value", K(ret), K(filter));
+    } else if (OB_FAIL(ObParquetFileMeta::can_skip_chunk(
+                         file_meta_.get_column(filter.file_column_idx_),
+                         file_meta_.get_chunk(row_group_idx, filter.file_column_idx_),
+                         filter.cmp_type_, filter.value_type_, *value, can_skip))) {
+      LOG_WARN("fail to check chunk statistics", K(ret), K(filter), K(row_group_idx));
+    }
+  }
+  return ret;
+}
+
+int ObParquetTableRowIterator::open_next_row_group()
+{
+  int ret = OB_SUCCESS;
+  bool is_opened = false;
+  while (OB_SUCC(ret) && !is_opened) {
+    const int64_t row_group_idx = state_.row_group_idx_;
+    bool can_skip = false;
+    if (row_group_idx >= file_meta_.get_row_group_count() || state_.cur_row_idx_ >= state_.end_row_idx_) {
+      ret = OB_ITER_END;
+    } else {
+      const ObParquetRowGroupMeta &row_group = file_meta_.get_row_group(row_group_idx);
+      const int64_t row_group_end = row_group.first_row_idx_ + row_group.num_rows_;
+      ++state_.row_group_idx_;
+      if (row_group_end <= state_.cur_row_idx_) {
+        // before the line number range
+      } else if (OB_FAIL(can_skip_row_group(row_group_idx, can_skip))) {
+        LOG_WARN("fail to check row group", K(ret), K(row_group_idx));
+      } else if (can_skip) {
+        state_.cur_row_idx_ = row_group_end;
+        LOG_DEBUG("skip parquet row group", K(row_group_idx), K(row_group));
+      } else {
+        const int64_t skip_rows = MAX(state_.cur_row_idx_, row_group.first_row_idx_) - row_group.first_row_idx_;
+        row_group_allocator_.reuse();
+        for (int64_t i = 0; OB_SUCC(ret) && i < file_column_idxs_.count(); ++i) {
+          const int64_t column_idx = file_column_idxs_.at(i);
+          const int64_t native_idx = native_column_idxs_.at(i);
+          const bool output_native = column_idx >= 0 && native_idx >= 0
+              && ObParquetColumnReader::is_native_type(file_meta_.get_column(column_idx),
+                                                       column_exprs_.at(native_idx)->datum_meta_.type_,
+                                                       column_exprs_.at(native_idx)->datum_meta_.scale_);
+          char *buf = nullptr;
+          if (column_idx < 0) {
+            // the file has no such column
+          } else {
+            const ObParquetColumnChunkMeta &chunk = file_meta_.get_chunk(row_group_idx, column_idx);
+            const int64_t offset = chunk.get_start_offset();
+            const int64_t len = chunk.total_compressed_size_;
+            if (OB_UNLIKELY(offset < 0 || len <= 0 || offset + len > state_.file_size_)) {
+              ret = OB_INVALID_DATA;
+              LOG_WARN("invalid column chunk", K(ret), K(url_), K(chunk), K(state_.file_size_));
+            } else if (OB_ISNULL(buf = static_cast<char *>(row_group_allocator_.alloc(len)))) {
+              ret = OB_ALLOCATE_MEMORY_FAILED;
+              LOG_WARN("fail to alloc memory", K(ret), K(len));
+            } else if (OB_FAIL(read_fully(buf, len, offset))) {
+              LOG_WARN("fail to read column chunk", K(ret), K(url_), K(chunk));
+            } else if (OB_FAIL(column_readers_[i].init(file_meta_.get_column(column_idx), chunk,
+                                                       buf, len, row_group_allocator_,
+                                                       output_native))) {
+              LOG_WARN("fail to init column reader", K(ret), K(chunk));
+            } else if (OB_FAIL(column_readers_[i].skip_rows(skip_rows))) {
+              LOG_WARN("fail to skip rows", K(ret), K(skip_rows));
+            }
+          }
+          if (native_idx >= 0) {
+            is_native_columns_.at(native_idx) = output_native;
+          }
+        }
+        if (OB_SUCC(ret)) {
+          is_opened = true;
+          state_.cur_row_idx_ = row_group.first_row_idx_ + skip_rows;
+          state_.row_group_end_idx_ = MIN(row_group_end, state_.end_row_idx_);
+        }
+      }
+    }
+  }
+  return ret;
+}
+
+int ObParquetTableRowIterator::fill_rows(const int64_t capacity, const bool is_batch, int64_t &row_cnt)
+{
+  int ret = OB_SUCCESS;
+  const ExprFixedArray &file_column_exprs = *(scan_param_->ext_file_column_exprs_);
+  ObEvalCtx &eval_ctx = scan_param_->op_->get_eval_ctx();
+  row_cnt = 0;
+  batch_allocator_.reuse();
+  // batches never cross row groups
+  while (OB_SUCC(ret) && state_.cur_row_idx_ >= state_.row_group_end_idx_) {
+    if (state_.is_end_file_) {
+      if (OB_FAIL(open_next_file())) {
+        //do not print log
+      } else {
+        state_.is_end_file_ = false;
+      }
+    } else if (OB_FAIL(open_next_row_group())) {
+      if (OB_ITER_END == ret) {
+        ret = OB_SUCCESS;
+        state_.is_end_file_ = true;
+      } else {
+        LOG_WARN("fail to open next row group", K(ret), K(state_));
+      }
+    }
+  }
+  if (OB_SUCC(ret)) {
+    row_cnt = MIN(capacity, state_.row_group_end_idx_ - state_.cur_row_idx_);
+    for (int64_t i = 0; OB_SUCC(ret) && i < file_column_exprs.count(); ++i) {
+      const int64_t native_idx = native_column_idxs_.at(i);
+      const bool is_native = native_idx >= 0 && is_native_columns_.at(native_idx);
+      // native values are written into the column expr, the datums may refer to the
+      // convert expr of previous row groups
+      ObExpr *file_column_expr = is_native ? column_exprs_.at(native_idx) : file_column_exprs.at(i);
+      ObDatum *datums = !is_batch ? &file_column_expr->locate_datum_for_write(eval_ctx)
+                        : is_native ? file_column_expr->locate_datums_for_update(eval_ctx, row_cnt)
+                        : file_column_expr->locate_batch_datums(eval_ctx);
+      if (file_column_idxs_.at(i) < 0) {
+        for (int64_t j = 0; j < row_cnt; ++j) {
+          datums[j].set_null();
+        }
+      } else if (OB_FAIL(column_readers_[i].read_batch(row_cnt, datums, batch_allocator_))) {
+        LOG_WARN("fail to read parquet column", K(ret), K(i), K(url_), K(state_));
+      }
+      if (OB_SUCC(ret)) {
+        file_column_expr->set_evaluated_flag(eval_ctx);
+      }
+    }
+    if (OB_SUCC(ret) && OB_NOT_NULL(file_id_expr_)) {
+      ObDatum *datums = is_batch ? file_id_expr_->locate_batch_datums(eval_ctx)
+                                 : &file_id_expr_->locate_datum_for_write(eval_ctx);
+      for (int64_t i = 0; i < row_cnt; i++) {
+        datums[i].set_int(state_.cur_file_id_);
+      }
+      file_id_expr_->set_evaluated_flag(eval_ctx);
+    }
+    if (OB_SUCC(ret) && OB_NOT_NULL(line_number_expr_)) {
+      ObDatum *datums = is_batch ? line_number_expr_->locate_batch_datums(eval_ctx)
+                                 : &line_number_expr_->locate_datum_for_write(eval_ctx);
+      for (int64_t i = 0; i < row_cnt; i++) {
+        datums[i].set_int(state_.cur_row_idx_ + MIN_EXTERNAL_TABLE_LINE_NUMBER + i);
+      }
+      line_number_expr_->set_evaluated_flag(eval_ctx);
+    }
+    state_.cur_row_idx_ += row_cnt;
+  }
+  return ret;
+}
+
+int ObParquetTableRowIterator::calc_column_convert_exprs(const int64_t row_cnt, const bool is_batch)
+{
+  int ret = OB_SUCCESS;
+  ObEvalCtx &eval_ctx = scan_param_->op_->get_eval_ctx();
+  for (int i = 0; OB_SUCC(ret) && i < column_exprs_.count(); i++) {
+    ObExpr *column_expr = column_exprs_.at(i);
+    ObExpr *column_convert_expr = scan_param_->ext_column_convert_exprs_->at(i);
+    if (is_native_columns_.at(i)) {
+      // filled by fill_rows()
+    } else if (is_batch) {
+      OZ (column_convert_expr->eval_batch(eval_ctx, *bit_vector_cache_, row_cnt));
+      if (OB_SUCC(ret)) {
+        MEMCPY(column_expr->locate_batch_datums(eval_ctx),
+               column_convert_expr->locate_batch_datums(eval_ctx), sizeof(ObDatum) * row_cnt);
+        column_expr->set_evaluated_flag(eval_ctx);
+      }
+    } else {
+      ObDatum *convert_datum = NULL;
+      OZ (column_convert_expr->eval(eval_ctx, convert_datum));
+      if (OB_SUCC(ret)) {
+        column_expr->locate_datum_for_write(eval_ctx) = *convert_datum;
+        column_expr->set_evaluated_flag(eval_ctx);
+      }
+    }
+  }
+  return ret;
+}
+
+int ObParquetTableRowIterator::get_next_row()
+{
+  int ret = OB_SUCCESS;
+  int64_t row_cnt = 0;
+  if (OB_FAIL(fill_rows(1, false, row_cnt))) {
+    if (OB_ITER_END != ret) {
+      LOG_WARN("fail to fill rows", K(ret));
+    }
+  } else if (OB_FAIL(calc_column_convert_exprs(row_cnt, false))) {
+    LOG_WARN("fail to calc column convert exprs", K(ret));
+  }
+  return ret;
+}
+
+int ObParquetTableRowIterator::get_next_rows(int64_t &count, int64_t capacity)
+{
+  int ret = OB_SUCCESS;
+  ObEvalCtx &eval_ctx = scan_param_->op_->get_eval_ctx();
+  count = 0;
+  if (OB_ISNULL(bit_vector_cache_)) {
+    void *mem = nullptr;
+    if (OB_ISNULL(mem = allocator_.alloc(ObBitVector::memory_size(eval_ctx.max_batch_size_)))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("failed to alloc memory for skip", K(ret), K(eval_ctx.max_batch_size_));
+    } else {
+      bit_vector_cache_ = to_bit_vector(mem);
+      bit_vector_cache_->reset(eval_ctx.max_batch_size_);
+    }
+  }
+  if (OB_FAIL(ret)) {
+  } else if (OB_FAIL(fill_rows(MIN(capacity, eval_ctx.max_batch_size_), true, count))) {
+    if (OB_ITER_END != ret) {
+      LOG_WARN("fail to fill rows", K(ret));
+    }
+  } else if (OB_FAIL(calc_column_convert_exprs(count, true))) {
+    LOG_WARN("fail to calc column convert exprs", K(ret));
+  }
+  return ret;
+}
+
+void ObParquetTableRowIterator::reset()
+{
+  // reset state_ to initial values for rescan
+  state_.reuse();
+}
+
 
 
 
@@ -21,6 +21,7 @@
 #include "storage/access/ob_dml_param.h"
 #include "common/storage/ob_io_device.h"
 #include "share/backup/ob_backup_struct.h"
+#include "sql/engine/table/ob_parquet_file_reader.h"
 
 
 namespace oceanbase
@@ -66,13 +67,18 @@ private:
 
 class ObExternalTableRowIterator : public common::ObNewRowIterator {
 public:
-  ObExternalTableRowIterator() : scan_param_(nullptr) {}
+  ObExternalTableRowIterator() : scan_param_(nullptr), line_number_expr_(NULL), file_id_expr_(NULL) {}
   virtual int init(const storage::ObTableScanParam *scan_param) {
     scan_param_ = scan_param;
     return common::OB_SUCCESS;
   }
+protected:
+  int init_exprs(const storage::ObTableScanParam *scan_param);
 protected:
   const storage::ObTableScanParam *scan_param_;
+  ObSEArray<ObExpr*, 16> column_exprs_;
+  ObExpr *line_number_expr_;
+  ObExpr *file_id_expr_;
 };
 
 class ObExternalTableAccessService : public common::ObITabletScan
@@ -135,7 +141,7 @@ public:
                  K(cur_file_name_), K(cur_file_id_), K(cur_line_number_), K(line_count_limit_));
   };
 
-  ObCSVTableRowIterator() : bit_vector_cache_(NULL), line_number_expr_(NULL), file_id_expr_(NULL) {}
+  ObCSVTableRowIterator() : bit_vector_cache_(NULL) {}
   virtual ~ObCSVTableRowIterator();
   int init(const storage::ObTableScanParam *scan_param) override;
   int get_next_row() override;
@@ -160,7 +166,6 @@ private:
   int skip_lines();
   void release_buf();
   void dump_error_log(common::ObIArray<ObCSVGeneralParser::LineErrRec> &error_msgs);
-  int init_exprs(const storage::ObTableScanParam *scan_param);
 private:
   ObBitVector *bit_vector_cache_;
   StateValues state_;
@@ -168,9 +173,107 @@ private:
   ObCSVGeneralParser parser_;
   ObExternalDataAccessDriver data_access_driver_;
   ObSqlString url_;
-  ObSEArray<ObExpr*, 16> column_exprs_;
-  ObExpr *line_number_expr_;
-  ObExpr *file_id_expr_;
+};
+
+// Reads flat parquet files. Values are filled into the varchar file column exprs and converted to
+// the table columns by the column convert exprs, the same as csv. Row groups are skipped by
+// min/max statistics of simple comparisons in op_filters_, which are still evaluated by the scan
+// operator after reading.
+class ObParquetTableRowIterator : public ObExternalTableRowIterator {
+public:
+  static const int64_t MIN_EXTERNAL_TABLE_FILE_ID = 1;
+  static const int64_t MIN_EXTERNAL_TABLE_LINE_NUMBER = 1;
+  // parquet files are usually written with a footer smaller than this
+  static const int64_t FOOTER_PREFETCH_SIZE = 64 * 1024;
+
+public:
+  struct StateValues {
+    StateValues() :
+      file_idx_(0), is_end_file_(true), file_size_(0), cur_file_id_(MIN_EXTERNAL_TABLE_FILE_ID),
+      row_group_idx_(0), cur_row_idx_(0), end_row_idx_(INT64_MAX), row_group_end_idx_(0) {}
+    int64_t file_idx_;
+    bool is_end_file_;
+    int64_t file_size_;
+    common::ObString cur_file_name_;
+    int64_t cur_file_id_;
+    // the next row group to open
+    int64_t row_group_idx_;
+    // row indexes in the file, start from 0
+    int64_t cur_row_idx_;
+    int64_t end_row_idx_;
+    int64_t row_group_end_idx_;
+    void reuse() {
+      file_idx_ = 0;
+      is_end_file_ = true;
+      file_size_ = 0;
+      cur_file_name_.reset();
+      cur_file_id_ = MIN_EXTERNAL_TABLE_FILE_ID;
+      row_group_idx_ = 0;
+      cur_row_idx_ = 0;
+      end_row_idx_ = INT64_MAX;
+      row_group_end_idx_ = 0;
+    }
+    TO_STRING_KV(K(file_idx_), K(is_end_file_), K(file_size_), K(cur_file_name_), K(cur_file_id_),
+                 K(row_group_idx_), K(cur_row_idx_), K(end_row_idx_), K(row_group_end_idx_));
+  };
+
+  // filter `column cmp_type value_expr` which can be checked with statistics
+  struct PruneFilter {
+    PruneFilter() : cmp_type_(T_INVALID), file_column_idx_(-1), value_type_(ObNullType),
+                    value_expr_(NULL) {}
+    ObItemType cmp_type_;
+    int64_t file_column_idx_;
+    ObObjType value_type_;
+    ObExpr *value_expr_;
+    TO_STRING_KV(K(cmp_type_), K(file_column_idx_), K(value_type_), KP(value_expr_));
+  };
+
+  ObParquetTableRowIterator();
+  virtual ~ObParquetTableRowIterator();
+  int init(const storage::ObTableScanParam *scan_param) override;
+  int get_next_row() override;
+  int get_next_rows(int64_t &count, int64_t capacity) override;
+
+  virtual int get_next_row(ObNewRow *&row) override {
+    UNUSED(row);
+    return common::OB_ERR_UNEXPECTED;
+  }
+
+  virtual void reset() override;
+
+private:
+  int init_prune_filters();
+  int init_native_columns();
+  int open_next_file();
+  int read_file_meta();
+  int read_fully(char *buf, const int64_t len, const int64_t offset);
+  int open_next_row_group();
+  int can_skip_row_group(const int64_t row_group_idx, bool &can_skip);
+  int fill_rows(const int64_t capacity, const bool is_batch, int64_t &row_cnt);
+  int calc_column_convert_exprs(const int64_t row_cnt, const bool is_batch);
+private:
+  ObBitVector *bit_vector_cache_;
+  StateValues state_;
+  common::ObMalloc allocator_;
+  // footer and file meta, reused for each file
+  common::ObArenaAllocator file_allocator_;
+  // column chunks and decompressed pages, reused for each row group
+  common::ObArenaAllocator row_group_allocator_;
+  // text of values, reused for each batch
+  common::ObArenaAllocator batch_allocator_;
+  ObParquetFileMeta file_meta_;
+  ObExternalDataAccessDriver data_access_driver_;
+  ObSqlString url_;
+  // readers and column indexes in the current file of ext_file_column_exprs_,
+  // the index is -1 if the file has no such column
+  ObParquetColumnReader *column_readers_;
+  ObSEArray<int64_t, 16> file_column_idxs_;
+  // index of column_exprs_ that a file column is the only input of, or -1. Values of such file
+  // columns are decoded into the column expr directly if the file column type matches.
+  ObSEArray<int64_t, 16> native_column_idxs_;
+  // whether column_exprs_ are filled directly in the current row group, convert exprs are skipped
+  ObSEArray<bool, 16> is_native_columns_;
+  ObSEArray<PruneFilter, 4> prune_filters_;
 };
 
 }
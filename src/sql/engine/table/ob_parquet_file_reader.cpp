@@ -0,0 +1,1385 @@
+/**
+ * Copyright (c) 2023 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL
+#include "ob_parquet_file_reader.h"
+
+#include <cmath>
+#include "lib/compress/ob_compressor_pool.h"
+#include "lib/charset/ob_dtoa.h"
+#include "lib/timezone/ob_time_convert.h"
+#include "lib/utility/ob_fast_convert.h"
+
+namespace oceanbase
+{
+using namespace common;
+namespace sql
+{
+
+const char ObParquetDef::MAGIC[] = "PAR1";
+
+// Reader of thrift compact protocol, see
+// https://github.com/apache/thrift/blob/master/doc/specs/thrift-compact-protocol.md
+class ObParquetThriftReader
+{
+public:
+  enum Type
+  {
+    TT_STOP = 0,
+    TT_BOOL_TRUE = 1,
+    TT_BOOL_FALSE = 2,
+    TT_BYTE = 3,
+    TT_I16 = 4,
+    TT_I32 = 5,
+    TT_I64 = 6,
+    TT_DOUBLE = 7,
+    TT_BINARY = 8,
+    TT_LIST = 9,
+    TT_SET = 10,
+    TT_MAP = 11,
+    TT_STRUCT = 12,
+  };
+  static const int64_t MAX_NESTING_DEPTH = 64;
+
+  ObParquetThriftReader(const char *buf, const int64_t len)
+    : begin_(reinterpret_cast<const unsigned char *>(buf)), pos_(begin_), end_(begin_ + len) {}
+  int64_t get_pos() const { return pos_ - begin_; }
+
+  // type is TT_STOP at the end of a struct
+  int read_field_begin(int16_t &last_field_id, int16_t &field_id, int8_t &type)
+  {
+    int ret = OB_SUCCESS;
+    if (OB_UNLIKELY(pos_ >= end_)) {
+      ret = OB_INVALID_DATA;
+      LOG_WARN("unexpected end of thrift data", K(ret));
+    } else {
+      const uint8_t header = *pos_++;
+      const int16_t delta = header >> 4;
+      type = static_cast<int8_t>(header & 0x0F);
+      if (TT_STOP == type) {
+        field_id = 0;
+      } else if (0 != delta) {
+        field_id = static_cast<int16_t>(last_field_id + delta);
+      } else {
+        int64_t id = 0;
+        if (OB_FAIL(read_zigzag(id))) {
+          LOG_WARN("fail to read field id", K(ret));
+        } else {
+          field_id = static_cast<int16_t>(id);
+        }
+      }
+      last_field_id = field_id;
+    }
+    return ret;
+  }
+
+  int read_list_begin(int8_t &elem_type, int64_t &size)
+  {
+    int ret = OB_SUCCESS;
+    if (OB_UNLIKELY(pos_ >= end_)) {
+      ret = OB_INVALID_DATA;
+      LOG_WARN("unexpected end of thrift data", K(ret));
+    } else {
+      const uint8_t header = *pos_++;
+      uint64_t list_size = header >> 4;
+      elem_type = static_cast<int8_t>(header & 0x0F);
+      if (0x0F == list_size && OB_FAIL(read_varint(list_size))) {
+        LOG_WARN("fail to read list size", K(ret));
+      } else if (OB_UNLIKELY(list_size > static_cast<uint64_t>(end_ - pos_))) {
+        ret = OB_INVALID_DATA;
+        LOG_WARN("invalid list size", K(ret), K(list_size));
+      } else {
+        size = static_cast<int64_t>(list_size);
+      }
+    }
+    return ret;
+  }
+
+  // read an integer field of any width
+  int read_int(const int8_t type, int64_t &value)
+  {
+    int ret = OB_SUCCESS;
+    if (TT_BYTE == type) {
+      if (OB_UNLIKELY(pos_ >= end_)) {
+        ret = OB_INVALID_DATA;
+        LOG_WARN("unexpected end of thrift data", K(ret));
+      } else {
+        value = static_cast<int8_t>(*pos_++);
+      }
+    } else if (OB_UNLIKELY(TT_I16 != type && TT_I32 != type && TT_I64 != type)) {
+      ret = OB_INVALID_DATA;
+      LOG_WARN("unexpected thrift type", K(ret), K(type));
+    } else if (OB_FAIL(read_zigzag(value))) {
+      LOG_WARN("fail to read integer", K(ret));
+    }
+    return ret;
+  }
+
+  int read_int32(const int8_t type, int32_t &value)
+  {
+    int ret = OB_SUCCESS;
+    int64_t v = 0;
+    if (OB_FAIL(read_int(type, v))) {
+      LOG_WARN("fail to read int", K(ret));
+    } else {
+      value = static_cast<int32_t>(v);
+    }
+    return ret;
+  }
+
+  int read_bool(const int8_t type, bool &value)
+  {
+    int ret = OB_SUCCESS;
+    if (OB_UNLIKELY(TT_BOOL_TRUE != type && TT_BOOL_FALSE != type)) {
+      ret = OB_INVALID_DATA;
+      LOG_WARN("unexpected thrift type", K(ret), K(type));
+    } else {
+      value = (TT_BOOL_TRUE == type);
+    }
+    return ret;
+  }
+
+  // the returned value refers to the thrift data
+  int read_binary(const int8_t type, ObString &value)
+  {
+    int ret = OB_SUCCESS;
+    uint64_t len = 0;
+    if (OB_UNLIKELY(TT_BINARY != type)) {
+      ret = OB_INVALID_DATA;
+      LOG_WARN("unexpected thrift type", K(ret), K(type));
+    } else if (OB_FAIL(read_varint(len))) {
+      LOG_WARN("fail to read binary length", K(ret));
+    } else if (OB_UNLIKELY(len > static_cast<uint64_t>(end_ - pos_))) {
+      ret = OB_INVALID_DATA;
+      LOG_WARN("invalid binary length", K(ret), K(len));
+    } else {
+      value.assign_ptr(reinterpret_cast<const char *>(pos_), static_cast<int32_t>(len));
+      pos_ += len;
+    }
+    return ret;
+  }
+
+  int skip(const int8_t type, const int64_t depth = 0)
+  {
+    int ret = OB_SUCCESS;
+    uint64_t len = 0;
+    int64_t v = 0;
+    ObString str;
+    if (OB_UNLIKELY(depth > MAX_NESTING_DEPTH)) {
+      ret = OB_INVALID_DATA;
+      LOG_WARN("thrift data is nested too deep", K(ret), K(depth));
+    } else {
+      switch (type) {
+        case TT_BOOL_TRUE:
+        case TT_BOOL_FALSE:
+          break;
+        case TT_BYTE:
+        case TT_I16:
+        case TT_I32:
+        case TT_I64:
+          ret = read_int(type, v);
+          break;
+        case TT_DOUBLE:
+          if (OB_UNLIKELY(end_ - pos_ < static_cast<int64_t>(sizeof(double)))) {
+            ret = OB_INVALID_DATA;
+            LOG_WARN("unexpected end of thrift data", K(ret));
+          } else {
+            pos_ += sizeof(double);
+          }
+          break;
+        case TT_BINARY:
+          ret = read_binary(type, str);
+          break;
+        case TT_LIST:
+        case TT_SET: {
+          int8_t elem_type = TT_STOP;
+          int64_t size = 0;
+          if (OB_FAIL(read_list_begin(elem_type, size))) {
+            LOG_WARN("fail to read list", K(ret));
+          }
+          for (int64_t i = 0; OB_SUCC(ret) && i < size; ++i) {
+            // booleans in containers take one byte
+            if (TT_BOOL_TRUE == elem_type || TT_BOOL_FALSE == elem_type) {
+              ret = read_int(TT_BYTE, v);
+            } else {
+              ret = skip(elem_type, depth + 1);
+            }
+          }
+          break;
+        }
+        case TT_MAP: {
+          uint8_t kv_type = 0;
+          if (OB_FAIL(read_varint(len))) {
+            LOG_WARN("fail to read map size", K(ret));
+          } else if (len > 0) {
+            if (OB_UNLIKELY(pos_ >= end_)) {
+              ret = OB_INVALID_DATA;
+              LOG_WARN("unexpected end of thrift data", K(ret));
+            } else {
+              kv_type = *pos_++;
+            }
+          }
+          for (uint64_t i = 0; OB_SUCC(ret) && i < len; ++i) {
+            if (OB_FAIL(skip(static_cast<int8_t>(kv_type >> 4), depth + 1))) {
+            } else if (OB_FAIL(skip(static_cast<int8_t>(kv_type & 0x0F), depth + 1))) {
+            }
+          }
+          break;
+        }
+        case TT_STRUCT: {
+          int16_t last_field_id = 0;
+          int16_t field_id = 0;
+          int8_t field_type = TT_STOP;
+          while (OB_SUCC(ret) && OB_SUCC(read_field_begin(last_field_id, field_id, field_type))
+                 && TT_STOP != field_type) {
+            ret = skip(field_type, depth + 1);
+          }
+          break;
+        }
+        default:
+          ret = OB_INVALID_DATA;
+          LOG_WARN("unexpected thrift type", K(ret), K(type));
+          break;
+      }
+    }
+    return ret;
+  }
+
+private:
+  int read_varint(uint64_t &value)
+  {
+    int ret = OB_SUCCESS;
+    bool finished = false;
+    value = 0;
+    for (int64_t shift = 0; OB_SUCC(ret) && !finished; shift += 7) {
+      if (OB_UNLIKELY(pos_ >= end_ || shift >= 64)) {
+        ret = OB_INVALID_DATA;
+        LOG_WARN("invalid varint", K(ret), K(shift));
+      } else {
+        const uint8_t byte = *pos_++;
+        value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        finished = (0 == (byte & 0x80));
+      }
+    }
+    return ret;
+  }
+
+  int read_zigzag(int64_t &value)
+  {
+    int ret = OB_SUCCESS;
+    uint64_t v = 0;
+    if (OB_FAIL(read_varint(v))) {
+      LOG_WARN("fail to read varint", K(ret));
+    } else {
+      value = static_cast<int64_t>(v >> 1) ^ -static_cast<int64_t>(v & 1);
+    }
+    return ret;
+  }
+
+private:
+  const unsigned char *begin_;
+  const unsigned char *pos_;
+  const unsigned char *end_;
+};
+
+struct ObParquetPageHeader
+{
+  ObParquetPageHeader()
+    : type_(-1), uncompressed_size_(0), compressed_size_(0), num_values_(0),
+      encoding_(ObParquetDef::ENC_PLAIN), def_level_encoding_(ObParquetDef::ENC_RLE),
+      def_levels_len_(0), rep_levels_len_(0), is_compressed_(true) {}
+  int parse(ObParquetThriftReader &reader);
+  int32_t type_;
+  int32_t uncompressed_size_;
+  int32_t compressed_size_;
+  int32_t num_values_;
+  int32_t encoding_;
+  int32_t def_level_encoding_;
+  // for data page v2
+  int32_t def_levels_len_;
+  int32_t rep_levels_len_;
+  bool is_compressed_;
+  TO_STRING_KV(K_(type), K_(uncompressed_size), K_(compressed_size), K_(num_values), K_(encoding),
+               K_(def_level_encoding), K_(def_levels_len), K_(rep_levels_len), K_(is_compressed));
+};
+
+int ObParquetPageHeader::parse(ObParquetThriftReader &reader)
+{
+  int ret = OB_SUCCESS;
+  int16_t last_id = 0;
+  int16_t field_id = 0;
+  int8_t type = ObParquetThriftReader::TT_STOP;
+  while (OB_SUCC(ret) && OB_SUCC(reader.read_field_begin(last_id, field_id, type))
+         && ObParquetThriftReader::TT_STOP != type) {
+    switch (field_id) {
+      case 1: ret = reader.read_int32(type, type_); break;
+      case 2: ret = reader.read_int32(type, uncompressed_size_); break;
+      case 3: ret = reader.read_int32(type, compressed_size_); break;
+      case 5:   // DataPageHeader
+      case 7:   // DictionaryPageHeader
+      case 8: { // DataPageHeaderV2
+        const int16_t header_id = field_id;
+        int16_t sub_last_id = 0;
+        int8_t sub_type = ObParquetThriftReader::TT_STOP;
+        while (OB_SUCC(ret) && OB_SUCC(reader.read_field_begin(sub_last_id, field_id, sub_type))
+               && ObParquetThriftReader::TT_STOP != sub_type) {
+          if (1 == field_id) {
+            ret = reader.read_int32(sub_type, num_values_);
+          } else if (8 != header_id && 2 == field_id) {
+            ret = reader.read_int32(sub_type, encoding_);
+          } else if (5 == header_id && 3 == field_id) {
+            ret = reader.read_int32(sub_type, def_level_encoding_);
+          } else if (8 == header_id && 4 == field_id) {
+            ret = reader.read_int32(sub_type, encoding_);
+          } else if (8 == header_id && 5 == field_id) {
+            ret = reader.read_int32(sub_type, def_levels_len_);
+          } else if (8 == header_id && 6 == field_id) {
+            ret = reader.read_int32(sub_type, rep_levels_len_);
+          } else if (8 == header_id && 7 == field_id) {
+            ret = reader.read_bool(sub_type, is_compressed_);
+          } else {
+            ret = reader.skip(sub_type);
+          }
+        }
+        break;
+      }
+      default: ret = reader.skip(type); break;
+    }
+  }
+  if (OB_FAIL(ret)) {
+    LOG_WARN("fail to parse page header", K(ret), K(field_id), K(type));
+  } else if (OB_UNLIKELY(compressed_size_ < 0 || uncompressed_size_ < 0 || num_values_ < 0
+                         || def_levels_len_ < 0 || rep_levels_len_ < 0)) {
+    ret = OB_INVALID_DATA;
+    LOG_WARN("invalid page header", K(ret), KPC(this));
+  }
+  return ret;
+}
+
+static int parse_statistics(ObParquetThriftReader &reader, ObParquetColumnChunkMeta &chunk)
+{
+  int ret = OB_SUCCESS;
+  int16_t last_id = 0;
+  int16_t field_id = 0;
+  int8_t type = ObParquetThriftReader::TT_STOP;
+  ObString legacy_min;
+  ObString legacy_max;
+  ObString min;
+  ObString max;
+  bool has_legacy = false;
+  bool has_min_max = false;
+  while (OB_SUCC(ret) && OB_SUCC(reader.read_field_begin(last_id, field_id, type))
+         && ObParquetThriftReader::TT_STOP != type) {
+    switch (field_id) {
+      case 1: ret = reader.read_binary(type, legacy_max); has_legacy = true; break;
+      case 2: ret = reader.read_binary(type, legacy_min); break;
+      case 3: ret = reader.read_int(type, chunk.null_count_); break;
+      case 5: ret = reader.read_binary(type, max); has_min_max = true; break;
+      case 6: ret = reader.read_binary(type, min); break;
+      default: ret = reader.skip(type); break;
+    }
+  }
+  if (OB_SUCC(ret)) {
+    // the legacy min and max are sorted as signed values, which are right for the types we check
+    if (has_min_max && !min.empty() && !max.empty()) {
+      chunk.min_ = min;
+      chunk.max_ = max;
+      chunk.has_min_max_ = true;
+    } else if (has_legacy && !legacy_min.empty() && !legacy_max.empty()) {
+      chunk.min_ = legacy_min;
+      chunk.max_ = legacy_max;
+      chunk.has_min_max_ = true;
+    }
+  }
+  return ret;
+}
+
+static int parse_column_meta(ObParquetThriftReader &reader, ObParquetColumnChunkMeta &chunk)
+{
+  int ret = OB_SUCCESS;
+  int16_t last_id = 0;
+  int16_t field_id = 0;
+  int8_t type = ObParquetThriftReader::TT_STOP;
+  while (OB_SUCC(ret) && OB_SUCC(reader.read_field_begin(last_id, field_id, type))
+         && ObParquetThriftReader::TT_STOP != type) {
+    switch (field_id) {
+      case 4: ret = reader.read_int32(type, chunk.codec_); break;
+      case 5: ret = reader.read_int(type, chunk.num_values_); break;
+      case 7: ret = reader.read_int(type, chunk.total_compressed_size_); break;
+      case 9: ret = reader.read_int(type, chunk.data_page_offset_); break;
+      case 11: ret = reader.read_int(type, chunk.dictionary_page_offset_); break;
+      case 12: ret = parse_statistics(reader, chunk); break;
+      default: ret = reader.skip(type); break;
+    }
+  }
+  return ret;
+}
+
+void ObParquetFileMeta::reset()
+{
+  num_rows_ = 0;
+  columns_.reset();
+  row_groups_.reset();
+  chunks_.reset();
+}
+
+int ObParquetFileMeta::parse(const char *buf, const int64_t len)
+{
+  int ret = OB_SUCCESS;
+  ObParquetThriftReader reader(buf, len);
+  int16_t last_id = 0;
+  int16_t field_id = 0;
+  int8_t type = ObParquetThriftReader::TT_STOP;
+  int8_t elem_type = ObParquetThriftReader::TT_STOP;
+  int64_t size = 0;
+  reset();
+  while (OB_SUCC(ret) && OB_SUCC(reader.read_field_begin(last_id, field_id, type))
+         && ObParquetThriftReader::TT_STOP != type) {
+    if (2 == field_id) {
+      // schema, the first element is the root
+      if (OB_FAIL(reader.read_list_begin(elem_type, size))) {
+        LOG_WARN("fail to read schema list", K(ret));
+      }
+      for (int64_t i = 0; OB_SUCC(ret) && i < size; ++i) {
+        ObParquetColumnSchema column;
+        int32_t repetition = ObParquetDef::REP_REQUIRED;
+        int32_t num_children = 0;
+        int16_t col_last_id = 0;
+        int8_t col_type = ObParquetThriftReader::TT_STOP;
+        ObString name;
+        while (OB_SUCC(ret) && OB_SUCC(reader.read_field_begin(col_last_id, field_id, col_type))
+               && ObParquetThriftReader::TT_STOP != col_type) {
+          switch (field_id) {
+            case 1: ret = reader.read_int32(col_type, column.physical_type_); break;
+            case 2: ret = reader.read_int32(col_type, column.type_length_); break;
+            case 3: ret = reader.read_int32(col_type, repetition); break;
+            case 4: ret = reader.read_binary(col_type, name); break;
+            case 5: ret = reader.read_int32(col_type, num_children); break;
+            case 6: ret = reader.read_int32(col_type, column.converted_type_); break;
+            case 7: ret = reader.read_int32(col_type, column.scale_); break;
+            default: ret = reader.skip(col_type); break;
+          }
+        }
+        if (OB_FAIL(ret)) {
+          LOG_WARN("fail to parse schema element", K(ret), K(i));
+        } else if (0 == i) {
+          // skip root
+        } else if (OB_UNLIKELY(num_children > 0 || ObParquetDef::REP_REPEATED == repetition)) {
+          ret = OB_NOT_SUPPORTED;
+          LOG_WARN("nested parquet column is not supported", K(ret), K(name));
+          LOG_USER_ERROR(OB_NOT_SUPPORTED, "nested parquet column");
+        } else if (OB_UNLIKELY(ObParquetDef::CT_DECIMAL == column.converted_type_
+                               && (column.scale_ < 0 || column.scale_ > OB_MAX_DECIMAL_SCALE))) {
+          ret = OB_INVALID_DATA;
+          LOG_WARN("invalid decimal scale", K(ret), K(name), K(column.scale_));
+        } else if (OB_FAIL(ob_write_string(allocator_, name, column.name_))) {
+          LOG_WARN("fail to copy column name", K(ret));
+        } else {
+          column.max_def_level_ = (ObParquetDef::REP_OPTIONAL == repetition) ? 1 : 0;
+          if (OB_FAIL(columns_.push_back(column))) {
+            LOG_WARN("fail to push back column", K(ret));
+          }
+        }
+      }
+    } else if (3 == field_id) {
+      ret = reader.read_int(type, num_rows_);
+    } else if (4 == field_id) {
+      int64_t first_row_idx = 0;
+      if (OB_FAIL(reader.read_list_begin(elem_type, size))) {
+        LOG_WARN("fail to read row group list", K(ret));
+      }
+      for (int64_t i = 0; OB_SUCC(ret) && i < size; ++i) {
+        ObParquetRowGroupMeta row_group;
+        int64_t chunk_cnt = 0;
+        int16_t rg_last_id = 0;
+        int8_t rg_type = ObParquetThriftReader::TT_STOP;
+        while (OB_SUCC(ret) && OB_SUCC(reader.read_field_begin(rg_last_id, field_id, rg_type))
+               && ObParquetThriftReader::TT_STOP != rg_type) {
+          if (1 == field_id) {
+            int64_t chunk_size = 0;
+            if (OB_FAIL(reader.read_list_begin(elem_type, chunk_size))) {
+              LOG_WARN("fail to read column chunk list", K(ret));
+            }
+            for (int64_t j = 0; OB_SUCC(ret) && j < chunk_size; ++j) {
+              ObParquetColumnChunkMeta chunk;
+              int16_t chunk_last_id = 0;
+              int8_t chunk_type = ObParquetThriftReader::TT_STOP;
+              while (OB_SUCC(ret) && OB_SUCC(reader.read_field_begin(chunk_last_id, field_id, chunk_type))
+                     && ObParquetThriftReader::TT_STOP != chunk_type) {
+                if (3 == field_id) {
+                  ret = parse_column_meta(reader, chunk);
+                } else {
+                  ret = reader.skip(chunk_type);
+                }
+              }
+              ObString min;
+              ObString max;
+              if (OB_FAIL(ret)) {
+              } else if (chunk.has_min_max_
+                         && (OB_FAIL(ob_write_string(allocator_, chunk.min_, min))
+                             || OB_FAIL(ob_write_string(allocator_, chunk.max_, max)))) {
+                LOG_WARN("fail to copy statistics", K(ret));
+              } else {
+                chunk.min_ = min;
+                chunk.max_ = max;
+                if (OB_FAIL(chunks_.push_back(chunk))) {
+                  LOG_WARN("fail to push back chunk", K(ret));
+                }
+              }
+            }
+            chunk_cnt = chunk_size;
+          } else if (3 == field_id) {
+            ret = reader.read_int(rg_type, row_group.num_rows_);
+          } else {
+            ret = reader.skip(rg_type);
+          }
+        }
+        if (OB_FAIL(ret)) {
+          LOG_WARN("fail to parse row group", K(ret), K(i));
+        } else if (OB_UNLIKELY(chunk_cnt != columns_.count() || row_group.num_rows_ < 0)) {
+          ret = OB_INVALID_DATA;
+          LOG_WARN("unexpected row group", K(ret), K(chunk_cnt), K(columns_.count()), K(row_group));
+        } else {
+          row_group.first_row_idx_ = first_row_idx;
+          first_row_idx += row_group.num_rows_;
+          if (OB_FAIL(row_groups_.push_back(row_group))) {
+            LOG_WARN("fail to push back row group", K(ret));
+          }
+        }
+      }
+    } else {
+      ret = reader.skip(type);
+    }
+  }
+  if (OB_FAIL(ret)) {
+    LOG_WARN("fail to parse parquet file meta", K(ret), K(field_id), K(reader.get_pos()), K(len));
+  }
+  return ret;
+}
+
+template <typename T>
+bool ObParquetFileMeta::may_match(const ObItemType cmp_type, const T min, const T max, const T value)
+{
+  bool bret = true;
+  switch (cmp_type) {
+    case T_OP_EQ: bret = min <= value && value <= max; break;
+    case T_OP_LT: bret = min < value; break;
+    case T_OP_LE: bret = min <= value; break;
+    case T_OP_GT: bret = max > value; break;
+    case T_OP_GE: bret = max >= value; break;
+    default: break;
+  }
+  return bret;
+}
+
+int ObParquetFileMeta::can_skip_chunk(const ObParquetColumnSchema &column,
+                                      const ObParquetColumnChunkMeta &chunk,
+                                      const ObItemType cmp_type,
+                                      const ObObjType value_type,
+                                      const ObDatum &value,
+                                      bool &can_skip)
+{
+  int ret = OB_SUCCESS;
+  const int32_t physical_type = column.physical_type_;
+  const int32_t converted_type = column.converted_type_;
+  const bool is_signed_int = ObParquetDef::CT_NONE == converted_type
+      || (converted_type >= ObParquetDef::CT_INT_8 && converted_type <= ObParquetDef::CT_INT_64);
+  can_skip = false;
+  if (!chunk.has_min_max_ || value.is_null()) {
+    // no statistics
+  } else if (ObParquetDef::PT_INT32 == physical_type || ObParquetDef::PT_INT64 == physical_type) {
+    const int64_t width = ObParquetDef::PT_INT32 == physical_type ? sizeof(int32_t) : sizeof(int64_t);
+    if (OB_UNLIKELY(chunk.min_.length() != width || chunk.max_.length() != width)) {
+      ret = OB_INVALID_DATA;
+      LOG_WARN("invalid statistics", K(ret), K(column), K(chunk));
+    } else {
+      const int64_t min = sizeof(int32_t) == width ? *reinterpret_cast<const int32_t *>(chunk.min_.ptr())
+                                                   : *reinterpret_cast<const int64_t *>(chunk.min_.ptr());
+      const int64_t max = sizeof(int32_t) == width ? *reinterpret_cast<const int32_t *>(chunk.max_.ptr())
+                                                   : *reinterpret_cast<const int64_t *>(chunk.max_.ptr());
+      if (is_signed_int && (ObIntType == value_type
+                            || (ObInt32Type == value_type && sizeof(int32_t) == width))) {
+        can_skip = !may_match(cmp_type, min, max, value.get_int());
+      } else if (ObParquetDef::CT_DATE == converted_type && ObDateType == value_type) {
+        can_skip = !may_match(cmp_type, min, max, static_cast<int64_t>(value.get_date()));
+      }
+    }
+  } else if (ObParquetDef::PT_FLOAT == physical_type || ObParquetDef::PT_DOUBLE == physical_type) {
+    const int64_t width = ObParquetDef::PT_FLOAT == physical_type ? sizeof(float) : sizeof(double);
+    if (OB_UNLIKELY(chunk.min_.length() != width || chunk.max_.length() != width)) {
+      ret = OB_INVALID_DATA;
+      LOG_WARN("invalid statistics", K(ret), K(column), K(chunk));
+    } else if ((ObFloatType == value_type && sizeof(float) == width)
+               || (ObDoubleType == value_type && sizeof(double) == width)) {
+      const double min = sizeof(float) == width ? *reinterpret_cast<const float *>(chunk.min_.ptr())
+                                                : *reinterpret_cast<const double *>(chunk.min_.ptr());
+      const double max = sizeof(float) == width ? *reinterpret_cast<const float *>(chunk.max_.ptr())
+                                                : *reinterpret_cast<const double *>(chunk.max_.ptr());
+      const double v = sizeof(float) == width ? value.get_float() : value.get_double();
+      // NaN may be written into statistics by old writers
+      if (!std::isnan(min) && !std::isnan(max) && !std::isnan(v)) {
+        can_skip = !may_match(cmp_type, min, max, v);
+      }
+    }
+  }
+  return ret;
+}
+
+void ObParquetRleDecoder::reset()
+{
+  pos_ = nullptr;
+  end_ = nullptr;
+  bit_width_ = 0;
+  rle_remain_ = 0;
+  rle_value_ = 0;
+  packed_data_ = nullptr;
+  packed_idx_ = 0;
+  packed_remain_ = 0;
+}
+
+void ObParquetRleDecoder::init(const char *buf, const int64_t len, const int32_t bit_width)
+{
+  reset();
+  pos_ = reinterpret_cast<const unsigned char *>(buf);
+  end_ = pos_ + len;
+  bit_width_ = bit_width;
+}
+
+int ObParquetRleDecoder::next_run()
+{
+  int ret = OB_SUCCESS;
+  uint64_t header = 0;
+  bool finished = false;
+  for (int64_t shift = 0; OB_SUCC(ret) && !finished; shift += 7) {
+    if (OB_UNLIKELY(pos_ >= end_ || shift >= 64)) {
+      ret = OB_INVALID_DATA;
+      LOG_WARN("unexpected end of rle data", K(ret), K(shift));
+    } else {
+      header |= static_cast<uint64_t>(*pos_ & 0x7F) << shift;
+      finished = (0 == (*pos_ & 0x80));
+      ++pos_;
+    }
+  }
+  if (OB_FAIL(ret)) {
+  } else if (header & 1) {
+    // bit-packed groups of 8 values, the last group may be truncated
+    const int64_t group_cnt = static_cast<int64_t>(header >> 1);
+    packed_data_ = pos_;
+    packed_idx_ = 0;
+    packed_remain_ = group_cnt * 8;
+    pos_ = MIN(end_, pos_ + group_cnt * bit_width_);
+  } else {
+    const int64_t value_bytes = (bit_width_ + 7) / 8;
+    rle_remain_ = static_cast<int64_t>(header >> 1);
+    rle_value_ = 0;
+    if (OB_UNLIKELY(end_ - pos_ < value_bytes)) {
+      ret = OB_INVALID_DATA;
+      LOG_WARN("unexpected end of rle data", K(ret), K(value_bytes));
+    } else {
+      for (int64_t i = 0; i < value_bytes; ++i) {
+        rle_value_ |= static_cast<uint32_t>(pos_[i]) << (i * 8);
+      }
+      pos_ += value_bytes;
+    }
+  }
+  return ret;
+}
+
+int ObParquetRleDecoder::get_batch(const int64_t count, uint32_t *values)
+{
+  int ret = OB_SUCCESS;
+  const uint64_t mask = (1ULL << bit_width_) - 1;
+  int64_t idx = 0;
+  while (OB_SUCC(ret) && idx < count) {
+    if (rle_remain_ > 0) {
+      const int64_t cnt = MIN(rle_remain_, count - idx);
+      for (int64_t i = 0; i < cnt; ++i) {
+        values[idx + i] = rle_value_;
+      }
+      idx += cnt;
+      rle_remain_ -= cnt;
+    } else if (packed_remain_ > 0) {
+      const int64_t cnt = MIN(packed_remain_, count - idx);
+      for (int64_t i = 0; i < cnt; ++i) {
+        const int64_t bit_pos = (packed_idx_ + i) * bit_width_;
+        const unsigned char *p = packed_data_ + (bit_pos >> 3);
+        const int64_t shift = bit_pos & 7;
+        const int64_t bytes = MIN((shift + bit_width_ + 7) >> 3, end_ - p);
+        uint64_t v = 0;
+        for (int64_t j = 0; j < bytes; ++j) {
+          v |= static_cast<uint64_t>(p[j]) << (j * 8);
+        }
+        values[idx + i] = static_cast<uint32_t>((v >> shift) & mask);
+      }
+      idx += cnt;
+      packed_idx_ += cnt;
+      packed_remain_ -= cnt;
+    } else if (OB_FAIL(next_run())) {
+      LOG_WARN("fail to read next run", K(ret), K(idx), K(count));
+    }
+  }
+  return ret;
+}
+
+int ObParquetRleDecoder::skip(const int64_t count)
+{
+  int ret = OB_SUCCESS;
+  int64_t remain = count;
+  while (OB_SUCC(ret) && remain > 0) {
+    if (rle_remain_ > 0) {
+      const int64_t cnt = MIN(rle_remain_, remain);
+      rle_remain_ -= cnt;
+      remain -= cnt;
+    } else if (packed_remain_ > 0) {
+      const int64_t cnt = MIN(packed_remain_, remain);
+      packed_idx_ += cnt;
+      packed_remain_ -= cnt;
+      remain -= cnt;
+    } else if (OB_FAIL(next_run())) {
+      LOG_WARN("fail to read next run", K(ret), K(remain), K(count));
+    }
+  }
+  return ret;
+}
+
+void ObParquetColumnReader::reset()
+{
+  column_ = ObParquetColumnSchema();
+  chunk_ = ObParquetColumnChunkMeta();
+  allocator_ = nullptr;
+  output_native_ = false;
+  chunk_pos_ = nullptr;
+  chunk_end_ = nullptr;
+  page_remain_values_ = 0;
+  def_decoder_.reset();
+  is_dict_encoded_ = false;
+  index_decoder_.reset();
+  value_pos_ = nullptr;
+  value_end_ = nullptr;
+  bool_bit_idx_ = 0;
+  dict_values_ = nullptr;
+  dict_cnt_ = 0;
+}
+
+int ObParquetColumnReader::init(const ObParquetColumnSchema &column,
+                                const ObParquetColumnChunkMeta &chunk,
+                                const char *chunk_buf,
+                                const int64_t chunk_len,
+                                ObIAllocator &allocator,
+                                const bool output_native)
+{
+  int ret = OB_SUCCESS;
+  reset();
+  if (OB_ISNULL(chunk_buf) || OB_UNLIKELY(chunk_len <= 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), KP(chunk_buf), K(chunk_len));
+  } else if (OB_UNLIKELY(ObParquetDef::CODEC_UNCOMPRESSED != chunk.codec_
+                         && ObParquetDef::CODEC_SNAPPY != chunk.codec_
+                         && ObParquetDef::CODEC_ZSTD != chunk.codec_
+                         && ObParquetDef::CODEC_LZ4_RAW != chunk.codec_)) {
+    ret = OB_NOT_SUPPORTED;
+    LOG_WARN("parquet compression codec is not supported", K(ret), K(chunk));
+    LOG_USER_ERROR(OB_NOT_SUPPORTED, "parquet compression codec other than snappy, zstd and lz4_raw");
+  } else {
+    column_ = column;
+    chunk_ = chunk;
+    allocator_ = &allocator;
+    output_native_ = output_native;
+    chunk_pos_ = chunk_buf;
+    chunk_end_ = chunk_buf + chunk_len;
+  }
+  return ret;
+}
+
+int ObParquetColumnReader::decompress(const char *src, const int64_t src_len,
+                                      const int64_t uncompressed_len, const char *&data)
+{
+  int ret = OB_SUCCESS;
+  ObCompressor *compressor = nullptr;
+  ObCompressorType compressor_type = INVALID_COMPRESSOR;
+  char *buf = nullptr;
+  int64_t data_len = 0;
+  switch (chunk_.codec_) {
+    case ObParquetDef::CODEC_SNAPPY: compressor_type = SNAPPY_COMPRESSOR; break;
+    case ObParquetDef::CODEC_ZSTD: compressor_type = ZSTD_1_3_8_COMPRESSOR; break;
+    case ObParquetDef::CODEC_LZ4_RAW: compressor_type = LZ4_COMPRESSOR; break;
+    default: compressor_type = NONE_COMPRESSOR; break;
+  }
+  if (NONE_COMPRESSOR == compressor_type || 0 == uncompressed_len) {
+    data = src;
+  } else if (OB_FAIL(ObCompressorPool::get_instance().get_compressor(compressor_type, compressor))) {
+    LOG_WARN("fail to get compressor", K(ret), K(compressor_type));
+  } else if (OB_ISNULL(buf = static_cast<char *>(allocator_->alloc(uncompressed_len)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("fail to alloc memory", K(ret), K(uncompressed_len));
+  } else if (OB_FAIL(compressor->decompress(src, src_len, buf, uncompressed_len, data_len))) {
+    LOG_WARN("fail to decompress page", K(ret), K(src_len), K(uncompressed_len));
+  } else if (OB_UNLIKELY(data_len != uncompressed_len)) {
+    ret = OB_INVALID_DATA;
+    LOG_WARN("unexpected decompressed size", K(ret), K(data_len), K(uncompressed_len));
+  } else {
+    data = buf;
+  }
+  return ret;
+}
+
+int ObParquetColumnReader::load_dictionary(const char *buf, const int64_t len, const int64_t value_cnt)
+{
+  int ret = OB_SUCCESS;
+  const char *pos = buf;
+  const char *end = buf + len;
+  if (OB_UNLIKELY(ObParquetDef::PT_BOOLEAN == column_.physical_type_)) {
+    ret = OB_INVALID_DATA;
+    LOG_WARN("boolean column can not be dictionary encoded", K(ret), K(column_));
+  } else if (value_cnt > 0 && OB_ISNULL(dict_values_ = static_cast<ObString *>(
+                                  allocator_->alloc(sizeof(ObString) * value_cnt)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("fail to alloc dictionary", K(ret), K(value_cnt));
+  }
+  for (int64_t i = 0; OB_SUCC(ret) && i < value_cnt; ++i) {
+    new (dict_values_ + i) ObString();
+    if (OB_FAIL(read_plain_value(pos, end, dict_values_[i]))) {
+      LOG_WARN("fail to read dictionary value", K(ret), K(i), K(value_cnt));
+    }
+  }
+  if (OB_SUCC(ret)) {
+    dict_cnt_ = value_cnt;
+  }
+  return ret;
+}
+
+int ObParquetColumnReader::init_values(const int32_t encoding, const char *buf, const int64_t len)
+{
+  int ret = OB_SUCCESS;
+  value_pos_ = buf;
+  value_end_ = buf + len;
+  bool_bit_idx_ = 0;
+  if (ObParquetDef::ENC_PLAIN == encoding) {
+    is_dict_encoded_ = false;
+  } else if (ObParquetDef::ENC_PLAIN_DICTIONARY == encoding
+             || ObParquetDef::ENC_RLE_DICTIONARY == encoding) {
+    is_dict_encoded_ = true;
+    if (OB_ISNULL(dict_values_) && OB_UNLIKELY(page_remain_values_ > 0)) {
+      ret = OB_INVALID_DATA;
+      LOG_WARN("dictionary page is missing", K(ret), K(chunk_));
+    } else if (len > 0) {
+      const int32_t bit_width = static_cast<uint8_t>(buf[0]);
+      if (OB_UNLIKELY(bit_width > 32)) {
+        ret = OB_INVALID_DATA;
+        LOG_WARN("invalid bit width of dictionary index", K(ret), K(bit_width));
+      } else {
+        index_decoder_.init(buf + 1, len - 1, bit_width);
+      }
+    }
+  } else {
+    ret = OB_NOT_SUPPORTED;
+    LOG_WARN("parquet encoding is not supported", K(ret), K(encoding), K(column_));
+    LOG_USER_ERROR(OB_NOT_SUPPORTED, "parquet encoding other than plain and dictionary");
+  }
+  return ret;
+}
+
+int ObParquetColumnReader::load_next_page()
+{
+  int ret = OB_SUCCESS;
+  bool loaded = false;
+  while (OB_SUCC(ret) && !loaded) {
+    ObParquetPageHeader header;
+    ObParquetThriftReader reader(chunk_pos_, chunk_end_ - chunk_pos_);
+    const char *page_data = nullptr;
+    const char *data = nullptr;
+    if (OB_UNLIKELY(chunk_pos_ >= chunk_end_)) {
+      ret = OB_INVALID_DATA;
+      LOG_WARN("no more page in column chunk", K(ret), K(chunk_));
+    } else if (OB_FAIL(header.parse(reader))) {
+      LOG_WARN("fail to parse page header", K(ret));
+    } else if (OB_UNLIKELY(chunk_end_ - chunk_pos_ - reader.get_pos() < header.compressed_size_)) {
+      ret = OB_INVALID_DATA;
+      LOG_WARN("page is out of column chunk", K(ret), K(header), K(chunk_));
+    } else {
+      page_data = chunk_pos_ + reader.get_pos();
+      chunk_pos_ = page_data + header.compressed_size_;
+      switch (header.type_) {
+        case ObParquetDef::PAGE_DICTIONARY: {
+          if (OB_FAIL(decompress(page_data, header.compressed_size_, header.uncompressed_size_, data))) {
+            LOG_WARN("fail to decompress dictionary page", K(ret), K(header));
+          } else if (OB_FAIL(load_dictionary(data, header.uncompressed_size_, header.num_values_))) {
+            LOG_WARN("fail to load dictionary", K(ret), K(header));
+          }
+          break;
+        }
+        case ObParquetDef::PAGE_DATA: {
+          int64_t levels_len = 0;
+          page_remain_values_ = header.num_values_;
+          if (OB_FAIL(decompress(page_data, header.compressed_size_, header.uncompressed_size_, data))) {
+            LOG_WARN("fail to decompress data page", K(ret), K(header));
+          } else if (column_.max_def_level_ > 0) {
+            // definition levels prefixed by 4 bytes length
+            if (OB_UNLIKELY(ObParquetDef::ENC_RLE != header.def_level_encoding_)) {
+              ret = OB_NOT_SUPPORTED;
+              LOG_WARN("definition level encoding is not supported", K(ret), K(header));
+              LOG_USER_ERROR(OB_NOT_SUPPORTED, "parquet definition level encoding other than rle");
+            } else if (OB_UNLIKELY(header.uncompressed_size_ < static_cast<int64_t>(sizeof(uint32_t)))) {
+              ret = OB_INVALID_DATA;
+              LOG_WARN("invalid data page", K(ret), K(header));
+            } else {
+              const int64_t def_len = *reinterpret_cast<const uint32_t *>(data);
+              levels_len = sizeof(uint32_t) + def_len;
+              if (OB_UNLIKELY(levels_len > header.uncompressed_size_)) {
+                ret = OB_INVALID_DATA;
+                LOG_WARN("invalid definition levels length", K(ret), K(def_len), K(header));
+              } else {
+                def_decoder_.init(data + sizeof(uint32_t), def_len, 1);
+              }
+            }
+          }
+          if (OB_SUCC(ret) && OB_FAIL(init_values(header.encoding_, data + levels_len,
+                                                  header.uncompressed_size_ - levels_len))) {
+            LOG_WARN("fail to init values", K(ret), K(header));
+          }
+          loaded = true;
+          break;
+        }
+        case ObParquetDef::PAGE_DATA_V2: {
+          // levels are not compressed in data page v2
+          const int64_t levels_len = header.def_levels_len_ + header.rep_levels_len_;
+          page_remain_values_ = header.num_values_;
+          if (OB_UNLIKELY(header.rep_levels_len_ > 0 || levels_len > header.compressed_size_
+                          || levels_len > header.uncompressed_size_)) {
+            ret = OB_INVALID_DATA;
+            LOG_WARN("invalid data page v2", K(ret), K(header));
+          } else if (FALSE_IT(def_decoder_.init(page_data, header.def_levels_len_, 1))) {
+          } else if (!header.is_compressed_) {
+            data = page_data + levels_len;
+          } else if (OB_FAIL(decompress(page_data + levels_len, header.compressed_size_ - levels_len,
+                                        header.uncompressed_size_ - levels_len, data))) {
+            LOG_WARN("fail to decompress data page v2", K(ret), K(header));
+          }
+          if (OB_SUCC(ret) && OB_FAIL(init_values(header.encoding_, data,
+                                                  header.uncompressed_size_ - levels_len))) {
+            LOG_WARN("fail to init values", K(ret), K(header));
+          }
+          loaded = true;
+          break;
+        }
+        default:
+          // index page is skipped
+          break;
+      }
+    }
+  }
+  return ret;
+}
+
+int ObParquetColumnReader::read_def_levels(const int64_t row_cnt, uint8_t *defs, int64_t &not_null_cnt)
+{
+  int ret = OB_SUCCESS;
+  not_null_cnt = row_cnt;
+  if (column_.max_def_level_ > 0) {
+    uint32_t levels[MAX_SUB_BATCH_SIZE];
+    if (OB_FAIL(def_decoder_.get_batch(row_cnt, levels))) {
+      LOG_WARN("fail to read definition levels", K(ret), K(row_cnt));
+    } else {
+      not_null_cnt = 0;
+      for (int64_t i = 0; i < row_cnt; ++i) {
+        defs[i] = static_cast<uint8_t>(levels[i]);
+        not_null_cnt += defs[i];
+      }
+    }
+  } else {
+    MEMSET(defs, 1, row_cnt);
+  }
+  return ret;
+}
+
+int ObParquetColumnReader::read_plain_value(const char *&pos, const char *end, ObString &value)
+{
+  static const char BOOL_VALUES[2] = {0, 1};
+  int ret = OB_SUCCESS;
+  int64_t len = 0;
+  switch (column_.physical_type_) {
+    case ObParquetDef::PT_BOOLEAN:
+      if (OB_UNLIKELY(pos >= end)) {
+        ret = OB_INVALID_DATA;
+      } else {
+        value.assign_ptr(&BOOL_VALUES[(*pos >> bool_bit_idx_) & 1], 1);
+        if (8 == ++bool_bit_idx_) {
+          bool_bit_idx_ = 0;
+          ++pos;
+        }
+      }
+      break;
+    case ObParquetDef::PT_BYTE_ARRAY:
+      if (OB_UNLIKELY(end - pos < static_cast<int64_t>(sizeof(uint32_t)))) {
+        ret = OB_INVALID_DATA;
+      } else {
+        len = *reinterpret_cast<const uint32_t *>(pos);
+        pos += sizeof(uint32_t);
+        if (OB_UNLIKELY(end - pos < len)) {
+          ret = OB_INVALID_DATA;
+        } else {
+          value.assign_ptr(pos, static_cast<int32_t>(len));
+          pos += len;
+        }
+      }
+      break;
+    default:
+      switch (column_.physical_type_) {
+        case ObParquetDef::PT_INT32: len = sizeof(int32_t); break;
+        case ObParquetDef::PT_INT64: len = sizeof(int64_t); break;
+        case ObParquetDef::PT_INT96: len = 12; break;
+        case ObParquetDef::PT_FLOAT: len = sizeof(float); break;
+        case ObParquetDef::PT_DOUBLE: len = sizeof(double); break;
+        default: len = column_.type_length_; break;
+      }
+      if (OB_UNLIKELY(end - pos < len || len <= 0)) {
+        ret = OB_INVALID_DATA;
+      } else {
+        value.assign_ptr(pos, static_cast<int32_t>(len));
+        pos += len;
+      }
+      break;
+  }
+  if (OB_FAIL(ret)) {
+    LOG_WARN("invalid plain value", K(ret), K(column_), K(len), K(end - pos));
+  }
+  return ret;
+}
+
+bool ObParquetColumnReader::need_text_buf() const
+{
+  return !output_native_
+         && !((ObParquetDef::PT_BYTE_ARRAY == column_.physical_type_
+               || ObParquetDef::PT_FIXED_LEN_BYTE_ARRAY == column_.physical_type_)
+              && ObParquetDef::CT_DECIMAL != column_.converted_type_);
+}
+
+bool ObParquetColumnReader::is_native_type(const ObParquetColumnSchema &column, const ObObjType type,
+                                           const int16_t scale)
+{
+  const int32_t converted_type = column.converted_type_;
+  const bool is_signed_int = ObParquetDef::CT_NONE == converted_type
+      || (converted_type >= ObParquetDef::CT_INT_8 && converted_type <= ObParquetDef::CT_INT_64);
+  bool bret = false;
+  switch (column.physical_type_) {
+    case ObParquetDef::PT_BOOLEAN:
+      bret = ObTinyIntType == type;
+      break;
+    case ObParquetDef::PT_INT32:
+      bret = (is_signed_int && (ObInt32Type == type || ObIntType == type))
+          || (ObParquetDef::CT_DATE == converted_type && ObDateType == type);
+      break;
+    case ObParquetDef::PT_INT64:
+      // timestamps are printed with microseconds, other scales are rounded by the cast
+      bret = (is_signed_int && ObIntType == type)
+          || ((ObParquetDef::CT_TIMESTAMP_MILLIS == converted_type
+               || ObParquetDef::CT_TIMESTAMP_MICROS == converted_type)
+              && ObDateTimeType == type && MAX_SCALE_FOR_TEMPORAL == scale);
+      break;
+    case ObParquetDef::PT_FLOAT:
+      // float(m, d) and double(m, d) are rounded by the cast
+      bret = ObFloatType == type && scale < 0;
+      break;
+    case ObParquetDef::PT_DOUBLE:
+      bret = ObDoubleType == type && scale < 0;
+      break;
+    default:
+      break;
+  }
+  return bret;
+}
+
+static int64_t print_decimal(const int64_t unscaled, const int32_t scale, char *buf)
+{
+  char digits[ObFastFormatInt::MAX_DIGITS10_STR_SIZE];
+  const bool is_neg = unscaled < 0;
+  const uint64_t abs_value = is_neg ? (~static_cast<uint64_t>(unscaled) + 1) : unscaled;
+  const int64_t digit_cnt = ObFastFormatInt::format_unsigned(abs_value, digits);
+  int64_t pos = 0;
+  if (is_neg) {
+    buf[pos++] = '-';
+  }
+  if (scale <= 0) {
+    MEMCPY(buf + pos, digits, digit_cnt);
+    pos += digit_cnt;
+  } else if (digit_cnt > scale) {
+    MEMCPY(buf + pos, digits, digit_cnt - scale);
+    pos += digit_cnt - scale;
+    buf[pos++] = '.';
+    MEMCPY(buf + pos, digits + digit_cnt - scale, scale);
+    pos += scale;
+  } else {
+    buf[pos++] = '0';
+    buf[pos++] = '.';
+    MEMSET(buf + pos, '0', scale - digit_cnt);
+    pos += scale - digit_cnt;
+    MEMCPY(buf + pos, digits, digit_cnt);
+    pos += digit_cnt;
+  }
+  return pos;
+}
+
+// the type is checked by is_native_type() when the reader is inited. NaN and infinity can not
+// be stored in float and double columns, they are rejected as the cast of their text does.
+int ObParquetColumnReader::set_native_value(const ObString &value, ObDatum &datum) const
+{
+  int ret = OB_SUCCESS;
+  const char *ptr = value.ptr();
+  const int32_t converted_type = column_.converted_type_;
+  switch (column_.physical_type_) {
+    case ObParquetDef::PT_BOOLEAN:
+      datum.set_int(ptr[0] ? 1 : 0);
+      break;
+    case ObParquetDef::PT_INT32: {
+      const int32_t v = *reinterpret_cast<const int32_t *>(ptr);
+      if (ObParquetDef::CT_DATE == converted_type) {
+        datum.set_date(v);
+      } else {
+        datum.set_int(v);
+      }
+      break;
+    }
+    case ObParquetDef::PT_INT64: {
+      const int64_t v = *reinterpret_cast<const int64_t *>(ptr);
+      if (ObParquetDef::CT_TIMESTAMP_MILLIS == converted_type) {
+        datum.set_datetime(v * 1000);
+      } else if (ObParquetDef::CT_TIMESTAMP_MICROS == converted_type) {
+        datum.set_datetime(v);
+      } else {
+        datum.set_int(v);
+      }
+      break;
+    }
+    case ObParquetDef::PT_FLOAT: {
+      const float v = *reinterpret_cast<const float *>(ptr);
+      if (OB_UNLIKELY(std::isnan(v) || std::isinf(v))) {
+        ret = OB_INVALID_NUMERIC;
+        LOG_WARN("invalid float value", K(ret), K(v), K_(column));
+      } else {
+        datum.set_float(v);
+      }
+      break;
+    }
+    default: {
+      const double v = *reinterpret_cast<const double *>(ptr);
+      if (OB_UNLIKELY(std::isnan(v) || std::isinf(v))) {
+        ret = OB_INVALID_NUMERIC;
+        LOG_WARN("invalid double value", K(ret), K(v), K_(column));
+      } else {
+        datum.set_double(v);
+      }
+      break;
+    }
+  }
+  return ret;
+}
+
+// Values of native types are written as datums of the column type. Otherwise strings are referred
+// directly, other values are printed as text which is casted to the column type by the column
+// convert expr of external table.
+int ObParquetColumnReader::set_value(const ObString &value, ObDatum &datum, char *&text_pos) const
+{
+  int ret = OB_SUCCESS;
+  const char *ptr = value.ptr();
+  const int32_t physical_type = column_.physical_type_;
+  const int32_t converted_type = column_.converted_type_;
+  int64_t len = 0;
+  if (output_native_) {
+    ret = set_native_value(value, datum);
+  } else if ((ObParquetDef::PT_BYTE_ARRAY == physical_type
+       || ObParquetDef::PT_FIXED_LEN_BYTE_ARRAY == physical_type)
+      && ObParquetDef::CT_DECIMAL != converted_type) {
+    datum.set_string(value);
+  } else {
+    switch (physical_type) {
+      case ObParquetDef::PT_BOOLEAN:
+        text_pos[0] = ptr[0] ? '1' : '0';
+        len = 1;
+        break;
+      case ObParquetDef::PT_INT32: {
+        const int32_t v = *reinterpret_cast<const int32_t *>(ptr);
+        if (ObParquetDef::CT_DATE == converted_type) {
+          ret = ObTimeConverter::date_to_str(v, text_pos, MAX_VALUE_TEXT_LEN, len);
+        } else if (ObParquetDef::CT_DECIMAL == converted_type) {
+          len = print_decimal(v, column_.scale_, text_pos);
+        } else if (converted_type >= ObParquetDef::CT_UINT_8 && converted_type <= ObParquetDef::CT_UINT_64) {
+          len = ObFastFormatInt::format_unsigned(static_cast<uint32_t>(v), text_pos);
+        } else {
+          len = ObFastFormatInt::format_signed(v, text_pos);
+        }
+        break;
+      }
+      case ObParquetDef::PT_INT64: {
+        const int64_t v = *reinterpret_cast<const int64_t *>(ptr);
+        if (ObParquetDef::CT_TIMESTAMP_MILLIS == converted_type
+            || ObParquetDef::CT_TIMESTAMP_MICROS == converted_type) {
+          const int64_t usec = ObParquetDef::CT_TIMESTAMP_MILLIS == converted_type ? v * 1000 : v;
+          ret = ObTimeConverter::datetime_to_str(usec, nullptr, ObString(), 6,
+                                                 text_pos, MAX_VALUE_TEXT_LEN, len);
+        } else if (ObParquetDef::CT_DECIMAL == converted_type) {
+          len = print_decimal(v, column_.scale_, text_pos);
+        } else if (ObParquetDef::CT_UINT_64 == converted_type) {
+          len = ObFastFormatInt::format_unsigned(static_cast<uint64_t>(v), text_pos);
+        } else {
+          len = ObFastFormatInt::format_signed(v, text_pos);
+        }
+        break;
+      }
+      case ObParquetDef::PT_INT96: {
+        // legacy timestamp: nanoseconds of the day and julian day
+        const int64_t JULIAN_DAY_OF_EPOCH = 2440588;
+        const int64_t nanos = *reinterpret_cast<const int64_t *>(ptr);
+        const int64_t julian_day = *reinterpret_cast<const int32_t *>(ptr + sizeof(int64_t));
+        const int64_t usec = (julian_day - JULIAN_DAY_OF_EPOCH) * USECS_PER_DAY + nanos / 1000;
+        ret = ObTimeConverter::datetime_to_str(usec, nullptr, ObString(), 6,
+                                               text_pos, MAX_VALUE_TEXT_LEN, len);
+        break;
+      }
+      case ObParquetDef::PT_FLOAT:
+        len = ob_gcvt(*reinterpret_cast<const float *>(ptr), OB_GCVT_ARG_FLOAT,
+                      MAX_VALUE_TEXT_LEN - 1, text_pos, NULL);
+        break;
+      case ObParquetDef::PT_DOUBLE:
+        len = ob_gcvt(*reinterpret_cast<const double *>(ptr), OB_GCVT_ARG_DOUBLE,
+                      MAX_VALUE_TEXT_LEN - 1, text_pos, NULL);
+        break;
+      default: {
+        // decimal stored as big-endian two's complement
+        if (OB_UNLIKELY(value.length() > static_cast<int64_t>(sizeof(int64_t)) || value.empty())) {
+          ret = OB_NOT_SUPPORTED;
+          LOG_WARN("decimal wider than 64 bits is not supported", K(ret), K(column_), K(value.length()));
+          LOG_USER_ERROR(OB_NOT_SUPPORTED, "parquet decimal wider than 64 bits");
+        } else {
+          int64_t v = static_cast<int8_t>(ptr[0]);
+          for (int64_t i = 1; i < value.length(); ++i) {
+            v = static_cast<int64_t>(static_cast<uint64_t>(v) << 8) | static_cast<uint8_t>(ptr[i]);
+          }
+          len = print_decimal(v, column_.scale_, text_pos);
+        }
+        break;
+      }
+    }
+    if (OB_SUCC(ret)) {
+      datum.set_string(text_pos, static_cast<int32_t>(len));
+      text_pos += len;
+    } else {
+      LOG_WARN("fail to print value", K(ret), K(column_));
+    }
+  }
+  return ret;
+}
+
+int ObParquetColumnReader::read_plain_values(const int64_t row_cnt, const uint8_t *defs,
+                                             ObDatum *datums, char *&text_pos)
+{
+  int ret = OB_SUCCESS;
+  ObString value;
+  for (int64_t i = 0; OB_SUCC(ret) && i < row_cnt; ++i) {
+    if (0 == defs[i]) {
+      datums[i].set_null();
+    } else if (OB_FAIL(read_plain_value(value_pos_, value_end_, value))) {
+      LOG_WARN("fail to read plain value", K(ret), K(i));
+    } else if (OB_FAIL(set_value(value, datums[i], text_pos))) {
+      LOG_WARN("fail to set value", K(ret), K(i));
+    }
+  }
+  return ret;
+}
+
+int ObParquetColumnReader::read_dict_values(const int64_t row_cnt, const uint8_t *defs,
+                                            const int64_t not_null_cnt, ObDatum *datums,
+                                            char *&text_pos)
+{
+  int ret = OB_SUCCESS;
+  uint32_t indexes[MAX_SUB_BATCH_SIZE];
+  if (OB_FAIL(index_decoder_.get_batch(not_null_cnt, indexes))) {
+    LOG_WARN("fail to read dictionary indexes", K(ret), K(not_null_cnt));
+  }
+  for (int64_t i = 0, idx = 0; OB_SUCC(ret) && i < row_cnt; ++i) {
+    if (0 == defs[i]) {
+      datums[i].set_null();
+    } else if (OB_UNLIKELY(indexes[idx] >= dict_cnt_)) {
+      ret = OB_INVALID_DATA;
+      LOG_WARN("invalid dictionary index", K(ret), K(indexes[idx]), K(dict_cnt_));
+    } else if (OB_FAIL(set_value(dict_values_[indexes[idx++]], datums[i], text_pos))) {
+      LOG_WARN("fail to set value", K(ret), K(i));
+    }
+  }
+  return ret;
+}
+
+int ObParquetColumnReader::read_batch(const int64_t row_cnt, ObDatum *datums, ObIAllocator &text_allocator)
+{
+  int ret = OB_SUCCESS;
+  char *text_pos = nullptr;
+  uint8_t defs[MAX_SUB_BATCH_SIZE];
+  if (OB_ISNULL(allocator_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("column reader is not inited", K(ret));
+  } else if (need_text_buf() && row_cnt > 0
+             && OB_ISNULL(text_pos = static_cast<char *>(text_allocator.alloc(row_cnt * MAX_VALUE_TEXT_LEN)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("fail to alloc text buffer", K(ret), K(row_cnt));
+  }
+  for (int64_t idx = 0; OB_SUCC(ret) && idx < row_cnt; ) {
+    int64_t not_null_cnt = 0;
+    if (0 == page_remain_values_ && OB_FAIL(load_next_page())) {
+      LOG_WARN("fail to load next page", K(ret));
+    } else {
+      const int64_t cnt = MIN(MIN(row_cnt - idx, page_remain_values_), MAX_SUB_BATCH_SIZE);
+      if (OB_FAIL(read_def_levels(cnt, defs, not_null_cnt))) {
+        LOG_WARN("fail to read definition levels", K(ret));
+      } else if (is_dict_encoded_) {
+        ret = read_dict_values(cnt, defs, not_null_cnt, datums + idx, text_pos);
+      } else {
+        ret = read_plain_values(cnt, defs, datums + idx, text_pos);
+      }
+      idx += cnt;
+      page_remain_values_ -= cnt;
+    }
+  }
+  return ret;
+}
+
+int ObParquetColumnReader::skip_rows(const int64_t row_cnt)
+{
+  int ret = OB_SUCCESS;
+  uint8_t defs[MAX_SUB_BATCH_SIZE];
+  ObString value;
+  for (int64_t idx = 0; OB_SUCC(ret) && idx < row_cnt; ) {
+    int64_t not_null_cnt = 0;
+    if (0 == page_remain_values_ && OB_FAIL(load_next_page())) {
+      LOG_WARN("fail to load next page", K(ret));
+    } else if (row_cnt - idx >= page_remain_values_) {
+      // skip the whole page
+      idx += page_remain_values_;
+      page_remain_values_ = 0;
+    } else {
+      const int64_t cnt = MIN(row_cnt - idx, MAX_SUB_BATCH_SIZE);
+      if (OB_FAIL(read_def_levels(cnt, defs, not_null_cnt))) {
+        LOG_WARN("fail to read definition levels", K(ret));
+      } else if (is_dict_encoded_) {
+        ret = index_decoder_.skip(not_null_cnt);
+      } else {
+        for (int64_t i = 0; OB_SUCC(ret) && i < not_null_cnt; ++i) {
+          ret = read_plain_value(value_pos_, value_end_, value);
+        }
+      }
+      idx += cnt;
+      page_remain_values_ -= cnt;
+    }
+  }
+  return ret;
+}
+
+}
+}
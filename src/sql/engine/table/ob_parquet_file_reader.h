@@ -0,0 +1,281 @@
+/**
+ * Copyright (c) 2023 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OB_PARQUET_FILE_READER_H_
+#define OB_PARQUET_FILE_READER_H_
+
+#include "lib/container/ob_se_array.h"
+#include "lib/allocator/ob_allocator.h"
+#include "common/object/ob_obj_type.h"
+#include "share/datum/ob_datum.h"
+#include "objit/common/ob_item_type.h"
+
+namespace oceanbase
+{
+namespace sql
+{
+
+// Constants of the parquet format, the values are the same as parquet.thrift
+struct ObParquetDef
+{
+  static const char MAGIC[];
+  static const int64_t MAGIC_LEN = 4;
+  // footer length (4 bytes) and magic
+  static const int64_t FOOTER_TAIL_LEN = 8;
+
+  enum PhysicalType
+  {
+    PT_BOOLEAN = 0,
+    PT_INT32 = 1,
+    PT_INT64 = 2,
+    PT_INT96 = 3,
+    PT_FLOAT = 4,
+    PT_DOUBLE = 5,
+    PT_BYTE_ARRAY = 6,
+    PT_FIXED_LEN_BYTE_ARRAY = 7,
+  };
+  enum ConvertedType
+  {
+    CT_NONE = -1,
+    CT_UTF8 = 0,
+    CT_DECIMAL = 5,
+    CT_DATE = 6,
+    CT_TIMESTAMP_MILLIS = 9,
+    CT_TIMESTAMP_MICROS = 10,
+    CT_UINT_8 = 11,
+    CT_UINT_16 = 12,
+    CT_UINT_32 = 13,
+    CT_UINT_64 = 14,
+    CT_INT_8 = 15,
+    CT_INT_16 = 16,
+    CT_INT_32 = 17,
+    CT_INT_64 = 18,
+  };
+  enum Repetition
+  {
+    REP_REQUIRED = 0,
+    REP_OPTIONAL = 1,
+    REP_REPEATED = 2,
+  };
+  enum Codec
+  {
+    CODEC_UNCOMPRESSED = 0,
+    CODEC_SNAPPY = 1,
+    CODEC_GZIP = 2,
+    CODEC_LZO = 3,
+    CODEC_BROTLI = 4,
+    CODEC_LZ4 = 5,
+    CODEC_ZSTD = 6,
+    CODEC_LZ4_RAW = 7,
+  };
+  enum Encoding
+  {
+    ENC_PLAIN = 0,
+    ENC_PLAIN_DICTIONARY = 2,
+    ENC_RLE = 3,
+    ENC_BIT_PACKED = 4,
+    ENC_RLE_DICTIONARY = 8,
+  };
+  enum PageType
+  {
+    PAGE_DATA = 0,
+    PAGE_INDEX = 1,
+    PAGE_DICTIONARY = 2,
+    PAGE_DATA_V2 = 3,
+  };
+};
+
+struct ObParquetColumnSchema
+{
+  ObParquetColumnSchema()
+    : physical_type_(-1), type_length_(0), converted_type_(ObParquetDef::CT_NONE),
+      scale_(0), max_def_level_(0) {}
+  common::ObString name_;
+  int32_t physical_type_;
+  int32_t type_length_;
+  int32_t converted_type_;
+  int32_t scale_;
+  // 1 for optional columns, nested columns are not supported
+  int16_t max_def_level_;
+  TO_STRING_KV(K_(name), K_(physical_type), K_(type_length), K_(converted_type), K_(scale),
+               K_(max_def_level));
+};
+
+struct ObParquetColumnChunkMeta
+{
+  ObParquetColumnChunkMeta()
+    : codec_(ObParquetDef::CODEC_UNCOMPRESSED), num_values_(0), data_page_offset_(0),
+      dictionary_page_offset_(0), total_compressed_size_(0), has_min_max_(false), null_count_(-1) {}
+  // the dictionary page is in front of data pages if exists
+  int64_t get_start_offset() const
+  {
+    return dictionary_page_offset_ > 0 && dictionary_page_offset_ < data_page_offset_
+        ? dictionary_page_offset_ : data_page_offset_;
+  }
+  int32_t codec_;
+  int64_t num_values_;
+  int64_t data_page_offset_;
+  int64_t dictionary_page_offset_;
+  int64_t total_compressed_size_;
+  bool has_min_max_;
+  int64_t null_count_;
+  // plain encoded min and max value
+  common::ObString min_;
+  common::ObString max_;
+  TO_STRING_KV(K_(codec), K_(num_values), K_(data_page_offset), K_(dictionary_page_offset),
+               K_(total_compressed_size), K_(has_min_max), K_(null_count));
+};
+
+struct ObParquetRowGroupMeta
+{
+  ObParquetRowGroupMeta() : num_rows_(0), first_row_idx_(0) {}
+  int64_t num_rows_;
+  // row index of the first row in the file
+  int64_t first_row_idx_;
+  TO_STRING_KV(K_(num_rows), K_(first_row_idx));
+};
+
+// FileMetaData in the footer of a parquet file, only flat schemas are supported.
+class ObParquetFileMeta
+{
+public:
+  explicit ObParquetFileMeta(common::ObIAllocator &allocator)
+    : allocator_(allocator), num_rows_(0) {}
+  ~ObParquetFileMeta() { reset(); }
+  void reset();
+  // parse FileMetaData serialized by thrift compact protocol, strings are deep copied
+  int parse(const char *buf, const int64_t len);
+  int64_t get_column_count() const { return columns_.count(); }
+  int64_t get_row_group_count() const { return row_groups_.count(); }
+  int64_t get_row_count() const { return num_rows_; }
+  const ObParquetColumnSchema &get_column(const int64_t col_idx) const { return columns_.at(col_idx); }
+  const ObParquetRowGroupMeta &get_row_group(const int64_t rg_idx) const { return row_groups_.at(rg_idx); }
+  const ObParquetColumnChunkMeta &get_chunk(const int64_t rg_idx, const int64_t col_idx) const
+  {
+    return chunks_.at(rg_idx * columns_.count() + col_idx);
+  }
+  // check whether no value in the chunk satisfies `column cmp_type value` by min/max statistics,
+  // value_type is the type of both the table column and value. Only bigint, int, float, double
+  // and date columns read from the same parquet types are checked, so that the statistics are
+  // not changed by the conversion from the file column.
+  static int can_skip_chunk(const ObParquetColumnSchema &column,
+                            const ObParquetColumnChunkMeta &chunk,
+                            const ObItemType cmp_type,
+                            const common::ObObjType value_type,
+                            const common::ObDatum &value,
+                            bool &can_skip);
+  TO_STRING_KV(K_(num_rows), K_(columns), K_(row_groups));
+
+private:
+  template <typename T>
+  static bool may_match(const ObItemType cmp_type, const T min, const T max, const T value);
+
+private:
+  common::ObIAllocator &allocator_;
+  int64_t num_rows_;
+  common::ObSEArray<ObParquetColumnSchema, 16> columns_;
+  common::ObSEArray<ObParquetRowGroupMeta, 16> row_groups_;
+  // chunks of row group i are [i * column count, (i + 1) * column count)
+  common::ObSEArray<ObParquetColumnChunkMeta, 64> chunks_;
+};
+
+// Decoder of RLE/bit-packed hybrid encoding used by levels and dictionary indices
+class ObParquetRleDecoder
+{
+public:
+  ObParquetRleDecoder() { reset(); }
+  void reset();
+  void init(const char *buf, const int64_t len, const int32_t bit_width);
+  int get_batch(const int64_t count, uint32_t *values);
+  int skip(const int64_t count);
+private:
+  int next_run();
+private:
+  const unsigned char *pos_;
+  const unsigned char *end_;
+  int32_t bit_width_;
+  int64_t rle_remain_;
+  uint32_t rle_value_;
+  const unsigned char *packed_data_;
+  int64_t packed_idx_;
+  int64_t packed_remain_;
+};
+
+// Reader of one column chunk, values are decoded page by page in batches.
+class ObParquetColumnReader
+{
+public:
+  // enough for numbers, decimals and datetimes
+  static const int64_t MAX_VALUE_TEXT_LEN = 64;
+  static const int64_t MAX_SUB_BATCH_SIZE = 256;
+
+  ObParquetColumnReader() : allocator_(nullptr) { reset(); }
+  ~ObParquetColumnReader() { reset(); }
+  void reset();
+  // chunk_buf holds the whole column chunk and must be valid until reset,
+  // decompressed pages and the dictionary are allocated from allocator.
+  // Values are decoded as datums of the column type if output_native is true, which requires
+  // is_native_type() of the column type.
+  int init(const ObParquetColumnSchema &column, const ObParquetColumnChunkMeta &chunk,
+           const char *chunk_buf, const int64_t chunk_len, common::ObIAllocator &allocator,
+           const bool output_native = false);
+  // decode the next row_cnt values into datums, strings refer to the chunk or decompressed pages
+  // and other types are printed as text into text_allocator unless output_native.
+  int read_batch(const int64_t row_cnt, common::ObDatum *datums, common::ObIAllocator &text_allocator);
+  int skip_rows(const int64_t row_cnt);
+  // whether values of the parquet column are decoded into datums of the column type without
+  // conversion, the result is the same as casting the text of the value to the column type.
+  static bool is_native_type(const ObParquetColumnSchema &column, const common::ObObjType type,
+                             const int16_t scale);
+  TO_STRING_KV(K_(column), K_(chunk), K_(output_native), K_(page_remain_values),
+               K_(is_dict_encoded), K_(dict_cnt));
+
+private:
+  int load_next_page();
+  int decompress(const char *src, const int64_t src_len, const int64_t uncompressed_len,
+                 const char *&data);
+  int load_dictionary(const char *buf, const int64_t len, const int64_t value_cnt);
+  int init_values(const int32_t encoding, const char *buf, const int64_t len);
+  int read_def_levels(const int64_t row_cnt, uint8_t *defs, int64_t &not_null_cnt);
+  int read_plain_values(const int64_t row_cnt, const uint8_t *defs, common::ObDatum *datums,
+                        char *&text_pos);
+  int read_dict_values(const int64_t row_cnt, const uint8_t *defs, const int64_t not_null_cnt,
+                       common::ObDatum *datums, char *&text_pos);
+  int read_plain_value(const char *&pos, const char *end, common::ObString &value);
+  int set_value(const common::ObString &value, common::ObDatum &datum, char *&text_pos) const;
+  int set_native_value(const common::ObString &value, common::ObDatum &datum) const;
+  bool need_text_buf() const;
+
+private:
+  ObParquetColumnSchema column_;
+  ObParquetColumnChunkMeta chunk_;
+  common::ObIAllocator *allocator_;
+  bool output_native_;
+  const char *chunk_pos_;
+  const char *chunk_end_;
+  int64_t page_remain_values_;
+  ObParquetRleDecoder def_decoder_;
+  bool is_dict_encoded_;
+  ObParquetRleDecoder index_decoder_;
+  // plain encoded values of current page
+  const char *value_pos_;
+  const char *value_end_;
+  // bit offset in the current byte of plain encoded booleans
+  int64_t bool_bit_idx_;
+  common::ObString *dict_values_;
+  int64_t dict_cnt_;
+};
+
+}
+}
+
+#endif // OB_PARQUET_FILE_READER_H_
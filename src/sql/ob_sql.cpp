@@ -2130,7 +2130,7 @@ int ObSql::handle_ps_execute(const ObPsStmtId client_stmt_id,
     } else if (OB_FAIL(construct_param_store(ps_params, pctx->get_param_store_for_update()))) {
       LOG_WARN("construct param store failed", K(ret));
     } else {
-      const ObString &sql = !ps_info->get_no_param_sql().empty() ? ps_info->get_no_param_sql() : ps_info->get_ps_sql();
+      const ObString &sql = ps_info->get_exec_sql();
       context.cur_sql_ = sql;
 #ifndef NDEBUG
       LOG_INFO("Begin to handle execute statement", "sess_id", session.get_sessid(),
@@ -2142,7 +2142,7 @@ int ObSql::handle_ps_execute(const ObPsStmtId client_stmt_id,
       }
       if (OB_FAIL(session.store_query_string(sql))) {
         LOG_WARN("store query string fail", K(ret));
-      } else if (FALSE_IT(generate_ps_sql_id(sql, context))) {
+      } else if (FALSE_IT(generate_ps_sql_id(sql, *ps_info, context))) {
       } else if (OB_LIKELY(ObStmt::is_dml_stmt(stmt_type))) {
         //if plan not exist, generate plan
         ObPlanCacheCtx pc_ctx(sql, PC_PS_MODE, allocator, context, ectx,
@@ -5238,6 +5238,18 @@ void ObSql::generate_ps_sql_id(const ObString &raw_sql,
   (void)ObSQLUtils::md5(raw_sql, context.sql_id_, (int32_t)sizeof(context.sql_id_));
 }
 
+void ObSql::generate_ps_sql_id(const ObString &raw_sql,
+                               const ObPsStmtInfo &ps_info,
+                               ObSqlCtx &context)
+{
+  // sql id of the ps stmt is calculated at prepare, skip md5 on execute
+  if ('\0' != ps_info.get_sql_id()[0]) {
+    MEMCPY(context.sql_id_, ps_info.get_sql_id(), sizeof(context.sql_id_));
+  } else {
+    generate_ps_sql_id(raw_sql, context);
+  }
+}
+
 void ObSql::generate_sql_id(ObPlanCacheCtx &pc_ctx,
                            bool add_plan_to_pc,
                            ParseResult &parse_result,
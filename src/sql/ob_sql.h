@@ -448,6 +448,9 @@ private:
                          ParamStore &param_store);
   void generate_ps_sql_id(const ObString &raw_sql,
                           ObSqlCtx &context);
+  void generate_ps_sql_id(const ObString &raw_sql,
+                          const ObPsStmtInfo &ps_info,
+                          ObSqlCtx &context);
   void generate_sql_id(ObPlanCacheCtx &pc_ctx,
                            bool add_plan_to_pc,
                            ParseResult &parse_result,
@@ -1134,11 +1134,9 @@ int64_t ObFastParserBase::is_whitespace(int64_t pos)
     }
     ws_end_pos = pos;
   } else if ('#' == ch) { // #{non_newline}*
-    ch = raw_sql_.char_at(++pos);
-    while (is_non_newline(ch)) {
-      ch = raw_sql_.char_at(++pos);
-    }
-    ws_end_pos = pos;
+    // INVALID_CHAR is not a non_newline char either
+    ws_end_pos = pos + 1 < raw_sql_.raw_sql_len_ ?
+        raw_sql_.find_first_of(pos + 1, '\n', '\r', INVALID_CHAR) : pos + 1;
   } else if ('-' == ch) { // "--"{space}+{non_newline}*
     ch = raw_sql_.char_at(++pos);
     if ('-' == ch) {
@@ -1148,11 +1146,8 @@ int64_t ObFastParserBase::is_whitespace(int64_t pos)
         while (IS_MULTI_SPACE(pos, space_len)) {
           pos += space_len;
         }
-        ch = raw_sql_.char_at(pos);
-        while (is_non_newline(ch)) {
-          ch = raw_sql_.char_at(++pos);
-        }
-        ws_end_pos = pos;
+        ws_end_pos = pos < raw_sql_.raw_sql_len_ ?
+            raw_sql_.find_first_of(pos, '\n', '\r', INVALID_CHAR) : pos;
       }
     }
   }
@@ -1953,7 +1948,9 @@ int ObFastParserBase::process_comment_content(bool is_mysql_comment)
       is_match = true;
       break;;
     } else {
-      ch = raw_sql_.scan();
+      // only '*' and the '/' of nested comment need to be checked
+      raw_sql_.scan();
+      ch = raw_sql_.scan_to_first_of('*', is_mysql_comment ? '/' : '*', '*');
     }
   }
   if (!is_match) {
@@ -2391,8 +2388,8 @@ int ObFastParserMysql::process_string(const char quote)
     while (OB_SUCC(ret) && !raw_sql_.is_search_end()) {
       ch = raw_sql_.scan();
       int64_t copy_begin_pos = raw_sql_.cur_pos_;
-      while (!raw_sql_.is_search_end() && '\\' != ch && quote != ch) {
-        ch = raw_sql_.scan();
+      if ('\\' != ch && quote != ch) {
+        ch = raw_sql_.scan_to_first_of('\\', quote, quote);
       }
       int64_t len = raw_sql_.cur_pos_ - copy_begin_pos;
       if (len > 0) {
@@ -2705,9 +2702,7 @@ int ObFastParserMysql::parse_next_token()
           cur_token_type_ = IGNORE_TOKEN;
           // skip the second '-' and space
           raw_sql_.scan(1);
-          while (!raw_sql_.is_search_end() && is_non_newline(ch)) {
-            ch = raw_sql_.scan();
-          }
+          raw_sql_.scan_to_first_of('\n', '\r', INVALID_CHAR);
         } else if ('-' == ch &&
                    raw_sql_.cur_pos_ + 1 < raw_sql_.raw_sql_len_ &&
                    (raw_sql_.raw_sql_[raw_sql_.cur_pos_ + 1] == '\n' ||
@@ -2724,10 +2719,8 @@ int ObFastParserMysql::parse_next_token()
       case '#': {
         // sql_comment: (#{non_newline}*)
         cur_token_type_ = IGNORE_TOKEN;
-        ch = raw_sql_.scan();
-        while (is_non_newline(ch)) {
-          ch = raw_sql_.scan();
-        }
+        raw_sql_.scan();
+        raw_sql_.scan_to_first_of('\n', '\r', INVALID_CHAR);
         break;
       }
       case '/': {
@@ -2840,8 +2833,8 @@ int ObFastParserOracle::process_string(const bool in_q_quote)
     while (OB_SUCC(ret) && !raw_sql_.is_search_end()) {
       ch = raw_sql_.scan();
       int64_t copy_begin_pos = raw_sql_.cur_pos_;
-      while (!raw_sql_.is_search_end() && '\\' != ch && '\'' != ch) {
-        ch = raw_sql_.scan();
+      if ('\\' != ch && '\'' != ch) {
+        ch = raw_sql_.scan_to_first_of('\\', '\'', '\'');
       }
       int64_t len = raw_sql_.cur_pos_ - copy_begin_pos;
       if (len > 0) {
@@ -3132,10 +3125,8 @@ int ObFastParserOracle::parse_next_token()
         if ('-' == ch) {
           // "--"{non_newline}*
           cur_token_type_ = IGNORE_TOKEN;
-          ch = raw_sql_.scan();
-          while (!raw_sql_.is_search_end() && is_non_newline(ch)) {
-            ch = raw_sql_.scan();
-          }
+          raw_sql_.scan();
+          raw_sql_.scan_to_first_of('\n', '\r', INVALID_CHAR);
         } else if (OB_FAIL(process_negative())) {
           LOG_WARN("failed to handle negative", K(ret));
         }
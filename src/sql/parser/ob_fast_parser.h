@@ -21,6 +21,9 @@
 #include "sql/parser/parse_malloc.h"
 #include "sql/udr/ob_udr_struct.h"
 #include "sql/plan_cache/ob_plan_cache_struct.h"
+#if defined(__x86_64__)
+#include <emmintrin.h>
+#endif
 
 namespace oceanbase
 {
@@ -117,6 +120,52 @@ struct ObRawSql {
 		}
 		return raw_sql_[--cur_pos_];
 	}
+	/**
+	 * Find the first %c1, %c2 or %c3 in [pos, raw_sql_len_), used to skip the body of strings
+	 * and comments. The text is compared 16 bytes at a time on x86_64 and byte by byte for
+	 * the tail and on other platforms.
+	 * Return raw_sql_len_ if none of them is found
+	 */
+	inline int64_t find_first_of(int64_t pos, const char c1, const char c2, const char c3) const
+	{
+#if defined(__x86_64__)
+		const __m128i v1 = _mm_set1_epi8(c1);
+		const __m128i v2 = _mm_set1_epi8(c2);
+		const __m128i v3 = _mm_set1_epi8(c3);
+		for (; pos + 16 <= raw_sql_len_; pos += 16) {
+			const __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i *>(raw_sql_ + pos));
+			const int mask = _mm_movemask_epi8(_mm_or_si128(
+				_mm_or_si128(_mm_cmpeq_epi8(data, v1), _mm_cmpeq_epi8(data, v2)),
+				_mm_cmpeq_epi8(data, v3)));
+			if (0 != mask) {
+				return pos + __builtin_ctz(mask);
+			}
+		}
+#endif
+		for (; pos < raw_sql_len_; pos++) {
+			const char ch = raw_sql_[pos];
+			if (c1 == ch || c2 == ch || c3 == ch) {
+				return pos;
+			}
+		}
+		return raw_sql_len_;
+	}
+	// Same as calling scan() while the current char is none of %c1, %c2 and %c3.
+	// Return the char found, or INVALID_CHAR if the end is reached
+	inline char scan_to_first_of(const char c1, const char c2, const char c3)
+	{
+		char ch = INVALID_CHAR;
+		if (!is_search_end()) {
+			cur_pos_ = find_first_of(cur_pos_, c1, c2, c3);
+			if (cur_pos_ >= raw_sql_len_) {
+				search_end_ = true;
+				cur_pos_ = raw_sql_len_;
+			} else {
+				ch = raw_sql_[cur_pos_];
+			}
+		}
+		return ch;
+	}
 	inline char char_at(int64_t idx)
 	{
 		if (idx < 0 || idx >= raw_sql_len_) {
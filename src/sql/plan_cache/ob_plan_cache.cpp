@@ -393,6 +393,7 @@ void ObPlanCache::destroy()
       DESTROY_CONTEXT(root_context_);
       root_context_ = NULL;
     }
+    pc_stat_.destroy();
     inited_ = false;
   }
 }
@@ -408,6 +409,8 @@ int ObPlanCache::init(int64_t hash_bucket, uint64_t tenant_id)
       .set_mem_attr(attr);
     if (OB_FAIL(ROOT_CONTEXT->CREATE_CONTEXT(root_context_, param))) {
       SQL_PC_LOG(WARN, "failed to create context", K(ret));
+    } else if (OB_FAIL(pc_stat_.init(tenant_id))) {
+      SQL_PC_LOG(WARN, "failed to init plan cache stat", K(ret));
     } else if (OB_FAIL(co_mgr_.init(hash_bucket, tenant_id))) {
       SQL_PC_LOG(WARN, "failed to init lib cache manager", K(ret));
     } else if (OB_FAIL(cache_key_node_map_.create(hash::cal_next_prime(hash_bucket),
@@ -440,6 +443,7 @@ int ObPlanCache::init(int64_t hash_bucket, uint64_t tenant_id)
         DESTROY_CONTEXT(root_context_);
         root_context_ = NULL;
       }
+      pc_stat_.destroy();
     }
   }
   return ret;
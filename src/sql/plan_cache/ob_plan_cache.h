@@ -341,12 +341,8 @@ public:
   int64_t get_bucket_num() const { return bucket_num_; }
 
   // access count related
-  void inc_access_cnt() { ATOMIC_INC(&pc_stat_.access_count_);}
-  void inc_hit_and_access_cnt()
-  {
-    ATOMIC_INC(&pc_stat_.hit_count_);
-    ATOMIC_INC(&pc_stat_.access_count_);
-  }
+  void inc_access_cnt() { pc_stat_.inc_access_count(); }
+  void inc_hit_and_access_cnt() { pc_stat_.inc_hit_and_access_count(); }
 
   /*
    * cache evict
@@ -17,8 +17,10 @@
 #include "lib/container/ob_se_array.h"
 #include "lib/hash/ob_hashmap.h"
 #include "lib/hash_func/murmur_hash.h"
+#include "lib/metrics/ob_counter.h"
 #include "lib/time/ob_time_utility.h"
 #include "lib/allocator/ob_allocator.h"
+#include "lib/allocator/ob_malloc.h"
 #include "lib/string/ob_string.h"
 #include "lib/utility/serialization.h"
 #include "sql/plan_cache/ob_lib_cache_register.h"
@@ -538,16 +540,94 @@ struct ObPlanCacheCtx : public ObILibCacheCtx
 
 struct ObPlanCacheStat
 {
-  uint64_t access_count_;
-  uint64_t hit_count_;
+  // every plan cache lookup of the tenant updates them, so they are counted by cpu
+  // instead of bouncing one cache line between all worker threads. The two counts of
+  // a cpu share one slot, and a slot takes a whole cache line, so that neighbouring
+  // cpus do not false share.
+  struct Slot
+  {
+    int64_t access_count_;
+    int64_t hit_count_;
+  } CACHE_ALIGNED;
 
-  ObPlanCacheStat()
-    : access_count_(0),
-      hit_count_(0)
-  {}
+  ObPlanCacheStat() : slots_(NULL) {}
+  ~ObPlanCacheStat() { destroy(); }
+
+  // The plan cache is allocated by ob_malloc, which aligns to 16 bytes only, so the slots
+  // are allocated separately on a cache line boundary.
+  int init(const uint64_t tenant_id)
+  {
+    int ret = common::OB_SUCCESS;
+    if (NULL == slots_) {
+      const int64_t size = sizeof(Slot) * common::OB_COUNTER_MAX_CPU_NUM;
+      slots_ = static_cast<Slot *>(common::ob_malloc_align(CACHE_ALIGN_SIZE, size,
+                                   common::ObMemAttr(tenant_id, "PlanCacheStat")));
+      if (NULL == slots_) {
+        ret = common::OB_ALLOCATE_MEMORY_FAILED;
+      } else {
+        MEMSET(slots_, 0, size);
+      }
+    }
+    return ret;
+  }
+  void destroy()
+  {
+    if (NULL != slots_) {
+      common::ob_free_align(slots_);
+      slots_ = NULL;
+    }
+  }
+  void reset()
+  {
+    if (NULL != slots_) {
+      MEMSET(slots_, 0, sizeof(Slot) * common::OB_COUNTER_MAX_CPU_NUM);
+    }
+  }
+  void inc_access_count()
+  {
+    if (NULL != slots_) {
+      Slot &slot = get_slot();
+      (void)ATOMIC_FAA(&slot.access_count_, 1);
+    }
+  }
+  void inc_hit_and_access_count()
+  {
+    if (NULL != slots_) {
+      Slot &slot = get_slot();
+      (void)ATOMIC_FAA(&slot.hit_count_, 1);
+      (void)ATOMIC_FAA(&slot.access_count_, 1);
+    }
+  }
+  int64_t get_access_count() const
+  {
+    int64_t sum = 0;
+    for (int64_t i = 0; NULL != slots_ && i < get_valid_slot_count(); ++i) {
+      sum += ATOMIC_LOAD(&slots_[i].access_count_);
+    }
+    return sum;
+  }
+  int64_t get_hit_count() const
+  {
+    int64_t sum = 0;
+    for (int64_t i = 0; NULL != slots_ && i < get_valid_slot_count(); ++i) {
+      sum += ATOMIC_LOAD(&slots_[i].hit_count_);
+    }
+    return sum;
+  }
+
+  TO_STRING_KV("access_count", get_access_count(),
+               "hit_count", get_hit_count());
+
+private:
+  Slot &get_slot() { return slots_[common::icpu_id() % common::OB_COUNTER_MAX_CPU_NUM]; }
+  static int64_t get_valid_slot_count()
+  {
+    return std::min(common::get_max_icpu_id(), common::OB_COUNTER_MAX_CPU_NUM);
+  }
 
-  TO_STRING_KV("access_count", access_count_,
-               "hit_count", hit_count_);
+  // OB_COUNTER_MAX_CPU_NUM slots
+  Slot *slots_;
+  DISALLOW_COPY_AND_ASSIGN(ObPlanCacheStat);
 };
 
 }
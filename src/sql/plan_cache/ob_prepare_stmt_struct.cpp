@@ -16,6 +16,7 @@
 #include "lib/utility/ob_print_utils.h"
 #include "sql/plan_cache/ob_ps_sql_utils.h"
 #include "sql/plan_cache/ob_ps_cache.h"
+#include "sql/ob_sql_utils.h"
 #include "sql/resolver/cmd/ob_call_procedure_stmt.h"
 #include "sql/parser/parse_node.h"
 
@@ -288,8 +289,8 @@ ObPsStmtInfo::ObPsStmtInfo(ObIAllocator *inner_allocator)
     raw_params_(inner_allocator),
     raw_params_idx_(inner_allocator),
     literal_stmt_type_(stmt::T_NONE)
-
 {
+  sql_id_[0] = '\0';
 }
 
 ObPsStmtInfo::ObPsStmtInfo(ObIAllocator *inner_allocator,
@@ -318,6 +319,7 @@ ObPsStmtInfo::ObPsStmtInfo(ObIAllocator *inner_allocator,
     raw_params_idx_(inner_allocator),
     literal_stmt_type_(stmt::T_NONE)
 {
+  sql_id_[0] = '\0';
 }
 
 bool ObPsStmtInfo::is_valid() const
@@ -325,6 +327,11 @@ bool ObPsStmtInfo::is_valid() const
   return !ps_key_.ps_sql_.empty();
 }
 
+void ObPsStmtInfo::calc_sql_id()
+{
+  (void)ObSQLUtils::md5(get_exec_sql(), sql_id_, (int32_t)sizeof(sql_id_));
+}
+
 int ObPsStmtInfo::assign_no_param_sql(const common::ObString &no_param_sql)
 {
   int ret = OB_SUCCESS;
@@ -462,6 +469,7 @@ int ObPsStmtInfo::deep_copy(const ObPsStmtInfo &other)
     is_expired_ = other.is_expired_;
     is_expired_evicted_ = other.is_expired_evicted_;
     literal_stmt_type_ = other.literal_stmt_type_;
+    MEMCPY(sql_id_, other.sql_id_, sizeof(sql_id_));
     if (other.get_dep_objs_cnt() > 0) {
       dep_objs_cnt_ = other.get_dep_objs_cnt();
       if (NULL == (dep_objs_ = reinterpret_cast<ObSchemaObjVersion *>
@@ -187,6 +187,11 @@ public:
   const ObPsSqlKey& get_sql_key() const { return ps_key_; }
   inline const common::ObString &get_ps_sql() const { return ps_key_.ps_sql_; }
   inline const common::ObString &get_no_param_sql() const { return no_param_sql_; }
+  // sql executed by COM_STMT_EXECUTE, also the name of the ps plan in plan cache
+  inline const common::ObString &get_exec_sql() const
+  { return !no_param_sql_.empty() ? no_param_sql_ : ps_key_.ps_sql_; }
+  inline const char *get_sql_id() const { return sql_id_; }
+  void calc_sql_id();
   inline const common::ObIArray<int64_t> &get_raw_params_idx() const
   { return raw_params_idx_; }
   inline const common::ObIArray<ObPCParam *> &get_fixed_raw_params() const { return raw_params_; }
@@ -292,6 +297,8 @@ private:
   ObFixedArray<ObPCParam *, common::ObIAllocator> raw_params_;
   ObFixedArray<int64_t, common::ObIAllocator> raw_params_idx_;
   stmt::StmtType literal_stmt_type_;
+  // md5 of exec sql, calculated once at prepare instead of every execute
+  char sql_id_[common::OB_MAX_SQL_ID_LENGTH + 1];
 };
 
 struct TypeInfo {
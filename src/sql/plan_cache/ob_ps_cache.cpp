@@ -427,6 +427,7 @@ int ObPsCache::get_or_add_stmt_info(const PsCacheInfoCtx &info_ctx,
         // do nothing
       } else if (OB_FAIL(tmp_stmt_info.assign_no_param_sql(info_ctx.no_param_sql_))) {
         LOG_WARN("fail to assign no param sql", K(ret), K(info_ctx.no_param_sql_));
+      } else if (FALSE_IT(tmp_stmt_info.calc_sql_id())) {
       } else if (OB_FAIL(tmp_stmt_info.assign_raw_sql(info_ctx.raw_sql_))) {
         LOG_WARN("fail to assign rule name", K(ret), K(info_ctx.raw_sql_));
       } else if (OB_FAIL(tmp_stmt_info.assign_fixed_raw_params(*info_ctx.fixed_param_idx_,
@@ -2300,6 +2300,18 @@ int ObDDLResolver::resolve_file_format(const ParseNode *node, ObExternalFileForm
         ObString string_v = ObString(node->children_[0]->str_len_, node->children_[0]->str_value_).trim_space_only();
         if (0 == string_v.case_compare("CSV")) {
           format.format_type_ = ObExternalFileFormat::CSV_FORMAT;
+        } else if (0 == string_v.case_compare("PARQUET")) {
+          uint64_t tenant_data_version = 0;
+          if (OB_FAIL(GET_MIN_DATA_VERSION(params_.session_info_->get_effective_tenant_id(),
+                                           tenant_data_version))) {
+            LOG_WARN("get tenant data version failed", K(ret));
+          } else if (tenant_data_version < DATA_VERSION_4_3_0_0) {
+            ret = OB_NOT_SUPPORTED;
+            LOG_WARN("parquet format is not supported in data version less than 4.3.0", K(ret), K(tenant_data_version));
+            LOG_USER_ERROR(OB_NOT_SUPPORTED, "parquet format in data version less than 4.3.0");
+          } else {
+            format.format_type_ = ObExternalFileFormat::PARQUET_FORMAT;
+          }
         } else {
           ObSqlString err_msg;
           err_msg.append_fmt("format '%.*s'", string_v.length(), string_v.ptr());
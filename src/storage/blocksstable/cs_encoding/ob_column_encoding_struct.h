@@ -36,6 +36,8 @@ struct ObCSColumnHeader
     STRING = 1,
     INT_DICT = 2,
     STR_DICT = 3,
+    FLOAT = 4,
+    FSST = 5,
     MAX_TYPE
   };
 
@@ -46,6 +48,8 @@ struct ObCSColumnHeader
       case STRING :  { return "STRING"; }
       case INT_DICT: { return "INT_DICT"; }
       case STR_DICT: { return "STR_DICT"; }
+      case FLOAT:    { return "FLOAT"; }
+      case FSST:     { return "FSST"; }
       default:       { return "MAX_TYPE"; }
     }
   }
@@ -193,6 +197,90 @@ struct ObDictEncodingMeta final
 
 } __attribute__((packed));
 
+// Float/double values are stored as decimal integers: v = n * 10^factor / 10^exponent (ALP),
+// which is followed by exception_cnt_ exceptions in the column meta:
+// row_id(uint32_t) * exception_cnt_ + raw value(uint64_t) * exception_cnt_.
+// Exceptions are the values can not be restored from n exactly, such as NaN, inf and -0.0.
+struct ObFloatEncodingMeta final
+{
+  static constexpr uint8_t OB_FLOAT_ENCODING_META_V1 = 0;
+  static const int64_t MAX_DOUBLE_EXPONENT = 18;
+  static const int64_t MAX_FLOAT_EXPONENT = 10;
+  // scaled values are rounded by the magic number, which is exact below 2^51
+  static constexpr double ENCODING_UPPER_LIMIT = 2251799813685248.0;
+  static const double EXP10_ARR[MAX_DOUBLE_EXPONENT + 1];
+  static const double FRAC10_ARR[MAX_DOUBLE_EXPONENT + 1];
+
+  ObFloatEncodingMeta()
+    : version_(OB_FLOAT_ENCODING_META_V1), attrs_(0),
+      exponent_(0), factor_(0), exception_cnt_(0) {}
+  void reuse()
+  {
+    version_ = OB_FLOAT_ENCODING_META_V1;
+    attrs_ = 0;
+    exponent_ = 0;
+    factor_ = 0;
+    exception_cnt_ = 0;
+  }
+  OB_INLINE double decode(const int64_t v) const
+  {
+    return static_cast<double>(v) * EXP10_ARR[factor_] * FRAC10_ARR[exponent_];
+  }
+  OB_INLINE int64_t get_exceptions_size() const
+  {
+    return exception_cnt_ * (sizeof(uint32_t) + sizeof(uint64_t));
+  }
+
+  uint8_t version_;
+  uint8_t attrs_;
+  uint8_t exponent_;
+  uint8_t factor_;
+  uint32_t exception_cnt_;
+
+  TO_STRING_KV(K_(version), K_(attrs), K_(exponent), K_(factor), K_(exception_cnt));
+
+} __attribute__((packed));
+
+// Strings are compressed by a per micro block symbol table (FSST), each code in the compressed
+// bytes is a symbol of 1~8 bytes except ESCAPE_CODE, which is followed by a literal byte.
+// Column meta layout: fsst meta + symbol length(uint8_t) * symbol_cnt_ + symbol(8 bytes) * symbol_cnt_
+// + null bitmap(optional) + compressed data, the end offset of each row in compressed data is
+// stored in the integer stream.
+struct ObFsstEncodingMeta final
+{
+  static constexpr uint8_t OB_FSST_ENCODING_META_V1 = 0;
+  static const int64_t MAX_SYMBOL_LENGTH = 8;
+  static const int64_t MAX_SYMBOL_COUNT = 255;
+  static const uint8_t ESCAPE_CODE = 255;
+
+  ObFsstEncodingMeta()
+    : version_(OB_FSST_ENCODING_META_V1), attrs_(0), symbol_cnt_(0), reserved_(0),
+      max_string_len_(0), compressed_data_len_(0) {}
+  void reuse()
+  {
+    version_ = OB_FSST_ENCODING_META_V1;
+    attrs_ = 0;
+    symbol_cnt_ = 0;
+    reserved_ = 0;
+    max_string_len_ = 0;
+    compressed_data_len_ = 0;
+  }
+  OB_INLINE int64_t get_symbol_table_size() const
+  {
+    return symbol_cnt_ * (sizeof(uint8_t) + MAX_SYMBOL_LENGTH);
+  }
+
+  uint8_t version_;
+  uint8_t attrs_;
+  uint8_t symbol_cnt_;
+  uint8_t reserved_;
+  uint32_t max_string_len_;
+  uint32_t compressed_data_len_;
+
+  TO_STRING_KV(K_(version), K_(attrs), K_(symbol_cnt), K_(max_string_len), K_(compressed_data_len));
+
+} __attribute__((packed));
+
 
 struct ObColumnEncodingIdentifier
 {
@@ -391,6 +479,39 @@ struct ObIntegerColumnDecoderCtx : public ObBaseColumnDecoderCtx
   INHERIT_TO_STRING_KV("ObBaseColumnDecoderCtx", ObBaseColumnDecoderCtx, KP_(data), K_(datum_len), KPC_(ctx));
 };
 
+struct ObFloatColumnDecoderCtx : public ObIntegerColumnDecoderCtx
+{
+  ObFloatColumnDecoderCtx()
+    : ObIntegerColumnDecoderCtx(), float_meta_(nullptr),
+      exception_row_ids_(nullptr), exception_values_(nullptr), is_double_(false) {}
+
+  const ObFloatEncodingMeta *float_meta_;
+  // exception arrays are in column meta and may be unaligned
+  const char *exception_row_ids_;
+  const char *exception_values_;
+  bool is_double_;
+
+  INHERIT_TO_STRING_KV("ObIntegerColumnDecoderCtx", ObIntegerColumnDecoderCtx,
+      KPC_(float_meta), KP_(exception_row_ids), KP_(exception_values), K_(is_double));
+};
+
+struct ObFsstColumnDecoderCtx : public ObBaseColumnDecoderCtx
+{
+  ObFsstColumnDecoderCtx()
+    : ObBaseColumnDecoderCtx(), fsst_meta_(nullptr), symbol_lens_(nullptr), symbols_(nullptr),
+      compressed_data_(nullptr), offset_data_(nullptr), offset_ctx_(nullptr) {}
+
+  const ObFsstEncodingMeta *fsst_meta_;
+  const uint8_t *symbol_lens_;
+  const char *symbols_; // MAX_SYMBOL_LENGTH bytes for each symbol, may be unaligned
+  const char *compressed_data_;
+  const char *offset_data_;
+  const ObIntegerStreamDecoderCtx *offset_ctx_;
+
+  INHERIT_TO_STRING_KV("ObBaseColumnDecoderCtx", ObBaseColumnDecoderCtx, KPC_(fsst_meta),
+      KP_(symbol_lens), KP_(symbols), KP_(compressed_data), KP_(offset_data), KPC_(offset_ctx));
+};
+
 struct ObStringColumnDecoderCtx : public ObBaseColumnDecoderCtx
 {
   ObStringColumnDecoderCtx()
@@ -451,12 +572,16 @@ struct ObColumnCSDecoderCtx
     ObIntegerColumnDecoderCtx integer_ctx_;
     ObStringColumnDecoderCtx string_ctx_;
     ObDictColumnDecoderCtx dict_ctx_;
+    ObFloatColumnDecoderCtx float_ctx_;
+    ObFsstColumnDecoderCtx fsst_ctx_;
   };
   void reset() { MEMSET(this, 0, sizeof(ObColumnCSDecoderCtx));}
   OB_INLINE bool is_integer_type() const { return ObCSColumnHeader::INTEGER == type_; }
   OB_INLINE bool is_string_type() const { return ObCSColumnHeader::STRING == type_; }
   OB_INLINE bool is_int_dict_type() const { return ObCSColumnHeader::INT_DICT == type_; }
   OB_INLINE bool is_string_dict_type() const { return ObCSColumnHeader::STR_DICT == type_; }
+  OB_INLINE bool is_float_type() const { return ObCSColumnHeader::FLOAT == type_; }
+  OB_INLINE bool is_fsst_type() const { return ObCSColumnHeader::FSST == type_; }
 
   ObBaseColumnDecoderCtx& get_base_ctx()
   {
@@ -467,6 +592,10 @@ struct ObColumnCSDecoderCtx
       base_ctx = &string_ctx_;
     } else if (is_int_dict_type() || is_string_dict_type()) {
       base_ctx = &dict_ctx_;
+    } else if (is_float_type()) {
+      base_ctx = &float_ctx_;
+    } else if (is_fsst_type()) {
+      base_ctx = &fsst_ctx_;
     }
     return *base_ctx;
   }
@@ -23,6 +23,8 @@ int64_t size_array [] = {                    \
   sizeof(ObString##Item),                    \
   sizeof(ObIntDict##Item),                   \
   sizeof(ObStrDict##Item),                   \
+  sizeof(ObFloat##Item),                     \
+  sizeof(ObFsst##Item),                      \
 }                                            \
 
 CS_DEF_SIZE_ARRAY(ColumnEncoder, cs_encoder_sizes);
@@ -23,10 +23,14 @@
 #include "ob_string_column_encoder.h"
 #include "ob_int_dict_column_encoder.h"
 #include "ob_str_dict_column_encoder.h"
+#include "ob_float_column_encoder.h"
+#include "ob_fsst_column_encoder.h"
 #include "ob_integer_column_decoder.h"
 #include "ob_string_column_decoder.h"
 #include "ob_int_dict_column_decoder.h"
 #include "ob_str_dict_column_decoder.h"
+#include "ob_float_column_decoder.h"
+#include "ob_fsst_column_decoder.h"
 
 namespace oceanbase
 {
@@ -72,6 +76,8 @@ private:
   Pool string_pool_;
   Pool int_dict_pool_;
   Pool str_dict_pool_;
+  Pool float_pool_;
+  Pool fsst_pool_;
   Pool *pools_[ObCSColumnHeader::MAX_TYPE];
   int64_t pool_cnt_;
 };
@@ -268,6 +268,33 @@ int ObCSMicroBlockTransformer::build_original_transform_desc_(
         stream_row_cnt_arr_[stream_idx] = header_->row_count_;
         pre_streams_len = stream_offsets_arr_[stream_idx] - first_stream_begin_offset;
 
+      } else if (ObCSColumnHeader::Type::FLOAT == column_header.type_) {
+        stream_idx = stream_idx + 1;
+        original_desc_.column_first_stream_idx_arr_[i] = stream_idx;
+        original_desc_.column_meta_pos_arr_[i].offset_ = column_meta_begin_offset_ + pre_streams_len;
+        // float encoding has no null bitmap, column meta is float meta + exceptions
+        const ObFloatEncodingMeta *float_meta = reinterpret_cast<const ObFloatEncodingMeta *>(
+          payload_buf_ + original_desc_.column_meta_pos_arr_[i].offset_);
+        original_desc_.column_meta_pos_arr_[i].len_ =
+          sizeof(ObFloatEncodingMeta) + float_meta->get_exceptions_size();
+        original_desc_.set_is_integer_stream(stream_idx);
+        stream_row_cnt_arr_[stream_idx] = header_->row_count_;
+        pre_streams_len = stream_offsets_arr_[stream_idx] - first_stream_begin_offset;
+
+      } else if (ObCSColumnHeader::Type::FSST == column_header.type_) {
+        stream_idx = stream_idx + 1;
+        original_desc_.column_first_stream_idx_arr_[i] = stream_idx;
+        original_desc_.column_meta_pos_arr_[i].offset_ = column_meta_begin_offset_ + pre_streams_len;
+        // column meta is fsst meta + symbol table + null bitmap + compressed data
+        const ObFsstEncodingMeta *fsst_meta = reinterpret_cast<const ObFsstEncodingMeta *>(
+          payload_buf_ + original_desc_.column_meta_pos_arr_[i].offset_);
+        original_desc_.column_meta_pos_arr_[i].len_ = sizeof(ObFsstEncodingMeta)
+          + fsst_meta->get_symbol_table_size() + fsst_meta->compressed_data_len_
+          + (column_header.has_null_bitmap() ? ObCSEncodingUtil::get_bitmap_byte_size(header_->row_count_) : 0);
+        original_desc_.set_is_integer_stream(stream_idx);
+        stream_row_cnt_arr_[stream_idx] = header_->row_count_;
+        pre_streams_len = stream_offsets_arr_[stream_idx] - first_stream_begin_offset;
+
       } else if (ObCSColumnHeader::Type::STRING == column_header.type_) {
         stream_idx = stream_idx + 1;
         original_desc_.column_first_stream_idx_arr_[i] = stream_idx;
@@ -1180,6 +1207,24 @@ int ObCSMicroBlockTransformHelper::build_column_decoder_ctx(
         }
         break;
       }
+      case ObCSColumnHeader::Type::FLOAT : {
+        if (OB_FAIL(build_float_column_decoder_ctx_(obj_meta, col_first_stream_idx,
+            col_end_stream_idx, col_idx, decoder_ctx.float_ctx_))) {
+          LOG_WARN("fail to build_float_decoder_ctx", K(ret), K(col_first_stream_idx),
+              K(col_end_stream_idx), K(col_idx),
+              "transform_desc", ObMicroBlockTransformDescPrinter(col_cnt, stream_cnt, transform_desc_));
+        }
+        break;
+      }
+      case ObCSColumnHeader::Type::FSST : {
+        if (OB_FAIL(build_fsst_column_decoder_ctx_(obj_meta, col_first_stream_idx,
+            col_end_stream_idx, col_idx, decoder_ctx.fsst_ctx_))) {
+          LOG_WARN("fail to build_fsst_decoder_ctx", K(ret), K(col_first_stream_idx),
+              K(col_end_stream_idx), K(col_idx),
+              "transform_desc", ObMicroBlockTransformDescPrinter(col_cnt, stream_cnt, transform_desc_));
+        }
+        break;
+      }
       case ObCSColumnHeader::Type::STRING : {
         if (OB_FAIL(build_string_column_decoder_ctx_(obj_meta, col_first_stream_idx,
             col_end_stream_idx, col_idx, decoder_ctx.string_ctx_))) {
@@ -1282,6 +1327,70 @@ int ObCSMicroBlockTransformHelper::build_integer_column_decoder_ctx_(
   return ret;
 }
 
+int ObCSMicroBlockTransformHelper::build_float_column_decoder_ctx_(
+                                  const ObObjMeta &obj_meta,
+                                  const int32_t col_first_stream_idx,
+                                  const int32_t col_end_stream_idx,
+                                  const int32_t col_idx,
+                                  ObFloatColumnDecoderCtx &ctx)
+{
+  int ret = OB_SUCCESS;
+  if (OB_FAIL(build_integer_column_decoder_ctx_(obj_meta, col_first_stream_idx,
+      col_end_stream_idx, col_idx, ctx))) {
+    LOG_WARN("fail to build_integer_column_decoder_ctx", K(ret), K(col_first_stream_idx), K(col_idx));
+  } else {
+    const char *column_meta = get_column_meta(col_idx);
+    ctx.float_meta_ = reinterpret_cast<const ObFloatEncodingMeta *>(column_meta);
+    ctx.exception_row_ids_ = column_meta + sizeof(ObFloatEncodingMeta);
+    ctx.exception_values_ = ctx.exception_row_ids_ + sizeof(uint32_t) * ctx.float_meta_->exception_cnt_;
+    ctx.is_double_ = ObDoubleTC == ob_obj_type_class(ctx.col_header_->get_store_obj_type());
+    LOG_TRACE("build_float_column_decoder_ctx", K(col_first_stream_idx), K(col_end_stream_idx), K(col_idx), K(ctx));
+  }
+  return ret;
+}
+
+int ObCSMicroBlockTransformHelper::build_fsst_column_decoder_ctx_(
+                                  const ObObjMeta &obj_meta,
+                                  const int32_t col_first_stream_idx,
+                                  const int32_t col_end_stream_idx,
+                                  const int32_t col_idx,
+                                  ObFsstColumnDecoderCtx &ctx)
+{
+  int ret = OB_SUCCESS;
+  const char *buf = nullptr;
+  const char *ctx_buf = nullptr;
+  const ObCSColumnHeader &col_header = col_headers_[col_idx];
+  if (OB_UNLIKELY(col_end_stream_idx - col_first_stream_idx != 1)) {
+    ret = OB_INNER_STAT_ERROR;
+    LOG_WARN("fsst must has one stream", K(ret), K(col_first_stream_idx), K(col_end_stream_idx));
+  } else {
+    GET_STREAM_BUF(col_first_stream_idx);
+    if (OB_SUCC(ret)) {
+      const char *column_meta = get_column_meta(col_idx);
+      ctx.fsst_meta_ = reinterpret_cast<const ObFsstEncodingMeta *>(column_meta);
+      ctx.symbol_lens_ = reinterpret_cast<const uint8_t *>(column_meta + sizeof(ObFsstEncodingMeta));
+      ctx.symbols_ = column_meta + sizeof(ObFsstEncodingMeta) + sizeof(uint8_t) * ctx.fsst_meta_->symbol_cnt_;
+      ctx.compressed_data_ = column_meta + sizeof(ObFsstEncodingMeta) + ctx.fsst_meta_->get_symbol_table_size();
+      if (col_header.has_null_bitmap()) {
+        ctx.null_flag_ = ObBaseColumnDecoderCtx::HAS_NULL_BITMAP;
+        ctx.null_bitmap_ = ctx.compressed_data_;
+        ctx.compressed_data_ += ObCSEncodingUtil::get_bitmap_byte_size(header_->row_count_);
+      } else {
+        ctx.null_flag_ = ObBaseColumnDecoderCtx::HAS_NO_NULL;
+      }
+      ctx.offset_ctx_ = reinterpret_cast<const ObIntegerStreamDecoderCtx *>(
+        ctx_buf + transform_desc_.column_first_stream_decoding_ctx_offset_arr_[col_idx]);
+      ctx.offset_data_ = buf + transform_desc_.stream_data_pos_arr_[col_first_stream_idx].offset_;
+      ctx.obj_meta_ = obj_meta;
+      ctx.micro_block_header_ = get_micro_block_header();
+      ctx.col_header_  = &col_header;
+      ctx.allocator_ = allocator_;
+      LOG_TRACE("build_fsst_column_decoder_ctx", K(col_first_stream_idx), K(col_end_stream_idx), K(col_idx), K(ctx));
+    }
+  }
+  return ret;
+}
+
 int ObCSMicroBlockTransformHelper::build_string_column_decoder_ctx_(
                                     const ObObjMeta &obj_meta,
                                     const int32_t col_first_stream_idx,
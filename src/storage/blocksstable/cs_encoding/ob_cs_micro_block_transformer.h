@@ -240,6 +240,16 @@ private:
                                         const int32_t col_end_stream_idx,
                                         const int32_t col_idx,
                                         ObIntegerColumnDecoderCtx &ctx);
+  int build_float_column_decoder_ctx_(const ObObjMeta &obj_meta,
+                                      const int32_t col_first_stream_idx,
+                                      const int32_t col_end_stream_idx,
+                                      const int32_t col_idx,
+                                      ObFloatColumnDecoderCtx &ctx);
+  int build_fsst_column_decoder_ctx_(const ObObjMeta &obj_meta,
+                                     const int32_t col_first_stream_idx,
+                                     const int32_t col_end_stream_idx,
+                                     const int32_t col_idx,
+                                     ObFsstColumnDecoderCtx &ctx);
   int build_string_column_decoder_ctx_(const ObObjMeta &obj_meta,
                                        const int32_t col_first_stream_idx,
                                        const int32_t col_end_stream_idx,
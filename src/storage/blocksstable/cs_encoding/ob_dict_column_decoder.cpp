@@ -1079,9 +1079,16 @@ int ObDictColumnDecoder::in_operator(
     const sql::ObWhiteFilterOperatorType op_type = filter.get_op_type();
     sql::ObBitVector *ref_bitset = nullptr;
     int64_t matched_ref_cnt = 0;
+    int64_t min_matched_ref = -1;
+    int64_t max_matched_ref = -1;
     BUILD_REF_BITSET(ctx, (dict_val_cnt + 1), ref_bitset);
 
     if (OB_FAIL(ret)) {
+    } else if (can_binary_search_in_params(ctx, dict_val_cnt, filter)) {
+      if (OB_FAIL(sorted_dict_val_in_op(ctx, dict_val_cnt, filter, ref_bitset,
+          matched_ref_cnt, min_matched_ref, max_matched_ref))) {
+        LOG_WARN("fail to exe sorted_dict_val_in_op", KR(ret), K(dict_val_cnt));
+      }
     } else if (ctx.col_header_->is_integer_dict()) {
       const ObIntegerStreamMeta &stream_meta = ctx.int_ctx_->meta_;
       const uint64_t dict_val_base = stream_meta.is_use_base() * stream_meta.base_value();
@@ -1111,7 +1118,15 @@ int ObDictColumnDecoder::in_operator(
 
     if (OB_SUCC(ret) && (matched_ref_cnt > 0)) {
       const uint32_t ref_width_size = ctx.ref_ctx_->meta_.get_uint_width_size();
-      if (OB_FAIL(set_bitmap_with_bitset(ref_width_size, ctx.ref_data_, ref_bitset,
+      if (min_matched_ref >= 0 && max_matched_ref - min_matched_ref + 1 == matched_ref_cnt) {
+        // matched refs are continuous in sorted dict, compare refs with the range instead of probing bitset
+        int64_t refs_val[2] = {min_matched_ref, max_matched_ref + 1};
+        if (OB_FAIL(ObCSFilterFunctionFactory::instance().dict_ref_sort_bt_tranverse(ctx.ref_data_, dict_val_cnt,
+            refs_val, pd_filter_info.start_, pd_filter_info.count_, parent, ref_width_size, result_bitmap))) {
+          LOG_WARN("fail to exe dict_ref_sort_bt_tranverse", KR(ret), K(ref_width_size), K(min_matched_ref),
+              K(max_matched_ref), K(pd_filter_info));
+        }
+      } else if (OB_FAIL(set_bitmap_with_bitset(ref_width_size, ctx.ref_data_, ref_bitset,
           pd_filter_info.start_, pd_filter_info.count_, false/*has_null*/, 0, parent, result_bitmap))) {
         LOG_WARN("fail to set result bitmap", KR(ret), K(ref_width_size), K(pd_filter_info));
       }
@@ -1120,6 +1135,80 @@ int ObDictColumnDecoder::in_operator(
   return ret;
 }
 
+bool ObDictColumnDecoder::can_binary_search_in_params(
+    const ObDictColumnDecoderCtx &ctx,
+    const uint64_t dict_val_cnt,
+    const sql::ObWhiteFilterExecutor &filter)
+{
+  // binary search costs about log2(dict_val_cnt) comparisons for each param
+  const int64_t datums_cnt = filter.get_datums().count();
+  const int64_t search_cost = datums_cnt * (64 - __builtin_clzll(dict_val_cnt));
+  const sql::ObExpr *expr = filter.get_filter_node().expr_;
+  bool can_search = ctx.dict_meta_->is_sorted() && search_cost < static_cast<int64_t>(dict_val_cnt)
+      && nullptr != filter.cmp_func_ && nullptr != expr && !ctx.obj_meta_.is_decimal_int();
+  // cmp_func_ is built for one param type, so all params must have the same type and collation
+  // as the column to keep the order of dict
+  for (int64_t i = 0; can_search && i < expr->arg_cnt_; ++i) {
+    const sql::ObExpr *arg = expr->args_[i];
+    if (OB_ISNULL(arg)) {
+      can_search = false;
+    } else if (T_REF_COLUMN == arg->type_) {
+    } else if (arg->obj_meta_.get_type() != ctx.obj_meta_.get_type()
+        || arg->obj_meta_.get_collation_type() != ctx.obj_meta_.get_collation_type()) {
+      can_search = false;
+    }
+  }
+  return can_search;
+}
+
+int ObDictColumnDecoder::sorted_dict_val_in_op(
+    const ObDictColumnDecoderCtx &ctx,
+    const uint64_t dict_val_cnt,
+    const sql::ObWhiteFilterExecutor &filter,
+    sql::ObBitVector *ref_bitset,
+    int64_t &matched_ref_cnt,
+    int64_t &min_matched_ref,
+    int64_t &max_matched_ref)
+{
+  int ret = OB_SUCCESS;
+  ObCmpFunc cmp_func;
+  cmp_func.cmp_func_ = filter.cmp_func_;
+  ObDictValueIterator begin_it = ObDictValueIterator(&ctx, 0);
+  ObDictValueIterator end_it = ObDictValueIterator(&ctx, dict_val_cnt);
+  const common::ObIArray<common::ObDatum> &filter_datums = filter.get_datums();
+  for (int64_t i = 0; OB_SUCC(ret) && i < filter_datums.count(); ++i) {
+    const ObDatum &filter_datum = filter_datums.at(i);
+    if (filter_datum.is_null()) {
+      // null param matches nothing
+    } else {
+      ObDictValueIterator tranverse_it = std::lower_bound(begin_it, end_it, filter_datum,
+          [&cmp_func, &ret](const ObDatum &datum, const ObDatum &filter_datum) -> bool {
+            int cmp_ret = 0;
+            if (OB_FAIL(ret)) {
+            } else if (OB_FAIL(cmp_func.cmp_func_(datum, filter_datum, cmp_ret))) {
+              LOG_WARN("failed to compare datums", K(ret), K(datum), K(filter_datum));
+            }
+            return cmp_ret < 0;});
+      int64_t dict_ref = tranverse_it - begin_it;
+      // more than one dict value may be equal to the param with case insensitive collation
+      for (; OB_SUCC(ret) && tranverse_it != end_it; ++tranverse_it, ++dict_ref) {
+        int cmp_ret = 0;
+        if (OB_FAIL(cmp_func.cmp_func_(*tranverse_it, filter_datum, cmp_ret))) {
+          LOG_WARN("failed to compare datums", K(ret), K(*tranverse_it), K(filter_datum));
+        } else if (0 != cmp_ret) {
+          break;
+        } else if (!ref_bitset->exist(dict_ref)) {
+          ref_bitset->set(dict_ref);
+          ++matched_ref_cnt;
+          min_matched_ref = (min_matched_ref < 0 || dict_ref < min_matched_ref) ? dict_ref : min_matched_ref;
+          max_matched_ref = dict_ref > max_matched_ref ? dict_ref : max_matched_ref;
+        }
+      }
+    }
+  }
+  return ret;
+}
+
 void ObDictColumnDecoder::integer_dict_val_in_op(
     const ObDictColumnDecoderCtx &ctx,
     const sql::ObWhiteFilterExecutor &filter,
@@ -193,6 +193,20 @@ protected:
     sql::ObBitVector *ref_bitset,
     int64_t &matched_ref_cnt);
 
+  static bool can_binary_search_in_params(
+    const ObDictColumnDecoderCtx &ctx,
+    const uint64_t dict_val_cnt,
+    const sql::ObWhiteFilterExecutor &filter);
+
+  static int sorted_dict_val_in_op(
+    const ObDictColumnDecoderCtx &ctx,
+    const uint64_t dict_val_cnt,
+    const sql::ObWhiteFilterExecutor &filter,
+    sql::ObBitVector *ref_bitset,
+    int64_t &matched_ref_cnt,
+    int64_t &min_matched_ref,
+    int64_t &max_matched_ref);
+
   static int bt_operator(
     const ObDictColumnDecoderCtx &ctx,
     const sql::ObPushdownFilterExecutor *parent,
@@ -0,0 +1,728 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+#define USING_LOG_PREFIX STORAGE
+
+#include "ob_float_column_decoder.h"
+#include "ob_cs_decoding_util.h"
+#include "storage/blocksstable/encoding/ob_encoding_query_util.h"
+#include "storage/blocksstable/encoding/ob_raw_decoder.h"
+#include "src/share/vector/ob_continuous_vector.h"
+#include "src/share/vector/ob_fixed_length_vector.h"
+
+namespace oceanbase
+{
+namespace blocksstable
+{
+using namespace oceanbase::common;
+using namespace oceanbase::share;
+
+// the encoded integers are in [-2^51, 2^51), search in a wider range
+static const int64_t ALP_SEARCH_LOWER = -(1LL << 52);
+static const int64_t ALP_SEARCH_UPPER = (1LL << 52);
+
+template <typename ValueType>
+OB_INLINE static ValueType alp_decode(const ObFloatEncodingMeta &meta, const int64_t v)
+{
+  return static_cast<ValueType>(meta.decode(v));
+}
+
+template <typename ValueType>
+OB_INLINE static ValueType raw_bits_to_value(const uint64_t raw)
+{
+  ValueType value;
+  MEMCPY(&value, &raw, sizeof(ValueType));
+  return value;
+}
+
+// exception row ids are ascending
+OB_INLINE static bool find_exception(
+    const ObFloatColumnDecoderCtx &ctx, const int64_t row_id, uint64_t &raw)
+{
+  bool found = false;
+  int64_t left = 0;
+  int64_t right = ctx.float_meta_->exception_cnt_;
+  uint32_t cur_row_id = 0;
+  while (left < right) {
+    const int64_t mid = left + (right - left) / 2;
+    MEMCPY(&cur_row_id, ctx.exception_row_ids_ + mid * sizeof(uint32_t), sizeof(uint32_t));
+    if (cur_row_id < row_id) {
+      left = mid + 1;
+    } else {
+      right = mid;
+    }
+  }
+  if (left < ctx.float_meta_->exception_cnt_) {
+    MEMCPY(&cur_row_id, ctx.exception_row_ids_ + left * sizeof(uint32_t), sizeof(uint32_t));
+    if (cur_row_id == row_id) {
+      MEMCPY(&raw, ctx.exception_values_ + left * sizeof(uint64_t), sizeof(uint64_t));
+      found = true;
+    }
+  }
+  return found;
+}
+
+// min n that decode(n) >= x (or decode(n) > x if is_upper), return ALP_SEARCH_UPPER if not exist
+template <typename ValueType>
+static int64_t alp_lower_bound(const ObFloatEncodingMeta &meta, const ValueType x, const bool is_upper)
+{
+  int64_t left = ALP_SEARCH_LOWER;
+  int64_t right = ALP_SEARCH_UPPER;
+  while (left < right) {
+    const int64_t mid = left + (right - left) / 2;
+    const ValueType v = alp_decode<ValueType>(meta, mid);
+    if (is_upper ? v > x : v >= x) {
+      right = mid;
+    } else {
+      left = mid + 1;
+    }
+  }
+  return left;
+}
+
+struct ObFloatDatumWriter
+{
+  explicit ObFloatDatumWriter(ObDatum *datums) : datums_(datums) {}
+  OB_INLINE void set_null(const int64_t idx) { datums_[idx].set_null(); }
+  template <typename ValueType>
+  OB_INLINE void set_value(const int64_t idx, const ValueType value)
+  {
+    *(ValueType*)(datums_[idx].ptr_) = value;
+    datums_[idx].pack_ = sizeof(ValueType);
+  }
+  ObDatum *datums_;
+};
+
+struct ObFloatFixedVecWriter
+{
+  ObFloatFixedVecWriter(ObIVector &vector, const int64_t vec_offset)
+    : vector_(static_cast<ObFixedLengthBase &>(vector)), vec_offset_(vec_offset) {}
+  OB_INLINE void set_null(const int64_t idx) { vector_.set_null(vec_offset_ + idx); }
+  template <typename ValueType>
+  OB_INLINE void set_value(const int64_t idx, const ValueType value)
+  {
+    reinterpret_cast<ValueType *>(vector_.get_data())[vec_offset_ + idx] = value;
+  }
+  ObFixedLengthBase &vector_;
+  const int64_t vec_offset_;
+};
+
+// rows must be written in order
+struct ObFloatContinuousVecWriter
+{
+  ObFloatContinuousVecWriter(ObIVector &vector, const int64_t vec_offset)
+    : vector_(static_cast<ObContinuousFormat &>(vector)), vec_offset_(vec_offset), curr_offset_(0)
+  {
+    if (0 == vec_offset_) {
+      vector_.get_offsets()[0] = 0;
+    } else {
+      curr_offset_ = vector_.get_offsets()[vec_offset_];
+    }
+  }
+  OB_INLINE void set_null(const int64_t idx)
+  {
+    vector_.set_null(vec_offset_ + idx);
+    vector_.get_offsets()[vec_offset_ + idx + 1] = curr_offset_;
+  }
+  template <typename ValueType>
+  OB_INLINE void set_value(const int64_t idx, const ValueType value)
+  {
+    MEMCPY(vector_.get_data() + curr_offset_, &value, sizeof(ValueType));
+    curr_offset_ += sizeof(ValueType);
+    vector_.get_offsets()[vec_offset_ + idx + 1] = curr_offset_;
+  }
+  ObContinuousFormat &vector_;
+  const int64_t vec_offset_;
+  uint32_t curr_offset_;
+};
+
+template <typename StoreIntType, typename ValueType, typename Writer>
+static void decode_float_rows(
+    const ObFloatColumnDecoderCtx &ctx, const int64_t *row_ids, const int64_t row_cap, Writer &writer)
+{
+  const StoreIntType *store_uint_arr = reinterpret_cast<const StoreIntType *>(ctx.data_);
+  const ObIntegerStreamMeta &stream_meta = ctx.ctx_->meta_;
+  const uint64_t base = stream_meta.is_use_base() * stream_meta.base_value_;
+  const bool is_null_replaced = ctx.is_null_replaced();
+  const uint64_t null_replaced_value = ctx.null_replaced_value_;
+  const bool has_exception = ctx.float_meta_->exception_cnt_ > 0;
+  uint64_t raw = 0;
+  for (int64_t i = 0; i < row_cap; ++i) {
+    const int64_t row_id = row_ids[i];
+    const uint64_t value = store_uint_arr[row_id] + base;
+    if (is_null_replaced && value == null_replaced_value) {
+      writer.set_null(i);
+    } else if (has_exception && find_exception(ctx, row_id, raw)) {
+      writer.template set_value<ValueType>(i, raw_bits_to_value<ValueType>(raw));
+    } else {
+      writer.template set_value<ValueType>(i,
+          alp_decode<ValueType>(*ctx.float_meta_, static_cast<int64_t>(value)));
+    }
+  }
+}
+
+template <typename Writer>
+int ObFloatColumnDecoder::dispatch_decode_(const ObFloatColumnDecoderCtx &ctx,
+    const int64_t *row_ids, const int64_t row_cap, Writer &writer)
+{
+  int ret = OB_SUCCESS;
+#define DECODE_FLOAT_ROWS(StoreIntType)                                          \
+  if (ctx.is_double_) {                                                          \
+    decode_float_rows<StoreIntType, double>(ctx, row_ids, row_cap, writer);      \
+  } else {                                                                       \
+    decode_float_rows<StoreIntType, float>(ctx, row_ids, row_cap, writer);       \
+  }
+  switch (ctx.ctx_->meta_.get_width_tag()) {
+    case ObIntegerStream::UintWidth::UW_1_BYTE : {
+      DECODE_FLOAT_ROWS(uint8_t);
+      break;
+    }
+    case ObIntegerStream::UintWidth::UW_2_BYTE : {
+      DECODE_FLOAT_ROWS(uint16_t);
+      break;
+    }
+    case ObIntegerStream::UintWidth::UW_4_BYTE : {
+      DECODE_FLOAT_ROWS(uint32_t);
+      break;
+    }
+    case ObIntegerStream::UintWidth::UW_8_BYTE : {
+      DECODE_FLOAT_ROWS(uint64_t);
+      break;
+    }
+    default : {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("unexpected width", K(ret), K(ctx));
+    }
+  }
+#undef DECODE_FLOAT_ROWS
+  return ret;
+}
+
+int ObFloatColumnDecoder::decode(const ObColumnCSDecoderCtx &ctx,
+                                 const int64_t row_id,
+                                 common::ObDatum &datum) const
+{
+  int ret = OB_SUCCESS;
+  ObFloatDatumWriter writer(&datum);
+  if (OB_FAIL(dispatch_decode_(ctx.float_ctx_, &row_id, 1, writer))) {
+    LOG_WARN("fail to decode", K(ret), K(row_id));
+  }
+  return ret;
+}
+
+int ObFloatColumnDecoder::batch_decode(const ObColumnCSDecoderCtx &ctx,
+    const int64_t *row_ids, const int64_t row_cap, common::ObDatum *datums) const
+{
+  int ret = OB_SUCCESS;
+  ObFloatDatumWriter writer(datums);
+  if (OB_FAIL(dispatch_decode_(ctx.float_ctx_, row_ids, row_cap, writer))) {
+    LOG_WARN("fail to batch decode", K(ret), K(row_cap));
+  }
+  return ret;
+}
+
+int ObFloatColumnDecoder::decode_vector(
+    const ObColumnCSDecoderCtx &ctx, ObVectorDecodeCtx &vector_ctx) const
+{
+  int ret = OB_SUCCESS;
+  const ObFloatColumnDecoderCtx &float_ctx = ctx.float_ctx_;
+  const VectorFormat vec_format = vector_ctx.get_format();
+  ObIVector *vector = vector_ctx.get_vector();
+  if (OB_ISNULL(vector)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("unexpected null vector", K(ret), K(vector_ctx));
+  } else {
+    switch (vec_format) {
+      case VEC_FIXED : {
+        ObFloatFixedVecWriter writer(*vector, vector_ctx.vec_offset_);
+        ret = dispatch_decode_(float_ctx, vector_ctx.row_ids_, vector_ctx.row_cap_, writer);
+        break;
+      }
+      case VEC_CONTINUOUS : {
+        ObFloatContinuousVecWriter writer(*vector, vector_ctx.vec_offset_);
+        ret = dispatch_decode_(float_ctx, vector_ctx.row_ids_, vector_ctx.row_cap_, writer);
+        break;
+      }
+      default : {
+        ret = OB_NOT_SUPPORTED;
+        LOG_WARN("float column not support decoding to this vector format", K(ret), K(vec_format));
+      }
+    }
+    if (OB_FAIL(ret)) {
+      LOG_WARN("fail to decode_vector", K(ret), K(float_ctx), K(vector_ctx));
+    }
+  }
+  return ret;
+}
+
+int ObFloatColumnDecoder::get_null_count(
+    const ObColumnCSDecoderCtx &col_ctx,
+    const int64_t *row_ids,
+    const int64_t row_cap,
+    int64_t &null_count) const
+{
+  int ret = OB_SUCCESS;
+  null_count = 0;
+  const ObFloatColumnDecoderCtx &float_ctx = col_ctx.float_ctx_;
+  const ObIntegerStreamMeta &stream_meta = float_ctx.ctx_->meta_;
+  if (float_ctx.is_null_replaced()) {
+    const uint32_t width_size = stream_meta.get_uint_width_size();
+    const uint64_t base_val = stream_meta.is_use_base() * stream_meta.base_value_;
+    const uint64_t null_val = float_ctx.null_replaced_value_ - base_val;
+    uint64_t cur_val = 0;
+    for (int64_t i = 0; i < row_cap; ++i) {
+      ENCODING_ADAPT_MEMCPY(&cur_val, float_ctx.data_ + row_ids[i] * width_size, width_size);
+      if (cur_val == null_val) {
+        ++null_count;
+      }
+    }
+  }
+  return ret;
+}
+
+int ObFloatColumnDecoder::pushdown_operator(
+    const sql::ObPushdownFilterExecutor *parent,
+    const ObColumnCSDecoderCtx &col_ctx,
+    const sql::ObWhiteFilterExecutor &filter,
+    const sql::PushdownFilterInfo &pd_filter_info,
+    ObBitmap &result_bitmap) const
+{
+  UNUSED(parent);
+  int ret = OB_SUCCESS;
+  const ObFloatColumnDecoderCtx &float_ctx = col_ctx.float_ctx_;
+  const int64_t row_cnt = pd_filter_info.count_;
+  if (OB_UNLIKELY(row_cnt < 1 || row_cnt != result_bitmap.size())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", KR(ret), K(row_cnt), K(result_bitmap.size()));
+  } else {
+    const sql::ObWhiteFilterOperatorType op_type = filter.get_op_type();
+    switch (op_type) {
+      case sql::WHITE_OP_NU:
+      case sql::WHITE_OP_NN: {
+        if (OB_FAIL(nu_nn_operator(float_ctx, filter, pd_filter_info, result_bitmap))) {
+          LOG_WARN("fail to handle nu_nn operator", KR(ret), K(pd_filter_info));
+        }
+        break;
+      }
+      case sql::WHITE_OP_EQ:
+      case sql::WHITE_OP_NE:
+      case sql::WHITE_OP_GT:
+      case sql::WHITE_OP_GE:
+      case sql::WHITE_OP_LT:
+      case sql::WHITE_OP_LE: {
+        if (OB_FAIL(comparison_operator(float_ctx, filter, pd_filter_info, result_bitmap))) {
+          LOG_WARN("fail to handle comparison operator", KR(ret), K(pd_filter_info));
+        }
+        break;
+      }
+      case sql::WHITE_OP_BT: {
+        if (OB_FAIL(between_operator(float_ctx, filter, pd_filter_info, result_bitmap))) {
+          LOG_WARN("fail to handle between operator", KR(ret), K(pd_filter_info));
+        }
+        break;
+      }
+      case sql::WHITE_OP_IN: {
+        if (OB_FAIL(in_operator(float_ctx, filter, pd_filter_info, result_bitmap))) {
+          LOG_WARN("fail to handle in operator", KR(ret), K(pd_filter_info));
+        }
+        break;
+      }
+      default: {
+        ret = OB_NOT_SUPPORTED;
+        LOG_WARN("unexpected operation type", KR(ret), K(op_type));
+      }
+    }
+    LOG_TRACE("float white filter pushdown", K(ret), K(float_ctx),
+        K(filter.get_op_type()), K(pd_filter_info), K(result_bitmap.popcnt()));
+  }
+  return ret;
+}
+
+int ObFloatColumnDecoder::nu_nn_operator(
+    const ObFloatColumnDecoderCtx &ctx,
+    const sql::ObWhiteFilterExecutor &filter,
+    const sql::PushdownFilterInfo &pd_filter_info,
+    ObBitmap &result_bitmap)
+{
+  int ret = OB_SUCCESS;
+  const int64_t row_start = pd_filter_info.start_;
+  const int64_t row_count = pd_filter_info.count_;
+  const ObIntegerStreamMeta &stream_meta = ctx.ctx_->meta_;
+  if (ctx.is_null_replaced()) {
+    // transform 'x is null' to 'x == null_replaced_value'
+    const uint64_t base_value = stream_meta.is_use_base() * stream_meta.base_value_;
+    const uint64_t filter_val = ctx.null_replaced_value_ - base_value;
+    const uint8_t store_width_tag = stream_meta.get_width_tag();
+    raw_compare_function cmp_func = RawCompareFunctionFactory::instance().get_cmp_function(
+                                    false/*is_signed_data*/, store_width_tag, sql::WHITE_OP_EQ);
+    if (OB_ISNULL(cmp_func)) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("unexpected nullptr compare function", KR(ret), K(store_width_tag));
+    } else {
+      cmp_func(reinterpret_cast<const unsigned char *>(ctx.data_), filter_val, result_bitmap.get_data(),
+               row_start, row_start + row_count);
+    }
+  }
+
+  if (OB_SUCC(ret) && (sql::WHITE_OP_NN == filter.get_op_type())) {
+    if (OB_FAIL(result_bitmap.bit_not())) {
+      LOG_WARN("fail to execute bit_not", KR(ret));
+    }
+  }
+  return ret;
+}
+
+// NaN is bigger than any number, and can only be handled by datum comparison
+OB_INLINE static bool can_compare_on_integer(
+    const ObFloatColumnDecoderCtx &ctx, const ObObjMeta &filter_val_meta, const ObDatum &filter_datum)
+{
+  bool can_compare = false;
+  if (filter_datum.is_null()) {
+  } else if (ctx.is_double_) {
+    can_compare = ObDoubleTC == filter_val_meta.get_type_class() && !isnan(filter_datum.get_double());
+  } else {
+    can_compare = ObFloatTC == filter_val_meta.get_type_class() && !isnan(filter_datum.get_float());
+  }
+  return can_compare;
+}
+
+OB_INLINE static int64_t get_integer_bound(
+    const ObFloatColumnDecoderCtx &ctx, const ObDatum &filter_datum, const bool is_upper)
+{
+  return ctx.is_double_ ?
+      alp_lower_bound<double>(*ctx.float_meta_, filter_datum.get_double(), is_upper) :
+      alp_lower_bound<float>(*ctx.float_meta_, filter_datum.get_float(), is_upper);
+}
+
+int ObFloatColumnDecoder::comparison_operator(
+    const ObFloatColumnDecoderCtx &ctx,
+    const sql::ObWhiteFilterExecutor &filter,
+    const sql::PushdownFilterInfo &pd_filter_info,
+    ObBitmap &result_bitmap)
+{
+  int ret = OB_SUCCESS;
+  int64_t datums_cnt = 0;
+  common::ObObjMeta filter_val_meta;
+  if (OB_UNLIKELY((datums_cnt = filter.get_datums().count()) != 1)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", KR(ret), K(datums_cnt));
+  } else if (OB_FAIL(filter.get_filter_node().get_filter_val_meta(filter_val_meta))) {
+    LOG_WARN("Fail to find datum meta", K(ret), K(filter));
+  } else {
+    const sql::ObWhiteFilterOperatorType op_type = filter.get_op_type();
+    const ObDatum &filter_datum = filter.get_datums().at(0);
+    if (can_compare_on_integer(ctx, filter_val_meta, filter_datum)) {
+      // decode is monotonic, so the comparison can be transformed to an integer range
+      int64_t lower = ALP_SEARCH_LOWER;
+      int64_t upper = ALP_SEARCH_UPPER;
+      bool is_reverse = false;
+      switch (op_type) {
+        case sql::WHITE_OP_LT: {
+          upper = get_integer_bound(ctx, filter_datum, false/*is_upper*/);
+          break;
+        }
+        case sql::WHITE_OP_LE: {
+          upper = get_integer_bound(ctx, filter_datum, true/*is_upper*/);
+          break;
+        }
+        case sql::WHITE_OP_GT: {
+          lower = get_integer_bound(ctx, filter_datum, true/*is_upper*/);
+          break;
+        }
+        case sql::WHITE_OP_GE: {
+          lower = get_integer_bound(ctx, filter_datum, false/*is_upper*/);
+          break;
+        }
+        case sql::WHITE_OP_NE:
+          is_reverse = true;
+          // fall through
+        case sql::WHITE_OP_EQ: {
+          lower = get_integer_bound(ctx, filter_datum, false/*is_upper*/);
+          upper = get_integer_bound(ctx, filter_datum, true/*is_upper*/);
+          break;
+        }
+        default: {
+          ret = OB_ERR_UNEXPECTED;
+          LOG_WARN("unexpected operator type", KR(ret), K(op_type));
+        }
+      }
+      if (OB_SUCC(ret) && OB_FAIL(tranverse_integer_range_op(ctx, lower, upper, is_reverse,
+          filter, pd_filter_info, result_bitmap))) {
+        LOG_WARN("fail to tranverse integer range op", KR(ret), K(lower), K(upper), K(op_type));
+      }
+    } else {
+      ObDatumCmpFuncType type_cmp_func = filter.cmp_func_;
+      ObGetFilterCmpRetFunc get_cmp_ret = get_filter_cmp_ret_func(op_type);
+      auto eval = [&] (const ObObjMeta &obj_meta, const ObDatum &cur_datum, const int64_t idx)
+      {
+        int tmp_ret = OB_SUCCESS;
+        int cmp_ret = 0;
+        if (OB_TMP_FAIL(type_cmp_func(cur_datum, filter_datum, cmp_ret))) {
+          LOG_WARN("fail to compare datums", K(tmp_ret), K(cur_datum), K(filter_datum));
+        } else if (get_cmp_ret(cmp_ret)) {
+          if (OB_TMP_FAIL(result_bitmap.set(idx))) {
+            LOG_WARN("fail to set result bitmap", KR(tmp_ret), K(idx));
+          }
+        }
+        return tmp_ret;
+      };
+      if (OB_FAIL(tranverse_datum_all_op(ctx, pd_filter_info, result_bitmap, eval))) {
+        LOG_WARN("fail to traverse_datum in cmp_op", KR(ret), K(ctx));
+      }
+    }
+  }
+  return ret;
+}
+
+int ObFloatColumnDecoder::between_operator(
+    const ObFloatColumnDecoderCtx &ctx,
+    const sql::ObWhiteFilterExecutor &filter,
+    const sql::PushdownFilterInfo &pd_filter_info,
+    ObBitmap &result_bitmap)
+{
+  int ret = OB_SUCCESS;
+  int64_t datums_cnt = 0;
+  common::ObObjMeta filter_val_meta;
+  if (OB_UNLIKELY((datums_cnt = filter.get_datums().count()) != 2)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", KR(ret), K(datums_cnt));
+  } else if (OB_FAIL(filter.get_filter_node().get_filter_val_meta(filter_val_meta))) {
+    LOG_WARN("Fail to find datum meta", K(ret), K(filter));
+  } else {
+    const ObDatum &left_datum = filter.get_datums().at(0);
+    const ObDatum &right_datum = filter.get_datums().at(1);
+    if (can_compare_on_integer(ctx, filter_val_meta, left_datum)
+        && can_compare_on_integer(ctx, filter_val_meta, right_datum)) {
+      const int64_t lower = get_integer_bound(ctx, left_datum, false/*is_upper*/);
+      const int64_t upper = get_integer_bound(ctx, right_datum, true/*is_upper*/);
+      if (OB_FAIL(tranverse_integer_range_op(ctx, lower, upper, false/*is_reverse*/,
+          filter, pd_filter_info, result_bitmap))) {
+        LOG_WARN("fail to tranverse integer range op", KR(ret), K(lower), K(upper));
+      }
+    } else {
+      ObDatumCmpFuncType type_cmp_func = filter.cmp_func_;
+      auto eval = [&] (const ObObjMeta &obj_meta, const ObDatum &cur_datum, const int64_t idx)
+      {
+        int tmp_ret = OB_SUCCESS;
+        int left_cmp_ret = 0;
+        int right_cmp_ret = 0;
+        if (OB_TMP_FAIL(type_cmp_func(cur_datum, left_datum, left_cmp_ret))) {
+          LOG_WARN("fail to compare datums", K(tmp_ret), K(cur_datum), K(left_datum));
+        } else if (left_cmp_ret < 0) {
+        } else if (OB_TMP_FAIL(type_cmp_func(cur_datum, right_datum, right_cmp_ret))) {
+          LOG_WARN("fail to compare datums", K(tmp_ret), K(cur_datum), K(right_datum));
+        } else if (right_cmp_ret <= 0) {
+          if (OB_TMP_FAIL(result_bitmap.set(idx))) {
+            LOG_WARN("fail to set result bitmap", KR(tmp_ret), K(idx));
+          }
+        }
+        return tmp_ret;
+      };
+      if (OB_FAIL(tranverse_datum_all_op(ctx, pd_filter_info, result_bitmap, eval))) {
+        LOG_WARN("fail to traverse_datum in bt_op", KR(ret), K(ctx));
+      }
+    }
+  }
+  return ret;
+}
+
+int ObFloatColumnDecoder::in_operator(
+    const ObFloatColumnDecoderCtx &ctx,
+    const sql::ObWhiteFilterExecutor &filter,
+    const sql::PushdownFilterInfo &pd_filter_info,
+    ObBitmap &result_bitmap)
+{
+  int ret = OB_SUCCESS;
+  int64_t datum_cnt = 0;
+  if (OB_UNLIKELY((datum_cnt = (filter.get_datums().count())) < 1)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", KR(ret), K(datum_cnt));
+  } else {
+    auto eval = [&] (const ObObjMeta &obj_meta, const ObDatum &cur_datum, const int64_t idx)
+    {
+      int tmp_ret = OB_SUCCESS;
+      ObObj cur_obj;
+      bool is_exist = false;
+      if (OB_TMP_FAIL(cur_datum.to_obj(cur_obj, obj_meta))) {
+        LOG_WARN("fail to convert datum to obj", KR(tmp_ret), K(cur_datum), K(obj_meta));
+      } else if (OB_TMP_FAIL(filter.exist_in_obj_set(cur_obj, is_exist))) {
+        LOG_WARN("fail to check obj in hashset", KR(tmp_ret), K(cur_obj));
+      } else if (is_exist) {
+        if (OB_TMP_FAIL(result_bitmap.set(idx))) {
+          LOG_WARN("fail to set result bitmap", KR(tmp_ret), K(idx));
+        }
+      }
+      return tmp_ret;
+    };
+    if (OB_FAIL(tranverse_datum_all_op(ctx, pd_filter_info, result_bitmap, eval))) {
+      LOG_WARN("fail to tranverse datum in in_op", KR(ret), K(ctx));
+    }
+  }
+  return ret;
+}
+
+template <typename StoreIntType>
+static void integer_range_tranverse(
+    const ObFloatColumnDecoderCtx &ctx,
+    const int64_t lower,
+    const int64_t upper,
+    const bool is_reverse,
+    const int64_t row_start,
+    const int64_t row_count,
+    uint8_t *bitmap_data)
+{
+  const StoreIntType *store_uint_arr = reinterpret_cast<const StoreIntType *>(ctx.data_) + row_start;
+  const ObIntegerStreamMeta &stream_meta = ctx.ctx_->meta_;
+  const uint64_t base = stream_meta.is_use_base() * stream_meta.base_value_;
+  for (int64_t i = 0; i < row_count; ++i) {
+    const int64_t value = static_cast<int64_t>(store_uint_arr[i] + base);
+    bitmap_data[i] = (lower <= value && value < upper) ^ is_reverse;
+  }
+  if (ctx.is_null_replaced()) {
+    for (int64_t i = 0; i < row_count; ++i) {
+      if (static_cast<uint64_t>(store_uint_arr[i] + base) == static_cast<uint64_t>(ctx.null_replaced_value_)) {
+        bitmap_data[i] = 0;
+      }
+    }
+  }
+}
+
+int ObFloatColumnDecoder::tranverse_integer_range_op(
+    const ObFloatColumnDecoderCtx &ctx,
+    const int64_t lower,
+    const int64_t upper,
+    const bool is_reverse,
+    const sql::ObWhiteFilterExecutor &filter,
+    const sql::PushdownFilterInfo &pd_filter_info,
+    ObBitmap &result_bitmap)
+{
+  int ret = OB_SUCCESS;
+  const int64_t row_start = pd_filter_info.start_;
+  const int64_t row_count = pd_filter_info.count_;
+  uint8_t *bitmap_data = result_bitmap.get_data();
+  switch (ctx.ctx_->meta_.get_width_tag()) {
+    case ObIntegerStream::UintWidth::UW_1_BYTE : {
+      integer_range_tranverse<uint8_t>(ctx, lower, upper, is_reverse, row_start, row_count, bitmap_data);
+      break;
+    }
+    case ObIntegerStream::UintWidth::UW_2_BYTE : {
+      integer_range_tranverse<uint16_t>(ctx, lower, upper, is_reverse, row_start, row_count, bitmap_data);
+      break;
+    }
+    case ObIntegerStream::UintWidth::UW_4_BYTE : {
+      integer_range_tranverse<uint32_t>(ctx, lower, upper, is_reverse, row_start, row_count, bitmap_data);
+      break;
+    }
+    case ObIntegerStream::UintWidth::UW_8_BYTE : {
+      integer_range_tranverse<uint64_t>(ctx, lower, upper, is_reverse, row_start, row_count, bitmap_data);
+      break;
+    }
+    default : {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("unexpected width", K(ret), K(ctx));
+    }
+  }
+
+  // exception rows hold a placeholder integer, compare their real values
+  const int64_t exception_cnt = ctx.float_meta_->exception_cnt_;
+  if (OB_SUCC(ret) && exception_cnt > 0) {
+    const sql::ObWhiteFilterOperatorType op_type = filter.get_op_type();
+    ObDatumCmpFuncType type_cmp_func = filter.cmp_func_;
+    ObGetFilterCmpRetFunc get_cmp_ret = get_filter_cmp_ret_func(op_type);
+    ObDatum cur_datum;
+    uint64_t raw = 0;
+    uint32_t row_id = 0;
+    cur_datum.pack_ = ctx.is_double_ ? sizeof(double) : sizeof(float);
+    cur_datum.ptr_ = reinterpret_cast<const char *>(&raw);
+    for (int64_t i = 0; OB_SUCC(ret) && i < exception_cnt; ++i) {
+      MEMCPY(&row_id, ctx.exception_row_ids_ + i * sizeof(uint32_t), sizeof(uint32_t));
+      if (row_id < row_start) {
+      } else if (row_id >= row_start + row_count) {
+        break;
+      } else {
+        int cmp_ret = 0;
+        bool is_match = false;
+        MEMCPY(&raw, ctx.exception_values_ + i * sizeof(uint64_t), sizeof(uint64_t));
+        if (sql::WHITE_OP_BT == op_type) {
+          if (OB_FAIL(type_cmp_func(cur_datum, filter.get_datums().at(0), cmp_ret))) {
+            LOG_WARN("fail to compare datums", K(ret), K(cur_datum));
+          } else if (cmp_ret >= 0) {
+            if (OB_FAIL(type_cmp_func(cur_datum, filter.get_datums().at(1), cmp_ret))) {
+              LOG_WARN("fail to compare datums", K(ret), K(cur_datum));
+            } else {
+              is_match = cmp_ret <= 0;
+            }
+          }
+        } else if (OB_FAIL(type_cmp_func(cur_datum, filter.get_datums().at(0), cmp_ret))) {
+          LOG_WARN("fail to compare datums", K(ret), K(cur_datum));
+        } else {
+          is_match = get_cmp_ret(cmp_ret);
+        }
+        if (OB_SUCC(ret) && OB_FAIL(result_bitmap.set(row_id - row_start, is_match))) {
+          LOG_WARN("fail to set result bitmap", KR(ret), K(row_id), K(row_start));
+        }
+      }
+    }
+  }
+  return ret;
+}
+
+template<typename Operator>
+int ObFloatColumnDecoder::tranverse_datum_all_op(
+    const ObFloatColumnDecoderCtx &ctx,
+    const sql::PushdownFilterInfo &pd_filter_info,
+    ObBitmap &result_bitmap,
+    Operator const &eval)
+{
+  int ret = OB_SUCCESS;
+  const int64_t row_start = pd_filter_info.start_;
+  const int64_t row_count = pd_filter_info.count_;
+  const ObIntegerStreamMeta &stream_meta = ctx.ctx_->meta_;
+  const uint32_t store_width_size = stream_meta.get_uint_width_size();
+  const bool use_null_replace = ctx.is_null_replaced();
+  const uint64_t base = stream_meta.is_use_base() * stream_meta.base_value_;
+  const uint64_t null_replaced_val = ctx.null_replaced_value_;
+  const bool has_exception = ctx.float_meta_->exception_cnt_ > 0;
+  ObDatum cur_datum;
+  uint64_t cur_datum_val = 0;
+  cur_datum.ptr_ = reinterpret_cast<const char*>(&cur_datum_val);
+  // NU/NN will not reach here.
+  for (int64_t i = 0; (OB_SUCC(ret) && (i < row_count)); ++i) {
+    const int64_t row_id = row_start + i;
+    uint64_t value = 0;
+    ENCODING_ADAPT_MEMCPY(&value, ctx.data_ + row_id * store_width_size, store_width_size);
+    value += base;
+    if (use_null_replace && value == null_replaced_val) {
+      // cur_datum is null, directly set result_bitmap
+      if (OB_FAIL(result_bitmap.set(i, false))) {
+        LOG_WARN("fail to set result bitmap", KR(ret), K(i));
+      }
+    } else {
+      if (has_exception && find_exception(ctx, row_id, cur_datum_val)) {
+      } else if (ctx.is_double_) {
+        const double v = alp_decode<double>(*ctx.float_meta_, static_cast<int64_t>(value));
+        MEMCPY(&cur_datum_val, &v, sizeof(double));
+      } else {
+        const float v = alp_decode<float>(*ctx.float_meta_, static_cast<int64_t>(value));
+        cur_datum_val = 0;
+        MEMCPY(&cur_datum_val, &v, sizeof(float));
+      }
+      cur_datum.pack_ = ctx.is_double_ ? sizeof(double) : sizeof(float);
+      if (OB_FAIL(eval(ctx.obj_meta_, cur_datum, i))) {
+        LOG_WARN("fail to exe eval", KR(ret), K(i), K(cur_datum));
+      }
+    }
+  }
+  return ret;
+}
+
+}
+}
@@ -0,0 +1,373 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX STORAGE
+
+#include "ob_float_column_encoder.h"
+#include "ob_cs_encoding_util.h"
+#include "lib/codec/ob_codecs.h"
+
+namespace oceanbase
+{
+namespace blocksstable
+{
+
+using namespace common;
+
+// 2^52 + 2^51, adding and subtracting it rounds a double below 2^51 to the nearest integer
+static const double ALP_ROUND_MAGIC_NUMBER = 6755399441055744.0;
+
+ObFloatColumnEncoder::ObFloatColumnEncoder()
+  : is_double_(false),
+    float_meta_(),
+    enc_ctx_(),
+    integer_stream_encoder_(),
+    integer_range_(0),
+    alp_ints_(nullptr),
+    exception_row_ids_(nullptr),
+    exception_values_(nullptr)
+{
+}
+
+ObFloatColumnEncoder::~ObFloatColumnEncoder() {}
+
+int ObFloatColumnEncoder::init(
+  const ObColumnCSEncodingCtx &ctx, const int64_t column_index, const int64_t row_count)
+{
+  int ret = OB_SUCCESS;
+  if (IS_INIT) {
+    ret = OB_INIT_TWICE;
+    LOG_WARN("init twice", K(ret));
+  } else if (OB_FAIL(ObIColumnCSEncoder::init(ctx, column_index, row_count))) {
+    LOG_WARN("init base column encoder failed", K(ret), K(ctx), K(column_index), K(row_count));
+  } else {
+    const ObObjTypeClass tc = column_type_.get_type_class();
+    column_header_.type_ = type_;
+    column_header_.set_is_fixed_length();
+    is_double_ = ObDoubleTC == tc;
+    if (ObFloatTC != tc && ObDoubleTC != tc) {
+      ret = OB_NOT_SUPPORTED;
+      LOG_WARN("not supported type class", K(ret), K(tc), K_(column_type), K_(column_index));
+    } else if (OB_FAIL(do_init_())) {
+      LOG_WARN("fail to do init", K(ret));
+    } else {
+      LOG_DEBUG("init float column encoder", K(ret), K_(column_type), K_(column_index), K_(float_meta));
+    }
+  }
+  return ret;
+}
+
+void ObFloatColumnEncoder::reuse()
+{
+  ObIColumnCSEncoder::reuse();
+  is_double_ = false;
+  float_meta_.reuse();
+  integer_stream_encoder_.reuse();
+  integer_range_ = 0;
+  enc_ctx_.reset();
+  alp_ints_ = nullptr;
+  exception_row_ids_ = nullptr;
+  exception_values_ = nullptr;
+}
+
+int ObFloatColumnEncoder::do_init_()
+{
+  int ret = OB_SUCCESS;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else if (FALSE_IT(choose_exponent_and_factor_())) {
+  } else if (OB_FAIL(convert_to_integers_())) {
+    LOG_WARN("fail to convert to integers", K(ret), K_(float_meta));
+  } else {
+    int_stream_count_ = 1;
+    if (OB_FAIL(enc_ctx_.build_stream_encoder_info(
+        ctx_->null_cnt_ > 0/*has_null*/,
+        false/*not monotonic*/,
+        &ctx_->encoding_ctx_->cs_encoding_opt_,
+        ctx_->encoding_ctx_->previous_cs_encoding_.get_column_encoding(column_index_),
+        0/*stream_idx*/, ctx_->encoding_ctx_->compressor_type_, ctx_->allocator_))) {
+      LOG_WARN("fail to build_stream_encoder_info", K(ret));
+    }
+  }
+  return ret;
+}
+
+OB_INLINE bool ObFloatColumnEncoder::try_encode_(
+    const ObDatum &datum, const uint8_t exponent, const uint8_t factor, int64_t &alp_int) const
+{
+  bool is_valid = false;
+  const double value = is_double_ ? datum.get_double() : static_cast<double>(datum.get_float());
+  const double scaled = value * ObFloatEncodingMeta::EXP10_ARR[exponent]
+      * ObFloatEncodingMeta::FRAC10_ARR[factor];
+  // NaN and inf are excluded here too
+  if (scaled < ObFloatEncodingMeta::ENCODING_UPPER_LIMIT
+      && scaled > -ObFloatEncodingMeta::ENCODING_UPPER_LIMIT) {
+    alp_int = static_cast<int64_t>(scaled + ALP_ROUND_MAGIC_NUMBER - ALP_ROUND_MAGIC_NUMBER);
+    // must be the same with ObFloatEncodingMeta::decode
+    const double decoded = static_cast<double>(alp_int) * ObFloatEncodingMeta::EXP10_ARR[factor]
+        * ObFloatEncodingMeta::FRAC10_ARR[exponent];
+    // compare bits, so that -0.0 is an exception
+    if (is_double_) {
+      is_valid = 0 == MEMCMP(&decoded, datum.ptr_, sizeof(double));
+    } else {
+      const float decoded_float = static_cast<float>(decoded);
+      is_valid = 0 == MEMCMP(&decoded_float, datum.ptr_, sizeof(float));
+    }
+  }
+  return is_valid;
+}
+
+void ObFloatColumnEncoder::choose_exponent_and_factor_()
+{
+  const int64_t not_null_cnt = row_count_ - ctx_->null_cnt_;
+  const int64_t max_exponent = is_double_ ?
+      ObFloatEncodingMeta::MAX_DOUBLE_EXPONENT : ObFloatEncodingMeta::MAX_FLOAT_EXPONENT;
+  const int64_t exception_bits = (sizeof(uint32_t) + sizeof(uint64_t)) * CHAR_BIT;
+  const ObDatum *samples[MAX_SAMPLE_COUNT];
+  int64_t sample_cnt = 0;
+  if (not_null_cnt > 0) {
+    // pick not null datums evenly
+    const int64_t step = std::max(1L, not_null_cnt / MAX_SAMPLE_COUNT);
+    int64_t not_null_idx = 0;
+    for (int64_t i = 0; i < row_count_ && sample_cnt < MAX_SAMPLE_COUNT; ++i) {
+      const ObDatum &datum = ctx_->col_datums_->at(i);
+      if (!datum.is_null()) {
+        if (0 == not_null_idx % step) {
+          samples[sample_cnt++] = &datum;
+        }
+        ++not_null_idx;
+      }
+    }
+  }
+
+  int64_t best_cost = INT64_MAX;
+  for (int64_t exponent = max_exponent; exponent >= 0; --exponent) {
+    for (int64_t factor = 0; factor <= exponent; ++factor) {
+      int64_t exception_cnt = 0;
+      int64_t min = INT64_MAX;
+      int64_t max = INT64_MIN;
+      int64_t alp_int = 0;
+      for (int64_t i = 0; i < sample_cnt; ++i) {
+        if (try_encode_(*samples[i], exponent, factor, alp_int)) {
+          min = std::min(min, alp_int);
+          max = std::max(max, alp_int);
+        } else {
+          ++exception_cnt;
+        }
+      }
+      const uint64_t range = exception_cnt == sample_cnt ? 0 : static_cast<uint64_t>(max - min);
+      const int64_t cost = ObCSEncodingUtil::get_bit_size(range) * (sample_cnt - exception_cnt)
+          + exception_cnt * exception_bits;
+      // prefer smaller exponent for the same cost, which keeps the integers small
+      if (cost <= best_cost) {
+        best_cost = cost;
+        float_meta_.exponent_ = static_cast<uint8_t>(exponent);
+        float_meta_.factor_ = static_cast<uint8_t>(factor);
+      }
+    }
+  }
+}
+
+int ObFloatColumnEncoder::convert_to_integers_()
+{
+  int ret = OB_SUCCESS;
+  const int64_t not_null_cnt = row_count_ - ctx_->null_cnt_;
+  const int64_t ints_size = sizeof(int64_t) * row_count_;
+  const int64_t exceptions_size = (sizeof(uint32_t) + sizeof(uint64_t)) * std::max(1L, not_null_cnt);
+  char *exceptions_buf = nullptr;
+  if (OB_ISNULL(alp_ints_ = static_cast<int64_t *>(ctx_->allocator_->alloc(ints_size)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("fail to alloc", K(ret), K(ints_size));
+  } else if (OB_ISNULL(exceptions_buf = static_cast<char *>(ctx_->allocator_->alloc(exceptions_size)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("fail to alloc", K(ret), K(exceptions_size));
+  } else {
+    exception_values_ = reinterpret_cast<uint64_t *>(exceptions_buf);
+    exception_row_ids_ = reinterpret_cast<uint32_t *>(
+        exceptions_buf + sizeof(uint64_t) * std::max(1L, not_null_cnt));
+    int64_t min = INT64_MAX;
+    int64_t max = INT64_MIN;
+    uint32_t exception_cnt = 0;
+    for (int64_t i = 0; i < row_count_; ++i) {
+      const ObDatum &datum = ctx_->col_datums_->at(i);
+      if (datum.is_null()) {
+        // replaced later
+      } else if (try_encode_(datum, float_meta_.exponent_, float_meta_.factor_, alp_ints_[i])) {
+        min = std::min(min, alp_ints_[i]);
+        max = std::max(max, alp_ints_[i]);
+      } else {
+        exception_row_ids_[exception_cnt] = static_cast<uint32_t>(i);
+        if (is_double_) {
+          exception_values_[exception_cnt] = datum.get_uint64();
+        } else {
+          // float datum holds 4 bytes, keep the bits in the low part of the slot
+          const float value = datum.get_float();
+          uint32_t bits = 0;
+          MEMCPY(&bits, &value, sizeof(float));
+          exception_values_[exception_cnt] = bits;
+        }
+        ++exception_cnt;
+      }
+    }
+    if (INT64_MAX == min) { // all datums are null or exception
+      min = 0;
+      max = 0;
+    }
+    float_meta_.exception_cnt_ = exception_cnt;
+    // exception slots take the minimum, which is harmless to bit packing
+    for (int64_t i = 0; i < exception_cnt; ++i) {
+      alp_ints_[exception_row_ids_[i]] = min;
+    }
+    // |min| is less than 2^51, use min - 1 to replace null without overflow
+    const bool is_replace_null = ctx_->null_cnt_ > 0;
+    const int64_t null_replaced_value = min - 1;
+    if (is_replace_null) {
+      for (int64_t i = 0; i < row_count_; ++i) {
+        if (ctx_->col_datums_->at(i).is_null()) {
+          alp_ints_[i] = null_replaced_value;
+        }
+      }
+      min = null_replaced_value;
+    }
+    if (OB_FAIL(enc_ctx_.build_signed_stream_meta(min, max, is_replace_null,
+        null_replaced_value, -1/*precision_width_size*/, is_force_raw_, integer_range_))) {
+      LOG_WARN("fail to build_signed_stream_meta", K(ret), K(min), K(max));
+    }
+  }
+  return ret;
+}
+
+int ObFloatColumnEncoder::store_column(ObMicroBufferWriter &buf_writer)
+{
+  int ret = OB_SUCCESS;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else if (OB_FAIL(store_float_meta_(buf_writer))) {
+    LOG_WARN("fail to store float meta", K(ret), K_(float_meta));
+  } else if (OB_FAIL(store_integers_(buf_writer))) {
+    LOG_WARN("fail to store integers", K(ret), K_(enc_ctx));
+  } else if (OB_FAIL(stream_offsets_.push_back(buf_writer.length()))) {
+    LOG_WARN("fail to push back", K(ret));
+  } else {
+    int_stream_encoding_types_[0] = enc_ctx_.meta_.get_encoding_type();
+  }
+  return ret;
+}
+
+int ObFloatColumnEncoder::store_float_meta_(ObMicroBufferWriter &buf_writer)
+{
+  int ret = OB_SUCCESS;
+  const int64_t exception_cnt = float_meta_.exception_cnt_;
+  if (OB_FAIL(buf_writer.write(&float_meta_, sizeof(ObFloatEncodingMeta)))) {
+    LOG_WARN("fail to write float meta", K(ret), K(buf_writer));
+  } else if (0 == exception_cnt) {
+  } else if (OB_FAIL(buf_writer.write(exception_row_ids_, sizeof(uint32_t) * exception_cnt))) {
+    LOG_WARN("fail to write exception row ids", K(ret), K(exception_cnt));
+  } else if (OB_FAIL(buf_writer.write(exception_values_, sizeof(uint64_t) * exception_cnt))) {
+    LOG_WARN("fail to write exception values", K(ret), K(exception_cnt));
+  }
+  return ret;
+}
+
+int ObFloatColumnEncoder::store_integers_(ObMicroBufferWriter &buf_writer)
+{
+  int ret = OB_SUCCESS;
+  switch (enc_ctx_.meta_.get_width_tag()) {
+    case ObIntegerStream::UintWidth::UW_1_BYTE : {
+      ret = do_store_integers_<uint8_t>(buf_writer);
+      break;
+    }
+    case ObIntegerStream::UintWidth::UW_2_BYTE : {
+      ret = do_store_integers_<uint16_t>(buf_writer);
+      break;
+    }
+    case ObIntegerStream::UintWidth::UW_4_BYTE : {
+      ret = do_store_integers_<uint32_t>(buf_writer);
+      break;
+    }
+    case ObIntegerStream::UintWidth::UW_8_BYTE : {
+      ret = do_store_integers_<uint64_t>(buf_writer);
+      break;
+    }
+    default : {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("unexpected width", K(ret), K_(enc_ctx));
+    }
+  }
+  return ret;
+}
+
+template <typename T>
+int ObFloatColumnEncoder::do_store_integers_(ObMicroBufferWriter &buf_writer)
+{
+  int ret = OB_SUCCESS;
+  T *int_arr = nullptr;
+  const int64_t alloc_size = sizeof(T) * row_count_;
+  if (OB_ISNULL(int_arr = static_cast<T *>(ctx_->allocator_->alloc(alloc_size)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("fail to alloc", K(ret), K(alloc_size));
+  } else {
+    // truncation is fine, the stream encoder subtracts the base in the width of T
+    for (int64_t i = 0; i < row_count_; ++i) {
+      int_arr[i] = static_cast<T>(alp_ints_[i]);
+    }
+    if (OB_FAIL(integer_stream_encoder_.encode(enc_ctx_, int_arr, row_count_, buf_writer))) {
+      LOG_WARN("fail to encode stream", K(ret), K_(enc_ctx));
+    }
+  }
+  return ret;
+}
+
+int64_t ObFloatColumnEncoder::estimate_store_size() const
+{
+  int64_t size = INT64_MAX;
+  if (!is_inited_) {
+  } else if (is_force_raw_) {
+  } else {
+    size = ObCSEncodingUtil::get_bit_size(integer_range_) * row_count_ / CHAR_BIT
+        + sizeof(ObFloatEncodingMeta) + float_meta_.get_exceptions_size();
+  }
+  return size;
+}
+
+int ObFloatColumnEncoder::get_identifier_and_stream_types(
+    ObColumnEncodingIdentifier &identifier, const ObIntegerStream::EncodingType *&types) const
+{
+  int ret = OB_SUCCESS;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else {
+    identifier.set(type_, int_stream_count_, 0);
+    types = int_stream_encoding_types_;
+  }
+  return ret;
+}
+
+int ObFloatColumnEncoder::get_maximal_encoding_store_size(int64_t &size) const
+{
+  int ret = OB_SUCCESS;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else {
+    size = sizeof(ObFloatEncodingMeta) + float_meta_.get_exceptions_size() + sizeof(ObIntegerStreamMeta) +
+        common::ObCodec::get_moderate_encoding_size(enc_ctx_.meta_.get_uint_width_size() * row_count_);
+    size = std::min(size, ObCSEncodingUtil::MAX_COLUMN_ENCODING_STORE_SIZE);
+  }
+  return ret;
+}
+
+}  // end namespace blocksstable
+}  // end namespace oceanbase
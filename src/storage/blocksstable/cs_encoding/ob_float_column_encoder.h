@@ -0,0 +1,81 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_ENCODING_OB_FLOAT_COLUMN_ENCODER_H_
+#define OCEANBASE_ENCODING_OB_FLOAT_COLUMN_ENCODER_H_
+
+#include "ob_icolumn_cs_encoder.h"
+#include "ob_integer_stream_encoder.h"
+
+namespace oceanbase
+{
+namespace blocksstable
+{
+
+// Encode float/double column as decimal integers (ALP, adaptive lossless floating-point),
+// the exponent and factor are chosen by sampling, values which can not be restored exactly
+// are stored as exceptions in column meta.
+class ObFloatColumnEncoder : public ObIColumnCSEncoder
+{
+public:
+  static const ObCSColumnHeader::Type type_ = ObCSColumnHeader::FLOAT;
+  static const int64_t MAX_SAMPLE_COUNT = 64;
+  ObFloatColumnEncoder();
+  virtual ~ObFloatColumnEncoder();
+
+  ObFloatColumnEncoder(const ObFloatColumnEncoder&) = delete;
+  ObFloatColumnEncoder &operator=(const ObFloatColumnEncoder&) = delete;
+
+  int init(
+    const ObColumnCSEncodingCtx &ctx, const int64_t column_index, const int64_t row_count) override;
+  void reuse() override;
+  int store_column(ObMicroBufferWriter &buf_writer) override;
+  int64_t estimate_store_size() const override;
+  ObCSColumnHeader::Type get_type() const override { return type_; }
+  int get_identifier_and_stream_types(
+      ObColumnEncodingIdentifier &identifier, const ObIntegerStream::EncodingType *&types) const override;
+  int get_maximal_encoding_store_size(int64_t &size) const override;
+  int get_string_data_len(uint32_t &len) const override
+  {
+    len = 0;
+    return OB_SUCCESS;
+  }
+
+  INHERIT_TO_STRING_KV("ICSColumnEncoder", ObIColumnCSEncoder,
+    K_(is_double), K_(float_meta), K_(enc_ctx), K_(integer_range));
+
+private:
+  int do_init_();
+  void choose_exponent_and_factor_();
+  int convert_to_integers_();
+  int store_float_meta_(ObMicroBufferWriter &buf_writer);
+  int store_integers_(ObMicroBufferWriter &buf_writer);
+  template <typename T>
+  int do_store_integers_(ObMicroBufferWriter &buf_writer);
+  bool try_encode_(const common::ObDatum &datum, const uint8_t exponent,
+                   const uint8_t factor, int64_t &alp_int) const;
+
+private:
+  bool is_double_;
+  ObFloatEncodingMeta float_meta_;
+  ObIntegerStreamEncoderCtx enc_ctx_;
+  ObIntegerStreamEncoder integer_stream_encoder_;
+  uint64_t integer_range_;
+  int64_t *alp_ints_;
+  uint32_t *exception_row_ids_;
+  uint64_t *exception_values_;
+};
+
+}  // end namespace blocksstable
+}  // end namespace oceanbase
+
+#endif  // OCEANBASE_ENCODING_OB_FLOAT_COLUMN_ENCODER_H_
@@ -0,0 +1,667 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+#define USING_LOG_PREFIX STORAGE
+
+#include "ob_fsst_column_decoder.h"
+#include "ob_fsst_symbol_table.h"
+#include "ob_cs_decoding_util.h"
+#include "storage/blocksstable/encoding/ob_encoding_query_util.h"
+#include "src/share/vector/ob_uniform_vector.h"
+#include "src/share/vector/ob_continuous_vector.h"
+#include "src/share/vector/ob_discrete_vector.h"
+
+namespace oceanbase
+{
+namespace blocksstable
+{
+using namespace oceanbase::common;
+using namespace oceanbase::share;
+
+#define FSST_DISPATCH_OFFSET_WIDTH(ctx, FUNC, ...)                       \
+  switch ((ctx).offset_ctx_->meta_.get_width_tag()) {                    \
+    case ObIntegerStream::UintWidth::UW_1_BYTE : {                       \
+      ret = FUNC<uint8_t>(__VA_ARGS__);                                  \
+      break;                                                             \
+    }                                                                    \
+    case ObIntegerStream::UintWidth::UW_2_BYTE : {                       \
+      ret = FUNC<uint16_t>(__VA_ARGS__);                                 \
+      break;                                                             \
+    }                                                                    \
+    case ObIntegerStream::UintWidth::UW_4_BYTE : {                       \
+      ret = FUNC<uint32_t>(__VA_ARGS__);                                 \
+      break;                                                             \
+    }                                                                    \
+    case ObIntegerStream::UintWidth::UW_8_BYTE : {                       \
+      ret = FUNC<uint64_t>(__VA_ARGS__);                                 \
+      break;                                                             \
+    }                                                                    \
+    default : {                                                          \
+      ret = OB_ERR_UNEXPECTED;                                           \
+      LOG_WARN("unexpected width", K(ret), K(ctx));                      \
+    }                                                                    \
+  }
+
+template <typename OffsetIntType>
+struct ObFsstRowReader
+{
+  explicit ObFsstRowReader(const ObFsstColumnDecoderCtx &ctx)
+    : offset_arr_(reinterpret_cast<const OffsetIntType *>(ctx.offset_data_)),
+      codes_(reinterpret_cast<const unsigned char *>(ctx.compressed_data_)),
+      symbol_lens_(ctx.symbol_lens_),
+      symbols_(ctx.symbols_),
+      max_string_len_(ctx.fsst_meta_->max_string_len_)
+  {}
+  OB_INLINE void get_codes(const int64_t row_id, const unsigned char *&codes, int64_t &code_len) const
+  {
+    const uint64_t start = 0 == row_id ? 0 : offset_arr_[row_id - 1];
+    codes = codes_ + start;
+    code_len = offset_arr_[row_id] - start;
+  }
+  // each code is decompressed to at most MAX_SYMBOL_LENGTH bytes
+  OB_INLINE int64_t get_max_decompressed_len(const int64_t row_id) const
+  {
+    const unsigned char *codes = nullptr;
+    int64_t code_len = 0;
+    get_codes(row_id, codes, code_len);
+    return std::min(static_cast<int64_t>(max_string_len_),
+                    code_len * ObFsstEncodingMeta::MAX_SYMBOL_LENGTH);
+  }
+  OB_INLINE int64_t decompress(const int64_t row_id, char *out) const
+  {
+    const unsigned char *codes = nullptr;
+    int64_t code_len = 0;
+    get_codes(row_id, codes, code_len);
+    return ObFsstSymbolTable::decompress(symbol_lens_, symbols_, codes, code_len, out);
+  }
+  const OffsetIntType *offset_arr_;
+  const unsigned char *codes_;
+  const uint8_t *symbol_lens_;
+  const char *symbols_;
+  const uint32_t max_string_len_;
+};
+
+struct ObFsstDatumWriter
+{
+  explicit ObFsstDatumWriter(ObDatum *datums) : datums_(datums) {}
+  OB_INLINE void set_null(const int64_t idx) { datums_[idx].set_null(); }
+  OB_INLINE void set_string(const int64_t idx, const char *ptr, const int64_t len)
+  {
+    datums_[idx].ptr_ = ptr;
+    datums_[idx].pack_ = static_cast<uint32_t>(len);
+  }
+  ObDatum *datums_;
+};
+
+struct ObFsstDiscreteVecWriter
+{
+  ObFsstDiscreteVecWriter(ObIVector &vector, const int64_t vec_offset)
+    : vector_(static_cast<ObDiscreteFormat &>(vector)), vec_offset_(vec_offset) {}
+  OB_INLINE void set_null(const int64_t idx) { vector_.set_null(vec_offset_ + idx); }
+  OB_INLINE void set_string(const int64_t idx, const char *ptr, const int64_t len)
+  {
+    vector_.get_ptrs()[vec_offset_ + idx] = const_cast<char *>(ptr);
+    vector_.get_lens()[vec_offset_ + idx] = static_cast<ObLength>(len);
+  }
+  ObDiscreteFormat &vector_;
+  const int64_t vec_offset_;
+};
+
+struct ObFsstUniformVecWriter
+{
+  ObFsstUniformVecWriter(ObIVector &vector, const int64_t vec_offset)
+    : vector_(static_cast<ObUniformFormat<false> &>(vector)), vec_offset_(vec_offset) {}
+  OB_INLINE void set_null(const int64_t idx) { vector_.get_datum(vec_offset_ + idx).set_null(); }
+  OB_INLINE void set_string(const int64_t idx, const char *ptr, const int64_t len)
+  {
+    ObDatum &datum = vector_.get_datum(vec_offset_ + idx);
+    datum.ptr_ = ptr;
+    datum.pack_ = static_cast<uint32_t>(len);
+  }
+  ObUniformFormat<false> &vector_;
+  const int64_t vec_offset_;
+};
+
+// rows must be written in order
+struct ObFsstContinuousVecWriter
+{
+  ObFsstContinuousVecWriter(ObIVector &vector, const int64_t vec_offset)
+    : vector_(static_cast<ObContinuousFormat &>(vector)), vec_offset_(vec_offset), curr_offset_(0)
+  {
+    if (0 == vec_offset_) {
+      vector_.get_offsets()[0] = 0;
+    } else {
+      curr_offset_ = vector_.get_offsets()[vec_offset_];
+    }
+  }
+  OB_INLINE void set_null(const int64_t idx)
+  {
+    vector_.set_null(vec_offset_ + idx);
+    vector_.get_offsets()[vec_offset_ + idx + 1] = curr_offset_;
+  }
+  OB_INLINE void set_string(const int64_t idx, const char *ptr, const int64_t len)
+  {
+    MEMCPY(vector_.get_data() + curr_offset_, ptr, len);
+    curr_offset_ += len;
+    vector_.get_offsets()[vec_offset_ + idx + 1] = curr_offset_;
+  }
+  ObContinuousFormat &vector_;
+  const int64_t vec_offset_;
+  uint32_t curr_offset_;
+};
+
+template <typename OffsetIntType, typename Writer>
+static int decode_fsst_rows(
+    const ObFsstColumnDecoderCtx &ctx, const int64_t *row_ids, const int64_t row_cap, Writer &writer)
+{
+  int ret = OB_SUCCESS;
+  const ObFsstRowReader<OffsetIntType> reader(ctx);
+  const bool has_null = ctx.has_null_bitmap();
+  int64_t buf_size = 0;
+  char *buf = nullptr;
+  // allocate once for all rows, the decoded strings are referenced by datums
+  for (int64_t i = 0; i < row_cap; ++i) {
+    if (!has_null || !ObCSDecodingUtil::test_bit(ctx.null_bitmap_, row_ids[i])) {
+      buf_size += reader.get_max_decompressed_len(row_ids[i]);
+    }
+  }
+  if (buf_size > 0 && OB_ISNULL(buf = static_cast<char *>(ctx.allocator_->alloc(buf_size)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("fail to alloc", K(ret), K(buf_size));
+  } else {
+    int64_t pos = 0;
+    for (int64_t i = 0; i < row_cap; ++i) {
+      const int64_t row_id = row_ids[i];
+      if (has_null && ObCSDecodingUtil::test_bit(ctx.null_bitmap_, row_id)) {
+        writer.set_null(i);
+      } else {
+        const int64_t len = reader.decompress(row_id, buf + pos);
+        writer.set_string(i, buf + pos, len);
+        pos += len;
+      }
+    }
+  }
+  return ret;
+}
+
+template <typename Writer>
+int ObFsstColumnDecoder::dispatch_decode_(const ObFsstColumnDecoderCtx &ctx,
+    const int64_t *row_ids, const int64_t row_cap, Writer &writer)
+{
+  int ret = OB_SUCCESS;
+  FSST_DISPATCH_OFFSET_WIDTH(ctx, decode_fsst_rows, ctx, row_ids, row_cap, writer);
+  return ret;
+}
+
+int ObFsstColumnDecoder::decode(const ObColumnCSDecoderCtx &ctx,
+                                const int64_t row_id,
+                                common::ObDatum &datum) const
+{
+  int ret = OB_SUCCESS;
+  ObFsstDatumWriter writer(&datum);
+  if (OB_FAIL(dispatch_decode_(ctx.fsst_ctx_, &row_id, 1, writer))) {
+    LOG_WARN("fail to decode", K(ret), K(row_id));
+  }
+  return ret;
+}
+
+int ObFsstColumnDecoder::batch_decode(const ObColumnCSDecoderCtx &ctx,
+    const int64_t *row_ids, const int64_t row_cap, common::ObDatum *datums) const
+{
+  int ret = OB_SUCCESS;
+  ObFsstDatumWriter writer(datums);
+  if (OB_FAIL(dispatch_decode_(ctx.fsst_ctx_, row_ids, row_cap, writer))) {
+    LOG_WARN("fail to batch decode", K(ret), K(row_cap));
+  }
+  return ret;
+}
+
+int ObFsstColumnDecoder::decode_vector(
+    const ObColumnCSDecoderCtx &ctx, ObVectorDecodeCtx &vector_ctx) const
+{
+  int ret = OB_SUCCESS;
+  const ObFsstColumnDecoderCtx &fsst_ctx = ctx.fsst_ctx_;
+  const VectorFormat vec_format = vector_ctx.get_format();
+  ObIVector *vector = vector_ctx.get_vector();
+  if (OB_ISNULL(vector)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("unexpected null vector", K(ret), K(vector_ctx));
+  } else {
+    switch (vec_format) {
+      case VEC_DISCRETE : {
+        ObFsstDiscreteVecWriter writer(*vector, vector_ctx.vec_offset_);
+        ret = dispatch_decode_(fsst_ctx, vector_ctx.row_ids_, vector_ctx.row_cap_, writer);
+        break;
+      }
+      case VEC_CONTINUOUS : {
+        ObFsstContinuousVecWriter writer(*vector, vector_ctx.vec_offset_);
+        ret = dispatch_decode_(fsst_ctx, vector_ctx.row_ids_, vector_ctx.row_cap_, writer);
+        break;
+      }
+      case VEC_UNIFORM : {
+        ObFsstUniformVecWriter writer(*vector, vector_ctx.vec_offset_);
+        ret = dispatch_decode_(fsst_ctx, vector_ctx.row_ids_, vector_ctx.row_cap_, writer);
+        break;
+      }
+      default : {
+        ret = OB_NOT_SUPPORTED;
+        LOG_WARN("fsst column not support decoding to this vector format", K(ret), K(vec_format));
+      }
+    }
+    if (OB_FAIL(ret)) {
+      LOG_WARN("fail to decode_vector", K(ret), K(fsst_ctx), K(vector_ctx));
+    }
+  }
+  return ret;
+}
+
+int ObFsstColumnDecoder::get_null_count(
+    const ObColumnCSDecoderCtx &col_ctx,
+    const int64_t *row_ids,
+    const int64_t row_cap,
+    int64_t &null_count) const
+{
+  int ret = OB_SUCCESS;
+  const ObFsstColumnDecoderCtx &fsst_ctx = col_ctx.fsst_ctx_;
+  null_count = 0;
+  if (OB_ISNULL(row_ids) || row_cap < 1) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", KR(ret), K(row_cap));
+  } else if (fsst_ctx.has_null_bitmap()) {
+    for (int64_t i = 0; i < row_cap; ++i) {
+      if (ObCSDecodingUtil::test_bit(fsst_ctx.null_bitmap_, row_ids[i])) {
+        ++null_count;
+      }
+    }
+  }
+  return ret;
+}
+
+int ObFsstColumnDecoder::pushdown_operator(
+    const sql::ObPushdownFilterExecutor *parent,
+    const ObColumnCSDecoderCtx &col_ctx,
+    const sql::ObWhiteFilterExecutor &filter,
+    const sql::PushdownFilterInfo &pd_filter_info,
+    ObBitmap &result_bitmap) const
+{
+  UNUSED(parent);
+  int ret = OB_SUCCESS;
+  const ObFsstColumnDecoderCtx &fsst_ctx = col_ctx.fsst_ctx_;
+  const int64_t row_cnt = pd_filter_info.count_;
+  if (OB_UNLIKELY(row_cnt < 1 || row_cnt != result_bitmap.size())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", KR(ret), K(row_cnt), K(result_bitmap.size()));
+  } else {
+    const sql::ObWhiteFilterOperatorType op_type = filter.get_op_type();
+    switch (op_type) {
+      case sql::WHITE_OP_NU:
+      case sql::WHITE_OP_NN: {
+        if (OB_FAIL(nu_nn_operator(fsst_ctx, filter, pd_filter_info, result_bitmap))) {
+          LOG_WARN("fail to handle nu_nn operator", KR(ret), K(pd_filter_info));
+        }
+        break;
+      }
+      case sql::WHITE_OP_EQ:
+      case sql::WHITE_OP_NE:
+      case sql::WHITE_OP_GT:
+      case sql::WHITE_OP_GE:
+      case sql::WHITE_OP_LT:
+      case sql::WHITE_OP_LE: {
+        if (OB_FAIL(comparison_operator(fsst_ctx, filter, pd_filter_info, result_bitmap))) {
+          LOG_WARN("fail to handle comparison operator", KR(ret), K(pd_filter_info));
+        }
+        break;
+      }
+      case sql::WHITE_OP_BT: {
+        if (OB_FAIL(between_operator(fsst_ctx, filter, pd_filter_info, result_bitmap))) {
+          LOG_WARN("fail to handle between operator", KR(ret), K(pd_filter_info));
+        }
+        break;
+      }
+      case sql::WHITE_OP_IN: {
+        if (OB_FAIL(in_operator(fsst_ctx, filter, pd_filter_info, result_bitmap))) {
+          LOG_WARN("fail to handle in operator", KR(ret), K(pd_filter_info));
+        }
+        break;
+      }
+      default: {
+        ret = OB_NOT_SUPPORTED;
+        LOG_WARN("unexpected operation type", KR(ret), K(op_type));
+      }
+    }
+    LOG_TRACE("fsst white filter pushdown", K(ret), K(fsst_ctx),
+        K(filter.get_op_type()), K(pd_filter_info), K(result_bitmap.popcnt()));
+  }
+  return ret;
+}
+
+int ObFsstColumnDecoder::nu_nn_operator(
+    const ObFsstColumnDecoderCtx &ctx,
+    const sql::ObWhiteFilterExecutor &filter,
+    const sql::PushdownFilterInfo &pd_filter_info,
+    ObBitmap &result_bitmap)
+{
+  int ret = OB_SUCCESS;
+  const int64_t row_start = pd_filter_info.start_;
+  const int64_t row_count = pd_filter_info.count_;
+  if (ctx.has_null_bitmap()) {
+    for (int64_t i = 0; OB_SUCC(ret) && i < row_count; ++i) {
+      if (ObCSDecodingUtil::test_bit(ctx.null_bitmap_, row_start + i)) {
+        if (OB_FAIL(result_bitmap.set(i))) {
+          LOG_WARN("fail to set result bitmap", KR(ret), K(i));
+        }
+      }
+    }
+  }
+  if (OB_SUCC(ret) && (sql::WHITE_OP_NN == filter.get_op_type())) {
+    if (OB_FAIL(result_bitmap.bit_not())) {
+      LOG_WARN("fail to execute bit_not", KR(ret));
+    }
+  }
+  return ret;
+}
+
+bool ObFsstColumnDecoder::can_compare_on_compressed(
+    const ObFsstColumnDecoderCtx &ctx,
+    const sql::ObWhiteFilterExecutor &filter)
+{
+  bool can_compare = false;
+  common::ObObjMeta filter_val_meta;
+  const sql::ObPushdownWhiteFilterNode &filter_node = filter.get_filter_node();
+  const bool need_padding = (ctx.obj_meta_.is_fixed_len_char_type() && nullptr != ctx.col_param_);
+  if (need_padding || CS_TYPE_BINARY != ctx.obj_meta_.get_collation_type()) {
+  } else if (sql::WHITE_OP_IN == filter.get_op_type() && !filter.is_filter_dynamic_node()) {
+    // each value of IN is an argument of the filter expr
+    can_compare = nullptr != filter_node.expr_;
+    for (int64_t i = 0; can_compare && i < filter_node.expr_->arg_cnt_; ++i) {
+      const sql::ObExpr *arg = filter_node.expr_->args_[i];
+      if (OB_ISNULL(arg)) {
+        can_compare = false;
+      } else if (T_REF_COLUMN != arg->type_) {
+        can_compare = CS_TYPE_BINARY == arg->obj_meta_.get_collation_type()
+            && ctx.obj_meta_.get_type_class() == arg->obj_meta_.get_type_class();
+      }
+    }
+  } else if (OB_SUCCESS != filter_node.get_filter_val_meta(filter_val_meta)) {
+  } else {
+    can_compare = CS_TYPE_BINARY == filter_val_meta.get_collation_type()
+        && ctx.obj_meta_.get_type_class() == filter_val_meta.get_type_class();
+  }
+  return can_compare;
+}
+
+int ObFsstColumnDecoder::compress_filter_values(
+    const ObFsstColumnDecoderCtx &ctx,
+    const sql::ObWhiteFilterExecutor &filter,
+    ObString *compressed_values,
+    int64_t &value_cnt)
+{
+  int ret = OB_SUCCESS;
+  ObFsstSymbolTable symbol_table;
+  symbol_table.load(ctx.fsst_meta_->symbol_cnt_, ctx.symbol_lens_, ctx.symbols_);
+  value_cnt = 0;
+  for (int64_t i = 0; OB_SUCC(ret) && i < filter.get_datums().count(); ++i) {
+    const ObDatum &datum = filter.get_datums().at(i);
+    char *buf = nullptr;
+    if (datum.is_null()) {
+      // null never equals to any value
+    } else if (datum.len_ > ctx.fsst_meta_->max_string_len_) {
+      // longer than any string of this column
+    } else if (OB_ISNULL(buf = static_cast<char *>(ctx.allocator_->alloc(std::max(1L, 2L * datum.len_))))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("fail to alloc", K(ret), K(datum));
+    } else {
+      const int64_t len = symbol_table.compress(datum.ptr_, datum.len_, buf);
+      compressed_values[value_cnt++].assign_ptr(buf, static_cast<int32_t>(len));
+    }
+  }
+  return ret;
+}
+
+int ObFsstColumnDecoder::comparison_operator(
+    const ObFsstColumnDecoderCtx &ctx,
+    const sql::ObWhiteFilterExecutor &filter,
+    const sql::PushdownFilterInfo &pd_filter_info,
+    ObBitmap &result_bitmap)
+{
+  int ret = OB_SUCCESS;
+  int64_t datums_cnt = 0;
+  if (OB_UNLIKELY((datums_cnt = filter.get_datums().count()) != 1)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", KR(ret), K(datums_cnt));
+  } else {
+    const sql::ObWhiteFilterOperatorType op_type = filter.get_op_type();
+    const ObDatum &filter_datum = filter.get_datums().at(0);
+    if ((sql::WHITE_OP_EQ == op_type || sql::WHITE_OP_NE == op_type)
+        && !filter_datum.is_null() && can_compare_on_compressed(ctx, filter)) {
+      ObString compressed_value;
+      int64_t value_cnt = 0;
+      if (OB_FAIL(compress_filter_values(ctx, filter, &compressed_value, value_cnt))) {
+        LOG_WARN("fail to compress filter value", KR(ret), K(filter_datum));
+      } else if (OB_FAIL(tranverse_compressed_equal_op(ctx, &compressed_value, value_cnt,
+          sql::WHITE_OP_NE == op_type, pd_filter_info, result_bitmap))) {
+        LOG_WARN("fail to tranverse compressed equal op", KR(ret), K(op_type));
+      }
+    } else {
+      ObDatumCmpFuncType type_cmp_func = filter.cmp_func_;
+      ObGetFilterCmpRetFunc get_cmp_ret = get_filter_cmp_ret_func(op_type);
+      auto eval = [&] (const ObObjMeta &obj_meta, const ObDatum &cur_datum, const int64_t idx)
+      {
+        int tmp_ret = OB_SUCCESS;
+        int cmp_ret = 0;
+        if (OB_TMP_FAIL(type_cmp_func(cur_datum, filter_datum, cmp_ret))) {
+          LOG_WARN("fail to compare datums", K(tmp_ret), K(cur_datum), K(filter_datum));
+        } else if (get_cmp_ret(cmp_ret)) {
+          if (OB_TMP_FAIL(result_bitmap.set(idx))) {
+            LOG_WARN("fail to set result bitmap", KR(tmp_ret), K(idx));
+          }
+        }
+        return tmp_ret;
+      };
+      if (OB_FAIL(tranverse_datum_all_op(ctx, pd_filter_info, result_bitmap, eval))) {
+        LOG_WARN("fail to traverse_datum in cmp_op", KR(ret), K(ctx));
+      }
+    }
+  }
+  return ret;
+}
+
+int ObFsstColumnDecoder::between_operator(
+    const ObFsstColumnDecoderCtx &ctx,
+    const sql::ObWhiteFilterExecutor &filter,
+    const sql::PushdownFilterInfo &pd_filter_info,
+    ObBitmap &result_bitmap)
+{
+  int ret = OB_SUCCESS;
+  int64_t datums_cnt = 0;
+  if (OB_UNLIKELY((datums_cnt = filter.get_datums().count()) != 2)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", KR(ret), K(datums_cnt));
+  } else {
+    const ObDatum &left_datum = filter.get_datums().at(0);
+    const ObDatum &right_datum = filter.get_datums().at(1);
+    ObDatumCmpFuncType type_cmp_func = filter.cmp_func_;
+    auto eval = [&] (const ObObjMeta &obj_meta, const ObDatum &cur_datum, const int64_t idx)
+    {
+      int tmp_ret = OB_SUCCESS;
+      int left_cmp_ret = 0;
+      int right_cmp_ret = 0;
+      if (OB_TMP_FAIL(type_cmp_func(cur_datum, left_datum, left_cmp_ret))) {
+        LOG_WARN("fail to compare datums", K(tmp_ret), K(cur_datum), K(left_datum));
+      } else if (left_cmp_ret < 0) {
+      } else if (OB_TMP_FAIL(type_cmp_func(cur_datum, right_datum, right_cmp_ret))) {
+        LOG_WARN("fail to compare datums", K(tmp_ret), K(cur_datum), K(right_datum));
+      } else if (right_cmp_ret <= 0) {
+        if (OB_TMP_FAIL(result_bitmap.set(idx))) {
+          LOG_WARN("fail to set result bitmap", KR(tmp_ret), K(idx));
+        }
+      }
+      return tmp_ret;
+    };
+    if (OB_FAIL(tranverse_datum_all_op(ctx, pd_filter_info, result_bitmap, eval))) {
+      LOG_WARN("fail to traverse_datum in bt_op", KR(ret), K(ctx));
+    }
+  }
+  return ret;
+}
+
+int ObFsstColumnDecoder::in_operator(
+    const ObFsstColumnDecoderCtx &ctx,
+    const sql::ObWhiteFilterExecutor &filter,
+    const sql::PushdownFilterInfo &pd_filter_info,
+    ObBitmap &result_bitmap)
+{
+  int ret = OB_SUCCESS;
+  int64_t datum_cnt = 0;
+  if (OB_UNLIKELY((datum_cnt = (filter.get_datums().count())) < 1)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", KR(ret), K(datum_cnt));
+  } else if (datum_cnt <= MAX_COMPRESSED_IN_CNT && can_compare_on_compressed(ctx, filter)) {
+    ObString compressed_values[MAX_COMPRESSED_IN_CNT];
+    int64_t value_cnt = 0;
+    if (OB_FAIL(compress_filter_values(ctx, filter, compressed_values, value_cnt))) {
+      LOG_WARN("fail to compress filter values", KR(ret), K(datum_cnt));
+    } else if (OB_FAIL(tranverse_compressed_equal_op(ctx, compressed_values, value_cnt,
+        false/*is_reverse*/, pd_filter_info, result_bitmap))) {
+      LOG_WARN("fail to tranverse compressed equal op", KR(ret), K(value_cnt));
+    }
+  } else {
+    auto eval = [&] (const ObObjMeta &obj_meta, const ObDatum &cur_datum, const int64_t idx)
+    {
+      int tmp_ret = OB_SUCCESS;
+      ObObj cur_obj;
+      bool is_exist = false;
+      if (OB_TMP_FAIL(cur_datum.to_obj(cur_obj, obj_meta))) {
+        LOG_WARN("fail to convert datum to obj", KR(tmp_ret), K(cur_datum), K(obj_meta));
+      } else if (OB_TMP_FAIL(filter.exist_in_obj_set(cur_obj, is_exist))) {
+        LOG_WARN("fail to check obj in hashset", KR(tmp_ret), K(cur_obj));
+      } else if (is_exist) {
+        if (OB_TMP_FAIL(result_bitmap.set(idx))) {
+          LOG_WARN("fail to set result bitmap", KR(tmp_ret), K(idx));
+        }
+      }
+      return tmp_ret;
+    };
+    if (OB_FAIL(tranverse_datum_all_op(ctx, pd_filter_info, result_bitmap, eval))) {
+      LOG_WARN("fail to tranverse datum in in_op", KR(ret), K(ctx));
+    }
+  }
+  return ret;
+}
+
+template <typename OffsetIntType>
+static int compressed_equal_tranverse(
+    const ObFsstColumnDecoderCtx &ctx,
+    const ObString *compressed_values,
+    const int64_t value_cnt,
+    const bool is_reverse,
+    const int64_t row_start,
+    const int64_t row_count,
+    uint8_t *bitmap_data)
+{
+  const ObFsstRowReader<OffsetIntType> reader(ctx);
+  const unsigned char *codes = nullptr;
+  int64_t code_len = 0;
+  for (int64_t i = 0; i < row_count; ++i) {
+    bool is_equal = false;
+    reader.get_codes(row_start + i, codes, code_len);
+    for (int64_t j = 0; !is_equal && j < value_cnt; ++j) {
+      is_equal = code_len == compressed_values[j].length()
+          && 0 == MEMCMP(codes, compressed_values[j].ptr(), code_len);
+    }
+    bitmap_data[i] = is_equal ^ is_reverse;
+  }
+  if (ctx.has_null_bitmap()) {
+    for (int64_t i = 0; i < row_count; ++i) {
+      if (ObCSDecodingUtil::test_bit(ctx.null_bitmap_, row_start + i)) {
+        bitmap_data[i] = 0;
+      }
+    }
+  }
+  return OB_SUCCESS;
+}
+
+int ObFsstColumnDecoder::tranverse_compressed_equal_op(
+    const ObFsstColumnDecoderCtx &ctx,
+    const ObString *compressed_values,
+    const int64_t value_cnt,
+    const bool is_reverse,
+    const sql::PushdownFilterInfo &pd_filter_info,
+    ObBitmap &result_bitmap)
+{
+  int ret = OB_SUCCESS;
+  const int64_t row_start = pd_filter_info.start_;
+  const int64_t row_count = pd_filter_info.count_;
+  uint8_t *bitmap_data = result_bitmap.get_data();
+  FSST_DISPATCH_OFFSET_WIDTH(ctx, compressed_equal_tranverse,
+      ctx, compressed_values, value_cnt, is_reverse, row_start, row_count, bitmap_data);
+  return ret;
+}
+
+template <typename OffsetIntType, typename Operator>
+static int datum_tranverse(
+    const ObFsstColumnDecoderCtx &ctx,
+    const int64_t row_start,
+    const int64_t row_count,
+    ObBitmap &result_bitmap,
+    Operator const &eval)
+{
+  int ret = OB_SUCCESS;
+  const ObFsstRowReader<OffsetIntType> reader(ctx);
+  const bool has_null = ctx.has_null_bitmap();
+  const bool need_padding = (ctx.obj_meta_.is_fixed_len_char_type() && nullptr != ctx.col_param_);
+  const int64_t buf_size = std::max(1L, static_cast<int64_t>(ctx.fsst_meta_->max_string_len_));
+  char *buf = nullptr;
+  // the buffer is reused by each row
+  if (OB_ISNULL(buf = static_cast<char *>(ctx.allocator_->alloc(buf_size)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("fail to alloc", K(ret), K(buf_size));
+  }
+  ObStorageDatum cur_datum;
+  // NU/NN will not reach here.
+  for (int64_t i = 0; OB_SUCC(ret) && i < row_count; ++i) {
+    const int64_t row_id = row_start + i;
+    if (has_null && ObCSDecodingUtil::test_bit(ctx.null_bitmap_, row_id)) {
+      if (OB_FAIL(result_bitmap.set(i, false))) {
+        LOG_WARN("fail to set result bitmap", KR(ret), K(i));
+      }
+    } else {
+      cur_datum.ptr_ = buf;
+      cur_datum.pack_ = static_cast<uint32_t>(reader.decompress(row_id, buf));
+      if (need_padding && OB_FAIL(storage::pad_column(
+          ctx.obj_meta_, ctx.col_param_->get_accuracy(), *ctx.allocator_, cur_datum))) {
+        LOG_WARN("fail to pad datum", KR(ret), K(cur_datum));
+      } else if (OB_FAIL(eval(ctx.obj_meta_, cur_datum, i))) {
+        LOG_WARN("fail to exe eval", KR(ret), K(i), K(cur_datum));
+      }
+    }
+  }
+  return ret;
+}
+
+template<typename Operator>
+int ObFsstColumnDecoder::tranverse_datum_all_op(
+    const ObFsstColumnDecoderCtx &ctx,
+    const sql::PushdownFilterInfo &pd_filter_info,
+    ObBitmap &result_bitmap,
+    Operator const &eval)
+{
+  int ret = OB_SUCCESS;
+  const int64_t row_start = pd_filter_info.start_;
+  const int64_t row_count = pd_filter_info.count_;
+  FSST_DISPATCH_OFFSET_WIDTH(ctx, datum_tranverse, ctx, row_start, row_count, result_bitmap, eval);
+  return ret;
+}
+
+#undef FSST_DISPATCH_OFFSET_WIDTH
+
+}
+}
@@ -0,0 +1,106 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_ENCODING_OB_FSST_COLUMN_DECODER_H_
+#define OCEANBASE_ENCODING_OB_FSST_COLUMN_DECODER_H_
+
+#include "ob_icolumn_cs_decoder.h"
+
+namespace oceanbase
+{
+namespace blocksstable
+{
+
+class ObFsstColumnDecoder : public ObIColumnCSDecoder
+{
+public:
+  static const ObCSColumnHeader::Type type_ = ObCSColumnHeader::FSST;
+  // IN filter with more values is evaluated on decompressed strings with the hash set
+  static const int64_t MAX_COMPRESSED_IN_CNT = 16;
+  ObFsstColumnDecoder() {}
+  virtual ~ObFsstColumnDecoder() {}
+  ObFsstColumnDecoder(const ObFsstColumnDecoder&) = delete;
+  ObFsstColumnDecoder &operator=(const ObFsstColumnDecoder&) = delete;
+
+  virtual int decode(const ObColumnCSDecoderCtx &ctx,
+      const int64_t row_id, common::ObDatum &datum) const override;
+  virtual int batch_decode(const ObColumnCSDecoderCtx &ctx, const int64_t *row_ids,
+      const int64_t row_cap, common::ObDatum *datums) const override;
+  virtual int decode_vector(const ObColumnCSDecoderCtx &ctx, ObVectorDecodeCtx &vector_ctx) const override;
+
+  virtual int get_null_count(const ObColumnCSDecoderCtx &ctx,
+     const int64_t *row_ids, const int64_t row_cap, int64_t &null_count) const override;
+
+  virtual ObCSColumnHeader::Type get_type() const override { return type_; }
+
+  virtual int pushdown_operator(
+      const sql::ObPushdownFilterExecutor *parent,
+      const ObColumnCSDecoderCtx &col_ctx,
+      const sql::ObWhiteFilterExecutor &filter,
+      const sql::PushdownFilterInfo &pd_filter_info,
+      common::ObBitmap &result_bitmap) const override;
+
+private:
+  template <typename Writer>
+  static int dispatch_decode_(const ObFsstColumnDecoderCtx &ctx, const int64_t *row_ids,
+                              const int64_t row_cap, Writer &writer);
+
+  static int nu_nn_operator(const ObFsstColumnDecoderCtx &ctx,
+                            const sql::ObWhiteFilterExecutor &filter,
+                            const sql::PushdownFilterInfo &pd_filter_info,
+                            common::ObBitmap &result_bitmap);
+
+  static int comparison_operator(const ObFsstColumnDecoderCtx &ctx,
+                                 const sql::ObWhiteFilterExecutor &filter,
+                                 const sql::PushdownFilterInfo &pd_filter_info,
+                                 common::ObBitmap &result_bitmap);
+
+  static int between_operator(const ObFsstColumnDecoderCtx &ctx,
+                              const sql::ObWhiteFilterExecutor &filter,
+                              const sql::PushdownFilterInfo &pd_filter_info,
+                              common::ObBitmap &result_bitmap);
+
+  static int in_operator(const ObFsstColumnDecoderCtx &ctx,
+                         const sql::ObWhiteFilterExecutor &filter,
+                         const sql::PushdownFilterInfo &pd_filter_info,
+                         common::ObBitmap &result_bitmap);
+
+  // compressing is deterministic, so equality can be checked on compressed bytes
+  // if the column is compared byte by byte
+  static bool can_compare_on_compressed(const ObFsstColumnDecoderCtx &ctx,
+                                        const sql::ObWhiteFilterExecutor &filter);
+
+  // set the not null rows whose compressed bytes equal to one of the compressed filter values,
+  // or equal to none of them if is_reverse
+  static int tranverse_compressed_equal_op(const ObFsstColumnDecoderCtx &ctx,
+                                           const common::ObString *compressed_values,
+                                           const int64_t value_cnt,
+                                           const bool is_reverse,
+                                           const sql::PushdownFilterInfo &pd_filter_info,
+                                           common::ObBitmap &result_bitmap);
+
+  static int compress_filter_values(const ObFsstColumnDecoderCtx &ctx,
+                                    const sql::ObWhiteFilterExecutor &filter,
+                                    common::ObString *compressed_values,
+                                    int64_t &value_cnt);
+
+  template<typename Operator>
+  static int tranverse_datum_all_op(const ObFsstColumnDecoderCtx &ctx,
+                                    const sql::PushdownFilterInfo &pd_filter_info,
+                                    common::ObBitmap &result_bitmap,
+                                    Operator const &eval);
+};
+
+}  // end namespace blocksstable
+}  // end namespace oceanbase
+
+#endif  // OCEANBASE_ENCODING_OB_FSST_COLUMN_DECODER_H_
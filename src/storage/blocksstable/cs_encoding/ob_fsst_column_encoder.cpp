@@ -0,0 +1,267 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX STORAGE
+
+#include "ob_fsst_column_encoder.h"
+#include "ob_cs_encoding_util.h"
+#include "lib/codec/ob_codecs.h"
+
+namespace oceanbase
+{
+namespace blocksstable
+{
+
+using namespace common;
+
+ObFsstColumnEncoder::ObFsstColumnEncoder()
+  : fsst_meta_(),
+    symbol_table_(),
+    enc_ctx_(),
+    integer_stream_encoder_(),
+    compressed_data_(nullptr),
+    end_offsets_(nullptr)
+{
+}
+
+ObFsstColumnEncoder::~ObFsstColumnEncoder() {}
+
+int ObFsstColumnEncoder::init(
+  const ObColumnCSEncodingCtx &ctx, const int64_t column_index, const int64_t row_count)
+{
+  int ret = OB_SUCCESS;
+  if (IS_INIT) {
+    ret = OB_INIT_TWICE;
+    LOG_WARN("init twice", K(ret));
+  } else if (OB_FAIL(ObIColumnCSEncoder::init(ctx, column_index, row_count))) {
+    LOG_WARN("init base column encoder failed", K(ret), K(ctx), K(column_index), K(row_count));
+  } else if (OB_UNLIKELY(ObStringSC != store_class_ || ctx.is_wide_int_)) {
+    ret = OB_NOT_SUPPORTED;
+    LOG_WARN("not supported store class", K(ret), K_(store_class), K_(column_type), K_(column_index));
+  } else {
+    column_header_.type_ = type_;
+    if (ctx_->null_cnt_ > 0) {
+      column_header_.set_has_null_bitmap();
+    }
+    if (OB_FAIL(do_init_())) {
+      LOG_WARN("fail to do init", K(ret));
+    } else {
+      LOG_DEBUG("init fsst column encoder", K(ret), K_(column_type), K_(column_index), K_(fsst_meta));
+    }
+  }
+  return ret;
+}
+
+void ObFsstColumnEncoder::reuse()
+{
+  ObIColumnCSEncoder::reuse();
+  fsst_meta_.reuse();
+  symbol_table_.reset();
+  enc_ctx_.reset();
+  integer_stream_encoder_.reuse();
+  compressed_data_ = nullptr;
+  end_offsets_ = nullptr;
+}
+
+int ObFsstColumnEncoder::do_init_()
+{
+  int ret = OB_SUCCESS;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else if (OB_FAIL(symbol_table_.build(*ctx_->col_datums_, row_count_,
+      ctx_->var_data_size_, *ctx_->allocator_))) {
+    LOG_WARN("fail to build symbol table", K(ret), K_(row_count), KPC_(ctx));
+  } else if (OB_FAIL(compress_datums_())) {
+    LOG_WARN("fail to compress datums", K(ret), K_(symbol_table));
+  } else if (OB_FAIL(enc_ctx_.build_offset_array_stream_meta(
+      fsst_meta_.compressed_data_len_, is_force_raw_))) {
+    LOG_WARN("fail to build_offset_array_stream_meta", K(ret), K_(fsst_meta));
+  } else if (OB_FAIL(enc_ctx_.build_stream_encoder_info(
+      false/*has_null*/,
+      true/*monotonic inc*/,
+      &ctx_->encoding_ctx_->cs_encoding_opt_,
+      ctx_->encoding_ctx_->previous_cs_encoding_.get_column_encoding(column_index_),
+      0/*stream_idx*/, ctx_->encoding_ctx_->compressor_type_, ctx_->allocator_))) {
+    LOG_WARN("fail to build_stream_encoder_info", K(ret));
+  } else {
+    int_stream_count_ = 1;
+  }
+  return ret;
+}
+
+int ObFsstColumnEncoder::compress_datums_()
+{
+  int ret = OB_SUCCESS;
+  // every byte is escaped in the worst case
+  const int64_t data_size = std::max(1L, ctx_->var_data_size_ * 2);
+  const int64_t offsets_size = sizeof(uint32_t) * row_count_;
+  if (OB_ISNULL(compressed_data_ = static_cast<char *>(ctx_->allocator_->alloc(data_size)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("fail to alloc", K(ret), K(data_size));
+  } else if (OB_ISNULL(end_offsets_ = static_cast<uint32_t *>(ctx_->allocator_->alloc(offsets_size)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("fail to alloc", K(ret), K(offsets_size));
+  } else {
+    int64_t pos = 0;
+    uint32_t max_string_len = 0;
+    for (int64_t i = 0; i < row_count_; ++i) {
+      const ObDatum &datum = ctx_->col_datums_->at(i);
+      if (!datum.is_null()) {
+        pos += symbol_table_.compress(datum.ptr_, datum.len_, compressed_data_ + pos);
+        max_string_len = std::max(max_string_len, static_cast<uint32_t>(datum.len_));
+      }
+      end_offsets_[i] = static_cast<uint32_t>(pos);
+    }
+    fsst_meta_.symbol_cnt_ = static_cast<uint8_t>(symbol_table_.get_symbol_cnt());
+    fsst_meta_.max_string_len_ = max_string_len;
+    fsst_meta_.compressed_data_len_ = static_cast<uint32_t>(pos);
+  }
+  return ret;
+}
+
+int ObFsstColumnEncoder::store_column(ObMicroBufferWriter &buf_writer)
+{
+  int ret = OB_SUCCESS;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else if (OB_FAIL(store_fsst_meta_(buf_writer))) {
+    LOG_WARN("fail to store fsst meta", K(ret), K_(fsst_meta));
+  } else if (OB_FAIL(store_offsets_(buf_writer))) {
+    LOG_WARN("fail to store offsets", K(ret), K_(enc_ctx));
+  } else if (OB_FAIL(stream_offsets_.push_back(buf_writer.length()))) {
+    LOG_WARN("fail to push back", K(ret));
+  } else {
+    int_stream_encoding_types_[0] = enc_ctx_.meta_.get_encoding_type();
+  }
+  return ret;
+}
+
+int ObFsstColumnEncoder::store_fsst_meta_(ObMicroBufferWriter &buf_writer)
+{
+  int ret = OB_SUCCESS;
+  const int64_t symbol_cnt = fsst_meta_.symbol_cnt_;
+  if (OB_FAIL(buf_writer.write(&fsst_meta_, sizeof(ObFsstEncodingMeta)))) {
+    LOG_WARN("fail to write fsst meta", K(ret), K(buf_writer));
+  } else if (OB_FAIL(buf_writer.write(symbol_table_.get_symbol_lens(), sizeof(uint8_t) * symbol_cnt))) {
+    LOG_WARN("fail to write symbol lens", K(ret), K(symbol_cnt));
+  } else if (OB_FAIL(buf_writer.write(symbol_table_.get_symbols(),
+      ObFsstEncodingMeta::MAX_SYMBOL_LENGTH * symbol_cnt))) {
+    LOG_WARN("fail to write symbols", K(ret), K(symbol_cnt));
+  } else if (OB_FAIL(store_null_bitamp(buf_writer))) {
+    LOG_WARN("fail to store null bitmap", K(ret));
+  } else if (OB_FAIL(buf_writer.write(compressed_data_, fsst_meta_.compressed_data_len_))) {
+    LOG_WARN("fail to write compressed data", K(ret), K_(fsst_meta));
+  }
+  return ret;
+}
+
+int ObFsstColumnEncoder::store_offsets_(ObMicroBufferWriter &buf_writer)
+{
+  int ret = OB_SUCCESS;
+  switch (enc_ctx_.meta_.get_width_tag()) {
+    case ObIntegerStream::UintWidth::UW_1_BYTE : {
+      ret = do_store_offsets_<uint8_t>(buf_writer);
+      break;
+    }
+    case ObIntegerStream::UintWidth::UW_2_BYTE : {
+      ret = do_store_offsets_<uint16_t>(buf_writer);
+      break;
+    }
+    case ObIntegerStream::UintWidth::UW_4_BYTE : {
+      ret = do_store_offsets_<uint32_t>(buf_writer);
+      break;
+    }
+    case ObIntegerStream::UintWidth::UW_8_BYTE : {
+      ret = do_store_offsets_<uint64_t>(buf_writer);
+      break;
+    }
+    default : {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("unexpected width", K(ret), K_(enc_ctx));
+    }
+  }
+  return ret;
+}
+
+template <typename T>
+int ObFsstColumnEncoder::do_store_offsets_(ObMicroBufferWriter &buf_writer)
+{
+  int ret = OB_SUCCESS;
+  T *offset_arr = nullptr;
+  const int64_t alloc_size = sizeof(T) * row_count_;
+  if (OB_ISNULL(offset_arr = static_cast<T *>(ctx_->allocator_->alloc(alloc_size)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("fail to alloc", K(ret), K(alloc_size));
+  } else {
+    for (int64_t i = 0; i < row_count_; ++i) {
+      offset_arr[i] = static_cast<T>(end_offsets_[i]);
+    }
+    if (OB_FAIL(integer_stream_encoder_.encode(enc_ctx_, offset_arr, row_count_, buf_writer))) {
+      LOG_WARN("fail to encode stream", K(ret), K_(enc_ctx));
+    }
+  }
+  return ret;
+}
+
+int64_t ObFsstColumnEncoder::estimate_store_size() const
+{
+  int64_t size = INT64_MAX;
+  if (!is_inited_) {
+  } else if (is_force_raw_) {
+  } else {
+    const int64_t avg_length = fsst_meta_.compressed_data_len_ / row_count_;
+    size = sizeof(ObFsstEncodingMeta) + fsst_meta_.get_symbol_table_size()
+        + fsst_meta_.compressed_data_len_
+        + ObCSEncodingUtil::get_bit_size(avg_length) * row_count_ / CHAR_BIT;
+    if (column_header_.has_null_bitmap()) {
+      size += ObCSEncodingUtil::get_bitmap_byte_size(row_count_);
+    }
+  }
+  return size;
+}
+
+int ObFsstColumnEncoder::get_identifier_and_stream_types(
+    ObColumnEncodingIdentifier &identifier, const ObIntegerStream::EncodingType *&types) const
+{
+  int ret = OB_SUCCESS;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else {
+    identifier.set(type_, int_stream_count_, 0);
+    types = int_stream_encoding_types_;
+  }
+  return ret;
+}
+
+int ObFsstColumnEncoder::get_maximal_encoding_store_size(int64_t &size) const
+{
+  int ret = OB_SUCCESS;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else {
+    size = sizeof(ObFsstEncodingMeta) + fsst_meta_.get_symbol_table_size()
+        + fsst_meta_.compressed_data_len_ + sizeof(ObIntegerStreamMeta)
+        + common::ObCodec::get_moderate_encoding_size(enc_ctx_.meta_.get_uint_width_size() * row_count_);
+    if (column_header_.has_null_bitmap()) {
+      size += ObCSEncodingUtil::get_bitmap_byte_size(row_count_);
+    }
+    size = std::min(size, ObCSEncodingUtil::MAX_COLUMN_ENCODING_STORE_SIZE);
+  }
+  return ret;
+}
+
+}  // end namespace blocksstable
+}  // end namespace oceanbase
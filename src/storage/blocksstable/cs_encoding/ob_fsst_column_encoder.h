@@ -0,0 +1,76 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_ENCODING_OB_FSST_COLUMN_ENCODER_H_
+#define OCEANBASE_ENCODING_OB_FSST_COLUMN_ENCODER_H_
+
+#include "ob_icolumn_cs_encoder.h"
+#include "ob_integer_stream_encoder.h"
+#include "ob_fsst_symbol_table.h"
+
+namespace oceanbase
+{
+namespace blocksstable
+{
+
+// Compress each string with a symbol table built from the strings of this column.
+// The compressed data is stored in column meta rather than in the all string data,
+// so that a single row can be decompressed without decompressing the whole block.
+class ObFsstColumnEncoder : public ObIColumnCSEncoder
+{
+public:
+  static const ObCSColumnHeader::Type type_ = ObCSColumnHeader::FSST;
+  ObFsstColumnEncoder();
+  virtual ~ObFsstColumnEncoder();
+
+  ObFsstColumnEncoder(const ObFsstColumnEncoder&) = delete;
+  ObFsstColumnEncoder &operator=(const ObFsstColumnEncoder&) = delete;
+
+  int init(
+    const ObColumnCSEncodingCtx &ctx, const int64_t column_index, const int64_t row_count) override;
+  void reuse() override;
+  int store_column(ObMicroBufferWriter &buf_writer) override;
+  int64_t estimate_store_size() const override;
+  ObCSColumnHeader::Type get_type() const override { return type_; }
+  int get_identifier_and_stream_types(
+      ObColumnEncodingIdentifier &identifier, const ObIntegerStream::EncodingType *&types) const override;
+  int get_maximal_encoding_store_size(int64_t &size) const override;
+  int get_string_data_len(uint32_t &len) const override
+  {
+    len = 0;
+    return OB_SUCCESS;
+  }
+
+  INHERIT_TO_STRING_KV("ICSColumnEncoder", ObIColumnCSEncoder,
+    K_(fsst_meta), K_(symbol_table), K_(enc_ctx));
+
+private:
+  int do_init_();
+  int compress_datums_();
+  int store_fsst_meta_(ObMicroBufferWriter &buf_writer);
+  int store_offsets_(ObMicroBufferWriter &buf_writer);
+  template <typename T>
+  int do_store_offsets_(ObMicroBufferWriter &buf_writer);
+
+private:
+  ObFsstEncodingMeta fsst_meta_;
+  ObFsstSymbolTable symbol_table_;
+  ObIntegerStreamEncoderCtx enc_ctx_;
+  ObIntegerStreamEncoder integer_stream_encoder_;
+  char *compressed_data_;
+  uint32_t *end_offsets_;
+};
+
+}  // end namespace blocksstable
+}  // end namespace oceanbase
+
+#endif  // OCEANBASE_ENCODING_OB_FSST_COLUMN_ENCODER_H_
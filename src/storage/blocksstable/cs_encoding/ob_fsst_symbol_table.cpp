@@ -0,0 +1,195 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX STORAGE
+
+#include "ob_fsst_symbol_table.h"
+#include <algorithm>
+
+namespace oceanbase
+{
+namespace blocksstable
+{
+
+using namespace common;
+
+void ObFsstSymbolTable::reset()
+{
+  symbol_cnt_ = 0;
+  MEMSET(lens_, 0, sizeof(lens_));
+  MEMSET(symbols_, 0, sizeof(symbols_));
+  MEMSET(bucket_begin_, 0, sizeof(bucket_begin_));
+  MEMSET(bucket_codes_, 0, sizeof(bucket_codes_));
+}
+
+int ObFsstSymbolTable::build(const ObColDatums &datums, const int64_t row_count,
+    const int64_t var_data_size, ObIAllocator &allocator)
+{
+  int ret = OB_SUCCESS;
+  const int64_t candidates_size = sizeof(Candidate) * CANDIDATE_TABLE_SIZE;
+  Candidate *candidates = nullptr;
+  reset();
+  if (OB_UNLIKELY(row_count <= 0 || var_data_size < 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), K(row_count), K(var_data_size));
+  } else if (OB_ISNULL(candidates = static_cast<Candidate *>(allocator.alloc(candidates_size)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("fail to alloc", K(ret), K(candidates_size));
+  } else {
+    // sample rows evenly, the sampled rows are the same in each generation
+    const int64_t step = std::max(1L, var_data_size / MAX_SAMPLE_BYTES);
+    for (int64_t gen = 0; gen < GENERATION_COUNT; ++gen) {
+      MEMSET(candidates, 0, candidates_size);
+      int64_t sample_bytes = 0;
+      for (int64_t i = 0; i < row_count && sample_bytes < MAX_SAMPLE_BYTES; i += step) {
+        const ObDatum &datum = datums.at(i);
+        if (!datum.is_null()) {
+          const char *str = datum.ptr_;
+          const int64_t len = datum.len_;
+          uint64_t prev_symbol = 0;
+          uint8_t prev_len = 0;
+          int64_t pos = 0;
+          while (pos < len) {
+            uint8_t code = 0;
+            uint64_t cur_symbol = 0;
+            uint8_t cur_len = static_cast<uint8_t>(find_longest_symbol_(str + pos, len - pos, code));
+            if (0 == cur_len) {
+              cur_len = 1;
+              cur_symbol = static_cast<uint8_t>(str[pos]);
+            } else {
+              cur_symbol = symbols_[code];
+            }
+            add_candidate_(candidates, cur_symbol, cur_len);
+            // extend the previous symbol with the current one
+            if (prev_len > 0 && prev_len + cur_len <= ObFsstEncodingMeta::MAX_SYMBOL_LENGTH) {
+              add_candidate_(candidates, prev_symbol | (cur_symbol << (prev_len * CHAR_BIT)),
+                             prev_len + cur_len);
+            }
+            prev_symbol = cur_symbol;
+            prev_len = cur_len;
+            pos += cur_len;
+          }
+          sample_bytes += len;
+        }
+      }
+      choose_symbols_(candidates);
+    }
+    allocator.free(candidates);
+    LOG_DEBUG("build fsst symbol table", K(row_count), K(var_data_size), K_(symbol_cnt));
+  }
+  return ret;
+}
+
+void ObFsstSymbolTable::add_candidate_(
+    Candidate *candidates, const uint64_t symbol, const uint8_t len) const
+{
+  const uint64_t hash = (symbol * 0x9E3779B97F4A7C15ULL) ^ len;
+  bool found = false;
+  Candidate *victim = nullptr;
+  // probe a few slots only, the candidate replaces the probed one with the least gain if it
+  // gains more, otherwise it is dropped
+  for (int64_t i = 0; !found && i < MAX_CANDIDATE_PROBE_COUNT; ++i) {
+    Candidate &candidate = candidates[(hash + i) & (CANDIDATE_TABLE_SIZE - 1)];
+    if (0 == candidate.count_) {
+      candidate.symbol_ = symbol;
+      candidate.len_ = len;
+      candidate.count_ = 1;
+      found = true;
+    } else if (candidate.symbol_ == symbol && candidate.len_ == len) {
+      ++candidate.count_;
+      found = true;
+    } else if (nullptr == victim
+               || static_cast<uint64_t>(candidate.count_) * candidate.len_
+                  < static_cast<uint64_t>(victim->count_) * victim->len_) {
+      victim = &candidate;
+    }
+  }
+  if (!found && static_cast<uint64_t>(victim->count_) * victim->len_ < len) {
+    victim->symbol_ = symbol;
+    victim->len_ = len;
+    victim->count_ = 1;
+  }
+}
+
+void ObFsstSymbolTable::choose_symbols_(Candidate *candidates)
+{
+  // a single byte is escaped with 2 bytes if there is no symbol for it, so its gain is 1 per occurrence
+  std::sort(candidates, candidates + CANDIDATE_TABLE_SIZE,
+      [](const Candidate &l, const Candidate &r) {
+        const uint64_t l_gain = static_cast<uint64_t>(l.count_) * l.len_;
+        const uint64_t r_gain = static_cast<uint64_t>(r.count_) * r.len_;
+        return l_gain > r_gain || (l_gain == r_gain && l.symbol_ < r.symbol_);
+      });
+  symbol_cnt_ = 0;
+  MEMSET(symbols_, 0, sizeof(symbols_));
+  for (int64_t i = 0; i < CANDIDATE_TABLE_SIZE && symbol_cnt_ < ObFsstEncodingMeta::MAX_SYMBOL_COUNT; ++i) {
+    const Candidate &candidate = candidates[i];
+    if (candidate.count_ > 1 || (candidate.count_ > 0 && candidate.len_ > 1)) {
+      lens_[symbol_cnt_] = candidate.len_;
+      symbols_[symbol_cnt_] = candidate.symbol_;
+      ++symbol_cnt_;
+    }
+  }
+  build_index_();
+}
+
+void ObFsstSymbolTable::load(const int64_t symbol_cnt, const uint8_t *symbol_lens, const char *symbols)
+{
+  reset();
+  symbol_cnt_ = symbol_cnt > ObFsstEncodingMeta::MAX_SYMBOL_COUNT ? ObFsstEncodingMeta::MAX_SYMBOL_COUNT : symbol_cnt;
+  MEMCPY(lens_, symbol_lens, symbol_cnt_);
+  MEMCPY(symbols_, symbols, symbol_cnt_ * ObFsstEncodingMeta::MAX_SYMBOL_LENGTH);
+  build_index_();
+}
+
+void ObFsstSymbolTable::build_index_()
+{
+  uint16_t bucket_cnt[UINT8_MAX + 1];
+  MEMSET(bucket_cnt, 0, sizeof(bucket_cnt));
+  for (int64_t code = 0; code < symbol_cnt_; ++code) {
+    bucket_codes_[code] = static_cast<uint8_t>(code);
+    ++bucket_cnt[symbols_[code] & UINT8_MAX];
+  }
+  bucket_begin_[0] = 0;
+  for (int64_t i = 0; i <= UINT8_MAX; ++i) {
+    bucket_begin_[i + 1] = bucket_begin_[i] + bucket_cnt[i];
+  }
+  // the first match in a bucket is the longest one
+  std::sort(bucket_codes_, bucket_codes_ + symbol_cnt_,
+      [this](const uint8_t l, const uint8_t r) {
+        const uint8_t l_first = symbols_[l] & UINT8_MAX;
+        const uint8_t r_first = symbols_[r] & UINT8_MAX;
+        return l_first < r_first
+            || (l_first == r_first && (lens_[l] > lens_[r] || (lens_[l] == lens_[r] && l < r)));
+      });
+}
+
+int64_t ObFsstSymbolTable::compress(const char *str, const int64_t len, char *out) const
+{
+  int64_t out_pos = 0;
+  int64_t pos = 0;
+  while (pos < len) {
+    uint8_t code = 0;
+    const int64_t matched_len = find_longest_symbol_(str + pos, len - pos, code);
+    if (0 == matched_len) {
+      out[out_pos++] = static_cast<char>(ObFsstEncodingMeta::ESCAPE_CODE);
+      out[out_pos++] = str[pos++];
+    } else {
+      out[out_pos++] = static_cast<char>(code);
+      pos += matched_len;
+    }
+  }
+  return out_pos;
+}
+
+}  // end namespace blocksstable
+}  // end namespace oceanbase
@@ -0,0 +1,125 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_ENCODING_OB_FSST_SYMBOL_TABLE_H_
+#define OCEANBASE_ENCODING_OB_FSST_SYMBOL_TABLE_H_
+
+#include "ob_column_encoding_struct.h"
+#include "storage/blocksstable/encoding/ob_encoding_util.h"
+
+namespace oceanbase
+{
+namespace blocksstable
+{
+
+// Symbol table of FSST (fast static symbol table) string compression.
+// Strings are compressed greedily with the longest matched symbol, so the compressed bytes of
+// a string are determined by the table, which makes equality comparison on compressed bytes possible.
+class ObFsstSymbolTable
+{
+public:
+  static const int64_t MAX_SAMPLE_BYTES = 16 << 10;
+  static const int64_t GENERATION_COUNT = 5;
+  static const int64_t CANDIDATE_TABLE_SIZE = 4096;
+  static const int64_t MAX_CANDIDATE_PROBE_COUNT = 16;
+
+  ObFsstSymbolTable() { reset(); }
+  ~ObFsstSymbolTable() {}
+  void reset();
+
+  // build the table from sampled not null datums
+  int build(const ObColDatums &datums, const int64_t row_count,
+            const int64_t var_data_size, common::ObIAllocator &allocator);
+  // load the table from column meta
+  void load(const int64_t symbol_cnt, const uint8_t *symbol_lens, const char *symbols);
+  // the size of out must be at least 2 * len
+  int64_t compress(const char *str, const int64_t len, char *out) const;
+
+  OB_INLINE int64_t get_symbol_cnt() const { return symbol_cnt_; }
+  OB_INLINE const uint8_t *get_symbol_lens() const { return lens_; }
+  OB_INLINE const uint64_t *get_symbols() const { return symbols_; }
+
+  OB_INLINE static int64_t get_decompressed_len(
+      const uint8_t *symbol_lens, const unsigned char *codes, const int64_t code_len)
+  {
+    int64_t len = 0;
+    for (int64_t i = 0; i < code_len; ++i) {
+      if (ObFsstEncodingMeta::ESCAPE_CODE == codes[i]) {
+        ++len;
+        ++i;
+      } else {
+        len += symbol_lens[codes[i]];
+      }
+    }
+    return len;
+  }
+
+  OB_INLINE static int64_t decompress(const uint8_t *symbol_lens, const char *symbols,
+      const unsigned char *codes, const int64_t code_len, char *out)
+  {
+    int64_t pos = 0;
+    for (int64_t i = 0; i < code_len; ++i) {
+      const uint8_t code = codes[i];
+      if (ObFsstEncodingMeta::ESCAPE_CODE == code) {
+        out[pos++] = static_cast<char>(codes[++i]);
+      } else {
+        MEMCPY(out + pos, symbols + code * ObFsstEncodingMeta::MAX_SYMBOL_LENGTH, symbol_lens[code]);
+        pos += symbol_lens[code];
+      }
+    }
+    return pos;
+  }
+
+  TO_STRING_KV(K_(symbol_cnt));
+
+private:
+  struct Candidate
+  {
+    uint64_t symbol_;
+    uint32_t count_;
+    uint8_t len_;
+  };
+  // return matched length and 0 if no symbol matched
+  OB_INLINE int64_t find_longest_symbol_(const char *str, const int64_t remain, uint8_t &code) const;
+  void add_candidate_(Candidate *candidates, const uint64_t symbol, const uint8_t len) const;
+  void choose_symbols_(Candidate *candidates);
+  void build_index_();
+
+private:
+  int64_t symbol_cnt_;
+  uint8_t lens_[ObFsstEncodingMeta::MAX_SYMBOL_COUNT];
+  uint64_t symbols_[ObFsstEncodingMeta::MAX_SYMBOL_COUNT];
+  // codes grouped by the first byte of symbol, longer symbols come first in each group
+  uint16_t bucket_begin_[UINT8_MAX + 2];
+  uint8_t bucket_codes_[ObFsstEncodingMeta::MAX_SYMBOL_COUNT];
+};
+
+OB_INLINE int64_t ObFsstSymbolTable::find_longest_symbol_(
+    const char *str, const int64_t remain, uint8_t &code) const
+{
+  int64_t matched_len = 0;
+  const uint8_t first = static_cast<uint8_t>(str[0]);
+  for (int64_t i = bucket_begin_[first]; 0 == matched_len && i < bucket_begin_[first + 1]; ++i) {
+    const uint8_t cur_code = bucket_codes_[i];
+    const uint8_t len = lens_[cur_code];
+    if (len <= remain && 0 == MEMCMP(&symbols_[cur_code], str, len)) {
+      code = cur_code;
+      matched_len = len;
+    }
+  }
+  return matched_len;
+}
+
+}  // end namespace blocksstable
+}  // end namespace oceanbase
+
+#endif  // OCEANBASE_ENCODING_OB_FSST_SYMBOL_TABLE_H_
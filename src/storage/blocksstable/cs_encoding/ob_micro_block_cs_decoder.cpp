@@ -17,6 +17,8 @@
 #include "ob_dict_column_decoder.h"
 #include "ob_integer_column_decoder.h"
 #include "ob_string_column_decoder.h"
+#include "ob_float_column_decoder.h"
+#include "ob_fsst_column_decoder.h"
 #include "share/rc/ob_tenant_base.h"
 #include "storage/access/ob_pushdown_aggregate.h"
 #include "storage/access/ob_table_access_context.h"
@@ -231,6 +233,8 @@ static local_decode_acquire_func acquire_local_funcs_[ObCSColumnHeader::MAX_TYPE
     acquire_local_decoder<ObStringColumnDecoder>,
     acquire_local_decoder<ObIntDictColumnDecoder>,
     acquire_local_decoder<ObStrDictColumnDecoder>,
+    acquire_local_decoder<ObFloatColumnDecoder>,
+    acquire_local_decoder<ObFsstColumnDecoder>,
 };
 
 static local_decode_release_func release_local_funcs_[ObCSColumnHeader::MAX_TYPE] = {
@@ -238,6 +242,8 @@ static local_decode_release_func release_local_funcs_[ObCSColumnHeader::MAX_TYPE
     release_local_decoder<ObStringColumnDecoder>,
     release_local_decoder<ObIntDictColumnDecoder>,
     release_local_decoder<ObStrDictColumnDecoder>,
+    release_local_decoder<ObFloatColumnDecoder>,
+    release_local_decoder<ObFsstColumnDecoder>,
 };
 
 template <class Decoder>
@@ -788,6 +794,24 @@ int ObMicroBlockCSDecoder::acquire(
     }
     break;
   }
+  case ObCSColumnHeader::FLOAT: {
+    ObFloatColumnDecoder *d = NULL;
+    if (OB_FAIL(allocator.alloc(d))) {
+      LOG_WARN("alloc failed", K(ret));
+    } else {
+      decoder = d;
+    }
+    break;
+  }
+  case ObCSColumnHeader::FSST: {
+    ObFsstColumnDecoder *d = NULL;
+    if (OB_FAIL(allocator.alloc(d))) {
+      LOG_WARN("alloc failed", K(ret));
+    } else {
+      decoder = d;
+    }
+    break;
+  }
   default:
     ret = OB_INNER_STAT_ERROR;
     LOG_WARN("unsupported encoding type", K(ret), K(type));
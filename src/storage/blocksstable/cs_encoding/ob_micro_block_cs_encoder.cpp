@@ -17,6 +17,8 @@
 #include "ob_cs_encoding_util.h"
 #include "ob_icolumn_cs_encoder.h"
 #include "ob_integer_column_encoder.h"
+#include "ob_float_column_encoder.h"
+#include "ob_fsst_column_encoder.h"
 #include "ob_integer_stream_encoder.h"
 #include "share/config/ob_server_config.h"
 #include "share/ob_force_print_log.h"
@@ -1087,6 +1089,10 @@ int ObMicroBlockCSEncoder::choose_specified_encoder_(const int64_t column_idx,
       if (OB_FAIL(alloc_and_init_encoder_<ObIntDictColumnEncoder>(column_idx, e))) {
         LOG_WARN("fail to alloc encoder", K(ret), K(column_idx), K(store_class));
       }
+    } else if (ObCSColumnHeader::Type::FLOAT == type && is_float_column_(column_idx)) {
+      if (OB_FAIL(alloc_and_init_encoder_<ObFloatColumnEncoder>(column_idx, e))) {
+        LOG_WARN("fail to alloc encoder", K(ret), K(column_idx), K(store_class));
+      }
     } else {
       ret = OB_ERR_UNEXPECTED;
       LOG_WARN("specified unexpected econding type", K(ret), K(column_idx), K(store_class), K(col_ctx));
@@ -1100,6 +1106,10 @@ int ObMicroBlockCSEncoder::choose_specified_encoder_(const int64_t column_idx,
       if (OB_FAIL(alloc_and_init_encoder_<ObStrDictColumnEncoder>(column_idx, e))) {
         LOG_WARN("fail to alloc encoder", K(ret), K(column_idx), K(store_class));
       }
+    } else if (ObCSColumnHeader::Type::FSST == type && is_fsst_column_(column_idx)) {
+      if (OB_FAIL(alloc_and_init_encoder_<ObFsstColumnEncoder>(column_idx, e))) {
+        LOG_WARN("fail to alloc encoder", K(ret), K(column_idx), K(store_class));
+      }
     } else {
       ret = OB_ERR_UNEXPECTED;
       LOG_WARN("specified unexpected econding type", K(ret), K(type), K(store_class), K(col_ctx));
@@ -1178,6 +1188,30 @@ int ObMicroBlockCSEncoder::choose_encoder_for_integer_(
        K(integer_estimate_size), K(dict_estimate_size), KPC(integer_encoder), KPC(dict_encoder));
   }
 
+  if (OB_SUCC(ret) && is_float_column_(column_idx) && !col_ctxs_.at(column_idx).force_raw_encoding_
+      && ctx_.major_working_cluster_version_ >= DATA_VERSION_4_3_0_0) {
+    // integer encoder on the raw bits is the xor fallback for float values,
+    // float encoding can not be decoded by old observers, e is freed by the caller if fail
+    ObIColumnCSEncoder *float_encoder = nullptr;
+    integer_encoder = nullptr;
+    dict_encoder = nullptr;
+    if (OB_FAIL(alloc_and_init_encoder_<ObFloatColumnEncoder>(column_idx, float_encoder))) {
+      LOG_WARN("fail to alloc encoder", K(ret), K(column_idx));
+    } else {
+      const int64_t float_estimate_size = float_encoder->estimate_store_size();
+      const int64_t chosen_estimate_size = e->estimate_store_size();
+      if (float_estimate_size < chosen_estimate_size) {
+        free_encoder_(e);
+        e = float_encoder;
+      } else {
+        free_encoder_(float_encoder);
+      }
+      float_encoder = nullptr;
+      LOG_DEBUG("choose encoder for float", K(column_idx), K(float_estimate_size),
+          K(chosen_estimate_size), KPC(e));
+    }
+  }
+
   if (OB_FAIL(ret)) {
     if (nullptr != integer_encoder) {
       free_encoder_(integer_encoder);
@@ -1219,6 +1253,30 @@ int ObMicroBlockCSEncoder::choose_encoder_for_string_(
       K(string_estimate_size), K(dict_estimate_size), KPC(string_encoder), KPC(dict_encoder));
   }
 
+  if (OB_SUCC(ret) && is_fsst_column_(column_idx) && !col_ctxs_.at(column_idx).force_raw_encoding_
+      && ctx_.major_working_cluster_version_ >= DATA_VERSION_4_3_0_0) {
+    // fsst keeps strings randomly accessible without decompressing the whole string data,
+    // fsst encoding can not be decoded by old observers, e is freed by the caller if fail
+    ObIColumnCSEncoder *fsst_encoder = nullptr;
+    string_encoder = nullptr;
+    dict_encoder = nullptr;
+    if (OB_FAIL(alloc_and_init_encoder_<ObFsstColumnEncoder>(column_idx, fsst_encoder))) {
+      LOG_WARN("fail to alloc encoder", K(ret), K(column_idx));
+    } else {
+      const int64_t fsst_estimate_size = fsst_encoder->estimate_store_size();
+      const int64_t chosen_estimate_size = e->estimate_store_size();
+      if (fsst_estimate_size < chosen_estimate_size) {
+        free_encoder_(e);
+        e = fsst_encoder;
+      } else {
+        free_encoder_(fsst_encoder);
+      }
+      fsst_encoder = nullptr;
+      LOG_DEBUG("choose encoder for fsst", K(column_idx), K(fsst_estimate_size),
+          K(chosen_estimate_size), KPC(e));
+    }
+  }
+
   if (OB_FAIL(ret)) {
     if (nullptr != string_encoder) {
       free_encoder_(string_encoder);
@@ -112,10 +112,20 @@ private:
   {
     return ObCSEncodingUtil::is_integer_store_class(sc) || (sc == ObDecimalIntSC && !is_wide_int);
   }
+  OB_INLINE bool is_float_column_(const int64_t column_idx) const
+  {
+    const ObObjTypeClass tc = ctx_.col_descs_->at(column_idx).col_type_.get_type_class();
+    return ObFloatTC == tc || ObDoubleTC == tc;
+  }
   static OB_INLINE bool is_string_store_(const ObObjTypeStoreClass sc, const bool is_wide_int)
   {
     return ObCSEncodingUtil::is_string_store_class(sc) || is_wide_int;
   }
+  OB_INLINE bool is_fsst_column_(const int64_t column_idx) const
+  {
+    const ObObjTypeClass tc = ctx_.col_descs_->at(column_idx).col_type_.get_type_class();
+    return ObStringSC == get_store_class_map()[tc] && !col_ctxs_.at(column_idx).is_wide_int_;
+  }
 
 private:
   compaction::ObLocalArena allocator_;
@@ -68,7 +68,10 @@ int ObSkipIndexFilterExecutor::falsifiable_pushdown_filter(
         if (filter.is_filter_dynamic_node()) {
           sql::ObDynamicFilterExecutor &dynamic_filter =
               static_cast<sql::ObDynamicFilterExecutor &>(filter);
-          if (!dynamic_filter.is_data_prepared()) {
+          if (!dynamic_filter.is_data_prepared() &&
+              OB_FAIL(dynamic_filter.prepare_skipping_index_data())) {
+            LOG_WARN("Fail to prepare runtime filter data", K(ret), K(col_idx));
+          } else if (!dynamic_filter.is_data_prepared()) {
             filter.get_filter_bool_mask().set_uncertain();
           } else if (dynamic_filter.is_filter_all_data()) {
             filter.get_filter_bool_mask().set_always_false();
@@ -447,6 +450,11 @@ int ObSkipIndexFilterExecutor::in_operator(const sql::ObWhiteFilterExecutor &fil
   if (OB_UNLIKELY(datums.count() == 0 || filter.null_param_contained())){
     ret = OB_INVALID_ARGUMENT;
     LOG_WARN("Invalid argument for falsifiable IN operator", K(ret), K(filter));
+  } else if (filter.is_filter_dynamic_node() &&
+             static_cast<const sql::ObDynamicFilterExecutor &>(filter).is_in_params_sorted()) {
+    if (OB_FAIL(sorted_in_operator(filter, min_datum, max_datum, fal_desc))) {
+      LOG_WARN("Failed to run sorted IN operator", K(ret));
+    }
   } else {
     const int ref_count = datums.count();
     ObDatumCmpFuncType cmp_func = filter.cmp_func_;
@@ -481,6 +489,49 @@ int ObSkipIndexFilterExecutor::in_operator(const sql::ObWhiteFilterExecutor &fil
   return ret;
 }
 
+// IN params of runtime filter are sorted, find the first param not less than min_datum,
+// the block contains none of the params if it is greater than max_datum.
+int ObSkipIndexFilterExecutor::sorted_in_operator(const sql::ObWhiteFilterExecutor &filter,
+                                                  const common::ObDatum &min_datum,
+                                                  const common::ObDatum &max_datum,
+                                                  sql::ObBoolMask &fal_desc)
+{
+  int ret = OB_SUCCESS;
+  const common::ObIArray<common::ObDatum> &datums = filter.get_datums();
+  ObDatumCmpFuncType cmp_func = filter.cmp_func_;
+  int64_t low = 0;
+  int64_t high = datums.count();
+  int cmp_res = 0;
+  while (OB_SUCC(ret) && low < high) {
+    const int64_t mid = low + (high - low) / 2;
+    if (OB_FAIL(cmp_func(min_datum, datums.at(mid), cmp_res))) {
+      LOG_WARN("Failed to compare datum", K(ret), K(min_datum), K(mid), K(datums.at(mid)));
+    } else if (cmp_res > 0) {
+      low = mid + 1;
+    } else {
+      high = mid;
+    }
+  }
+  if (OB_FAIL(ret)) {
+  } else if (low == datums.count()) {
+    fal_desc.set_always_false();
+  } else if (OB_FAIL(cmp_func(max_datum, datums.at(low), cmp_res))) {
+    LOG_WARN("Failed to compare datum", K(ret), K(max_datum), K(low), K(datums.at(low)));
+  } else if (cmp_res < 0) {
+    fal_desc.set_always_false();
+  } else if (OB_FAIL(cmp_func(min_datum, datums.at(low), cmp_res))) {
+    LOG_WARN("Failed to compare datum", K(ret), K(min_datum), K(low), K(datums.at(low)));
+  } else if (0 == cmp_res && OB_FAIL(cmp_func(max_datum, datums.at(low), cmp_res))) {
+    LOG_WARN("Failed to compare datum", K(ret), K(max_datum), K(low), K(datums.at(low)));
+  } else if (0 == cmp_res) {
+    // min == max == param
+    fal_desc.set_always_true();
+  } else {
+    fal_desc.set_uncertain();
+  }
+  return ret;
+}
+
 int ObSkipIndexFilterExecutor::bt_operator(const sql::ObWhiteFilterExecutor &filter,
                                            const common::ObDatum &min_datum,
                                            const common::ObDatum &max_datum,
@@ -99,6 +99,10 @@ private:
                   const common::ObDatum &min_datum,
                   const common::ObDatum &max_datum,
                   sql::ObBoolMask &fal_desc);
+  int sorted_in_operator(const sql::ObWhiteFilterExecutor &filter,
+                         const common::ObDatum &min_datum,
+                         const common::ObDatum &max_datum,
+                         sql::ObBoolMask &fal_desc);
 private:
   ObAggRowReader agg_row_reader_;
   ObSkipIndexColMeta meta_;
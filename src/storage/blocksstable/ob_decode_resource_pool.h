@@ -46,7 +46,8 @@ public:
                    str_diff_pool_(), hex_str_pool_(), str_prefix_pool_(),
                    column_equal_pool_(), column_substr_pool_(), ctx_block_pool_(),
                    cs_integer_pool_(), cs_string_pool_(), cs_int_dict_pool_(),
-                   cs_str_dict_pool_(), cs_ctx_block_pool_(), is_inited_(false) {}
+                   cs_str_dict_pool_(), cs_float_pool_(), cs_fsst_pool_(), cs_ctx_block_pool_(),
+                   is_inited_(false) {}
   ~ObDecodeResourcePool();
   static int mtl_init(ObDecodeResourcePool *&ctx_array_pool);
   void destroy();
@@ -84,6 +85,8 @@ private:
   ObSmallObjPool<ObStringColumnDecoder> cs_string_pool_;
   ObSmallObjPool<ObIntDictColumnDecoder> cs_int_dict_pool_;
   ObSmallObjPool<ObStrDictColumnDecoder> cs_str_dict_pool_;
+  ObSmallObjPool<ObFloatColumnDecoder> cs_float_pool_;
+  ObSmallObjPool<ObFsstColumnDecoder> cs_fsst_pool_;
   ObSmallObjPool<ObColumnCSDecoderCtxBlock> cs_ctx_block_pool_;
   bool is_inited_;
 };
@@ -144,7 +147,8 @@ public:
   void reset();
 private:
   constexpr static int16_t MAX_CS_CNTS[ObCSColumnHeader::MAX_TYPE] =
-      {MAX_CS_FREE_CNT, MAX_CS_FREE_CNT, MAX_CS_FREE_CNT, MAX_CS_FREE_CNT};
+      {MAX_CS_FREE_CNT, MAX_CS_FREE_CNT, MAX_CS_FREE_CNT, MAX_CS_FREE_CNT, MAX_CS_FREE_CNT,
+       MAX_CS_FREE_CNT};
   template <typename T>
   inline int alloc_miss_cache(T *&item);
   inline bool has_decoder(const ObCSColumnHeader::Type &type) const;
@@ -159,6 +163,8 @@ private:
   ObIColumnCSDecoder* cs_string_pool_[MAX_CS_CNTS[ObCSColumnHeader::STRING]];
   ObIColumnCSDecoder* cs_int_dict_pool_[MAX_CS_CNTS[ObCSColumnHeader::INT_DICT]];
   ObIColumnCSDecoder* cs_str_dict_pool_[MAX_CS_CNTS[ObCSColumnHeader::INT_DICT]];
+  ObIColumnCSDecoder* cs_float_pool_[MAX_CS_CNTS[ObCSColumnHeader::FLOAT]];
+  ObIColumnCSDecoder* cs_fsst_pool_[MAX_CS_CNTS[ObCSColumnHeader::FSST]];
   ObIColumnCSDecoder** pools_[ObCSColumnHeader::MAX_TYPE];
   int16_t free_cnts_[ObCSColumnHeader::MAX_TYPE];
 };
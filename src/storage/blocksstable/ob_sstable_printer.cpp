@@ -665,6 +665,18 @@ void ObSSTablePrinter::print_cs_encoding_column_meta(
     print_line("dict_meta.attrs", dict_meta->attrs_);
     print_line("dict_meta.distinct_val_cnt", dict_meta->distinct_val_cnt_);
     print_line("dict_meta.ref_row_cnt", dict_meta->ref_row_cnt_);
+  } else if (ObCSColumnHeader::Type::FLOAT == type) {
+    const ObFloatEncodingMeta *float_meta = reinterpret_cast<const ObFloatEncodingMeta *>(start);
+    print_line("float_meta.version", float_meta->version_);
+    print_line("float_meta.exponent", float_meta->exponent_);
+    print_line("float_meta.factor", float_meta->factor_);
+    print_line("float_meta.exception_cnt", float_meta->exception_cnt_);
+  } else if (ObCSColumnHeader::Type::FSST == type) {
+    const ObFsstEncodingMeta *fsst_meta = reinterpret_cast<const ObFsstEncodingMeta *>(start);
+    print_line("fsst_meta.version", fsst_meta->version_);
+    print_line("fsst_meta.symbol_cnt", fsst_meta->symbol_cnt_);
+    print_line("fsst_meta.max_string_len", fsst_meta->max_string_len_);
+    print_line("fsst_meta.compressed_data_len", fsst_meta->compressed_data_len_);
   } else {
     print_line("has_nullbitmap", (0 != len));
   }
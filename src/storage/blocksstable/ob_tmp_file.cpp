@@ -503,6 +503,31 @@ int ObTmpFileExtent::read(const ObTmpFileIOInfo &io_info, const int64_t offset,
   return ret;
 }
 
+int ObTmpFileExtent::read_ahead(const ObTmpFileIOInfo &io_info, const int64_t offset,
+    const int64_t size, ObMacroBlockHandle &mb_handle)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(!is_alloced_)) {
+    ret = OB_ERR_UNEXPECTED;
+    STORAGE_LOG(WARN, "ObTmpFileExtent has not been allocated", K(ret));
+  } else if (OB_UNLIKELY(offset < 0 || size <= 0 || offset + size > get_offset())) {
+    ret = OB_INVALID_ARGUMENT;
+    STORAGE_LOG(WARN, "invalid argument", K(ret), K(offset), K(get_offset()), K(size));
+  } else {
+    ObTmpBlockIOInfo info;
+    info.io_desc_ = io_info.io_desc_;
+    info.block_id_ = block_id_;
+    info.offset_ = start_page_id_ * ObTmpMacroBlock::get_default_page_size() + offset;
+    info.size_ = size;
+    info.tenant_id_ = io_info.tenant_id_;
+    info.io_timeout_ms_ = io_info.io_timeout_ms_;
+    if (OB_FAIL(OB_TMP_FILE_STORE.read_ahead(owner_->get_tenant_id(), info, mb_handle))) {
+      STORAGE_LOG(WARN, "fail to read ahead the extent", K(ret), K(info), K(*this));
+    }
+  }
+  return ret;
+}
+
 int ObTmpFileExtent::write(const ObTmpFileIOInfo &io_info,int64_t &size, char *&buf)
 {
   int ret = OB_SUCCESS;
@@ -726,7 +751,9 @@ ObTmpFile::ObTmpFile()
     allocator_(NULL),
     file_meta_(),
     read_guard_(0),
-    next_truncated_extent_id_(0)
+    next_truncated_extent_id_(0),
+    read_ahead_end_(0),
+    read_ahead_handle_()
 {
 }
 
@@ -749,6 +776,8 @@ int ObTmpFile::clear()
       is_inited_ = false;
       read_guard_ = 0;
       next_truncated_extent_id_ = 0;
+      read_ahead_end_ = 0;
+      read_ahead_handle_.reset();
     }
   }
   return ret;
@@ -944,6 +973,47 @@ int ObTmpFile::once_aio_read_batch_without_lock(
   return ret;
 }
 
+int ObTmpFile::read_ahead_without_lock(const ObTmpFileIOInfo &io_info)
+{
+  int ret = OB_SUCCESS;
+  common::ObIArray<ObTmpFileExtent *> &extents = file_meta_.get_extents();
+  const int64_t start = MAX(MAX(offset_, read_ahead_end_), read_guard_);
+  int64_t ith_extent = -1;
+  ObTmpFileExtent *tmp = nullptr;
+  if (offset_ + READ_AHEAD_SIZE / 2 < read_ahead_end_ || !read_ahead_handle_.is_finished()) {
+    // enough pages after the read offset are loaded or being loaded.
+  } else if (OB_ISNULL(tmp = file_meta_.get_last_extent()) || start >= tmp->get_global_end()) {
+    // nothing to read ahead.
+  } else {
+    ith_extent = find_first_extent(start);
+    while (ith_extent < extents.count() && extents.at(ith_extent)->get_global_end() <= start) {
+      ++ith_extent;
+    }
+  }
+
+  if (OB_FAIL(ret) || ith_extent < 0) {
+    // do nothing.
+  } else if (OB_UNLIKELY(ith_extent >= extents.count())
+      || OB_ISNULL(tmp = extents.at(ith_extent))
+      || OB_UNLIKELY(tmp->get_global_start() > start)) {
+    ret = OB_ERR_UNEXPECTED;
+    STORAGE_LOG(WARN, "fail to find the extent", K(ret), K(start), K(ith_extent), K(extents.count()));
+  } else {
+    // only one macro block io in flight, the rest of the extent is loaded by the next one.
+    const int64_t size = MIN(tmp->get_global_end() - start, READ_AHEAD_SIZE);
+    if (tmp->is_truncated()) {
+      // the truncated extent is read as zero.
+    } else if (OB_FAIL(tmp->read_ahead(io_info, start - tmp->get_global_start(), size,
+                                       read_ahead_handle_))) {
+      STORAGE_LOG(WARN, "fail to read ahead the extent", K(ret), K(start), K(size), KPC(tmp));
+    }
+    if (OB_SUCC(ret)) {
+      read_ahead_end_ = start + size;
+    }
+  }
+  return ret;
+}
+
 int64_t ObTmpFile::get_extent_cache(const int64_t offset, const ObTmpFileIOHandle &handle)
 {
   common::ObIArray<ObTmpFileExtent *> &extents = file_meta_.get_extents();
@@ -978,7 +1048,13 @@ int ObTmpFile::aio_read(const ObTmpFileIOInfo &io_info, ObTmpFileIOHandle &handl
         STORAGE_LOG(WARN, "fail to do aio read without lock", K(ret));
       }
     } else {
+      int tmp_ret = OB_SUCCESS;
       handle.set_update_offset_in_file();
+      if (handle.get_data_size() < io_info.size_) {
+        // more than one batch, the rest is read by the handle.
+      } else if (OB_TMP_FAIL(read_ahead_without_lock(io_info))) {
+        STORAGE_LOG(WARN, "fail to read ahead", K(tmp_ret), K_(offset));
+      }
     }
   }
   return ret;
@@ -1021,6 +1097,10 @@ int ObTmpFile::seek(const int64_t offset, const int whence)
         ret = OB_NOT_SUPPORTED;
         STORAGE_LOG(WARN, "not supported whence", K(ret), K(whence));
     }
+    if (OB_SUCC(ret)) {
+      // restart read ahead from the new offset.
+      read_ahead_end_ = 0;
+    }
   }
   return ret;
 }
@@ -177,6 +177,8 @@ public:
   ~ObTmpFileExtent();
   int read(const ObTmpFileIOInfo &io_info, const int64_t offset, const int64_t size,
       char *buf, ObTmpFileIOHandle &handle);
+  int read_ahead(const ObTmpFileIOInfo &io_info, const int64_t offset, const int64_t size,
+      ObMacroBlockHandle &mb_handle);
   int write(const ObTmpFileIOInfo &io_info, int64_t &size, char *&buf);
   void reset();
   OB_INLINE bool is_closed() const { return ATOMIC_LOAD(&is_closed_); }
@@ -300,6 +302,7 @@ private:
       const ObTmpFileIOInfo &io_info,
       int64_t &offset,
       ObTmpFileIOHandle &handle);
+  int read_ahead_without_lock(const ObTmpFileIOInfo &io_info);
   int64_t small_file_prealloc_size();
   int64_t big_file_prealloc_size();
   int64_t find_first_extent(const int64_t offset);
@@ -312,6 +315,8 @@ private:
   static const int64_t SMALL_FILE_MAX_THRESHOLD = 4;
   static const int64_t BIG_FILE_PREALLOC_EXTENT_SIZE = 8;
   static const int64_t READ_SIZE_PER_BATCH = 8 * 1024 * 1024; // 8MB
+  // pages after the read offset loaded into page cache asynchronously by sequential read.
+  static const int64_t READ_AHEAD_SIZE = 1 * 1024 * 1024; // 1MB
 
   bool is_inited_;
   bool is_big_;
@@ -327,6 +332,11 @@ private:
   // to optimize truncated speed, record the last_truncated_extent_id, so that we do not need to binary search the extent id every time we truncated.
   int64_t next_truncated_extent_id_;
 
+  // the pages before read_ahead_end_ have been loaded or are being loaded by read_ahead_handle_,
+  // the handle is kept until the next read ahead, since releasing it cancels the unfinished io.
+  int64_t read_ahead_end_;
+  ObMacroBlockHandle read_ahead_handle_;
+
   DISALLOW_COPY_AND_ASSIGN(ObTmpFile);
 };
 
@@ -1396,6 +1396,73 @@ int ObTmpTenantFileStore::read_page(ObTmpMacroBlock *block, ObTmpBlockIOInfo &io
   return ret;
 }
 
+int ObTmpTenantFileStore::read_ahead(const ObTmpBlockIOInfo &io_info, ObMacroBlockHandle &mb_handle)
+{
+  int ret = OB_SUCCESS;
+  ObTmpMacroBlock *block = NULL;
+  common::ObIArray<ObTmpPageIOInfo> *page_io_infos = nullptr;
+  mb_handle.reset();
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    STORAGE_LOG(WARN, "ObTmpTenantFileStore has not been inited", K(ret));
+  } else if (OB_UNLIKELY(io_info.offset_ < 0 || io_info.size_ <= 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    STORAGE_LOG(WARN, "invalid argument", K(ret), K(io_info));
+  } else if (OB_FAIL(tmp_block_manager_.get_macro_block(io_info.block_id_, block))) {
+    STORAGE_LOG(WARN, "fail to get block from tmp block manager", K(ret), K_(io_info.block_id));
+  } else if (OB_ISNULL(block)) {
+    ret = OB_ERR_UNEXPECTED;
+    STORAGE_LOG(WARN, "the block is NULL", K(ret), K_(io_info.block_id));
+  } else if (!block->is_disked()) {
+    // the memory and washing block is read from block cache, nothing to load.
+  } else {
+    void *buf = ob_malloc(sizeof(common::ObSEArray<ObTmpPageIOInfo, ObTmpFilePageBuddy::MAX_PAGE_NUMS>), "TmpReadAhead");
+    if (OB_ISNULL(buf)) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      STORAGE_LOG(WARN, "fail to alloc a buf", K(ret));
+    } else {
+      page_io_infos = new (buf) common::ObSEArray<ObTmpPageIOInfo, ObTmpFilePageBuddy::MAX_PAGE_NUMS>();
+      const int64_t page_size = ObTmpMacroBlock::get_default_page_size();
+      const int64_t end_page_id = (io_info.offset_ + io_info.size_ - 1) / page_size;
+      for (int64_t page_id = io_info.offset_ / page_size; OB_SUCC(ret) && page_id <= end_page_id; page_id++) {
+        ObTmpPageCacheKey key(io_info.block_id_, page_id, io_info.tenant_id_);
+        ObTmpPageValueHandle p_handle;
+        if (OB_SUCC(page_cache_->get_page(key, p_handle))) {
+          // already cached.
+        } else if (OB_ENTRY_NOT_EXIST == ret) {
+          ret = OB_SUCCESS;
+          ObTmpPageIOInfo page_io_info;
+          page_io_info.key_ = key;
+          page_io_info.offset_ = 0;
+          page_io_info.size_ = page_size;
+          if (OB_FAIL(page_io_infos->push_back(page_io_info))) {
+            STORAGE_LOG(WARN, "Fail to push back into page_io_infos", K(ret), K(page_io_info));
+          }
+        } else {
+          STORAGE_LOG(WARN, "fail to get page from page cache", K(ret));
+        }
+      }
+      if (OB_SUCC(ret) && page_io_infos->count() > 0) {
+        // load the missing pages by one io, from the first one to the last one.
+        const int64_t first_page_id = page_io_infos->at(0).key_.get_page_id();
+        const int64_t last_page_id = page_io_infos->at(page_io_infos->count() - 1).key_.get_page_id();
+        ObTmpBlockIOInfo info(io_info);
+        info.offset_ = first_page_id * page_size + ObTmpMacroBlock::get_header_padding();
+        info.size_ = (last_page_id - first_page_id + 1) * page_size;
+        info.macro_block_id_ = block->get_macro_block_id();
+        if (OB_FAIL(page_cache_->prefetch(info, *page_io_infos, mb_handle, io_allocator_))) {
+          STORAGE_LOG(WARN, "fail to read ahead tmp pages", K(ret), K(info));
+        }
+      }
+    }
+  }
+  if (OB_NOT_NULL(page_io_infos)) {
+    page_io_infos->destroy();
+    ob_free(page_io_infos);
+  }
+  return ret;
+}
+
 int ObTmpTenantFileStore::write(const ObTmpBlockIOInfo &io_info)
 {
   int ret = OB_SUCCESS;
@@ -1646,6 +1713,19 @@ int ObTmpFileStore::read(const uint64_t tenant_id, ObTmpBlockIOInfo &io_info,
   return ret;
 }
 
+int ObTmpFileStore::read_ahead(const uint64_t tenant_id, const ObTmpBlockIOInfo &io_info,
+    ObMacroBlockHandle &mb_handle)
+{
+  int ret = OB_SUCCESS;
+  ObTmpTenantFileStoreHandle store_handle;
+  if (OB_FAIL(get_store(tenant_id, store_handle))) {
+    STORAGE_LOG(WARN, "fail to get tmp tenant file store", K(ret), K(tenant_id), K(io_info));
+  } else if (OB_FAIL(store_handle.get_tenant_store()->read_ahead(io_info, mb_handle))) {
+    STORAGE_LOG(WARN, "fail to read ahead the extent", K(ret), K(tenant_id), K(io_info));
+  }
+  return ret;
+}
+
 int ObTmpFileStore::write(const uint64_t tenant_id, const ObTmpBlockIOInfo &io_info)
 {
   int ret = OB_SUCCESS;
@@ -248,6 +248,9 @@ public:
   int free(ObTmpFileExtent *extent);
   int free(const int64_t block_id, const int32_t start_page_id, const int32_t page_nums);
   int read(ObTmpBlockIOInfo &io_info, ObTmpFileIOHandle &handle);
+  // load the pages of a disked block which are not in page cache without waiting,
+  // mb_handle is empty if there is nothing to load.
+  int read_ahead(const ObTmpBlockIOInfo &io_info, ObMacroBlockHandle &mb_handle);
   int write(const ObTmpBlockIOInfo &io_info);
   int wash_block(const int64_t block_id, ObTmpTenantMemBlockManager::ObIOWaitInfoHandle &handle);
   void refresh_memory_limit(const uint64_t tenant_id);
@@ -338,6 +341,8 @@ public:
   int alloc(const int64_t dir_id, const uint64_t tenant_id, const int64_t size,
       ObTmpFileExtent &extent);
   int read(const uint64_t tenant_id, ObTmpBlockIOInfo &io_info, ObTmpFileIOHandle &handle);
+  int read_ahead(const uint64_t tenant_id, const ObTmpBlockIOInfo &io_info,
+      ObMacroBlockHandle &mb_handle);
   int write(const uint64_t tenant_id, const ObTmpBlockIOInfo &io_info);
   int wash_block(const uint64_t tenant_id, const int64_t block_id,
                  ObTmpTenantMemBlockManager::ObIOWaitInfoHandle &handle);
@@ -1149,6 +1149,11 @@ int ObCOMergeDagNet::create_co_execute_dags(share::ObIDag &schedule_dag)
   return ret;
 }
 
+/*
+ * Each batch scans and fuses the whole input once and projects the rows into its cg writers,
+ * so less batches means less repeated scanning on wide tables. Batches are only split to keep
+ * the merge threads busy and to keep the writers of one batch in the memory budget.
+ */
 int ObCOMergeDagNet::choose_merge_batch_size(const int64_t column_group_cnt)
 {
   int ret = OB_SUCCESS;
@@ -1156,16 +1161,53 @@ int ObCOMergeDagNet::choose_merge_batch_size(const int64_t column_group_cnt)
   if (OB_UNLIKELY(column_group_cnt <= 0)) {
     ret = OB_ERR_UNEXPECTED;
     LOG_WARN("get unexpected count", K(ret), K(column_group_cnt));
-  } else if (column_group_cnt < ObCOTabletMergeCtx::DEFAULT_CG_MERGE_BATCH_SIZE * 2) {
-    merge_batch_size_ = column_group_cnt;
   } else {
-    int64_t batch_cnt = column_group_cnt / ObCOTabletMergeCtx::DEFAULT_CG_MERGE_BATCH_SIZE;
-    merge_batch_size_ = column_group_cnt / batch_cnt;
+    const int64_t merge_thread = get_merge_thread_cnt();
+    const int64_t concurrent_cnt = co_merge_ctx_->get_concurrent_cnt();
+    const int64_t mem_allow_used = lib::get_tenant_memory_remain(MTL_ID()) * ADAPTIVE_PERCENT;
+    merge_batch_size_ = calc_merge_batch_size(co_merge_ctx_->get_merge_type(), column_group_cnt,
+        merge_thread, concurrent_cnt, co_merge_ctx_->get_tables_handle().get_count(), mem_allow_used);
+    LOG_INFO("choose co merge batch size", K(column_group_cnt), K(merge_thread), K(concurrent_cnt),
+        K(mem_allow_used), K(merge_batch_size_));
   }
 
   return ret;
 }
 
+int64_t ObCOMergeDagNet::calc_merge_batch_size(
+    const compaction::ObMergeType merge_type,
+    const int64_t column_group_cnt,
+    const int64_t merge_thread,
+    const int64_t concurrent_cnt,
+    const int64_t sstable_cnt,
+    const int64_t mem_allow_used)
+{
+  int64_t merge_batch_size = column_group_cnt;
+  if (column_group_cnt >= ObCOTabletMergeCtx::DEFAULT_CG_MERGE_BATCH_SIZE * 2) {
+    const int64_t default_batch_cnt = column_group_cnt / ObCOTabletMergeCtx::DEFAULT_CG_MERGE_BATCH_SIZE;
+    const int64_t thread_cnt = MAX(merge_thread, 1);
+    const int64_t task_cnt = MAX(concurrent_cnt, 1);
+    const int64_t mem_allow_batch_size = ObCompactionEstimator::estimate_compaction_batch_size(
+        merge_type, mem_allow_used / thread_cnt, task_cnt, sstable_cnt);
+    // batches needed to keep merge threads busy, each batch runs concurrent_cnt tasks
+    const int64_t thread_batch_cnt = MAX(thread_cnt / task_cnt, 1);
+    const int64_t mem_batch_cnt = (column_group_cnt + mem_allow_batch_size - 1) / mem_allow_batch_size;
+    const int64_t batch_cnt = MIN(default_batch_cnt, MAX(thread_batch_cnt, mem_batch_cnt));
+    merge_batch_size = (column_group_cnt + batch_cnt - 1) / batch_cnt;
+  }
+  return merge_batch_size;
+}
+
+int64_t ObCOMergeDagNet::get_merge_thread_cnt() const
+{
+  int tmp_ret = OB_SUCCESS;
+  int64_t merge_thread = 0; // default value
+  if (OB_TMP_FAIL(MTL(ObTenantDagScheduler *)->get_limit(ObDagPrio::DAG_PRIO_COMPACTION_LOW, merge_thread))) {
+    LOG_WARN_RET(tmp_ret, "failed to get major thread limit, use default value");
+  }
+  return (0 >= merge_thread) ? ObCompactionEstimator::DEFAULT_MERGE_THREAD_CNT : merge_thread;
+}
+
 int ObCOMergeDagNet::inner_schedule_finish_dag(ObIDag *parent_dag)
 {
   int ret = OB_SUCCESS;
@@ -1200,12 +1242,7 @@ int ObCOMergeDagNet::inner_schedule_finish_dag(ObIDag *parent_dag)
 void ObCOMergeDagNet::try_update_merge_batch_size(const int64_t column_group_cnt)
 {
   int tmp_ret = OB_SUCCESS;
-  int64_t merge_thread = 0; // default value
-  if (OB_TMP_FAIL(MTL(ObTenantDagScheduler *)->get_limit(ObDagPrio::DAG_PRIO_COMPACTION_LOW, merge_thread))) {
-    LOG_WARN_RET(tmp_ret, "failed to get major thread limit, use default value");
-  }
-  merge_thread = (0 >= merge_thread) ? ObCompactionEstimator::DEFAULT_MERGE_THREAD_CNT : merge_thread;
-
+  const int64_t merge_thread = get_merge_thread_cnt();
   const int64_t mem_allow_used = lib::get_tenant_memory_remain(MTL_ID()) * ADAPTIVE_PERCENT; // allow use 40% memory for co merge
   int64_t batch_mem_allow_per_thread = MAX(mem_allow_used / merge_thread - ObCompactionEstimator::MAJOR_MEM_PER_THREAD, 0);
   int64_t mem_allow_batch_size = MAX(batch_mem_allow_per_thread / ObCompactionEstimator::CO_MAJOR_CG_BASE_MEM, 1);
@@ -298,6 +298,14 @@ public:
   const ObCOMergeDagParam& get_dag_param() const { return basic_param_; }
   void collect_running_info(const uint32_t start_cg_idx, const uint32_t end_cg_idx, const int64_t hash,
       const share::ObDagId &dag_id, const ObCompactionTimeGuard &time_guard);
+  // batch size of the cg merge, mem_allow_used is the memory budget of all the merge threads
+  static int64_t calc_merge_batch_size(
+      const compaction::ObMergeType merge_type,
+      const int64_t column_group_cnt,
+      const int64_t merge_thread,
+      const int64_t concurrent_cnt,
+      const int64_t sstable_cnt,
+      const int64_t mem_allow_used);
   template<class T>
   int create_dag(
     const uint32_t start_cg_idx,
@@ -319,6 +327,7 @@ private:
       ObCOMergeBatchExeDag *&dag,
       const bool add_scheduler_flag = true);
   int choose_merge_batch_size(const int64_t column_group_cnt);
+  int64_t get_merge_thread_cnt() const;
   int inner_schedule_finish_dag(ObIDag *parent_dag = nullptr);
   void try_update_merge_batch_size(const int64_t column_group_cnt);
   int inner_create_and_schedule_dags(ObIDag *parent_dag = nullptr);
@@ -726,6 +726,32 @@ void ObBasicTabletMergeCtx::add_sstable_merge_info(
     } else {
       MTL(ObCompactionSuggestionMgr*)->analyze_merge_info(sstable_merge_info, ObDagType::DAG_TYPE_CO_MERGE_BATCH_EXECUTE, cost_time);
     }
+    (void) report_write_stat(sstable_merge_info);
+  }
+}
+
+void ObBasicTabletMergeCtx::report_write_stat(const ObSSTableMergeInfo &sstable_merge_info) const
+{
+  int tmp_ret = OB_SUCCESS;
+  const ObMergeType merge_type = get_merge_type();
+  bool report_succ = false;
+  if (get_tablet_id().is_special_merge_tablet() || sstable_merge_info.new_flush_occupy_size_ <= 0) {
+    // no need report
+  } else if (!is_mini_merge(merge_type) && !is_minor_merge_type(merge_type)
+      && !is_major_or_meta_merge_type(merge_type)) {
+    // only the compaction on data is counted into write amplification
+  } else {
+    ObTabletStat report_stat;
+    report_stat.ls_id_ = get_ls_id().id();
+    report_stat.tablet_id_ = get_tablet_id().id();
+    if (is_mini_merge(merge_type)) {
+      report_stat.ingest_bytes_ = sstable_merge_info.new_flush_occupy_size_;
+    } else {
+      report_stat.compaction_write_bytes_ = sstable_merge_info.new_flush_occupy_size_;
+    }
+    if (OB_TMP_FAIL(MTL(ObTenantTabletStatMgr *)->report_stat(report_stat, report_succ))) {
+      LOG_WARN_RET(tmp_ret, "failed to report tablet write stat", K(report_stat));
+    }
   }
 }
 
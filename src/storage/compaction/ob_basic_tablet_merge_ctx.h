@@ -172,6 +172,7 @@ public:
                               const ObStorageSnapshotInfo *snapshot_info = nullptr,
                               const int64_t start_cg_idx = 0,
                               const int64_t end_cg_idx = 0);
+  void report_write_stat(const ObSSTableMergeInfo &sstable_merge_info) const;
   int generate_participant_table_info(PartTableInfo &info) const;
   int generate_macro_id_list(char *buf, const int64_t buf_len, const blocksstable::ObSSTable *&sstable) const;
   /* GET FUNC */
@@ -108,6 +108,7 @@ int ObMergeFuser::fuse_row(MERGE_ITER_ARRAY &macro_row_iters)
 {
   int ret = OB_SUCCESS;
   bool is_need_fuse = false;
+  bool is_fused = false;
   const int64_t macro_row_iters_cnt = macro_row_iters.count();
 
   if (OB_UNLIKELY(!is_inited())) {
@@ -119,6 +120,10 @@ int ObMergeFuser::fuse_row(MERGE_ITER_ARRAY &macro_row_iters)
   } else if (OB_ISNULL(macro_row_iters.at(0)) || OB_ISNULL(macro_row_iters.at(0)->get_curr_row())) {
     ret = OB_INVALID_ARGUMENT;
     STORAGE_LOG(WARN, "Invalid macro row iters to fuse row", K(ret), K(macro_row_iters));
+  } else if (1 == macro_row_iters_cnt
+      && OB_FAIL(fuse_single_row(*macro_row_iters.at(0)->get_curr_row(), is_fused))) {
+    STORAGE_LOG(WARN, "failed to fuse single row", K(ret));
+  } else if (is_fused) {
   } else if (OB_FAIL(preprocess_fuse_row(*macro_row_iters.at(0)->get_curr_row(), is_need_fuse))) {
     STORAGE_LOG(WARN, "failed to preprocess_fuse_row", K(ret));
   } else if (!is_need_fuse && macro_row_iters.at(0)->get_curr_row()->row_flag_.is_delete()) {
@@ -310,6 +315,38 @@ int ObMajorPartitionMergeFuser::end_fuse_row(const storage::ObNopPos &nop_pos, b
   return ret;
 }
 
+// Rows in the key ranges without incremental data come from the base sstable alone and
+// seldom have nop columns, copy them in one pass instead of resetting and fusing the result row.
+int ObMajorPartitionMergeFuser::fuse_single_row(const blocksstable::ObDatumRow &row, bool &is_fused)
+{
+  int ret = OB_SUCCESS;
+  is_fused = false;
+  if (OB_UNLIKELY(row.count_ != column_cnt_ || !row.row_flag_.is_exist_without_delete())) {
+  } else {
+    is_fused = true;
+    for (int64_t i = 0; is_fused && i < column_cnt_; ++i) {
+      if (row.storage_datums_[i].is_nop()) {
+        // nop columns need to be filled with default values
+        is_fused = false;
+      } else {
+        result_row_.storage_datums_[i] = row.storage_datums_[i];
+      }
+    }
+    if (is_fused) {
+      nop_pos_.reset();
+      if (OB_ISNULL(result_row_.trans_info_)) {
+        result_row_.trans_info_ = row.trans_info_;
+      }
+      result_row_.count_ = column_cnt_;
+      result_row_.trans_id_.reset();
+      result_row_.mvcc_row_flag_.reset();
+      result_row_.row_flag_.reset();
+      result_row_.row_flag_.set_flag(ObDmlFlag::DF_INSERT);
+    }
+  }
+  return ret;
+}
+
 /*
  *ObMinorPartitionMergeFuser
  */
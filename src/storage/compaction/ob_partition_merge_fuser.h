@@ -75,6 +75,12 @@ protected:
   int fuse_delete_row(const blocksstable::ObDatumRow &del_row, const int64_t rowkey_column_cnt);
   virtual int preprocess_fuse_row(const blocksstable::ObDatumRow &row, bool &is_need_fuse);
   virtual int end_fuse_row(const storage::ObNopPos &nop_pos, blocksstable::ObDatumRow &result_row);
+  virtual int fuse_single_row(const blocksstable::ObDatumRow &row, bool &is_fused)
+  {
+    UNUSED(row);
+    is_fused = false;
+    return OB_SUCCESS;
+  }
 protected:
   bool is_inited_;
   common::ObIAllocator &allocator_;
@@ -155,6 +161,7 @@ public:
   INHERIT_TO_STRING_KV("ObIPartitionMergeFuser", ObIPartitionMergeFuser, K_(default_row));
 protected:
   virtual int inner_init(const ObMergeParameter &merge_param) override;
+  virtual int fuse_single_row(const blocksstable::ObDatumRow &row, bool &is_fused) override;
 protected:
   blocksstable::ObDatumRow default_row_;
   ObFixedArray<int32_t, ObIAllocator> generated_cols_;
@@ -900,6 +900,7 @@ int ObPartitionMergePolicy::refine_minor_merge_result(
     ObGetMergeTablesResult &result)
 {
   int ret = OB_SUCCESS;
+  int64_t size_ratio = 0;
   if (result.handle_.get_count() <= MAX(minor_compact_trigger, 1)) {
     ret = OB_NO_NEED_MERGE;
     LOG_DEBUG("minor refine, no need to do minor merge", K(result));
@@ -909,6 +910,12 @@ int ObPartitionMergePolicy::refine_minor_merge_result(
     LOG_WARN("Unexpected merge type to refine merge tables", K(result), K(ret));
   } else if (0 == minor_compact_trigger || result.handle_.get_count() >= OB_UNSAFE_TABLE_CNT) {
     // no refine
+  } else if (0 < (size_ratio = get_minor_compaction_size_ratio())) {
+    if (OB_FAIL(refine_tiered_minor_merge_result(minor_compact_trigger, size_ratio, result))) {
+      if (OB_NO_NEED_MERGE != ret) {
+        LOG_WARN("failed to refine tiered minor merge result", K(ret), K(size_ratio), K(result));
+      }
+    }
   } else {
     ObTablesHandleArray mini_tables;
     ObITable *table = NULL;
@@ -960,7 +967,7 @@ int ObPartitionMergePolicy::refine_minor_merge_result(
       result.reset_handle_and_range();
       for (int64_t i = 0; OB_SUCC(ret) && i < mini_tables.get_count(); i++) {
         ObTableHandleV2 tmp_table_handle;
-        if (OB_FAIL(result.handle_.get_table(i, tmp_table_handle))) {
+        if (OB_FAIL(mini_tables.get_table(i, tmp_table_handle))) {
           LOG_WARN("failed to get table from handles array", K(ret), K(i));
         } else if (OB_UNLIKELY(0 != i
             && tmp_table_handle.get_table()->get_start_scn() != result.scn_range_.end_scn_)) {
@@ -983,6 +990,85 @@ int ObPartitionMergePolicy::refine_minor_merge_result(
   return ret;
 }
 
+int64_t ObPartitionMergePolicy::get_minor_compaction_size_ratio()
+{
+  int64_t size_ratio = 0;
+  omt::ObTenantConfigGuard tenant_config(TENANT_CONF(MTL_ID()));
+  if (tenant_config.is_valid()) {
+    size_ratio = tenant_config->_minor_compaction_size_ratio;
+  }
+  return size_ratio;
+}
+
+/*
+ * size-tiered refine: starting from the newest sstable, an older sstable is added into the merge
+ * only if its size is not larger than (100 + size_ratio)% of the total size of the newer ones.
+ * A large sstable is rewritten only after enough small sstables are accumulated on top of it,
+ * so each row is rewritten O(log(total_size)) times instead of once per minor merge.
+ */
+int ObPartitionMergePolicy::refine_tiered_minor_merge_result(
+    const int64_t minor_compact_trigger,
+    const int64_t size_ratio,
+    ObGetMergeTablesResult &result)
+{
+  int ret = OB_SUCCESS;
+  const int64_t table_cnt = result.handle_.get_count();
+  int64_t start_idx = table_cnt;
+  int64_t newer_size = 0;
+  bool stop = false;
+  ObSSTable *sstable = nullptr;
+  for (int64_t i = table_cnt - 1; OB_SUCC(ret) && !stop && i >= 0; --i) {
+    if (OB_ISNULL(sstable = static_cast<ObSSTable *>(result.handle_.get_table(i)))
+        || OB_UNLIKELY(!sstable->is_minor_sstable())) {
+      ret = OB_ERR_SYS;
+      LOG_ERROR("get unexpected table", K(ret), K(i), KPC(sstable));
+    } else if (table_cnt - 1 != i
+        && sstable->get_occupy_size() * 100 > newer_size * (100 + size_ratio)) {
+      stop = true;
+    } else {
+      newer_size += sstable->get_occupy_size();
+      start_idx = i;
+    }
+  }
+
+  if (OB_FAIL(ret)) {
+  } else if (table_cnt - start_idx <= minor_compact_trigger) {
+    ret = OB_NO_NEED_MERGE;
+    LOG_DEBUG("minor refine, not enough sstables in the newest tier", K(start_idx), K(size_ratio), K(result));
+    result.handle_.reset();
+  } else if (0 != start_idx) {
+    ObTablesHandleArray tier_tables;
+    for (int64_t i = start_idx; OB_SUCC(ret) && i < table_cnt; ++i) {
+      ObTableHandleV2 tmp_table_handle;
+      if (OB_FAIL(result.handle_.get_table(i, tmp_table_handle))) {
+        LOG_WARN("failed to get table from handles array", K(ret), K(i));
+      } else if (OB_FAIL(tier_tables.add_table(tmp_table_handle))) {
+        LOG_WARN("failed to add table", K(ret), K(tmp_table_handle));
+      }
+    }
+    if (OB_SUCC(ret)) {
+      result.reset_handle_and_range();
+      for (int64_t i = 0; OB_SUCC(ret) && i < tier_tables.get_count(); ++i) {
+        ObTableHandleV2 tmp_table_handle;
+        if (OB_FAIL(tier_tables.get_table(i, tmp_table_handle))) {
+          LOG_WARN("failed to get table from handles array", K(ret), K(i));
+        } else if (OB_FAIL(result.handle_.add_table(tmp_table_handle))) {
+          LOG_WARN("Failed to add table to minor merge result", K(ret), K(tmp_table_handle));
+        } else {
+          if (1 == result.handle_.get_count()) {
+            result.scn_range_.start_scn_ = tmp_table_handle.get_table()->get_start_scn();
+          }
+          result.scn_range_.end_scn_ = tmp_table_handle.get_table()->get_end_scn();
+        }
+      }
+      if (OB_SUCC(ret)) {
+        LOG_INFO("minor refine, size tiered minor merge refine info", K(size_ratio), K(newer_size), K(result));
+      }
+    }
+  }
+  return ret;
+}
+
 // call this func means have serialized medium compaction clog = medium_snapshot
 int ObPartitionMergePolicy::check_need_medium_merge(
     ObLS &ls,
@@ -147,6 +147,11 @@ private:
       const ObMergeType merge_type,
       const int64_t minor_compact_trigger,
       storage::ObGetMergeTablesResult &result);
+  static int64_t get_minor_compaction_size_ratio();
+  static int refine_tiered_minor_merge_result(
+      const int64_t minor_compact_trigger,
+      const int64_t size_ratio,
+      storage::ObGetMergeTablesResult &result);
 
   static int deal_with_minor_result(
       const compaction::ObMergeType &merge_type,
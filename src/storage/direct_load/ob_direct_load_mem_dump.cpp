@@ -35,7 +35,8 @@ ObDirectLoadMemDump::Context::Context()
   : allocator_("TLD_MemDumpCtx"),
     safe_allocator_(allocator_),
     finished_sub_dump_count_(0),
-    sub_dump_count_(0)
+    sub_dump_count_(0),
+    is_sorted_(false)
 {
   allocator_.set_tenant_id(MTL_ID());
 }
@@ -242,7 +243,7 @@ int ObDirectLoadMemDump::dump_tables()
   }
 
   if (OB_SUCC(ret)) {
-    if (OB_FAIL(merger.init(iters, &compare))) {
+    if (!context_ptr_->is_sorted_ && OB_FAIL(merger.init(iters, &compare))) {
       LOG_WARN("fail to init merger", KR(ret));
     } else if (OB_FAIL(datum_row.init(mem_ctx_->column_count_))) {
       LOG_WARN("fail to init datum row", KR(ret));
@@ -252,8 +253,20 @@ int ObDirectLoadMemDump::dump_tables()
     }
   }
   ObTabletID last_tablet_id;
+  int64_t chunk_idx = 0;
   while (OB_SUCC(ret) && !(mem_ctx_->has_error_)) {
-    if (OB_FAIL(merger.get_next_item(external_row))) {
+    if (context_ptr_->is_sorted_) {
+      // chunks are ordered and do not overlap, read them one by one without merge
+      ret = OB_ITER_END;
+      while (OB_ITER_END == ret && chunk_idx < chunk_iters.count()) {
+        if (OB_ITER_END == (ret = chunk_iters.at(chunk_idx).get_next_item(external_row))) {
+          ++chunk_idx;
+        }
+      }
+    } else {
+      ret = merger.get_next_item(external_row);
+    }
+    if (OB_FAIL(ret)) {
       if (OB_UNLIKELY(OB_ITER_END != ret)) {
         LOG_WARN("fail to get next row");
       } else {
@@ -54,6 +54,8 @@ public:
     common::ObArray<ChunkType *> mem_chunk_array_;
     int64_t finished_sub_dump_count_;
     int64_t sub_dump_count_;
+    // chunks in mem_chunk_array_ are ordered and do not overlap
+    bool is_sorted_;
 
   private:
     lib::ObMutex mutex_;
@@ -73,6 +73,75 @@ int ObDirectLoadMemSample::gen_ranges(ObIArray<ChunkType *> &chunks, ObIArray<Ra
   return ret;
 }
 
+int ObDirectLoadMemSample::check_sorted(ObIArray<ChunkType *> &chunks, bool &is_sorted)
+{
+  int ret = OB_SUCCESS;
+  CompareType compare;
+  is_sorted = false;
+  if (OB_FAIL(compare.init(*(mem_ctx_->datum_utils_), mem_ctx_->dup_action_, true /*ignore_seq_no*/))) {
+    LOG_WARN("fail to init compare", KR(ret));
+  } else {
+    is_sorted = chunks.count() > 0;
+    for (int64_t i = 0; is_sorted && i < chunks.count(); i++) {
+      if (chunks.at(i)->get_size() <= 0) {
+        is_sorted = false;
+      }
+    }
+  }
+  if (OB_SUCC(ret) && is_sorted) {
+    std::sort(chunks.get_data(), chunks.get_data() + chunks.count(),
+              [&compare](ChunkType *a, ChunkType *b) {
+                return compare(a->get_item(0), b->get_item(0));
+              });
+    if (OB_FAIL(compare.get_error_code())) {
+      LOG_WARN("fail to sort chunks", KR(ret));
+    }
+    // the same rowkey must not be in two chunks, so that each range is read from chunks in order
+    for (int64_t i = 1; OB_SUCC(ret) && is_sorted && i < chunks.count(); i++) {
+      ChunkType *prev = chunks.at(i - 1);
+      is_sorted = compare(prev->get_item(prev->get_size() - 1), chunks.at(i)->get_item(0));
+      if (OB_FAIL(compare.get_error_code())) {
+        LOG_WARN("fail to compare rows", KR(ret));
+      }
+    }
+  }
+  return ret;
+}
+
+int ObDirectLoadMemSample::gen_sorted_ranges(ObIArray<ChunkType *> &chunks,
+                                             ObIArray<RangeType> &ranges)
+{
+  int ret = OB_SUCCESS;
+  int64_t row_count = 0;
+  for (int64_t i = 0; i < chunks.count(); i++) {
+    row_count += chunks.at(i)->get_size();
+  }
+  RowType *last_row = nullptr;
+  int64_t chunk_idx = 0;
+  int64_t chunk_start_pos = 0; // position of the first row of chunk_idx in all rows
+  for (int64_t i = 1; OB_SUCC(ret) && i < range_count_; i++) {
+    // the last row of the i-th range
+    const int64_t pos = MAX(i * row_count / range_count_ - 1, 0);
+    while (chunk_idx < chunks.count() - 1 &&
+           pos >= chunk_start_pos + chunks.at(chunk_idx)->get_size()) {
+      chunk_start_pos += chunks.at(chunk_idx)->get_size();
+      chunk_idx++;
+    }
+    RowType *row = chunks.at(chunk_idx)->get_item(pos - chunk_start_pos);
+    if (OB_FAIL(ranges.push_back(RangeType(last_row, row)))) {
+      LOG_WARN("fail to push range", KR(ret));
+    } else {
+      last_row = row;
+    }
+  }
+  if (OB_SUCC(ret)) {
+    if (OB_FAIL(ranges.push_back(RangeType(last_row, nullptr)))) {
+      LOG_WARN("fail to push range", KR(ret));
+    }
+  }
+  return ret;
+}
+
 int ObDirectLoadMemSample::do_work()
 {
   int ret = OB_SUCCESS;
@@ -100,9 +169,19 @@ int ObDirectLoadMemSample::do_work()
   }
 
   if (OB_SUCC(ret)) {
-    if (OB_FAIL(gen_ranges(chunks, ranges))) {
+    if (OB_FAIL(check_sorted(context_ptr->mem_chunk_array_, context_ptr->is_sorted_))) {
+      LOG_WARN("fail to check sorted", KR(ret));
+    } else if (context_ptr->is_sorted_) {
+      // sorted input, split by row count instead of sampling
+      if (OB_FAIL(gen_sorted_ranges(context_ptr->mem_chunk_array_, ranges))) {
+        LOG_WARN("fail to gen sorted ranges", KR(ret));
+      }
+    } else if (OB_FAIL(gen_ranges(chunks, ranges))) {
       LOG_WARN("fail to gen ranges", KR(ret));
-    } else {
+    }
+    if (OB_SUCC(ret)) {
+      LOG_INFO("mem sample gen ranges", K(chunks.count()), K(range_count_),
+               "is_sorted", context_ptr->is_sorted_);
       ATOMIC_AAF(&(mem_ctx_->running_dump_count_), range_count_);
     }
   }
@@ -44,6 +44,12 @@ private:
                table::ObTableLoadHandle<ObDirectLoadMemDump::Context> sample_ptr);
   int gen_ranges(common::ObIArray<ChunkType *> &chunks,
                  common::ObIArray<RangeType> &ranges);
+  // sort chunks by the first row, is_sorted is true if the rows of chunks do not overlap,
+  // which means the input is sorted and chunks can be concatenated without merge
+  int check_sorted(common::ObIArray<ChunkType *> &chunks, bool &is_sorted);
+  // split the sorted chunks into ranges of the same row count
+  int gen_sorted_ranges(common::ObIArray<ChunkType *> &chunks,
+                        common::ObIArray<RangeType> &ranges);
 
 private:
   // data members
@@ -137,6 +137,8 @@ bool ObTabletStat::check_need_report() const
         exist_row_total_table_cnt_ >= exist_row_read_table_cnt_ * QUERY_REPORT_INEFFICIENT_THRESHOLD * boost_factor) {
       bret = true;
     }
+  } else if (0 < ingest_bytes_ || 0 < compaction_write_bytes_) { // report by compaction write stat
+    bret = true;
   }
   return bret;
 }
@@ -165,6 +167,8 @@ ObTabletStat& ObTabletStat::operator+=(const ObTabletStat &other)
     insert_row_cnt_ += other.insert_row_cnt_;
     update_row_cnt_ += other.update_row_cnt_;
     delete_row_cnt_ += other.delete_row_cnt_;
+    ingest_bytes_ += other.ingest_bytes_;
+    compaction_write_bytes_ += other.compaction_write_bytes_;
   }
   return *this;
 }
@@ -183,6 +187,8 @@ ObTabletStat& ObTabletStat::archive(int64_t factor)
     insert_row_cnt_ /= factor;
     update_row_cnt_ /= factor;
     delete_row_cnt_ /= factor;
+    ingest_bytes_ /= factor;
+    compaction_write_bytes_ /= factor;
   }
   return *this;
 }
@@ -332,6 +338,13 @@ void ObTabletStream::refresh()
   past_buckets_.refresh(tablet_stat, has_retired_stat);
 }
 
+void ObTabletStream::get_accumulated_stat(ObTabletStat &tablet_stat) const
+{
+  curr_buckets_.get_tablet_stat(tablet_stat);
+  latest_buckets_.get_tablet_stat(tablet_stat);
+  past_buckets_.get_tablet_stat(tablet_stat);
+}
+
 int ObTabletStream::get_all_tablet_stat(common::ObIArray<ObTabletStat> &tablet_stats) const
 {
   int ret = OB_SUCCESS;
@@ -739,6 +752,37 @@ int ObTenantTabletStatMgr::get_latest_tablet_stat(
   return ret;
 }
 
+int ObTenantTabletStatMgr::get_accumulated_tablet_stat(
+    const share::ObLSID &ls_id,
+    const common::ObTabletID &tablet_id,
+    ObTabletStat &tablet_stat)
+{
+  int ret = OB_SUCCESS;
+  tablet_stat.reset();
+  tablet_stat.ls_id_ = ls_id.id();
+  tablet_stat.tablet_id_ = tablet_id.id();
+  const ObTabletStatKey key(ls_id, tablet_id);
+
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("ObTenantTabletStatMgr not inited", K(ret));
+  } else if (OB_UNLIKELY(!key.is_valid())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("get invalid arguments", K(ret), K(ls_id), K(tablet_id));
+  } else {
+    ObTabletStreamNode *stream_node = nullptr;
+    ObBucketHashRLockGuard lock_guard(bucket_lock_, key.hash());
+    if (OB_FAIL(stream_map_.get_refactored(key, stream_node))) {
+      if (OB_HASH_NOT_EXIST != ret) {
+        LOG_WARN("failed to get history stat", K(ret), K(key));
+      }
+    } else {
+      stream_node->stream_.get_accumulated_stat(tablet_stat);
+    }
+  }
+  return ret;
+}
+
 int ObTenantTabletStatMgr::clear_tablet_stat(
     const share::ObLSID &ls_id,
     const common::ObTabletID &tablet_id)
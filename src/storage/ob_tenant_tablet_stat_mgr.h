@@ -78,13 +78,18 @@ public:
   bool is_valid() const;
   bool check_need_report() const;
   int64_t get_total_merge_row_count() const { return insert_row_cnt_ + update_row_cnt_ + delete_row_cnt_; }
+  // bytes written by all compactions per byte flushed by mini compaction
+  double get_write_amplification() const
+  {
+    return 0 == ingest_bytes_ ? 0 : static_cast<double>(ingest_bytes_ + compaction_write_bytes_) / ingest_bytes_;
+  }
   ObTabletStat& operator=(const ObTabletStat &other);
   ObTabletStat& operator+=(const ObTabletStat &other);
   ObTabletStat& archive(int64_t factor);
   TO_STRING_KV(K_(ls_id), K_(tablet_id), K_(query_cnt), K_(merge_cnt), K_(scan_logical_row_cnt),
                K_(scan_physical_row_cnt), K_(scan_micro_block_cnt), K_(pushdown_micro_block_cnt),
                K_(exist_row_total_table_cnt), K_(exist_row_read_table_cnt), K_(insert_row_cnt),
-               K_(update_row_cnt), K_(delete_row_cnt));
+               K_(update_row_cnt), K_(delete_row_cnt), K_(ingest_bytes), K_(compaction_write_bytes));
 
 public:
   static constexpr int64_t QUERY_REPORT_INEFFICIENT_THRESHOLD = 3;
@@ -103,6 +108,8 @@ public:
   uint64_t insert_row_cnt_;
   uint64_t update_row_cnt_;
   uint64_t delete_row_cnt_;
+  uint64_t ingest_bytes_; // bytes flushed by mini compaction
+  uint64_t compaction_write_bytes_; // bytes rewritten by minor and major compaction
 };
 
 
@@ -246,6 +253,7 @@ public:
   int get_all_tablet_stat(common::ObIArray<ObTabletStat> &tablet_stats) const;
   OB_INLINE ObTabletStatKey& get_tablet_stat_key() { return key_; }
   OB_INLINE void get_latest_stat(ObTabletStat &tablet_stat) const { curr_buckets_.get_tablet_stat(tablet_stat); }
+  void get_accumulated_stat(ObTabletStat &tablet_stat) const;
   TO_STRING_KV(K_(key), K_(curr_buckets), K_(latest_buckets), K_(past_buckets));
 
 private:
@@ -364,6 +372,11 @@ public:
       const share::ObLSID &ls_id,
       const common::ObTabletID &tablet_id,
       ObTabletStat &tablet_stat);
+  // sum of all the buckets of the tablet stream, i.e. the stat of the past 400 minutes
+  int get_accumulated_tablet_stat(
+      const share::ObLSID &ls_id,
+      const common::ObTabletID &tablet_id,
+      ObTabletStat &tablet_stat);
   int get_history_tablet_stats(
       const share::ObLSID &ls_id,
       const common::ObTabletID &tablet_id,
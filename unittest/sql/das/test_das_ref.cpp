@@ -0,0 +1,113 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL_DAS
+#include <gtest/gtest.h>
+#include <thread>
+#define private public
+#include "sql/das/ob_das_ref.h"
+#include "sql/das/ob_das_rpc_processor.h"
+#include "sql/das/ob_data_access_service.h"
+#undef private
+#include "sql/ob_sql_init.h"
+#include "sql/engine/ob_exec_context.h"
+#include "share/rc/ob_tenant_base.h"
+
+using namespace oceanbase;
+using namespace oceanbase::common;
+using namespace oceanbase::share;
+using namespace oceanbase::sql;
+
+class TestDASRef : public ::testing::Test
+{
+public:
+  TestDASRef()
+    : tbase_(OB_SYS_TENANT_ID), alloc_(), exec_ctx_(alloc_), eval_ctx_(exec_ctx_)
+  {}
+  virtual ~TestDASRef() = default;
+  virtual void SetUp() override
+  {
+    // the das ref takes its concurrency limit from the tenant das service
+    static ObDataAccessService instance;
+    tbase_.inner_set(&instance);
+    ASSERT_EQ(OB_SUCCESS, tbase_.init());
+    ObTenantEnv::set_tenant(&tbase_);
+  }
+  virtual void TearDown() override {}
+
+  // what the rpc thread does once the response of a remote task is received
+  static void finish_remote_task(ObDASRef &das_ref, ObRpcDasAsyncAccessCallBack *cb)
+  {
+    cb->get_async_cb_context()->set_finished();
+    das_ref.inc_concurrency_limit_with_signal();
+  }
+
+protected:
+  ObTenantBase tbase_;
+  ObArenaAllocator alloc_;
+  ObExecContext exec_ctx_;
+  ObEvalCtx eval_ctx_;
+
+private:
+  // disallow copy
+  TestDASRef(const TestDASRef &other);
+  TestDASRef& operator=(const TestDASRef &other);
+};
+
+TEST_F(TestDASRef, signal_on_each_response)
+{
+  ObDASRef das_ref(eval_ctx_, exec_ctx_);
+  ObSEArray<ObIDASTaskOp*, 2> task_ops;
+  const int64_t timeout_ts = ObTimeUtility::current_time() + 10 * 1000 * 1000L;
+  ObRpcDasAsyncAccessCallBack *fast_cb = nullptr;
+  ObRpcDasAsyncAccessCallBack *slow_cb = nullptr;
+  ASSERT_EQ(OB_SUCCESS, das_ref.allocate_async_das_cb(fast_cb, task_ops, timeout_ts));
+  ASSERT_EQ(OB_SUCCESS, das_ref.allocate_async_das_cb(slow_cb, task_ops, timeout_ts));
+  ASSERT_EQ(OB_SUCCESS, das_ref.dec_concurrency_limit());
+  ASSERT_EQ(OB_SUCCESS, das_ref.dec_concurrency_limit());
+  ASSERT_FALSE(das_ref.has_unprocessed_remote_resp());
+
+  // only the fast server responds, the sql thread must be woken up while the slow one is in flight
+  std::thread responder(finish_remote_task, std::ref(das_ref), fast_cb);
+  {
+    ObThreadCondGuard guard(das_ref.cond_);
+    while (!das_ref.has_unprocessed_remote_resp()) {
+      ASSERT_EQ(OB_SUCCESS, das_ref.cond_.wait(5 * 1000));
+    }
+  }
+  responder.join();
+  ASSERT_TRUE(fast_cb->get_async_cb_context()->is_finished());
+  ASSERT_FALSE(slow_cb->get_async_cb_context()->is_finished());
+  ASSERT_EQ(das_ref.get_max_concurrency() - 1, das_ref.get_current_concurrency());
+
+  // a processed response is not reported again
+  fast_cb->get_async_cb_context()->set_processed();
+  ASSERT_FALSE(das_ref.has_unprocessed_remote_resp());
+
+  finish_remote_task(das_ref, slow_cb);
+  ASSERT_TRUE(das_ref.has_unprocessed_remote_resp());
+  slow_cb->get_async_cb_context()->set_processed();
+  ASSERT_FALSE(das_ref.has_unprocessed_remote_resp());
+  ASSERT_EQ(das_ref.get_max_concurrency(), das_ref.get_current_concurrency());
+
+  // every response is processed already, waiting returns at once and releases the callbacks
+  ASSERT_EQ(OB_SUCCESS, das_ref.wait_executing_tasks());
+  ASSERT_TRUE(das_ref.async_cb_list_.empty());
+}
+
+int main(int argc, char **argv)
+{
+  OB_LOGGER.set_log_level("INFO");
+  init_sql_factories();
+  ::testing::InitGoogleTest(&argc,argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,154 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL_DTL
+
+#include <gtest/gtest.h>
+#include "lib/random/ob_random.h"
+#include "sql/dtl/ob_dtl_vectors_buffer.h"
+#include "sql/dtl/ob_dtl_vectors_codec.h"
+
+namespace oceanbase
+{
+namespace sql
+{
+namespace dtl
+{
+using namespace common;
+
+// build serialized vectors payload in the layout of ObDtlLinkedBuffer::serialize_vector
+class TestDtlVectorsCodec : public ::testing::Test
+{
+public:
+  static const int64_t BUF_SIZE = 1L << 20;
+  TestDtlVectorsCodec() : raw_(NULL), encoded_(NULL), decoded_(NULL), raw_size_(0) {}
+  virtual void SetUp() override
+  {
+    raw_ = static_cast<char *>(ob_malloc(BUF_SIZE, "DtlCodecTest"));
+    encoded_ = static_cast<char *>(ob_malloc(BUF_SIZE, "DtlCodecTest"));
+    decoded_ = static_cast<char *>(ob_malloc(BUF_SIZE, "DtlCodecTest"));
+    ASSERT_TRUE(NULL != raw_ && NULL != encoded_ && NULL != decoded_);
+    MEMSET(raw_, 0, BUF_SIZE);
+  }
+  virtual void TearDown() override
+  {
+    ob_free(raw_);
+    ob_free(encoded_);
+    ob_free(decoded_);
+  }
+
+  // %fixed_lens: 0 for continuous column
+  void build(const int64_t row_cnt, const int64_t *fixed_lens, const int64_t col_cnt,
+             const int64_t range)
+  {
+    int64_t pos = 0;
+    *reinterpret_cast<int32_t *>(raw_) = ObDtlVectorsBuffer::MAGIC;
+    *reinterpret_cast<int32_t *>(raw_ + sizeof(int32_t)) = col_cnt;
+    *reinterpret_cast<int32_t *>(raw_ + 2 * sizeof(int32_t)) = row_cnt;
+    pos = 3 * sizeof(int32_t);
+    VectorInfo *infos = reinterpret_cast<VectorInfo *>(raw_ + pos);
+    pos += col_cnt * sizeof(VectorInfo);
+    for (int64_t i = 0; i < col_cnt; i++) {
+      infos[i].nulls_offset_ = pos;
+      ObBitVector *nulls = to_bit_vector(raw_ + pos);
+      nulls->reset(row_cnt);
+      pos += ObBitVector::memory_size(row_cnt);
+      if (0 == fixed_lens[i]) {
+        infos[i].format_ = VEC_CONTINUOUS;
+        infos[i].fixed_len_ = 0;
+        infos[i].offsets_offset_ = pos;
+        uint32_t *offsets = reinterpret_cast<uint32_t *>(raw_ + pos);
+        pos += (row_cnt + 1) * sizeof(uint32_t);
+        infos[i].data_offset_ = pos;
+        offsets[0] = pos;
+        for (int64_t j = 0; j < row_cnt; j++) {
+          const int64_t len = snprintf(raw_ + pos, 32, "customer#%ld", ObRandom::rand(0, range));
+          pos += len;
+          offsets[j + 1] = pos;
+        }
+      } else {
+        infos[i].format_ = VEC_FIXED;
+        infos[i].fixed_len_ = fixed_lens[i];
+        infos[i].data_offset_ = pos;
+        for (int64_t j = 0; j < row_cnt; j++) {
+          const int64_t val = 1000000 + ObRandom::rand(-range, range);
+          const int64_t vals[2] = { val, val };
+          if (0 == j % 7) {
+            nulls->set(j);
+          }
+          MEMCPY(raw_ + pos, vals, fixed_lens[i]);
+          pos += fixed_lens[i];
+        }
+      }
+    }
+    raw_size_ = pos;
+  }
+
+  void check_round_trip(int64_t &encoded_size)
+  {
+    int64_t decoded_size = 0;
+    int64_t raw_size = 0;
+    ASSERT_EQ(OB_SUCCESS, ObDtlVectorsCodec::encode(raw_, raw_size_, encoded_, raw_size_,
+                                                    encoded_size));
+    ASSERT_EQ(OB_SUCCESS, ObDtlVectorsCodec::get_decoded_size(encoded_, encoded_size, raw_size));
+    ASSERT_EQ(raw_size_, raw_size);
+    ASSERT_EQ(OB_SUCCESS, ObDtlVectorsCodec::decode(encoded_, encoded_size, decoded_, BUF_SIZE,
+                                                    decoded_size));
+    ASSERT_EQ(raw_size_, decoded_size);
+    ASSERT_EQ(0, MEMCMP(raw_, decoded_, raw_size_));
+  }
+
+protected:
+  char *raw_;
+  char *encoded_;
+  char *decoded_;
+  int64_t raw_size_;
+};
+
+TEST_F(TestDtlVectorsCodec, narrow_range)
+{
+  const int64_t fixed_lens[] = { 8, 4, 0 };
+  int64_t encoded_size = 0;
+  build(1024, fixed_lens, 3, 100);
+  check_round_trip(encoded_size);
+  LOG_INFO("narrow range", K(raw_size_), K(encoded_size));
+  ASSERT_LT(encoded_size * 2, raw_size_);
+}
+
+TEST_F(TestDtlVectorsCodec, wide_range)
+{
+  const int64_t fixed_lens[] = { 8, 0, 16 };
+  int64_t encoded_size = 0;
+  build(1000, fixed_lens, 3, INT32_MAX);
+  check_round_trip(encoded_size);
+  LOG_INFO("wide range", K(raw_size_), K(encoded_size));
+}
+
+TEST_F(TestDtlVectorsCodec, no_space)
+{
+  const int64_t fixed_lens[] = { 8 };
+  int64_t encoded_size = 0;
+  build(16, fixed_lens, 1, 10);
+  ASSERT_EQ(OB_SIZE_OVERFLOW, ObDtlVectorsCodec::encode(raw_, raw_size_, encoded_, 16,
+                                                        encoded_size));
+}
+
+} // end namespace dtl
+} // end namespace sql
+} // end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
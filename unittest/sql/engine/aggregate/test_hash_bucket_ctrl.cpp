@@ -0,0 +1,285 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL_ENG
+#include <gtest/gtest.h>
+
+#include "sql/ob_sql_init.h"
+#include "sql/engine/aggregate/ob_exec_hash_struct_vec.h"
+
+using namespace oceanbase;
+using namespace oceanbase::common;
+using namespace oceanbase::sql;
+
+// expose the bucket locating of the hash table, buckets are set valid without group rows
+class TestHashTableVec : public ObExtendHashTableVec<ObGroupRowBucket>
+{
+public:
+  TestHashTableVec() : ObExtendHashTableVec<ObGroupRowBucket>(OB_SYS_TENANT_ID),
+                       alloc_("TestHashCtrl")
+  {
+  }
+  ~TestHashTableVec() { destroy(); }
+  int prepare(const int64_t bucket_num)
+  {
+    int ret = OB_SUCCESS;
+    void *buf = nullptr;
+    mem_attr_ = lib::ObMemAttr(OB_SYS_TENANT_ID, "TestHashCtrl");
+    allocator_.set_allocator(&alloc_);
+    if (OB_ISNULL(buf = allocator_.alloc(sizeof(BucketArray), mem_attr_))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+    } else {
+      buckets_ = new(buf)BucketArray(allocator_);
+      ret = extend(bucket_num);
+    }
+    return ret;
+  }
+  int64_t insert(const uint64_t hash_val)
+  {
+    const int64_t pos = locate_bucket_pos(*buckets_, bucket_ctrl_, hash_val);
+    if (!buckets_->at(pos).is_valid()) {
+      set_bucket_valid(buckets_->at(pos), pos, hash_val);
+      ++size_;
+    }
+    return pos;
+  }
+  int64_t find(const uint64_t hash_val) const
+  {
+    return locate_bucket_pos(*buckets_, bucket_ctrl_, hash_val);
+  }
+  // probe bucket by bucket, as the table without control bytes does
+  int64_t scalar_find(const uint64_t hash_val) const
+  {
+    return locate_bucket_pos(*buckets_, ObGroupRowBucketCtrl(), hash_val);
+  }
+  const ObGroupRowBucket &bucket(const int64_t pos) const { return buckets_->at(pos); }
+  const ObGroupRowBucketCtrl &ctrl() const { return bucket_ctrl_; }
+  int64_t valid_bucket_cnt() const
+  {
+    int64_t cnt = 0;
+    for (int64_t i = 0; i < buckets_->count(); ++i) {
+      cnt += buckets_->at(i).is_valid() ? 1 : 0;
+    }
+    return cnt;
+  }
+private:
+  ObArenaAllocator alloc_;
+};
+
+class ObHashBucketCtrlTest : public ::testing::Test
+{
+public:
+  ObHashBucketCtrlTest() : alloc_("TestHashCtrl"), page_alloc_(alloc_),
+                           attr_(OB_SYS_TENANT_ID, "TestHashCtrl") {}
+  virtual ~ObHashBucketCtrlTest() = default;
+  virtual void SetUp() {};
+  virtual void TearDown() {};
+
+  // hash value starting probing at bucket %start of a table of %bucket_num buckets,
+  // all hash values of the same %start share the same tag
+  static uint64_t make_hash(const int64_t start, const int64_t seq, const int64_t bucket_num)
+  {
+    return start + seq * bucket_num;
+  }
+  static uint64_t mix_hash(const uint64_t v)
+  {
+    return (v * 0x9E3779B97F4A7C15ULL) & ObGroupRowBucketBase::HASH_VAL_MASK;
+  }
+
+protected:
+  ObArenaAllocator alloc_;
+  ModulePageAllocator page_alloc_;
+  lib::ObMemAttr attr_;
+
+private:
+  // disallow copy
+  ObHashBucketCtrlTest(const ObHashBucketCtrlTest &other);
+  ObHashBucketCtrlTest& operator=(const ObHashBucketCtrlTest &other);
+};
+
+TEST_F(ObHashBucketCtrlTest, ctrl_init)
+{
+  ObGroupRowBucketCtrl ctrl;
+  // less buckets than one group has no control bytes
+  ASSERT_EQ(OB_SUCCESS, ctrl.init(page_alloc_, attr_, ObGroupRowBucketCtrl::GROUP_WIDTH / 2));
+  ASSERT_FALSE(ctrl.is_valid());
+  ASSERT_EQ(0, ctrl.mem_used());
+
+  const int64_t bucket_num = 64;
+  ASSERT_EQ(OB_SUCCESS, ctrl.init(page_alloc_, attr_, bucket_num));
+  ASSERT_TRUE(ctrl.is_valid());
+  ASSERT_EQ(bucket_num + ObGroupRowBucketCtrl::GROUP_WIDTH, ctrl.mem_used());
+  for (int64_t pos = 0; pos < bucket_num; ++pos) {
+    ASSERT_EQ(UINT16_MAX, ctrl.match(pos, ObGroupRowBucketCtrl::EMPTY_CTRL));
+  }
+  // tag never collides with EMPTY_CTRL
+  for (uint64_t v = 0; v < 1024; ++v) {
+    ASSERT_NE(ObGroupRowBucketCtrl::EMPTY_CTRL, ObGroupRowBucketCtrl::tag(mix_hash(v)));
+  }
+  ctrl.destroy(page_alloc_);
+  ASSERT_FALSE(ctrl.is_valid());
+}
+
+TEST_F(ObHashBucketCtrlTest, ctrl_set_match)
+{
+  const int64_t bucket_num = 64;
+  ObGroupRowBucketCtrl ctrl;
+  ASSERT_EQ(OB_SUCCESS, ctrl.init(page_alloc_, attr_, bucket_num));
+  const uint64_t h1 = mix_hash(1);
+  const uint64_t h2 = mix_hash(2);
+  const uint8_t t1 = ObGroupRowBucketCtrl::tag(h1);
+  const uint8_t t2 = ObGroupRowBucketCtrl::tag(h2);
+  ASSERT_NE(t1, t2);
+  ctrl.set(20, h1);
+  ctrl.set(23, h2);
+  ctrl.set(35, h1);
+  ASSERT_EQ(1U << 4, ctrl.match(16, t1));
+  ASSERT_EQ(1U << 7, ctrl.match(16, t2));
+  ASSERT_EQ((1U << 0) | (1U << 15), ctrl.match(20, t1));
+  ASSERT_EQ(UINT16_MAX & ~((1U << 4) | (1U << 7)), ctrl.match(16, ObGroupRowBucketCtrl::EMPTY_CTRL));
+
+  ctrl.reuse();
+  ASSERT_EQ(0, ctrl.match(16, t1));
+  ASSERT_EQ(UINT16_MAX, ctrl.match(16, ObGroupRowBucketCtrl::EMPTY_CTRL));
+  ctrl.destroy(page_alloc_);
+}
+
+TEST_F(ObHashBucketCtrlTest, ctrl_wraparound)
+{
+  const int64_t bucket_num = 32;
+  const int64_t width = ObGroupRowBucketCtrl::GROUP_WIDTH;
+  ObGroupRowBucketCtrl ctrl;
+  ASSERT_EQ(OB_SUCCESS, ctrl.init(page_alloc_, attr_, bucket_num));
+  const uint64_t h = mix_hash(7);
+  const uint8_t t = ObGroupRowBucketCtrl::tag(h);
+  // buckets of the first group are mirrored after the last bucket
+  ctrl.set(0, h);
+  ctrl.set(width - 1, h);
+  ASSERT_EQ(t, ctrl.ctrl_[bucket_num]);
+  ASSERT_EQ(t, ctrl.ctrl_[bucket_num + width - 1]);
+  // groups starting in the last GROUP_WIDTH buckets see the first buckets after the last one
+  ASSERT_EQ(1U << 1, ctrl.match(bucket_num - 1, t));
+  ASSERT_EQ(1U << 4, ctrl.match(bucket_num - 4, t));
+  ASSERT_EQ((1U << 0) | (1U << (width - 1)), ctrl.match(0, t));
+  // the other buckets are not mirrored
+  const uint64_t h2 = mix_hash(8);
+  ASSERT_NE(t, ObGroupRowBucketCtrl::tag(h2));
+  ctrl.set(bucket_num - 1, h2);
+  ctrl.set(width, h2);
+  ASSERT_EQ(1U << 0, ctrl.match(bucket_num - 1, ObGroupRowBucketCtrl::tag(h2)));
+  ASSERT_EQ(t, ctrl.ctrl_[bucket_num + width - 1]);
+  ASSERT_EQ(1U << 0, ctrl.match(width, ObGroupRowBucketCtrl::tag(h2)));
+
+  ctrl.reuse();
+  for (int64_t i = 0; i < bucket_num + width; ++i) {
+    ASSERT_EQ(ObGroupRowBucketCtrl::EMPTY_CTRL, ctrl.ctrl_[i]);
+  }
+  ctrl.destroy(page_alloc_);
+}
+
+TEST_F(ObHashBucketCtrlTest, probe_across_groups)
+{
+  const int64_t bucket_num = 64;
+  const int64_t start = bucket_num - 4;
+  const int64_t cnt = ObGroupRowBucketCtrl::GROUP_WIDTH + 4;
+  TestHashTableVec table;
+  ASSERT_EQ(OB_SUCCESS, table.prepare(bucket_num));
+  ASSERT_TRUE(table.ctrl().is_valid());
+  // all hash values start at the same bucket and have the same tag, the probing wraps around
+  // the end of buckets and crosses the group boundary
+  for (int64_t i = 0; i < cnt; ++i) {
+    const uint64_t h = make_hash(start, i + 1, bucket_num);
+    ASSERT_EQ(ObGroupRowBucketCtrl::tag(make_hash(start, 1, bucket_num)),
+              ObGroupRowBucketCtrl::tag(h));
+    ASSERT_EQ((start + i) & (bucket_num - 1), table.insert(h));
+  }
+  for (int64_t i = 0; i < cnt; ++i) {
+    const uint64_t h = make_hash(start, i + 1, bucket_num);
+    const int64_t pos = table.find(h);
+    ASSERT_EQ((start + i) & (bucket_num - 1), pos);
+    ASSERT_TRUE(table.bucket(pos).is_valid());
+    ASSERT_TRUE(table.bucket(pos).check_hash(h));
+    ASSERT_EQ(table.scalar_find(h), pos);
+  }
+  // tag hits without the same hash value end at the first empty bucket
+  const uint64_t absent = make_hash(start, cnt + 1, bucket_num);
+  ASSERT_EQ((start + cnt) & (bucket_num - 1), table.find(absent));
+  ASSERT_FALSE(table.bucket(table.find(absent)).is_valid());
+  ASSERT_EQ(table.scalar_find(absent), table.find(absent));
+}
+
+TEST_F(ObHashBucketCtrlTest, probe_stops_at_empty)
+{
+  const int64_t bucket_num = 64;
+  TestHashTableVec table;
+  ASSERT_EQ(OB_SUCCESS, table.prepare(bucket_num));
+  const uint64_t h1 = make_hash(10, 1, bucket_num);
+  const uint64_t h2 = make_hash(12, 1, bucket_num);
+  ASSERT_EQ(10, table.insert(h1));
+  ASSERT_EQ(12, table.insert(h2));
+  // bucket 11 is empty, a later bucket of the same tag is not reached
+  const uint64_t absent = make_hash(10, 2, bucket_num);
+  ASSERT_EQ(11, table.find(absent));
+  ASSERT_EQ(table.scalar_find(absent), table.find(absent));
+  // insert existing hash value returns the same bucket
+  ASSERT_EQ(10, table.insert(h1));
+  ASSERT_EQ(2, table.valid_bucket_cnt());
+}
+
+TEST_F(ObHashBucketCtrlTest, rehash)
+{
+  const int64_t cnt = 200;
+  TestHashTableVec table;
+  // start without control bytes, and get them on the first extend
+  ASSERT_EQ(OB_SUCCESS, table.prepare(ObGroupRowBucketCtrl::GROUP_WIDTH / 2));
+  ASSERT_FALSE(table.ctrl().is_valid());
+  for (int64_t i = 0; i < 4; ++i) {
+    table.insert(mix_hash(i));
+  }
+  ASSERT_EQ(OB_SUCCESS, table.extend(64));
+  ASSERT_TRUE(table.ctrl().is_valid());
+  for (int64_t i = 0; i < cnt; ++i) {
+    // keep the table at most half filled as the auto extend does
+    if ((i + 1) * 2 > table.get_bucket_num()) {
+      ASSERT_EQ(OB_SUCCESS, table.extend(table.get_bucket_num() * 2));
+      ASSERT_EQ(table.get_bucket_num() + ObGroupRowBucketCtrl::GROUP_WIDTH,
+                table.ctrl().mem_used());
+    }
+    table.insert(mix_hash(i));
+  }
+  ASSERT_EQ(cnt, table.valid_bucket_cnt());
+  // every hash value is found after rehash, and at the same bucket as the scalar probing
+  for (int64_t i = 0; i < cnt; ++i) {
+    const uint64_t h = mix_hash(i);
+    const int64_t pos = table.find(h);
+    ASSERT_TRUE(table.bucket(pos).is_valid());
+    ASSERT_TRUE(table.bucket(pos).check_hash(h));
+    ASSERT_EQ(ObGroupRowBucketCtrl::tag(h), table.ctrl().ctrl_[pos]);
+    ASSERT_EQ(table.scalar_find(h), pos);
+  }
+  // control bytes of empty buckets are reset by rehash
+  for (int64_t pos = 0; pos < table.get_bucket_num(); ++pos) {
+    ASSERT_EQ(!table.bucket(pos).is_valid(),
+              ObGroupRowBucketCtrl::EMPTY_CTRL == table.ctrl().ctrl_[pos]);
+  }
+  for (int64_t i = cnt; i < cnt * 2; ++i) {
+    ASSERT_FALSE(table.bucket(table.find(mix_hash(i))).is_valid());
+  }
+}
+
+int main(int argc, char **argv)
+{
+  OB_LOGGER.set_log_level("INFO");
+  init_sql_factories();
+  ::testing::InitGoogleTest(&argc,argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,174 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL_ENG
+
+#include <gtest/gtest.h>
+#include <iostream>
+#include "lib/hash_func/murmur_hash.h"
+#include "lib/time/ob_time_utility.h"
+#include "sql/engine/join/hash_join/ob_hj_radix_partitioner.h"
+
+// Microbenchmark of hash table build: insert in arrival order vs radix partitioned insert.
+// It is not registered with ctest, the correctness of the build is checked by test_hj_radix_build.
+// usage: ./bench_hj_radix_build [-n row_count] [-l loop_count]
+namespace oceanbase
+{
+namespace sql
+{
+using namespace common;
+
+static int64_t ROW_COUNT = 1L << 22;
+static int64_t LOOP_COUNT = 3;
+
+struct TestRow
+{
+  uint64_t hash_;
+  uint64_t payload_;
+};
+
+// same layout as NormalizedBucket: <hash, key>, linear probing
+struct TestBucket
+{
+  uint64_t hash_;
+  uint64_t payload_;
+};
+
+struct TestGetPart
+{
+  TestGetPart(const uint64_t mask, const int64_t shift) : mask_(mask), shift_(shift) {}
+  int64_t operator()(const TestRow &row) const { return (row.hash_ & mask_) >> shift_; }
+  uint64_t mask_;
+  int64_t shift_;
+};
+
+class BenchHJRadixBuild : public ::testing::Test
+{
+public:
+  BenchHJRadixBuild() : rows_(NULL), part_rows_(NULL), buckets_(NULL), nbuckets_(0) {}
+  virtual void SetUp() override
+  {
+    nbuckets_ = next_pow2(ROW_COUNT * 2);
+    rows_ = static_cast<TestRow *>(ob_malloc(sizeof(TestRow) * ROW_COUNT, "HJRadixBench"));
+    part_rows_ = static_cast<TestRow *>(ob_malloc_align(CACHE_ALIGN_SIZE,
+                                        sizeof(TestRow) * ROW_COUNT, "HJRadixBench"));
+    buckets_ = static_cast<TestBucket *>(ob_malloc(sizeof(TestBucket) * nbuckets_, "HJRadixBench"));
+    ASSERT_TRUE(NULL != rows_ && NULL != part_rows_ && NULL != buckets_);
+    for (int64_t i = 0; i < ROW_COUNT; i++) {
+      // hash value 0 means empty bucket
+      rows_[i].hash_ = (murmurhash(&i, sizeof(i), 0) >> 1) | 1;
+      rows_[i].payload_ = i;
+    }
+  }
+  virtual void TearDown() override
+  {
+    ob_free(rows_);
+    ob_free_align(part_rows_);
+    ob_free(buckets_);
+  }
+
+  OB_INLINE void insert(const TestRow &row)
+  {
+    const uint64_t mask = nbuckets_ - 1;
+    uint64_t pos = row.hash_ & mask;
+    while (0 != buckets_[pos].hash_) {
+      pos = (pos + 1) & mask;
+    }
+    buckets_[pos].hash_ = row.hash_;
+    buckets_[pos].payload_ = row.payload_;
+  }
+
+  int64_t build_direct()
+  {
+    MEMSET(buckets_, 0, sizeof(TestBucket) * nbuckets_);
+    int64_t start = ObTimeUtility::current_time();
+    for (int64_t i = 0; i < ROW_COUNT; i++) {
+      insert(rows_[i]);
+    }
+    return ObTimeUtility::current_time() - start;
+  }
+
+  int64_t build_radix(int64_t &partition_time)
+  {
+    MEMSET(buckets_, 0, sizeof(TestBucket) * nbuckets_);
+    const int64_t bits = ObHJRadixPartitioner::calc_radix_bits(nbuckets_, sizeof(TestBucket));
+    const int64_t part_cnt = 1L << bits;
+    const int64_t swwc_cnt = ObRadixScatter<TestRow>::SWWC_CNT;
+    int64_t *offsets = static_cast<int64_t *>(ob_malloc(sizeof(int64_t) * (part_cnt + 1), "HJRadixBench"));
+    int64_t *pos = static_cast<int64_t *>(ob_malloc(sizeof(int64_t) * part_cnt, "HJRadixBench"));
+    TestRow *bufs = static_cast<TestRow *>(ob_malloc(sizeof(TestRow) * part_cnt * swwc_cnt, "HJRadixBench"));
+    TestGetPart get_part(nbuckets_ - 1, __builtin_ctzll(nbuckets_) - bits);
+
+    int64_t start = ObTimeUtility::current_time();
+    MEMSET(offsets, 0, sizeof(int64_t) * (part_cnt + 1));
+    ObRadixScatter<TestRow>::histogram(rows_, ROW_COUNT, get_part, offsets + 1);
+    for (int64_t i = 1; i <= part_cnt; i++) {
+      offsets[i] += offsets[i - 1];
+    }
+    ObRadixScatter<TestRow>::scatter(rows_, ROW_COUNT, get_part, part_cnt, offsets, bufs, pos,
+                                     part_rows_);
+    partition_time = ObTimeUtility::current_time() - start;
+    for (int64_t i = 0; i < ROW_COUNT; i++) {
+      insert(part_rows_[i]);
+    }
+    int64_t total_time = ObTimeUtility::current_time() - start;
+    ob_free(offsets);
+    ob_free(pos);
+    ob_free(bufs);
+    return total_time;
+  }
+
+protected:
+  TestRow *rows_;
+  TestRow *part_rows_;
+  TestBucket *buckets_;
+  int64_t nbuckets_;
+};
+
+TEST_F(BenchHJRadixBuild, build)
+{
+  LOG_INFO("hash table", K(ROW_COUNT), K(nbuckets_), "bucket_mem", nbuckets_ * sizeof(TestBucket),
+           "l2", get_level2_cache_size(), "l3", get_level3_cache_size(),
+           "radix_bits", ObHJRadixPartitioner::calc_radix_bits(nbuckets_, sizeof(TestBucket)));
+  for (int64_t i = 0; i < LOOP_COUNT; i++) {
+    int64_t partition_time = 0;
+    int64_t direct_time = build_direct();
+    int64_t radix_time = build_radix(partition_time);
+    std::cout << "rows: " << ROW_COUNT << ", buckets: " << nbuckets_
+              << ", direct build(us): " << direct_time
+              << ", radix build(us): " << radix_time
+              << " (partition: " << partition_time << ")" << std::endl;
+  }
+}
+
+} // end namespace sql
+} // end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  int c = 0;
+  while (-1 != (c = getopt(argc, argv, "n:l:"))) {
+    switch (c) {
+      case 'n':
+        oceanbase::sql::ROW_COUNT = atol(optarg);
+        break;
+      case 'l':
+        oceanbase::sql::LOOP_COUNT = atol(optarg);
+        break;
+      default:
+        break;
+    }
+  }
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,290 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL_ENG
+
+#include <gtest/gtest.h>
+#define private public
+#define protected public
+#include "sql/ob_sql_init.h"
+#include "sql/engine/join/hash_join/join_hash_table.h"
+#include "sql/engine/join/hash_join/ob_hj_partition.h"
+#undef private
+#undef protected
+#include "lib/hash_func/murmur_hash.h"
+
+namespace oceanbase
+{
+namespace sql
+{
+using namespace common;
+
+static const int64_t ROW_COUNT = 20000;
+static const int64_t MAX_BATCH_SIZE = 256;
+
+struct TestRow
+{
+  uint64_t hash_;
+  uint64_t payload_;
+};
+
+struct TestGetPart
+{
+  TestGetPart(const uint64_t mask, const int64_t shift) : mask_(mask), shift_(shift) {}
+  int64_t operator()(const TestRow &row) const { return (row.hash_ & mask_) >> shift_; }
+  uint64_t mask_;
+  int64_t shift_;
+};
+
+class TestMemCallback : public ObSqlMemoryCallback
+{
+public:
+  TestMemCallback() : used_(0), peak_(0) {}
+  virtual void alloc(int64_t size) override
+  {
+    used_ += size;
+    peak_ = std::max(peak_, used_);
+  }
+  virtual void free(int64_t size) override { used_ -= size; }
+  virtual void dumped(int64_t size) override { UNUSED(size); }
+  int64_t used_;
+  int64_t peak_;
+};
+
+class TestHJRadixBuild : public ::testing::Test
+{
+public:
+  TestHJRadixBuild() : alloc_("HJRadixTest") {}
+  virtual void SetUp() override
+  {
+    ctx_.join_type_ = INNER_JOIN;
+    ctx_.build_keys_ = &keys_;
+    ctx_.max_batch_size_ = MAX_BATCH_SIZE;
+    ctx_.stored_rows_ = static_cast<const ObHJStoredRow **>(
+        alloc_.alloc(sizeof(ObHJStoredRow *) * MAX_BATCH_SIZE));
+    ASSERT_TRUE(NULL != ctx_.stored_rows_);
+    ctx_.build_row_meta_.set_allocator(&alloc_);
+    // build rows without columns, only the hash value in the extra payload is used
+    ASSERT_EQ(OB_SUCCESS, ctx_.build_row_meta_.init(keys_, sizeof(ObHJStoredRow::ExtraInfo)));
+  }
+  virtual void TearDown() override
+  {
+    ctx_.build_row_meta_.reset();
+  }
+
+  // every hash value is shared by two rows, so items are chained in the bucket
+  static uint64_t row_hash(const int64_t idx)
+  {
+    int64_t v = idx / 2;
+    return murmurhash(&v, sizeof(v), 0) & ObHJStoredRow::HASH_VAL_MASK;
+  }
+
+  void fill_part(ObHJPartition &part)
+  {
+    const RowMeta &meta = ctx_.build_row_meta_;
+    const int64_t row_size = meta.get_row_fixed_size();
+    void *buf = alloc_.alloc(row_size);
+    ASSERT_TRUE(NULL != buf);
+    ObCompactRow *src = new(buf) ObCompactRow();
+    src->init(meta);
+    src->set_row_size(row_size);
+    ASSERT_EQ(OB_SUCCESS, part.init(keys_, MAX_BATCH_SIZE));
+    for (int64_t i = 0; i < ROW_COUNT; i++) {
+      ObCompactRow *stored_row = NULL;
+      static_cast<ObHJStoredRow *>(src)->set_hash_value(meta, row_hash(i));
+      ASSERT_EQ(OB_SUCCESS, part.get_row_store().add_row(src, stored_row));
+    }
+    ASSERT_EQ(OB_SUCCESS, part.finish_dump(false));
+    ASSERT_EQ(OB_SUCCESS, part.begin_iterator());
+  }
+
+  // bucket array larger than the L2 cache, so that radix build has more than one partition
+  static int64_t bucket_count(const int64_t bucket_size)
+  {
+    return next_pow2(std::max(ROW_COUNT * 2, 4 * get_level2_cache_size() / bucket_size));
+  }
+
+  void prepare_table(JoinHashTable &table)
+  {
+    ASSERT_EQ(OB_SUCCESS, table.init(ctx_, alloc_));
+    ASSERT_EQ(OB_SUCCESS, table.build_prepare(ROW_COUNT,
+                                              bucket_count(table.get_one_bucket_size())));
+  }
+
+  // count of items chained in the bucket of %hash_val
+  int64_t item_count(JoinHashTable &table, const uint64_t hash_val)
+  {
+    int64_t cnt = 0;
+    GenericItem *item = static_cast<GenericTable *>(table.hash_table_)->get(hash_val);
+    while (reinterpret_cast<GenericItem *>(END_ITEM) != item && cnt <= ROW_COUNT) {
+      cnt += 1;
+      item = item->get_next(ctx_.build_row_meta_);
+    }
+    return cnt;
+  }
+
+protected:
+  ObArenaAllocator alloc_;
+  ExprFixedArray keys_;
+  JoinTableCtx ctx_;
+};
+
+TEST_F(TestHJRadixBuild, scatter)
+{
+  const int64_t cnt = 10007;
+  const int64_t nbuckets = 1L << 16;
+  const int64_t part_cnt = 16;
+  TestRow *rows = static_cast<TestRow *>(alloc_.alloc(sizeof(TestRow) * cnt));
+  TestRow *part_rows = static_cast<TestRow *>(alloc_.alloc(sizeof(TestRow) * cnt + CACHE_ALIGN_SIZE));
+  ASSERT_TRUE(NULL != rows && NULL != part_rows);
+  part_rows = reinterpret_cast<TestRow *>(upper_align_buf(reinterpret_cast<char *>(part_rows),
+                                                          CACHE_ALIGN_SIZE));
+  for (int64_t i = 0; i < cnt; i++) {
+    rows[i].hash_ = murmurhash(&i, sizeof(i), 0);
+    rows[i].payload_ = i;
+  }
+  TestGetPart get_part(nbuckets - 1, __builtin_ctzll(nbuckets) - 4);
+  int64_t offsets[part_cnt + 1] = {0};
+  int64_t pos[part_cnt];
+  TestRow bufs[part_cnt * ObRadixScatter<TestRow>::SWWC_CNT];
+  ObRadixScatter<TestRow>::histogram(rows, cnt, get_part, offsets + 1);
+  for (int64_t i = 1; i <= part_cnt; i++) {
+    offsets[i] += offsets[i - 1];
+  }
+  ASSERT_EQ(cnt, offsets[part_cnt]);
+  ObRadixScatter<TestRow>::scatter(rows, cnt, get_part, part_cnt, offsets, bufs, pos, part_rows);
+  // every row lands in its partition and keeps the arrival order inside the partition
+  for (int64_t p = 0; p < part_cnt; p++) {
+    ASSERT_EQ(offsets[p + 1], pos[p]);
+    for (int64_t i = offsets[p]; i < offsets[p + 1]; i++) {
+      ASSERT_EQ(p, get_part(part_rows[i]));
+      if (i > offsets[p]) {
+        ASSERT_LT(part_rows[i - 1].payload_, part_rows[i].payload_);
+      }
+      ASSERT_EQ(rows[part_rows[i].payload_].hash_, part_rows[i].hash_);
+    }
+  }
+}
+
+TEST_F(TestHJRadixBuild, partitioner)
+{
+  ObHJPartition part(alloc_, OB_SERVER_TENANT_ID, 0, 0, 0);
+  fill_part(part);
+  const int64_t nbuckets = bucket_count(sizeof(GenericBucket));
+  TestMemCallback callback;
+  {
+    ObHJRadixPartitioner partitioner(alloc_);
+    partitioner.set_callback(&callback);
+    ASSERT_EQ(OB_SUCCESS, partitioner.init(nbuckets, sizeof(GenericBucket)));
+    JoinPartitionRowIter iter(&part);
+    int ret = OB_SUCCESS;
+    while (OB_SUCC(ret)) {
+      int64_t read_size = 0;
+      if (OB_SUCC(iter.get_next_batch(ctx_.stored_rows_, MAX_BATCH_SIZE, read_size))) {
+        ASSERT_EQ(OB_SUCCESS, partitioner.add_batch(ctx_.stored_rows_, read_size));
+      }
+    }
+    ASSERT_EQ(OB_ITER_END, ret);
+    ASSERT_EQ(ROW_COUNT, partitioner.get_row_count());
+    ASSERT_EQ(OB_SUCCESS, partitioner.partition(ctx_.build_row_meta_));
+    ASSERT_EQ(callback.used_, partitioner.get_mem_used());
+    ASSERT_GT(callback.used_, 0);
+
+    // every row is in the partition of its bucket position exactly once
+    const int64_t part_cnt = partitioner.get_part_count();
+    const int64_t part_buckets = nbuckets / part_cnt;
+    int64_t total = 0;
+    uint64_t hash_sum = 0;
+    for (int64_t p = 0; p < part_cnt; p++) {
+      ObHJRadixPartitioner::RowPtr *rows = NULL;
+      int64_t row_cnt = 0;
+      partitioner.get_part(p, rows, row_cnt);
+      for (int64_t i = 0; i < row_cnt; i++) {
+        const uint64_t bucket_pos = rows[i]->get_hash_value(ctx_.build_row_meta_) & (nbuckets - 1);
+        ASSERT_EQ(p, bucket_pos / part_buckets);
+        hash_sum += rows[i]->get_hash_value(ctx_.build_row_meta_);
+      }
+      total += row_cnt;
+    }
+    ASSERT_EQ(ROW_COUNT, total);
+    uint64_t expect_hash_sum = 0;
+    for (int64_t i = 0; i < ROW_COUNT; i++) {
+      expect_hash_sum += row_hash(i);
+    }
+    ASSERT_EQ(expect_hash_sum, hash_sum);
+  }
+  // all temporary memory is returned to the sql memory manager
+  ASSERT_EQ(0, callback.used_);
+  ASSERT_GT(callback.peak_, static_cast<int64_t>(sizeof(ObHJRadixPartitioner::RowPtr) * ROW_COUNT));
+}
+
+TEST_F(TestHJRadixBuild, radix_build)
+{
+  ObHJPartition direct_part(alloc_, OB_SERVER_TENANT_ID, 0, 0, 0);
+  ObHJPartition radix_part(alloc_, OB_SERVER_TENANT_ID, 0, 0, 1);
+  fill_part(direct_part);
+  fill_part(radix_part);
+  JoinHashTable direct_table;
+  JoinHashTable radix_table;
+  prepare_table(direct_table);
+  prepare_table(radix_table);
+  ASSERT_EQ(direct_table.get_nbuckets(), radix_table.get_nbuckets());
+
+  // arrival order build
+  {
+    JoinPartitionRowIter iter(&direct_part);
+    int ret = OB_SUCCESS;
+    int64_t used_buckets = 0;
+    int64_t collisions = 0;
+    while (OB_SUCC(ret)) {
+      int64_t read_size = 0;
+      if (OB_SUCC(iter.get_next_batch(ctx_.stored_rows_, MAX_BATCH_SIZE, read_size))) {
+        ASSERT_EQ(OB_SUCCESS, direct_table.hash_table_->insert_batch(
+            ctx_, const_cast<ObHJStoredRow **>(ctx_.stored_rows_), read_size,
+            used_buckets, collisions));
+      }
+    }
+    ASSERT_EQ(OB_ITER_END, ret);
+    direct_table.hash_table_->set_diag_info(used_buckets, collisions);
+  }
+  // radix partitioned build, temporary memory is tracked by the callback
+  TestMemCallback callback;
+  ctx_.mem_callback_ = &callback;
+  {
+    JoinPartitionRowIter iter(&radix_part);
+    ASSERT_EQ(OB_SUCCESS, radix_table.radix_build(iter, ctx_));
+  }
+  ctx_.mem_callback_ = NULL;
+  ASSERT_EQ(0, callback.used_);
+  ASSERT_GT(callback.peak_, 0);
+
+  // same buckets and the same rows of each hash value
+  ASSERT_EQ(ROW_COUNT / 2, radix_table.get_used_buckets());
+  ASSERT_EQ(direct_table.get_used_buckets(), radix_table.get_used_buckets());
+  for (int64_t i = 0; i < ROW_COUNT; i += 2) {
+    ASSERT_EQ(2, item_count(direct_table, row_hash(i)));
+    ASSERT_EQ(2, item_count(radix_table, row_hash(i)));
+  }
+  direct_table.free(&alloc_);
+  radix_table.free(&alloc_);
+}
+
+} // end namespace sql
+} // end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  OB_LOGGER.set_log_level("INFO");
+  oceanbase::sql::init_sql_factories();
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -305,6 +305,52 @@ TEST_F(TestParser, general_parser_escape)
 
 }
 
+TEST_F(TestParser, general_parser_skip_plain_bytes)
+{
+  const char *data =
+      "1,\"a long enclosed field with, comma and \\\"quote\\\" inside\",plain text longer than sixteen bytes\n"
+      "2,\xe4\xb8\xad\xe6\x96\x87\xe5\xad\x97\xe6\xae\xb5\xe8\xb6\x85\xe8\xbf\x87,\\N\n"
+      "3,abc\\,def,\"x\"\n";
+  const char *expect[] = {
+    "1", "a long enclosed field with, comma and \"quote\" inside", "plain text longer than sixteen bytes",
+    "2", "\xe4\xb8\xad\xe6\x96\x87\xe5\xad\x97\xe6\xae\xb5\xe8\xb6\x85\xe8\xbf\x87", "NULL",
+    "3", "abc,def", "x"};
+  const int64_t column_num = 3;
+  // utf8mb4 and binary skip plain bytes with simd, gbk goes through the char by char path
+  const ObCollationType cs_types[] = {CS_TYPE_UTF8MB4_BIN, CS_TYPE_BINARY, CS_TYPE_GBK_BIN};
+  for (int64_t i = 0; i < sizeof(cs_types) / sizeof(cs_types[0]); ++i) {
+    ObDataInFileStruct file_struct;
+    file_struct.field_term_str_ = ",";
+    file_struct.field_enclosed_str_ = "\"";
+    file_struct.field_enclosed_char_ = '"';
+    ObCSVGeneralParser parser;
+    ASSERT_EQ(OB_SUCCESS, parser.init(file_struct, column_num, cs_types[i]));
+
+    std::vector<std::string> results;
+    auto collect_fields = [&results](ObIArray<ObCSVGeneralParser::FieldValue> &arr) -> int {
+      for (int64_t j = 0; j < arr.count(); ++j) {
+        results.push_back(arr.at(j).is_null_ ? std::string("NULL") : std::string(arr.at(j).ptr_, arr.at(j).len_));
+      }
+      return OB_SUCCESS;
+    };
+    char escape_buf[1024];
+    ObSEArray<ObCSVGeneralParser::LineErrRec, 4> error_msgs;
+    const char *ptr = data;
+    const char *end = data + strlen(data);
+    int64_t nrows = INT64_MAX;
+    ASSERT_EQ(OB_SUCCESS, (parser.scan<decltype(collect_fields), true>(ptr, end, nrows,
+                                      escape_buf, escape_buf + sizeof(escape_buf),
+                                      collect_fields, error_msgs, false)));
+    ASSERT_EQ(3, nrows);
+    ASSERT_EQ(0, error_msgs.count());
+    ASSERT_EQ(end, ptr);
+    ASSERT_EQ(sizeof(expect) / sizeof(expect[0]), results.size());
+    for (int64_t j = 0; j < results.size(); ++j) {
+      ASSERT_EQ(std::string(expect[j]), results.at(j)) << "cs_type: " << cs_types[i] << ", field: " << j;
+    }
+  }
+}
+
 int main(int argc, char **argv)
 {
   init_sql_factories();
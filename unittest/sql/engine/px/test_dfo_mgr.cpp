@@ -14,19 +14,15 @@
 
 
 #include <gtest/gtest.h>
-#include <stdarg.h>
-#include "lib/tbsys.h"
-#include "sql/engine/ob_physical_plan_ctx.h"
-#include "sql/engine/ob_physical_plan.h"
+#define private public
+#define protected public
 #include "sql/engine/px/ob_dfo_mgr.h"
-#include "sql/engine/px/ob_px_coord.h"
-#include "lib/utility/ob_tracepoint.h"
+#undef private
+#undef protected
 
 using namespace oceanbase;
 using namespace oceanbase::common;
 using namespace oceanbase::sql;
-using namespace oceanbase::share;
-using namespace oceanbase::share::schema;
 
 class ObDFOMgrTest : public ::testing::Test
 {
@@ -36,13 +32,26 @@ public:
   virtual ~ObDFOMgrTest();
   virtual void SetUp();
   virtual void TearDown();
+protected:
+  // dfos of the plan, dfos_[0] is the root dfo
+  void create_dfos(const int64_t dfo_cnt);
+  void link(const int64_t parent, const int64_t child);
+  // build the schedule order of the dfo tree, each dfo takes %worker_cnt workers
+  void build(const int64_t worker_cnt, const int64_t admited_worker_cnt, const bool pipelined);
+  // the px coord schedules the dfos returned by get_ready_dfos
+  void schedule(ObIArray<ObDfo *> &dfos);
+  void finish(const int64_t idx) { dfos_.at(idx)->set_thread_finish(true); }
+  ObDfo *dfo(const int64_t idx) { return dfos_.at(idx); }
 private:
   // disallow copy
   DISALLOW_COPY_AND_ASSIGN(ObDFOMgrTest);
-private:
+protected:
   // data members
+  ObArenaAllocator allocator_;
+  ObDfoMgr dfo_mgr_;
+  ObArray<ObDfo *> dfos_;
 };
-ObDFOMgrTest::ObDFOMgrTest()
+ObDFOMgrTest::ObDFOMgrTest() : allocator_("DfoMgrTest"), dfo_mgr_(allocator_)
 {
 }
 
@@ -56,21 +65,58 @@ void ObDFOMgrTest::SetUp()
 
 void ObDFOMgrTest::TearDown()
 {
+  for (int64_t i = 0; i < dfos_.count(); ++i) {
+    dfos_.at(i)->~ObDfo();
+  }
+  dfos_.reset();
+}
+
+void ObDFOMgrTest::create_dfos(const int64_t dfo_cnt)
+{
+  for (int64_t i = 0; i < dfo_cnt; ++i) {
+    void *buf = allocator_.alloc(sizeof(ObDfo));
+    ASSERT_NE(nullptr, buf);
+    ObDfo *dfo = new (buf) ObDfo(allocator_);
+    dfo->set_dfo_id(i);
+    ASSERT_EQ(OB_SUCCESS, dfos_.push_back(dfo));
+  }
+  dfos_.at(0)->set_root_dfo(true);
+}
+
+void ObDFOMgrTest::link(const int64_t parent, const int64_t child)
+{
+  ASSERT_EQ(OB_SUCCESS, dfos_.at(parent)->append_child_dfo(dfos_.at(child)));
+  dfos_.at(child)->set_parent(dfos_.at(parent));
+}
+
+void ObDFOMgrTest::build(const int64_t worker_cnt, const int64_t admited_worker_cnt,
+                         const bool pipelined)
+{
+  for (int64_t i = 0; i < dfos_.count(); ++i) {
+    dfos_.at(i)->set_assigned_worker_count(0 == i ? 1 : worker_cnt);
+  }
+  dfo_mgr_.root_dfo_ = dfos_.at(0);
+  dfo_mgr_.admited_worker_count_ = admited_worker_cnt;
+  dfo_mgr_.enable_pipelined_sched_ = pipelined;
+  ASSERT_EQ(OB_SUCCESS, ObDfoSchedOrderGenerator::generate_sched_order(dfo_mgr_));
+}
+
+void ObDFOMgrTest::schedule(ObIArray<ObDfo *> &dfos)
+{
+  for (int64_t i = 0; i < dfos.count(); ++i) {
+    dfos.at(i)->set_scheduled();
+  }
 }
 
 TEST_F(ObDFOMgrTest, left_deep_tree)
 {
-  ObDFOMgr dfo_mgr;
-  ObDFO hash, prob, join, sort, qc;
-  ASSERT_EQ(OB_SUCCESS, qc.append_child_dfo(&sort));
-  ASSERT_EQ(OB_SUCCESS, sort.append_child_dfo(&join));
-  ASSERT_EQ(OB_SUCCESS, join.append_child_dfo(&hash));
-  ASSERT_EQ(OB_SUCCESS, join.append_child_dfo(&prob));
-
-  hash.set_parent(&join);
-  prob.set_parent(&join);
-  join.set_parent(&sort);
-  sort.set_parent(&qc);
+  // qc(0), sort(1), join(2), hash(3), prob(4)
+  create_dfos(5);
+  link(0, 1);
+  link(1, 2);
+  link(2, 3);
+  link(2, 4);
+  build(2, 100, false);
 
 /*
 
@@ -84,63 +130,58 @@ TEST_F(ObDFOMgrTest, left_deep_tree)
 
 */
 
-  ASSERT_EQ(OB_SUCCESS, ObDFOSchedOrderGenerator::generate(dfo_mgr, &qc));
+  ObArray<ObDfo *> dfos;
+  ASSERT_EQ(OB_SUCCESS, dfo_mgr_.get_ready_dfos(dfos));
+  ASSERT_EQ(2, dfos.count());
+  ASSERT_EQ(dfo(3), dfos.at(0));
+  ASSERT_EQ(dfo(2), dfos.at(1));
 
-  ObArray<ObDFO *> dfos;
-  ASSERT_EQ(OB_SUCCESS, dfo_mgr.get_ready_dfos(dfos));
-  ASSERT_TRUE(dfos.count() == 2);
-  ASSERT_TRUE(dfos.at(0) == &hash);
-  ASSERT_TRUE(dfos.at(1) == &join);
+  ASSERT_EQ(OB_SUCCESS, dfo_mgr_.get_ready_dfos(dfos));
+  ASSERT_EQ(0, dfos.count());
 
-  ASSERT_EQ(OB_SUCCESS, dfo_mgr.get_ready_dfos(dfos));
-  ASSERT_TRUE(dfos.count() == 0);
+  finish(3);
 
-  hash.set_state(ObDFOState::FINISH);
+  ASSERT_EQ(OB_SUCCESS, dfo_mgr_.get_ready_dfos(dfos));
+  ASSERT_EQ(2, dfos.count());
+  ASSERT_EQ(dfo(4), dfos.at(0));
+  ASSERT_EQ(dfo(2), dfos.at(1));
 
-  ASSERT_EQ(OB_SUCCESS, dfo_mgr.get_ready_dfos(dfos));
-  ASSERT_EQ(dfos.count(), 2);
-  ASSERT_TRUE(dfos.at(0) == &prob);
-  ASSERT_TRUE(dfos.at(1) == &join);
+  ASSERT_EQ(OB_SUCCESS, dfo_mgr_.get_ready_dfos(dfos));
+  ASSERT_EQ(0, dfos.count());
 
-  ASSERT_EQ(OB_SUCCESS, dfo_mgr.get_ready_dfos(dfos));
-  ASSERT_EQ(dfos.count(), 0);
+  finish(4);
 
-  prob.set_state(ObDFOState::FINISH);
+  ASSERT_EQ(OB_SUCCESS, dfo_mgr_.get_ready_dfos(dfos));
+  ASSERT_EQ(2, dfos.count());
+  ASSERT_EQ(dfo(2), dfos.at(0));
+  ASSERT_EQ(dfo(1), dfos.at(1));
 
-  ASSERT_EQ(OB_SUCCESS, dfo_mgr.get_ready_dfos(dfos));
-  ASSERT_TRUE(dfos.count() == 2);
-  ASSERT_TRUE(dfos.at(0) == &join);
-  ASSERT_TRUE(dfos.at(1) == &sort);
+  // root dfo is scheduled as soon as a child of the root edge is scheduled
+  ASSERT_EQ(OB_SUCCESS, dfo_mgr_.get_ready_dfos(dfos));
+  ASSERT_EQ(2, dfos.count());
+  ASSERT_EQ(dfo(1), dfos.at(0));
+  ASSERT_EQ(dfo(0), dfos.at(1));
 
-  join.set_state(ObDFOState::FINISH);
+  finish(2);
 
-  ASSERT_EQ(OB_SUCCESS, dfo_mgr.get_ready_dfos(dfos));
-  ASSERT_TRUE(dfos.count() == 2);
-  ASSERT_TRUE(dfos.at(0) == &sort);
-  ASSERT_TRUE(dfos.at(1) == &qc);
+  ASSERT_EQ(OB_SUCCESS, dfo_mgr_.get_ready_dfos(dfos));
+  ASSERT_EQ(0, dfos.count());
 
-  sort.set_state(ObDFOState::FINISH);
+  finish(1);
 
-  ASSERT_EQ(OB_ITER_END, dfo_mgr.get_ready_dfos(dfos));
+  ASSERT_EQ(OB_ITER_END, dfo_mgr_.get_ready_dfos(dfos));
 }
 
 TEST_F(ObDFOMgrTest, normalizer)
 {
-  ObDFOMgr dfo_mgr;
-  ObDFO h1, h2, prob, nlj, hj, sort, qc;
-
-  ASSERT_EQ(OB_SUCCESS, qc.append_child_dfo(&hj));
-  ASSERT_EQ(OB_SUCCESS, hj.append_child_dfo(&h2));
-  ASSERT_EQ(OB_SUCCESS, hj.append_child_dfo(&nlj));
-  ASSERT_EQ(OB_SUCCESS, nlj.append_child_dfo(&h1));
-  ASSERT_EQ(OB_SUCCESS, nlj.append_child_dfo(&prob));
-  h1.set_parent(&nlj);
-  prob.set_parent(&nlj);
-  h2.set_parent(&hj);
-  nlj.set_parent(&hj);
-  hj.set_parent(&qc);
-
-  ASSERT_EQ(OB_SUCCESS, ObDFOSchedOrderGenerator::generate(dfo_mgr, &qc));
+  // qc(0), hj(1), h2(2), nlj(3), h1(4), prob(5)
+  create_dfos(6);
+  link(0, 1);
+  link(1, 2);
+  link(1, 3);
+  link(3, 4);
+  link(3, 5);
+  build(2, 100, false);
 
 /*
 
@@ -154,137 +195,229 @@ TEST_F(ObDFOMgrTest, normalizer)
 
 */
 
-  // 遍历 edge，然后逐个加入 dfo_mgr
-  ObDFO *c1,*c2;
-  ASSERT_EQ(OB_SUCCESS, nlj.get_child_dfo(0, c1));
-  ASSERT_EQ(OB_SUCCESS, nlj.get_child_dfo(1, c2));
-  ASSERT_EQ(&h1, c1);
-  ASSERT_EQ(&prob, c2);
+  // nlj is swung to the first child of hj, and depends on h2
+  ObDfo *c1, *c2;
+  ASSERT_EQ(OB_SUCCESS, dfo(3)->get_child_dfo(0, c1));
+  ASSERT_EQ(OB_SUCCESS, dfo(3)->get_child_dfo(1, c2));
+  ASSERT_EQ(dfo(4), c1);
+  ASSERT_EQ(dfo(5), c2);
 
-  ASSERT_EQ(OB_SUCCESS, hj.get_child_dfo(0, c1));
-  ASSERT_EQ(OB_SUCCESS, hj.get_child_dfo(1, c2));
-  ASSERT_EQ(&nlj, c1);
-  ASSERT_EQ(&h2, c2);
+  ASSERT_EQ(OB_SUCCESS, dfo(1)->get_child_dfo(0, c1));
+  ASSERT_EQ(OB_SUCCESS, dfo(1)->get_child_dfo(1, c2));
+  ASSERT_EQ(dfo(3), c1);
+  ASSERT_EQ(dfo(2), c2);
+  ASSERT_TRUE(dfo(3)->has_depend_sibling());
+  ASSERT_EQ(dfo(2), dfo(3)->depend_sibling());
 
-  ASSERT_EQ(OB_SUCCESS, qc.get_child_dfo(0, c1));
-  ASSERT_EQ(&hj, c1);
+  ASSERT_EQ(OB_SUCCESS, dfo(0)->get_child_dfo(0, c1));
+  ASSERT_EQ(dfo(1), c1);
 
+  ObArray<ObDfo *> dfos;
+  ASSERT_EQ(OB_SUCCESS, dfo_mgr_.get_ready_dfos(dfos));
+  ASSERT_EQ(2, dfos.count());
+  ASSERT_EQ(dfo(4), dfos.at(0));
+  ASSERT_EQ(dfo(3), dfos.at(1));
 
-  ObArray<ObDFO *> dfos;
-  ASSERT_EQ(OB_SUCCESS, dfo_mgr.get_ready_dfos(dfos));
-  ASSERT_EQ(dfos.count(), 2);
-  ASSERT_EQ(dfos.at(0), &h1);
-  ASSERT_EQ(dfos.at(1), &nlj);
+  ASSERT_EQ(OB_SUCCESS, dfo_mgr_.get_ready_dfos(dfos));
+  ASSERT_EQ(0, dfos.count());
 
-  ASSERT_EQ(OB_SUCCESS, dfo_mgr.get_ready_dfos(dfos));
-  ASSERT_EQ(dfos.count(), 0);
+  finish(4);
 
-  h1.set_state(ObDFOState::FINISH);
+  ASSERT_EQ(OB_SUCCESS, dfo_mgr_.get_ready_dfos(dfos));
+  ASSERT_EQ(2, dfos.count());
+  ASSERT_EQ(dfo(5), dfos.at(0));
+  ASSERT_EQ(dfo(3), dfos.at(1));
 
-  ASSERT_EQ(OB_SUCCESS, dfo_mgr.get_ready_dfos(dfos));
-  ASSERT_EQ(dfos.count(), 2);
-  ASSERT_EQ(dfos.at(0), &prob);
-  ASSERT_EQ(dfos.at(1), &nlj);
+  finish(5);
 
-  prob.set_state(ObDFOState::FINISH);
+  ASSERT_EQ(OB_SUCCESS, dfo_mgr_.get_ready_dfos(dfos));
+  ASSERT_EQ(2, dfos.count());
+  ASSERT_EQ(dfo(3), dfos.at(0));
+  ASSERT_EQ(dfo(1), dfos.at(1));
 
-  ASSERT_EQ(OB_SUCCESS, dfo_mgr.get_ready_dfos(dfos));
-  ASSERT_EQ(dfos.count(), 2);
-  ASSERT_EQ(dfos.at(0), &nlj);
-  ASSERT_EQ(dfos.at(1), &hj);
+  ASSERT_EQ(OB_SUCCESS, dfo_mgr_.get_ready_dfos(dfos));
+  ASSERT_EQ(2, dfos.count());
+  ASSERT_EQ(dfo(2), dfos.at(0));
+  ASSERT_EQ(dfo(1), dfos.at(1));
 
-  ASSERT_EQ(OB_SUCCESS, dfo_mgr.get_ready_dfos(dfos));
-  ASSERT_EQ(dfos.count(), 2);
-  ASSERT_EQ(dfos.at(0), &h2);
-  ASSERT_EQ(dfos.at(1), &hj);
+  finish(2);
 
-  h2.set_state(ObDFOState::FINISH);
+  ASSERT_EQ(OB_SUCCESS, dfo_mgr_.get_ready_dfos(dfos));
+  ASSERT_EQ(2, dfos.count());
+  ASSERT_EQ(dfo(1), dfos.at(0));
+  ASSERT_EQ(dfo(0), dfos.at(1));
 
-  ASSERT_EQ(OB_SUCCESS, dfo_mgr.get_ready_dfos(dfos));
-  ASSERT_EQ(dfos.count(), 0);
+  finish(3);
 
-  nlj.set_state(ObDFOState::FINISH);
+  ASSERT_EQ(OB_SUCCESS, dfo_mgr_.get_ready_dfos(dfos));
+  ASSERT_EQ(0, dfos.count());
 
-  ASSERT_EQ(OB_SUCCESS, dfo_mgr.get_ready_dfos(dfos));
-  ASSERT_EQ(dfos.count(), 2);
-  ASSERT_EQ(dfos.at(0), &hj);
-  ASSERT_EQ(dfos.at(1), &qc);
+  finish(1);
 
-  hj.set_state(ObDFOState::FINISH);
+  ASSERT_EQ(OB_ITER_END, dfo_mgr_.get_ready_dfos(dfos));
+}
 
-  ASSERT_EQ(OB_ITER_END, dfo_mgr.get_ready_dfos(dfos));
+/*
+ * bushy tree, edges are (1,3) (2,3) (3,7) (4,6) (5,6) (6,7) (7,qc)
+ *
+ *                qc
+ *                |
+ *               dfo7
+ *             /      \
+ *          dfo3      dfo6
+ *         /   \     /    \
+ *      dfo1  dfo2 dfo4  dfo5
+ */
+#define BUILD_BUSHY_TREE(admited_worker_cnt, pipelined) \
+  create_dfos(8);                                        \
+  link(0, 7);                                            \
+  link(7, 3);                                            \
+  link(7, 6);                                            \
+  link(3, 1);                                            \
+  link(3, 2);                                            \
+  link(6, 4);                                            \
+  link(6, 5);                                            \
+  build(2, admited_worker_cnt, pipelined);
+
+#define CHECK_READY_DFOS(cnt, ...)                                  \
+  {                                                                 \
+    const int64_t expected[] = {-1, ##__VA_ARGS__};                 \
+    ASSERT_EQ(OB_SUCCESS, dfo_mgr_.get_ready_dfos(dfos));           \
+    ASSERT_EQ(cnt, dfos.count());                                   \
+    for (int64_t i = 0; i < cnt; ++i) {                             \
+      ASSERT_EQ(dfo(expected[i + 1]), dfos.at(i)) << "pos: " << i;  \
+    }                                                               \
+    schedule(dfos);                                                 \
+  }
+
+TEST_F(ObDFOMgrTest, bushy_tree_pipelined)
+{
+  BUILD_BUSHY_TREE(100, true);
+  ObArray<ObDfo *> dfos;
+  CHECK_READY_DFOS(2, 1, 3);
+  // the probe side leaf starts while the build side is running
+  CHECK_READY_DFOS(2, 2, 3);
+  CHECK_READY_DFOS(0);
+  finish(1);
+  // the next edge is not a leaf
+  CHECK_READY_DFOS(0);
+  finish(2);
+  CHECK_READY_DFOS(2, 3, 7);
+  CHECK_READY_DFOS(2, 7, 0);
+  // the build of the right subtree starts while the left subtree is running
+  CHECK_READY_DFOS(2, 4, 6);
+  CHECK_READY_DFOS(0);
+  finish(4);
+  CHECK_READY_DFOS(2, 5, 6);
+  CHECK_READY_DFOS(0);
+  finish(3);
+  finish(5);
+  CHECK_READY_DFOS(2, 6, 7);
+  CHECK_READY_DFOS(0);
+  finish(6);
+  CHECK_READY_DFOS(0);
+  finish(7);
+  ASSERT_EQ(OB_ITER_END, dfo_mgr_.get_ready_dfos(dfos));
 }
 
+TEST_F(ObDFOMgrTest, bushy_tree_not_pipelined)
+{
+  BUILD_BUSHY_TREE(100, false);
+  ObArray<ObDfo *> dfos;
+  CHECK_READY_DFOS(2, 1, 3);
+  CHECK_READY_DFOS(0);
+  finish(1);
+  CHECK_READY_DFOS(2, 2, 3);
+  finish(2);
+  CHECK_READY_DFOS(2, 3, 7);
+  CHECK_READY_DFOS(2, 7, 0);
+  CHECK_READY_DFOS(0);
+  finish(3);
+  CHECK_READY_DFOS(2, 4, 6);
+  CHECK_READY_DFOS(0);
+  finish(4);
+  CHECK_READY_DFOS(2, 5, 6);
+  finish(5);
+  CHECK_READY_DFOS(2, 6, 7);
+  finish(6);
+  CHECK_READY_DFOS(0);
+  finish(7);
+  ASSERT_EQ(OB_ITER_END, dfo_mgr_.get_ready_dfos(dfos));
+}
 
+TEST_F(ObDFOMgrTest, bushy_tree_worker_limit)
+{
+  // dfo 3, 7 and the next dfo 4, 6 need 8 workers
+  BUILD_BUSHY_TREE(6, true);
+  ObArray<ObDfo *> dfos;
+  CHECK_READY_DFOS(2, 1, 3);
+  CHECK_READY_DFOS(2, 2, 3);
+  finish(1);
+  finish(2);
+  CHECK_READY_DFOS(2, 3, 7);
+  CHECK_READY_DFOS(2, 7, 0);
+  CHECK_READY_DFOS(0);
+  // workers of dfo 3 are released
+  finish(3);
+  CHECK_READY_DFOS(2, 4, 6);
+  // dfo 4, 6 and 7 use 6 workers
+  CHECK_READY_DFOS(0);
+  finish(4);
+  CHECK_READY_DFOS(2, 5, 6);
+}
 
-TEST_F(ObDFOMgrTest, px_coord)
+TEST_F(ObDFOMgrTest, bushy_tree_force_bushy)
 {
-  class MyRunnable : public share::ObThreadPool
-  {
-  public:
-    void run1()
-    {
-      int ret = OB_SUCCESS;
-      LOG_INFO("start thread", K(thread));
-      ObPXCoord *coord = reinterpret_cast<ObPXCoord *>(arg);
-      if (OB_FAIL(coord->open())) {
-        LOG_WARN("fail open coord", K(ret));
-      }
-      LOG_INFO("end thread", K(thread));
-    }
-  };
-
-  ObPXCoord coord;
-  ObDFO h1, h2, prob, nlj, hj, qc;
-
-  ASSERT_EQ(OB_SUCCESS, qc.append_child_dfo(&hj));
-  ASSERT_EQ(OB_SUCCESS, hj.append_child_dfo(&h2));
-  ASSERT_EQ(OB_SUCCESS, hj.append_child_dfo(&nlj));
-  ASSERT_EQ(OB_SUCCESS, nlj.append_child_dfo(&h1));
-  ASSERT_EQ(OB_SUCCESS, nlj.append_child_dfo(&prob));
-  h1.set_parent(&nlj);
-  prob.set_parent(&nlj);
-  h2.set_parent(&hj);
-  nlj.set_parent(&hj);
-  hj.set_parent(&qc);
-  h1.set_id(1);
-  prob.set_id(2);
-  h2.set_id(3);
-  nlj.set_id(4);
-  hj.set_id(5);
-  qc.set_id(6);
+  BUILD_BUSHY_TREE(100, true);
+  // dfo 6 waits for the runtime filter of dfo 7
+  dfo(6)->set_force_bushy(true);
+  ObArray<ObDfo *> dfos;
+  CHECK_READY_DFOS(2, 1, 3);
+  CHECK_READY_DFOS(2, 2, 3);
+  finish(1);
+  finish(2);
+  CHECK_READY_DFOS(2, 3, 7);
+  CHECK_READY_DFOS(2, 7, 0);
+  CHECK_READY_DFOS(0);
+  finish(3);
+  CHECK_READY_DFOS(2, 4, 6);
+}
 
 /*
-
-              qc
-               / (e5)
-              hj
-        (e4)/    \  (e3)
-          h2     nlj
-           (e1)  /   \ (e2)
-               h1    prob
-
-*/
-
-
-  coord.set_dfo_tree(qc);
-
-  MyRunnable myrun;
-  obsys::CThread px_thread;
-  px_thread.start(&myrun, &coord);
-
-  // 模拟消息到达
-  h2.set_state(ObDFOState::FINISH);
-  h1.set_state(ObDFOState::FINISH);
-  usleep(1000 * 1000);
-  prob.set_state(ObDFOState::FINISH);
-  usleep(2000 * 1000);
-  nlj.set_state(ObDFOState::FINISH);
-  usleep(2000 * 1000);
-  hj.set_state(ObDFOState::FINISH);
-  usleep(2000 * 1000);
-
-  px_thread.join();
+ * three levels with a leaf under the top join, edges are (1,3) (2,3) (3,5) (4,5) (5,qc)
+ *
+ *              qc
+ *              |
+ *             dfo5
+ *            /    \
+ *         dfo3    dfo4
+ *        /    \
+ *     dfo1    dfo2
+ */
+TEST_F(ObDFOMgrTest, three_level_tree_pipelined)
+{
+  create_dfos(6);
+  link(0, 5);
+  link(5, 3);
+  link(5, 4);
+  link(3, 1);
+  link(3, 2);
+  build(2, 100, true);
+  ObArray<ObDfo *> dfos;
+  CHECK_READY_DFOS(2, 1, 3);
+  CHECK_READY_DFOS(2, 2, 3);
+  finish(1);
+  finish(2);
+  CHECK_READY_DFOS(2, 3, 5);
+  CHECK_READY_DFOS(2, 5, 0);
+  // the parent of the leaf is scheduled already
+  CHECK_READY_DFOS(2, 4, 5);
+  CHECK_READY_DFOS(0);
+  finish(3);
+  finish(4);
+  CHECK_READY_DFOS(0);
+  finish(5);
+  ASSERT_EQ(OB_ITER_END, dfo_mgr_.get_ready_dfos(dfos));
 }
 
 int main(int argc, char **argv)
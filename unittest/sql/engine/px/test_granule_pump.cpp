@@ -0,0 +1,250 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL_EXE
+#include <gtest/gtest.h>
+#include <thread>
+#include <atomic>
+#include <vector>
+#define private public
+#define protected public
+#include "sql/engine/px/ob_granule_pump.h"
+#undef private
+#undef protected
+#include "sql/ob_sql_init.h"
+
+using namespace oceanbase;
+using namespace oceanbase::common;
+using namespace oceanbase::sql;
+
+namespace
+{
+const uint64_t TEST_TSC_OP_ID = 1;
+const int64_t TEST_GRANULE_COUNT = 4;
+const int64_t TEST_PARALLELISM = 8;
+}
+
+class ObGranulePumpSplitTest : public ::testing::Test
+{
+public:
+  ObGranulePumpSplitTest() : allocator_("GIPumpTest") {}
+  virtual ~ObGranulePumpSplitTest() = default;
+  virtual void SetUp() {}
+  virtual void TearDown() { pump_.destroy(); }
+
+protected:
+  // range [start, end) of a single int rowkey column
+  void make_range(const int64_t start, const int64_t end, ObNewRange &range)
+  {
+    ObObj *objs = static_cast<ObObj *>(allocator_.alloc(sizeof(ObObj) * 2));
+    ASSERT_NE(nullptr, objs);
+    objs[0].set_int(start);
+    objs[1].set_int(end);
+    range.table_id_ = 1;
+    range.start_key_.assign(&objs[0], 1);
+    range.end_key_.assign(&objs[1], 1);
+    range.border_flag_.set_inclusive_start();
+    range.border_flag_.unset_inclusive_end();
+  }
+  // the shared pool of %granule_cnt single range granules, with space for %split_cnt more
+  void prepare_pump(const int64_t granule_cnt, const int64_t split_cnt, const bool can_split)
+  {
+    ASSERT_EQ(OB_SUCCESS, pump_.gi_task_array_map_.prepare_allocate(1));
+    GITaskArrayItem &item = pump_.gi_task_array_map_.at(0);
+    item.tsc_op_id_ = TEST_TSC_OP_ID;
+    item.can_split_ = can_split;
+    ASSERT_EQ(OB_SUCCESS, item.taskset_array_.prepare_allocate(1));
+    ObGITaskSet &taskset = get_shared_pool();
+    ASSERT_EQ(OB_SUCCESS, taskset.gi_task_set_.reserve(granule_cnt + split_cnt));
+    for (int64_t i = 0; i < granule_cnt; ++i) {
+      ObGITaskSet::ObGITaskInfo task_info;
+      make_range(i * 1000, (i + 1) * 1000, task_info.range_);
+      task_info.idx_ = i;
+      ASSERT_EQ(OB_SUCCESS, taskset.gi_task_set_.push_back(task_info));
+    }
+    pump_.splitter_type_ = ObGranulePump::GIT_RANDOM;
+    pump_.parallelism_ = TEST_PARALLELISM;
+    pump_.enable_granule_split_ = can_split;
+  }
+  ObGITaskSet &get_shared_pool()
+  {
+    return pump_.gi_task_array_map_.at(0).taskset_array_.at(ObGranulePump::OB_GRANULE_SHARED_POOL_POS);
+  }
+  int64_t get_start(const ObNewRange &range) { return range.start_key_.get_obj_ptr()[0].get_int(); }
+  int64_t get_end(const ObNewRange &range) { return range.end_key_.get_obj_ptr()[0].get_int(); }
+
+protected:
+  ObArenaAllocator allocator_;
+  ObGranulePump pump_;
+};
+
+TEST_F(ObGranulePumpSplitTest, need_split)
+{
+  prepare_pump(TEST_GRANULE_COUNT, TEST_PARALLELISM, true);
+  // less granules than workers are left
+  ASSERT_TRUE(pump_.need_split_granule_task(TEST_TSC_OP_ID));
+  ASSERT_FALSE(pump_.need_split_granule_task(TEST_TSC_OP_ID + 1));
+  // enough granules are left
+  ObGITaskSet &taskset = get_shared_pool();
+  for (int64_t i = 0; i < TEST_PARALLELISM; ++i) {
+    ASSERT_EQ(OB_SUCCESS, taskset.gi_task_set_.push_back(taskset.gi_task_set_.at(0)));
+  }
+  ASSERT_FALSE(pump_.need_split_granule_task(TEST_TSC_OP_ID));
+}
+
+TEST_F(ObGranulePumpSplitTest, need_split_disabled)
+{
+  prepare_pump(TEST_GRANULE_COUNT, TEST_PARALLELISM, false);
+  ASSERT_FALSE(pump_.need_split_granule_task(TEST_TSC_OP_ID));
+  ObNewRange first;
+  ObNewRange second;
+  bool split = false;
+  make_range(0, 500, first);
+  make_range(500, 1000, second);
+  ASSERT_EQ(OB_SUCCESS, pump_.add_split_granule_task(TEST_TSC_OP_ID, 0, first, second, split));
+  ASSERT_FALSE(split);
+  ASSERT_EQ(TEST_GRANULE_COUNT, get_shared_pool().gi_task_set_.count());
+}
+
+TEST_F(ObGranulePumpSplitTest, add_split_granule_task)
+{
+  prepare_pump(TEST_GRANULE_COUNT, 1, true);
+  ObGITaskSet &taskset = get_shared_pool();
+  ObNewRange first;
+  ObNewRange second;
+  bool split = false;
+  make_range(1000, 1500, first);
+  make_range(1500, 2000, second);
+
+  ASSERT_EQ(OB_INVALID_ARGUMENT, pump_.add_split_granule_task(TEST_TSC_OP_ID, TEST_GRANULE_COUNT,
+                                                              first, second, split));
+  ASSERT_FALSE(split);
+  ASSERT_EQ(OB_ERR_UNEXPECTED, pump_.add_split_granule_task(TEST_TSC_OP_ID + 1, 1,
+                                                            first, second, split));
+
+  ASSERT_EQ(OB_SUCCESS, pump_.add_split_granule_task(TEST_TSC_OP_ID, 1, first, second, split));
+  ASSERT_TRUE(split);
+  ASSERT_EQ(TEST_GRANULE_COUNT + 1, taskset.gi_task_set_.count());
+  ASSERT_EQ(1, pump_.gi_task_array_map_.at(0).split_cnt_);
+  // the ranges are copied by the pump
+  first.start_key_.get_obj_ptr()[0].set_int(-1);
+  second.start_key_.get_obj_ptr()[0].set_int(-1);
+
+  ObGranuleTaskInfo info;
+  ASSERT_EQ(OB_SUCCESS, pump_.get_task_at_pos(taskset, info, 1));
+  ASSERT_EQ(1, info.ranges_.count());
+  ASSERT_EQ(1000, get_start(info.ranges_.at(0)));
+  ASSERT_EQ(1500, get_end(info.ranges_.at(0)));
+  ASSERT_EQ(OB_SUCCESS, pump_.get_task_at_pos(taskset, info, TEST_GRANULE_COUNT));
+  ASSERT_EQ(1, info.ranges_.count());
+  ASSERT_EQ(1500, get_start(info.ranges_.at(0)));
+  ASSERT_EQ(2000, get_end(info.ranges_.at(0)));
+  ASSERT_EQ(-1, taskset.gi_task_set_.at(TEST_GRANULE_COUNT).idx_);
+
+  // no space left, the reserved capacity is rounded up to the array block size
+  while (taskset.gi_task_set_.count() < taskset.gi_task_set_.get_capacity()) {
+    ASSERT_EQ(OB_SUCCESS, taskset.gi_task_set_.push_back(taskset.gi_task_set_.at(TEST_GRANULE_COUNT)));
+  }
+  const int64_t full_cnt = taskset.gi_task_set_.count();
+  make_range(0, 500, first);
+  make_range(500, 1000, second);
+  ASSERT_EQ(OB_SUCCESS, pump_.add_split_granule_task(TEST_TSC_OP_ID, 0, first, second, split));
+  ASSERT_FALSE(split);
+  ASSERT_EQ(full_cnt, taskset.gi_task_set_.count());
+}
+
+TEST_F(ObGranulePumpSplitTest, multi_range_granule)
+{
+  prepare_pump(TEST_GRANULE_COUNT, TEST_PARALLELISM, true);
+  ObGITaskSet &taskset = get_shared_pool();
+  // granule 0 has two ranges
+  taskset.gi_task_set_.at(1).idx_ = 0;
+  ObNewRange first;
+  ObNewRange second;
+  bool split = false;
+  make_range(0, 500, first);
+  make_range(500, 1000, second);
+  ASSERT_EQ(OB_SUCCESS, pump_.add_split_granule_task(TEST_TSC_OP_ID, 0, first, second, split));
+  ASSERT_FALSE(split);
+  ObGranuleTaskInfo info;
+  ASSERT_EQ(OB_SUCCESS, pump_.get_task_at_pos(taskset, info, 0));
+  ASSERT_EQ(2, info.ranges_.count());
+}
+
+// workers split granules while others read granules of the shared pool
+TEST_F(ObGranulePumpSplitTest, concurrent_split_and_get)
+{
+  const int64_t thread_cnt = 8;
+  const int64_t split_per_thread = 64;
+  const int64_t split_cnt = thread_cnt / 2 * split_per_thread;
+  prepare_pump(TEST_GRANULE_COUNT, split_cnt, true);
+  ObGITaskSet &taskset = get_shared_pool();
+  std::atomic<int64_t> succ_split_cnt(0);
+  std::atomic<int64_t> fail_cnt(0);
+  std::vector<std::thread> threads;
+  for (int64_t t = 0; t < thread_cnt; ++t) {
+    threads.push_back(std::thread([&, t]() {
+      ObArenaAllocator range_alloc("GIPumpTest");
+      for (int64_t i = 0; i < split_per_thread; ++i) {
+        if (0 == t % 2) {
+          // split granule t / 2 into ranges of the same bounds, so readers always see
+          // a granule of the original bounds
+          const int64_t pos = t / 2 % TEST_GRANULE_COUNT;
+          ObObj *objs = static_cast<ObObj *>(range_alloc.alloc(sizeof(ObObj) * 2));
+          ObNewRange first;
+          ObNewRange second;
+          bool split = false;
+          objs[0].set_int(pos * 1000);
+          objs[1].set_int((pos + 1) * 1000);
+          first.table_id_ = 1;
+          first.start_key_.assign(&objs[0], 1);
+          first.end_key_.assign(&objs[1], 1);
+          second = first;
+          if (OB_SUCCESS != pump_.add_split_granule_task(TEST_TSC_OP_ID, pos, first, second, split)) {
+            ++fail_cnt;
+          } else if (split) {
+            ++succ_split_cnt;
+          }
+        } else {
+          for (int64_t pos = 0; pos < TEST_GRANULE_COUNT; ++pos) {
+            ObGranuleTaskInfo info;
+            if (OB_SUCCESS != pump_.get_task_at_pos(taskset, info, pos)
+                || 1 != info.ranges_.count()
+                || pos * 1000 != get_start(info.ranges_.at(0))
+                || (pos + 1) * 1000 != get_end(info.ranges_.at(0))) {
+              ++fail_cnt;
+            }
+          }
+        }
+      }
+    }));
+  }
+  for (int64_t t = 0; t < thread_cnt; ++t) {
+    threads[t].join();
+  }
+  ASSERT_EQ(0, fail_cnt.load());
+  ASSERT_EQ(split_cnt, succ_split_cnt.load());
+  ASSERT_EQ(TEST_GRANULE_COUNT + split_cnt, taskset.gi_task_set_.count());
+  ASSERT_EQ(split_cnt, pump_.gi_task_array_map_.at(0).split_cnt_);
+  // split granules have distinct negative idx
+  for (int64_t i = TEST_GRANULE_COUNT; i < taskset.gi_task_set_.count(); ++i) {
+    ASSERT_EQ(TEST_GRANULE_COUNT - 1 - i, taskset.gi_task_set_.at(i).idx_);
+  }
+}
+
+int main(int argc, char **argv)
+{
+  OB_LOGGER.set_log_level("INFO");
+  init_sql_factories();
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
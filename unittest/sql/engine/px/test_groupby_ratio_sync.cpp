@@ -0,0 +1,230 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL_EXE
+#include <gtest/gtest.h>
+
+#include "sql/ob_sql_init.h"
+#include "sql/engine/aggregate/ob_adaptive_bypass_ctrl.h"
+#include "sql/engine/px/datahub/components/ob_dh_groupby_ratio.h"
+
+using namespace oceanbase;
+using namespace oceanbase::common;
+using namespace oceanbase::sql;
+
+class ObGroupByRatioSyncTest : public ::testing::Test
+{
+public:
+  ObGroupByRatioSyncTest() = default;
+  virtual ~ObGroupByRatioSyncTest() = default;
+  virtual void SetUp() {};
+  virtual void TearDown() {};
+
+private:
+  // disallow copy
+  ObGroupByRatioSyncTest(const ObGroupByRatioSyncTest &other);
+  ObGroupByRatioSyncTest& operator=(const ObGroupByRatioSyncTest &other);
+};
+
+static void make_info(int64_t probe_cnt, int64_t ndv_cnt, ObGroupByRatioInfo &info)
+{
+  info.probe_cnt_ = probe_cnt;
+  info.ndv_cnt_ = ndv_cnt;
+  info.task_cnt_ = 1;
+}
+
+TEST_F(ObGroupByRatioSyncTest, ratio_info)
+{
+  ObGroupByRatioInfo info;
+  ASSERT_EQ(0, info.get_ratio());
+
+  ObGroupByRatioInfo piece;
+  make_info(1000, 100, piece);
+  info.merge(piece);
+  ASSERT_DOUBLE_EQ(0.9, info.get_ratio());
+
+  make_info(1000, 900, piece);
+  info.merge(piece);
+  ASSERT_EQ(2000, info.probe_cnt_);
+  ASSERT_EQ(1000, info.ndv_cnt_);
+  ASSERT_EQ(2, info.task_cnt_);
+  ASSERT_DOUBLE_EQ(0.5, info.get_ratio());
+
+  // worker without any probed row does not change the ratio
+  make_info(0, 0, piece);
+  info.merge(piece);
+  ASSERT_DOUBLE_EQ(0.5, info.get_ratio());
+  ASSERT_EQ(3, info.task_cnt_);
+
+  info.reset();
+  ASSERT_EQ(0, info.probe_cnt_);
+  ASSERT_EQ(0, info.get_ratio());
+}
+
+TEST_F(ObGroupByRatioSyncTest, serialize)
+{
+  char buf[1024];
+  ObGroupByRatioPieceMsg piece;
+  piece.op_id_ = 7;
+  piece.thread_id_ = 3;
+  make_info(12345, 678, piece.ratio_info_);
+  int64_t pos = 0;
+  ASSERT_EQ(OB_SUCCESS, piece.serialize(buf, sizeof(buf), pos));
+  ASSERT_EQ(pos, piece.get_serialize_size());
+  ObGroupByRatioPieceMsg piece2;
+  int64_t data_len = pos;
+  pos = 0;
+  ASSERT_EQ(OB_SUCCESS, piece2.deserialize(buf, data_len, pos));
+  ASSERT_EQ(data_len, pos);
+  ASSERT_EQ(7, piece2.op_id_);
+  ASSERT_EQ(3, piece2.thread_id_);
+  ASSERT_EQ(12345, piece2.ratio_info_.probe_cnt_);
+  ASSERT_EQ(678, piece2.ratio_info_.ndv_cnt_);
+  ASSERT_EQ(1, piece2.ratio_info_.task_cnt_);
+
+  ObGroupByRatioWholeMsg whole;
+  whole.op_id_ = 7;
+  make_info(100, 10, whole.ratio_info_);
+  whole.ratio_info_.task_cnt_ = 4;
+  pos = 0;
+  ASSERT_EQ(OB_SUCCESS, whole.serialize(buf, sizeof(buf), pos));
+  ObGroupByRatioWholeMsg whole2;
+  data_len = pos;
+  pos = 0;
+  ASSERT_EQ(OB_SUCCESS, whole2.deserialize(buf, data_len, pos));
+  ASSERT_EQ(7, whole2.op_id_);
+  ASSERT_EQ(100, whole2.ratio_info_.probe_cnt_);
+  ASSERT_EQ(10, whole2.ratio_info_.ndv_cnt_);
+  ASSERT_EQ(4, whole2.ratio_info_.task_cnt_);
+}
+
+TEST_F(ObGroupByRatioSyncTest, listener)
+{
+  const int64_t task_cnt = 3;
+  ObGroupByRatioPieceMsgCtx ctx(7, task_cnt, INT64_MAX);
+  ObSEArray<ObPxSqcMeta *, 1> sqcs;
+  ObGroupByRatioPieceMsg piece;
+  piece.op_id_ = 7;
+  make_info(1000, 100, piece.ratio_info_);
+  for (int64_t i = 0; i < task_cnt - 1; ++i) {
+    ASSERT_EQ(OB_SUCCESS, ObGroupByRatioPieceMsgListener::on_message(ctx, sqcs, piece));
+  }
+  ASSERT_EQ(task_cnt - 1, ctx.received_);
+  ASSERT_EQ(2000, ctx.whole_msg_.ratio_info_.probe_cnt_);
+  ASSERT_EQ(200, ctx.whole_msg_.ratio_info_.ndv_cnt_);
+
+  // piece of another operator is rejected
+  ObGroupByRatioPieceMsg other;
+  other.op_id_ = 8;
+  ASSERT_EQ(OB_ERR_UNEXPECTED, ObGroupByRatioPieceMsgListener::on_message(ctx, sqcs, other));
+  ASSERT_EQ(task_cnt - 1, ctx.received_);
+
+  // the last piece triggers the whole msg and resets the ctx for the next round
+  ASSERT_EQ(OB_SUCCESS, ObGroupByRatioPieceMsgListener::on_message(ctx, sqcs, piece));
+  ASSERT_EQ(0, ctx.received_);
+  ASSERT_EQ(0, ctx.whole_msg_.ratio_info_.probe_cnt_);
+
+  // more pieces than tasks
+  ObGroupByRatioPieceMsgCtx small_ctx(7, 0, INT64_MAX);
+  ASSERT_EQ(OB_ERR_UNEXPECTED, ObGroupByRatioPieceMsgListener::on_message(small_ctx, sqcs, piece));
+}
+
+TEST_F(ObGroupByRatioSyncTest, sync_not_opened)
+{
+  // _px_share_groupby_reduction_ratio off: ratio is never reported nor fetched
+  ObAdaptiveByPassCtrl ctrl;
+  ctrl.open_by_pass_ctrl();
+  ASSERT_FALSE(ctrl.need_report_ratio());
+  ASSERT_FALSE(ctrl.need_fetch_global_ratio());
+  ctrl.set_local_ratio(1000, 100);
+  ASSERT_FALSE(ctrl.need_report_ratio());
+  ASSERT_FALSE(ctrl.need_fetch_global_ratio());
+}
+
+TEST_F(ObGroupByRatioSyncTest, sync_state)
+{
+  ObAdaptiveByPassCtrl ctrl;
+  ctrl.open_by_pass_ctrl();
+  ctrl.open_global_ratio_sync();
+  ASSERT_TRUE(ctrl.need_report_ratio());
+  ASSERT_FALSE(ctrl.need_fetch_global_ratio());
+
+  ctrl.set_local_ratio(0, 0);
+  ASSERT_EQ(0, ctrl.local_ratio_);
+  ASSERT_FALSE(ctrl.need_report_ratio());
+  ASSERT_TRUE(ctrl.need_fetch_global_ratio());
+
+  // global ratio above 1 - 1/cut_ratio keeps the hash table
+  ctrl.set_global_ratio(0.9);
+  ASSERT_FALSE(ctrl.need_fetch_global_ratio());
+  ASSERT_FALSE(ctrl.global_by_pass_);
+  ASSERT_FALSE(ctrl.rebuild_times_exceeded());
+  ctrl.state_ = ObAdaptiveByPassCtrl::STATE_ANALYZE;
+  ctrl.gby_process_state(1000, 100, 0);
+  ASSERT_EQ(ObAdaptiveByPassCtrl::STATE_L3_INSERT, ctrl.state_);
+  ASSERT_TRUE(ctrl.need_resize_hash_table_);
+}
+
+TEST_F(ObGroupByRatioSyncTest, sync_by_pass)
+{
+  ObAdaptiveByPassCtrl ctrl;
+  ctrl.open_by_pass_ctrl();
+  ctrl.open_global_ratio_sync();
+  ctrl.set_local_ratio(1000, 100);
+  ASSERT_DOUBLE_EQ(0.9, ctrl.local_ratio_);
+
+  // all workers by pass once the global ratio is poor, even if the local ratio is good
+  ctrl.set_global_ratio(0.1);
+  ASSERT_TRUE(ctrl.global_by_pass_);
+  ASSERT_TRUE(ctrl.rebuild_times_exceeded());
+  ctrl.state_ = ObAdaptiveByPassCtrl::STATE_ANALYZE;
+  ctrl.gby_process_state(1000, 100, 0);
+  ASSERT_EQ(ObAdaptiveByPassCtrl::STATE_PROCESS_HT, ctrl.state_);
+  ASSERT_TRUE(ctrl.rebuild_times_exceeded());
+}
+
+TEST_F(ObGroupByRatioSyncTest, reset)
+{
+  ObAdaptiveByPassCtrl ctrl;
+  ctrl.open_by_pass_ctrl();
+  ctrl.open_global_ratio_sync();
+  ctrl.set_local_ratio(1000, 100);
+  ctrl.set_global_ratio(0.1);
+  ctrl.inc_by_pass_row_cnt(100);
+
+  // a rescan does not sync the ratio again and starts from the local ratio
+  ctrl.reset();
+  ASSERT_FALSE(ctrl.need_report_ratio());
+  ASSERT_FALSE(ctrl.need_fetch_global_ratio());
+  ASSERT_FALSE(ctrl.ratio_reported_);
+  ASSERT_FALSE(ctrl.global_ratio_fetched_);
+  ASSERT_FALSE(ctrl.global_by_pass_);
+  ASSERT_EQ(0, ctrl.local_ratio_);
+  ASSERT_EQ(0, ctrl.global_ratio_);
+  ASSERT_EQ(0, ctrl.by_pass_row_cnt_);
+  ASSERT_FALSE(ctrl.rebuild_times_exceeded());
+  ctrl.state_ = ObAdaptiveByPassCtrl::STATE_ANALYZE;
+  ctrl.gby_process_state(1000, 100, 0);
+  ASSERT_EQ(ObAdaptiveByPassCtrl::STATE_L3_INSERT, ctrl.state_);
+
+  // the sync can be opened again by the next open
+  ctrl.open_global_ratio_sync();
+  ASSERT_TRUE(ctrl.need_report_ratio());
+}
+
+int main(int argc, char **argv)
+{
+  OB_LOGGER.set_log_level("INFO");
+  init_sql_factories();
+  ::testing::InitGoogleTest(&argc,argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,202 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL_ENG
+
+#include <gtest/gtest.h>
+#include <iostream>
+#include "lib/allocator/page_arena.h"
+#include "lib/random/ob_random.h"
+#include "lib/time/ob_time_utility.h"
+#include "share/ob_order_perserving_encoder.h"
+#include "sql/engine/sort/ob_sort_msd_radix_vec_op.h"
+
+// Microbenchmark of sorting order preserving encoded keys: MSD radix sort vs comparison sort.
+// It is not registered with ctest, the order is checked by test_sort_msd_radix.
+// usage: ./bench_sort_msd_radix [-n row_count] [-l loop_count]
+namespace oceanbase
+{
+namespace sql
+{
+using namespace common;
+using namespace share;
+
+static int64_t ROW_COUNT = 1L << 20;
+static int64_t LOOP_COUNT = 3;
+
+struct TestRow
+{
+  int64_t idx_;
+};
+
+typedef ObMSDRadixSort<TestRow> MSDSort;
+typedef MSDSort::MSDItem Item;
+
+struct ItemCmp
+{
+  bool operator()(const Item &l, const Item &r) const
+  {
+    int cmp = MEMCMP(l.key_ptr_, r.key_ptr_, std::min(l.len_, r.len_));
+    return cmp < 0 || (0 == cmp && l.len_ < r.len_);
+  }
+};
+
+class BenchSortMSDRadix : public ::testing::Test
+{
+public:
+  BenchSortMSDRadix()
+    : alloc_(ObModIds::TEST), items_(NULL), sorted_(NULL), tmp_(NULL), scratch_(NULL),
+      row_cnt_(0)
+  {}
+  virtual void SetUp() override
+  {
+    row_cnt_ = ROW_COUNT;
+    items_ = static_cast<Item *>(alloc_.alloc(sizeof(Item) * row_cnt_));
+    sorted_ = static_cast<Item *>(alloc_.alloc(sizeof(Item) * row_cnt_));
+    tmp_ = static_cast<Item *>(alloc_.alloc(sizeof(Item) * row_cnt_));
+    scratch_ = static_cast<Item *>(alloc_.alloc(sizeof(Item) * row_cnt_));
+    ASSERT_TRUE(NULL != items_ && NULL != sorted_ && NULL != tmp_ && NULL != scratch_);
+  }
+  virtual void TearDown() override
+  {
+    alloc_.reset();
+  }
+
+  void add_key(const int64_t idx, const unsigned char *key, const int64_t len)
+  {
+    unsigned char *buf = static_cast<unsigned char *>(alloc_.alloc(len));
+    ASSERT_TRUE(NULL != buf);
+    MEMCPY(buf, key, len);
+    items_[idx].key_ptr_ = buf;
+    items_[idx].len_ = static_cast<uint32_t>(len);
+    items_[idx].row_ptr_ = NULL;
+  }
+
+  void gen_int_keys()
+  {
+    unsigned char buf[16];
+    for (int64_t i = 0; i < row_cnt_; i++) {
+      int64_t len = 0;
+      int64_t val = static_cast<int64_t>(ObRandom::rand(-1000000000L, 1000000000L));
+      ASSERT_EQ(OB_SUCCESS, ObOrderPerservingEncoder::encode_from_int(val, buf, len));
+      add_key(i, buf, len);
+    }
+  }
+
+  void gen_decimal_keys()
+  {
+    char str[64];
+    unsigned char buf[64];
+    for (int64_t i = 0; i < row_cnt_; i++) {
+      number::ObNumber num;
+      int64_t len = 0;
+      snprintf(str, sizeof(str), "%ld.%04ld", ObRandom::rand(-100000, 100000),
+               ObRandom::rand(0, 9999));
+      ASSERT_EQ(OB_SUCCESS, num.from(str, alloc_));
+      ASSERT_EQ(OB_SUCCESS, ObOrderPerservingEncoder::encode_from_number(num, buf, sizeof(buf),
+                                                                         len));
+      add_key(i, buf, len);
+    }
+  }
+
+  // strings with a common prefix and multi byte characters, encoded by utf8mb4 weights
+  void gen_utf8mb4_keys()
+  {
+    static const char *chars[] = { "a", "B", "z", "0", "\xc3\xa9", "\xe4\xb8\xad", "\xf0\x9f\x98\x80" };
+    static const int64_t char_cnt = sizeof(chars) / sizeof(chars[0]);
+    char str[128];
+    unsigned char buf[512];
+    for (int64_t i = 0; i < row_cnt_; i++) {
+      int64_t pos = snprintf(str, sizeof(str), "customer#");
+      const int64_t str_len = ObRandom::rand(4, 16);
+      for (int64_t j = 0; j < str_len; j++) {
+        pos += snprintf(str + pos, sizeof(str) - pos, "%s", chars[ObRandom::rand(0, char_cnt - 1)]);
+      }
+      int64_t len = 0;
+      ASSERT_EQ(OB_SUCCESS, ObOrderPerservingEncoder::encode_from_string_varlen(
+                                ObString(pos, str), buf, sizeof(buf), len,
+                                CS_TYPE_UTF8MB4_GENERAL_CI));
+      add_key(i, buf, len);
+    }
+  }
+
+  void run(const char *name)
+  {
+    for (int64_t loop = 0; loop < LOOP_COUNT; loop++) {
+      MEMCPY(sorted_, items_, sizeof(Item) * row_cnt_);
+      int64_t start = ObTimeUtility::current_time();
+      std::sort(sorted_, sorted_ + row_cnt_, ItemCmp());
+      const int64_t cmp_sort_time = ObTimeUtility::current_time() - start;
+
+      MEMCPY(tmp_, items_, sizeof(Item) * row_cnt_);
+      start = ObTimeUtility::current_time();
+      MSDSort::sort_items(tmp_, scratch_, row_cnt_, 0, 0);
+      const int64_t radix_sort_time = ObTimeUtility::current_time() - start;
+      for (int64_t i = 0; i < row_cnt_; i++) {
+        ASSERT_EQ(tmp_[i].len_, sorted_[i].len_);
+        ASSERT_EQ(0, MEMCMP(tmp_[i].key_ptr_, sorted_[i].key_ptr_, tmp_[i].len_));
+      }
+      std::cout << name << " rows: " << row_cnt_
+                << ", std::sort(us): " << cmp_sort_time
+                << ", msd radix sort(us): " << radix_sort_time << std::endl;
+    }
+  }
+
+protected:
+  ObArenaAllocator alloc_;
+  Item *items_;
+  Item *sorted_;
+  Item *tmp_;
+  Item *scratch_;
+  int64_t row_cnt_;
+};
+
+TEST_F(BenchSortMSDRadix, int_keys)
+{
+  gen_int_keys();
+  run("int");
+}
+
+TEST_F(BenchSortMSDRadix, decimal_keys)
+{
+  gen_decimal_keys();
+  run("decimal");
+}
+
+TEST_F(BenchSortMSDRadix, utf8mb4_keys)
+{
+  gen_utf8mb4_keys();
+  run("utf8mb4");
+}
+
+} // end namespace sql
+} // end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  int c = 0;
+  while (-1 != (c = getopt(argc, argv, "n:l:"))) {
+    switch (c) {
+      case 'n':
+        oceanbase::sql::ROW_COUNT = atol(optarg);
+        break;
+      case 'l':
+        oceanbase::sql::LOOP_COUNT = atol(optarg);
+        break;
+      default:
+        break;
+    }
+  }
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,262 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL_ENG
+
+#include <gtest/gtest.h>
+#include "lib/allocator/page_arena.h"
+#include "lib/container/ob_array.h"
+#include "lib/random/ob_random.h"
+#include "share/ob_order_perserving_encoder.h"
+#include "sql/engine/sort/ob_sort_msd_radix_vec_op.h"
+
+// MSD radix sort of order preserving encoded keys must give the same order as comparison sort.
+namespace oceanbase
+{
+namespace sql
+{
+using namespace common;
+using namespace share;
+
+// stored row with the encoded sort key as its only cell
+struct TestRow
+{
+  bool is_null(const int64_t col_idx) const { UNUSED(col_idx); return NULL == key_; }
+  const char *get_cell_payload(const RowMeta &meta, const int64_t col_idx) const
+  {
+    UNUSED(meta);
+    UNUSED(col_idx);
+    return key_;
+  }
+  int32_t get_length(const RowMeta &meta, const int64_t col_idx) const
+  {
+    UNUSED(meta);
+    UNUSED(col_idx);
+    return len_;
+  }
+  const char *key_;
+  int32_t len_;
+};
+
+typedef ObMSDRadixSort<TestRow> MSDSort;
+typedef MSDSort::MSDItem Item;
+
+struct ItemCmp
+{
+  bool operator()(const Item &l, const Item &r) const
+  {
+    int cmp = MEMCMP(l.key_ptr_, r.key_ptr_, std::min(l.len_, r.len_));
+    return cmp < 0 || (0 == cmp && l.len_ < r.len_);
+  }
+};
+
+class TestMemCallback : public ObSqlMemoryCallback
+{
+public:
+  TestMemCallback() : used_(0), peak_(0) {}
+  virtual void alloc(int64_t size) override
+  {
+    used_ += size;
+    peak_ = std::max(peak_, used_);
+  }
+  virtual void free(int64_t size) override { used_ -= size; }
+  virtual void dumped(int64_t size) override { UNUSED(size); }
+  int64_t used_;
+  int64_t peak_;
+};
+
+class TestSortMSDRadix : public ::testing::Test
+{
+public:
+  static const int64_t ROW_COUNT = 100000;
+
+  TestSortMSDRadix()
+    : alloc_(ObModIds::TEST), items_(NULL), sorted_(NULL), tmp_(NULL), scratch_(NULL),
+      row_cnt_(0)
+  {}
+  virtual void SetUp() override
+  {
+    row_cnt_ = ROW_COUNT;
+    items_ = static_cast<Item *>(alloc_.alloc(sizeof(Item) * row_cnt_));
+    sorted_ = static_cast<Item *>(alloc_.alloc(sizeof(Item) * row_cnt_));
+    tmp_ = static_cast<Item *>(alloc_.alloc(sizeof(Item) * row_cnt_));
+    scratch_ = static_cast<Item *>(alloc_.alloc(sizeof(Item) * row_cnt_));
+    ASSERT_TRUE(NULL != items_ && NULL != sorted_ && NULL != tmp_ && NULL != scratch_);
+  }
+  virtual void TearDown() override
+  {
+    alloc_.reset();
+  }
+
+  void add_key(const int64_t idx, const unsigned char *key, const int64_t len)
+  {
+    unsigned char *buf = static_cast<unsigned char *>(alloc_.alloc(len));
+    ASSERT_TRUE(NULL != buf);
+    MEMCPY(buf, key, len);
+    items_[idx].key_ptr_ = buf;
+    items_[idx].len_ = static_cast<uint32_t>(len);
+    items_[idx].row_ptr_ = NULL;
+  }
+
+  void gen_int_keys()
+  {
+    unsigned char buf[16];
+    for (int64_t i = 0; i < row_cnt_; i++) {
+      int64_t len = 0;
+      int64_t val = static_cast<int64_t>(ObRandom::rand(-1000000000L, 1000000000L));
+      ASSERT_EQ(OB_SUCCESS, ObOrderPerservingEncoder::encode_from_int(val, buf, len));
+      add_key(i, buf, len);
+    }
+  }
+
+  void gen_decimal_keys()
+  {
+    char str[64];
+    unsigned char buf[64];
+    for (int64_t i = 0; i < row_cnt_; i++) {
+      number::ObNumber num;
+      int64_t len = 0;
+      snprintf(str, sizeof(str), "%ld.%04ld", ObRandom::rand(-100000, 100000),
+               ObRandom::rand(0, 9999));
+      ASSERT_EQ(OB_SUCCESS, num.from(str, alloc_));
+      ASSERT_EQ(OB_SUCCESS, ObOrderPerservingEncoder::encode_from_number(num, buf, sizeof(buf),
+                                                                         len));
+      add_key(i, buf, len);
+    }
+  }
+
+  // strings with a common prefix and multi byte characters, encoded by utf8mb4 weights
+  void gen_utf8mb4_keys()
+  {
+    static const char *chars[] = { "a", "B", "z", "0", "\xc3\xa9", "\xe4\xb8\xad", "\xf0\x9f\x98\x80" };
+    static const int64_t char_cnt = sizeof(chars) / sizeof(chars[0]);
+    char str[128];
+    unsigned char buf[512];
+    for (int64_t i = 0; i < row_cnt_; i++) {
+      int64_t pos = snprintf(str, sizeof(str), "customer#");
+      const int64_t str_len = ObRandom::rand(4, 16);
+      for (int64_t j = 0; j < str_len; j++) {
+        pos += snprintf(str + pos, sizeof(str) - pos, "%s", chars[ObRandom::rand(0, char_cnt - 1)]);
+      }
+      int64_t len = 0;
+      ASSERT_EQ(OB_SUCCESS, ObOrderPerservingEncoder::encode_from_string_varlen(
+                                ObString(pos, str), buf, sizeof(buf), len,
+                                CS_TYPE_UTF8MB4_GENERAL_CI));
+      add_key(i, buf, len);
+    }
+  }
+
+  void check_sort()
+  {
+    MEMCPY(sorted_, items_, sizeof(Item) * row_cnt_);
+    std::sort(sorted_, sorted_ + row_cnt_, ItemCmp());
+    MEMCPY(tmp_, items_, sizeof(Item) * row_cnt_);
+    MSDSort::sort_items(tmp_, scratch_, row_cnt_, 0, 0);
+    for (int64_t i = 0; i < row_cnt_; i++) {
+      ASSERT_EQ(sorted_[i].len_, tmp_[i].len_);
+      ASSERT_EQ(0, MEMCMP(sorted_[i].key_ptr_, tmp_[i].key_ptr_, tmp_[i].len_));
+    }
+  }
+
+protected:
+  ObArenaAllocator alloc_;
+  Item *items_;
+  Item *sorted_;
+  Item *tmp_;
+  Item *scratch_;
+  int64_t row_cnt_;
+};
+
+TEST_F(TestSortMSDRadix, equal_and_prefix_keys)
+{
+  // empty key, keys are prefix of each other and duplicated keys
+  const char *keys[] = { "abc", "", "ab", "abcd", "abc", "b", "", "abd", "a", "abc" };
+  const int64_t cnt = sizeof(keys) / sizeof(keys[0]);
+  for (int64_t i = 0; i < row_cnt_; i++) {
+    const char *key = keys[i % cnt];
+    add_key(i, reinterpret_cast<const unsigned char *>(key), STRLEN(key));
+  }
+  check_sort();
+}
+
+TEST_F(TestSortMSDRadix, int_keys)
+{
+  gen_int_keys();
+  check_sort();
+}
+
+TEST_F(TestSortMSDRadix, decimal_keys)
+{
+  gen_decimal_keys();
+  check_sort();
+}
+
+TEST_F(TestSortMSDRadix, utf8mb4_keys)
+{
+  gen_utf8mb4_keys();
+  check_sort();
+}
+
+TEST_F(TestSortMSDRadix, report_memory)
+{
+  const int64_t cnt = MSDSort::MIN_RADIX_SORT_ROWS + 100;
+  gen_int_keys();
+  ObArray<TestRow *> rows;
+  TestRow *row_buf = static_cast<TestRow *>(alloc_.alloc(sizeof(TestRow) * cnt));
+  ASSERT_TRUE(NULL != row_buf);
+  for (int64_t i = 0; i < cnt; i++) {
+    row_buf[i].key_ = reinterpret_cast<const char *>(items_[i].key_ptr_);
+    row_buf[i].len_ = items_[i].len_;
+    ASSERT_EQ(OB_SUCCESS, rows.push_back(&row_buf[i]));
+  }
+  RowMeta row_meta;
+  TestMemCallback callback;
+  {
+    MSDSort msd(rows, row_meta, alloc_);
+    msd.set_callback(&callback);
+    bool can_encode = false;
+    ASSERT_EQ(OB_SUCCESS, msd.init(0, cnt, can_encode));
+    ASSERT_TRUE(can_encode);
+    // the items and the scratch items of all rows
+    ASSERT_EQ(static_cast<int64_t>(sizeof(Item) * cnt * 2), callback.used_);
+    msd.sort(0, cnt);
+  }
+  ASSERT_EQ(0, callback.used_);
+  ASSERT_EQ(static_cast<int64_t>(sizeof(Item) * cnt * 2), callback.peak_);
+  for (int64_t i = 1; i < cnt; i++) {
+    const TestRow *l = rows.at(i - 1);
+    const TestRow *r = rows.at(i);
+    const int cmp = MEMCMP(l->key_, r->key_, std::min(l->len_, r->len_));
+    ASSERT_TRUE(cmp < 0 || (0 == cmp && l->len_ <= r->len_));
+  }
+
+  // a null key falls back to comparison sort, the items are still returned
+  row_buf[cnt / 2].key_ = NULL;
+  {
+    MSDSort msd(rows, row_meta, alloc_);
+    msd.set_callback(&callback);
+    bool can_encode = true;
+    ASSERT_EQ(OB_SUCCESS, msd.init(0, cnt, can_encode));
+    ASSERT_FALSE(can_encode);
+  }
+  ASSERT_EQ(0, callback.used_);
+}
+
+} // end namespace sql
+} // end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
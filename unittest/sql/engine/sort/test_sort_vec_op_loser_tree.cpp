@@ -0,0 +1,205 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL_ENG
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <vector>
+#include "lib/random/ob_random.h"
+#include "sql/engine/sort/ob_sort_vec_op_loser_tree.h"
+
+namespace oceanbase
+{
+namespace sql
+{
+using namespace common;
+
+static const int64_t MAX_WAYS = 64;
+
+struct TestRun
+{
+  TestRun() : id_(0), pos_(0) {}
+  int64_t cur() const { return rows_.at(pos_); }
+  bool iter_end() const { return pos_ >= static_cast<int64_t>(rows_.size()); }
+  int64_t id_;
+  int64_t pos_;
+  std::vector<int64_t> rows_;
+};
+
+// same contract as the external merge sort comparator: true if %l is after %r
+struct TestRunCmp
+{
+  bool operator()(const TestRun *l, const TestRun *r)
+  {
+    return l->cur() > r->cur();
+  }
+};
+
+typedef ObSortVecOpLoserTree<TestRun *, TestRunCmp, MAX_WAYS> LoserTree;
+
+class TestSortVecOpLoserTree : public ::testing::Test
+{
+public:
+  TestSortVecOpLoserTree() : tree_(cmp_) {}
+  virtual void TearDown() override
+  {
+    tree_.reset();
+    runs_.clear();
+  }
+
+  void gen_runs(const int64_t run_cnt, const int64_t max_rows, const int64_t max_val)
+  {
+    runs_.resize(run_cnt);
+    for (int64_t i = 0; i < run_cnt; i++) {
+      TestRun &run = runs_.at(i);
+      run.id_ = i;
+      run.pos_ = 0;
+      run.rows_.clear();
+      const int64_t row_cnt = ObRandom::rand(0, max_rows);
+      for (int64_t j = 0; j < row_cnt; j++) {
+        run.rows_.push_back(ObRandom::rand(0, max_val));
+      }
+      std::sort(run.rows_.begin(), run.rows_.end());
+    }
+  }
+
+  // merge the runs the way ObSortVecOpImpl does: runs with no rows are never pushed,
+  // replace_top() while the top run has rows, pop() once it is exhausted.
+  void merge(std::vector<int64_t> &merged)
+  {
+    for (int64_t i = 0; i < static_cast<int64_t>(runs_.size()); i++) {
+      if (!runs_.at(i).iter_end()) {
+        ASSERT_EQ(OB_SUCCESS, tree_.push(&runs_.at(i)));
+      }
+    }
+    while (!tree_.empty()) {
+      TestRun *run = tree_.top();
+      merged.push_back(run->cur());
+      run->pos_ += 1;
+      if (run->iter_end()) {
+        ASSERT_EQ(OB_SUCCESS, tree_.pop());
+      } else {
+        ASSERT_EQ(OB_SUCCESS, tree_.replace_top(run));
+      }
+    }
+  }
+
+  void check_merge()
+  {
+    std::vector<int64_t> expected;
+    for (int64_t i = 0; i < static_cast<int64_t>(runs_.size()); i++) {
+      expected.insert(expected.end(), runs_.at(i).rows_.begin(), runs_.at(i).rows_.end());
+    }
+    std::sort(expected.begin(), expected.end());
+    std::vector<int64_t> merged;
+    merge(merged);
+    ASSERT_EQ(expected, merged);
+    ASSERT_EQ(0, tree_.count());
+  }
+
+protected:
+  TestRunCmp cmp_;
+  LoserTree tree_;
+  std::vector<TestRun> runs_;
+};
+
+TEST_F(TestSortVecOpLoserTree, empty)
+{
+  ASSERT_TRUE(tree_.empty());
+  ASSERT_EQ(OB_EMPTY_RESULT, tree_.pop());
+  TestRun run;
+  ASSERT_EQ(OB_EMPTY_RESULT, tree_.replace_top(&run));
+}
+
+TEST_F(TestSortVecOpLoserTree, single_run)
+{
+  gen_runs(1, 100, 1000);
+  runs_.at(0).rows_.push_back(1001);
+  check_merge();
+}
+
+TEST_F(TestSortVecOpLoserTree, random_runs)
+{
+  // cover power of two and odd way counts, leaves of the tree are at different depths
+  for (int64_t run_cnt = 1; run_cnt <= MAX_WAYS; run_cnt++) {
+    gen_runs(run_cnt, 200, 10000);
+    check_merge();
+    tree_.reset();
+  }
+}
+
+TEST_F(TestSortVecOpLoserTree, ties)
+{
+  // all runs have the same rows
+  runs_.resize(7);
+  for (int64_t i = 0; i < 7; i++) {
+    runs_.at(i).id_ = i;
+    runs_.at(i).rows_.assign(50, 42);
+  }
+  check_merge();
+  tree_.reset();
+  // heavy duplicates across runs
+  for (int64_t run_cnt = 2; run_cnt <= MAX_WAYS; run_cnt += 7) {
+    gen_runs(run_cnt, 100, 3);
+    check_merge();
+    tree_.reset();
+  }
+}
+
+TEST_F(TestSortVecOpLoserTree, exhausted_runs)
+{
+  // runs of a single row are exhausted right after their first replay, the remaining
+  // runs must still come out in order while exhausted leaves lose every match
+  runs_.resize(9);
+  for (int64_t i = 0; i < 9; i++) {
+    runs_.at(i).id_ = i;
+    if (0 == i % 2) {
+      runs_.at(i).rows_.push_back(i);
+    } else {
+      for (int64_t j = 0; j < 20; j++) {
+        runs_.at(i).rows_.push_back(j * 3 + i);
+      }
+    }
+  }
+  check_merge();
+  tree_.reset();
+  // most of the generated runs are empty and never pushed
+  for (int64_t run_cnt = 3; run_cnt <= MAX_WAYS; run_cnt += 5) {
+    gen_runs(run_cnt, 1, 100);
+    check_merge();
+    tree_.reset();
+  }
+}
+
+TEST_F(TestSortVecOpLoserTree, push_overflow)
+{
+  runs_.resize(MAX_WAYS + 1);
+  for (int64_t i = 0; i < MAX_WAYS; i++) {
+    runs_.at(i).rows_.push_back(i);
+    ASSERT_EQ(OB_SUCCESS, tree_.push(&runs_.at(i)));
+  }
+  runs_.at(MAX_WAYS).rows_.push_back(0);
+  ASSERT_EQ(OB_SIZE_OVERFLOW, tree_.push(&runs_.at(MAX_WAYS)));
+  ASSERT_EQ(MAX_WAYS, tree_.count());
+  ASSERT_EQ(0, tree_.top()->cur());
+}
+
+} // end namespace sql
+} // end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  oceanbase::common::ObLogger::get_logger().set_log_level("WARN");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,525 @@
+/**
+ * Copyright (c) 2023 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <string>
+#include <vector>
+#include "lib/compress/ob_compressor_pool.h"
+#include "sql/engine/table/ob_parquet_file_reader.h"
+
+using namespace oceanbase::sql;
+using namespace oceanbase::common;
+
+// Writer of thrift compact protocol, only what is needed to build a small parquet file
+class ThriftWriter
+{
+public:
+  ThriftWriter() { last_ids_.push_back(0); }
+  void byte(const uint8_t v) { buf_.push_back(static_cast<char>(v)); }
+  void varint(uint64_t v)
+  {
+    while (v >= 0x80) {
+      byte(static_cast<uint8_t>(v | 0x80));
+      v >>= 7;
+    }
+    byte(static_cast<uint8_t>(v));
+  }
+  void zigzag(const int64_t v) { varint((static_cast<uint64_t>(v) << 1) ^ static_cast<uint64_t>(v >> 63)); }
+  void field(const int16_t id, const uint8_t type)
+  {
+    const int16_t delta = id - last_ids_.back();
+    if (delta > 0 && delta <= 15) {
+      byte(static_cast<uint8_t>((delta << 4) | type));
+    } else {
+      byte(type);
+      zigzag(id);
+    }
+    last_ids_.back() = id;
+  }
+  void i32(const int16_t id, const int32_t v) { field(id, 5); zigzag(v); }
+  void i64(const int16_t id, const int64_t v) { field(id, 6); zigzag(v); }
+  void binary(const int16_t id, const std::string &v) { field(id, 8); varint(v.size()); buf_.append(v); }
+  void struct_begin(const int16_t id) { field(id, 12); last_ids_.push_back(0); }
+  // struct as an element of list
+  void elem_begin() { last_ids_.push_back(0); }
+  void struct_end() { byte(0); last_ids_.pop_back(); }
+  void list_begin(const int16_t id, const uint8_t elem_type, const int64_t size)
+  {
+    field(id, 9);
+    if (size < 15) {
+      byte(static_cast<uint8_t>((size << 4) | elem_type));
+    } else {
+      byte(static_cast<uint8_t>(0xF0 | elem_type));
+      varint(size);
+    }
+  }
+  std::string buf_;
+private:
+  std::vector<int16_t> last_ids_;
+};
+
+struct TestChunk
+{
+  int32_t physical_type_;
+  int32_t codec_;
+  int64_t num_values_;
+  int64_t dict_offset_;
+  int64_t data_offset_;
+  int64_t total_size_;
+  std::string min_;
+  std::string max_;
+};
+
+class TestParquetFileReader : public ::testing::Test
+{
+public:
+  TestParquetFileReader() : meta_(allocator_) {}
+  virtual void SetUp();
+  virtual void TearDown() {}
+
+  static std::string int64_bytes(const int64_t v) { return std::string(reinterpret_cast<const char *>(&v), sizeof(v)); }
+  static std::string double_bytes(const double v) { return std::string(reinterpret_cast<const char *>(&v), sizeof(v)); }
+  static std::string byte_array(const std::string &v)
+  {
+    const uint32_t len = static_cast<uint32_t>(v.size());
+    return std::string(reinterpret_cast<const char *>(&len), sizeof(len)) + v;
+  }
+  // definition levels of a data page v1, bit-packed
+  static std::string def_levels(const std::vector<int> &defs)
+  {
+    std::string levels;
+    const int64_t group_cnt = (defs.size() + 7) / 8;
+    levels.push_back(static_cast<char>((group_cnt << 1) | 1));
+    for (int64_t g = 0; g < group_cnt; ++g) {
+      uint8_t bits = 0;
+      for (int64_t i = 0; i < 8 && g * 8 + i < static_cast<int64_t>(defs.size()); ++i) {
+        bits |= static_cast<uint8_t>(defs[g * 8 + i] << i);
+      }
+      levels.push_back(static_cast<char>(bits));
+    }
+    const uint32_t len = static_cast<uint32_t>(levels.size());
+    return std::string(reinterpret_cast<const char *>(&len), sizeof(len)) + levels;
+  }
+  void append_page(const int32_t page_type, const int32_t num_values, const int32_t encoding,
+                   const std::string &data, const int32_t codec);
+
+  ObArenaAllocator allocator_;
+  std::string file_;
+  std::vector<std::vector<TestChunk> > row_groups_;
+  ObParquetFileMeta meta_;
+};
+
+void TestParquetFileReader::append_page(const int32_t page_type, const int32_t num_values,
+                                        const int32_t encoding, const std::string &data,
+                                        const int32_t codec)
+{
+  std::string page = data;
+  if (ObParquetDef::CODEC_SNAPPY == codec) {
+    ObCompressor *compressor = nullptr;
+    int64_t max_overflow = 0;
+    int64_t compressed_len = 0;
+    ASSERT_EQ(OB_SUCCESS, ObCompressorPool::get_instance().get_compressor(SNAPPY_COMPRESSOR, compressor));
+    ASSERT_EQ(OB_SUCCESS, compressor->get_max_overflow_size(data.size(), max_overflow));
+    page.resize(data.size() + max_overflow);
+    ASSERT_EQ(OB_SUCCESS, compressor->compress(data.data(), data.size(), &page[0], page.size(), compressed_len));
+    page.resize(compressed_len);
+  }
+  ThriftWriter header;
+  header.i32(1, page_type);
+  header.i32(2, static_cast<int32_t>(data.size()));
+  header.i32(3, static_cast<int32_t>(page.size()));
+  if (ObParquetDef::PAGE_DICTIONARY == page_type) {
+    header.struct_begin(7);
+    header.i32(1, num_values);
+    header.i32(2, encoding);
+  } else {
+    header.struct_begin(5);
+    header.i32(1, num_values);
+    header.i32(2, encoding);
+    header.i32(3, ObParquetDef::ENC_RLE);
+    header.i32(4, ObParquetDef::ENC_RLE);
+  }
+  header.struct_end();
+  header.byte(0);
+  file_.append(header.buf_);
+  file_.append(page);
+}
+
+// Columns: id bigint required plain, score double optional plain, name utf8 optional dictionary.
+// Row group 0: (1, 1.5, 'a'), (2, null, 'b'), (3, 3.5, null), (4, 4.5, 'a'), (5, null, 'c'),
+// id is split into two pages.
+// Row group 1: (6, 6.5, 'b'), (7, 7.5, 'b'), (8, 8.5, 'b'), id is compressed by snappy.
+void TestParquetFileReader::SetUp()
+{
+  file_ = ObParquetDef::MAGIC;
+  row_groups_.resize(2);
+  {
+    std::vector<TestChunk> &chunks = row_groups_[0];
+    chunks.resize(3);
+    TestChunk &id = chunks[0];
+    id.physical_type_ = ObParquetDef::PT_INT64;
+    id.codec_ = ObParquetDef::CODEC_UNCOMPRESSED;
+    id.num_values_ = 5;
+    id.dict_offset_ = 0;
+    id.data_offset_ = file_.size();
+    append_page(ObParquetDef::PAGE_DATA, 3, ObParquetDef::ENC_PLAIN,
+                int64_bytes(1) + int64_bytes(2) + int64_bytes(3), id.codec_);
+    append_page(ObParquetDef::PAGE_DATA, 2, ObParquetDef::ENC_PLAIN,
+                int64_bytes(4) + int64_bytes(5), id.codec_);
+    id.total_size_ = file_.size() - id.data_offset_;
+    id.min_ = int64_bytes(1);
+    id.max_ = int64_bytes(5);
+
+    TestChunk &score = chunks[1];
+    score.physical_type_ = ObParquetDef::PT_DOUBLE;
+    score.codec_ = ObParquetDef::CODEC_UNCOMPRESSED;
+    score.num_values_ = 5;
+    score.dict_offset_ = 0;
+    score.data_offset_ = file_.size();
+    append_page(ObParquetDef::PAGE_DATA, 5, ObParquetDef::ENC_PLAIN,
+                def_levels({1, 0, 1, 1, 0}) + double_bytes(1.5) + double_bytes(3.5) + double_bytes(4.5),
+                score.codec_);
+    score.total_size_ = file_.size() - score.data_offset_;
+    score.min_ = double_bytes(1.5);
+    score.max_ = double_bytes(4.5);
+
+    TestChunk &name = chunks[2];
+    name.physical_type_ = ObParquetDef::PT_BYTE_ARRAY;
+    name.codec_ = ObParquetDef::CODEC_UNCOMPRESSED;
+    name.num_values_ = 5;
+    name.dict_offset_ = file_.size();
+    append_page(ObParquetDef::PAGE_DICTIONARY, 3, ObParquetDef::ENC_PLAIN,
+                byte_array("a") + byte_array("b") + byte_array("c"), name.codec_);
+    name.data_offset_ = file_.size();
+    // indexes 0, 1, 0, 2 bit-packed with bit width 2
+    std::string indexes;
+    indexes.push_back(2);
+    indexes.push_back(static_cast<char>((1 << 1) | 1));
+    indexes.push_back(static_cast<char>(0 | (1 << 2) | (0 << 4) | (2 << 6)));
+    indexes.push_back(0);
+    append_page(ObParquetDef::PAGE_DATA, 5, ObParquetDef::ENC_RLE_DICTIONARY,
+                def_levels({1, 1, 0, 1, 1}) + indexes, name.codec_);
+    name.total_size_ = file_.size() - name.dict_offset_;
+  }
+  {
+    std::vector<TestChunk> &chunks = row_groups_[1];
+    chunks.resize(3);
+    TestChunk &id = chunks[0];
+    id.physical_type_ = ObParquetDef::PT_INT64;
+    id.codec_ = ObParquetDef::CODEC_SNAPPY;
+    id.num_values_ = 3;
+    id.dict_offset_ = 0;
+    id.data_offset_ = file_.size();
+    append_page(ObParquetDef::PAGE_DATA, 3, ObParquetDef::ENC_PLAIN,
+                int64_bytes(6) + int64_bytes(7) + int64_bytes(8), id.codec_);
+    id.total_size_ = file_.size() - id.data_offset_;
+    id.min_ = int64_bytes(6);
+    id.max_ = int64_bytes(8);
+
+    TestChunk &score = chunks[1];
+    score.physical_type_ = ObParquetDef::PT_DOUBLE;
+    score.codec_ = ObParquetDef::CODEC_UNCOMPRESSED;
+    score.num_values_ = 3;
+    score.dict_offset_ = 0;
+    score.data_offset_ = file_.size();
+    // definition levels in one rle run
+    const uint32_t levels_len = 2;
+    std::string levels(reinterpret_cast<const char *>(&levels_len), sizeof(levels_len));
+    levels.push_back(3 << 1);
+    levels.push_back(1);
+    append_page(ObParquetDef::PAGE_DATA, 3, ObParquetDef::ENC_PLAIN,
+                levels + double_bytes(6.5) + double_bytes(7.5) + double_bytes(8.5), score.codec_);
+    score.total_size_ = file_.size() - score.data_offset_;
+
+    TestChunk &name = chunks[2];
+    name.physical_type_ = ObParquetDef::PT_BYTE_ARRAY;
+    name.codec_ = ObParquetDef::CODEC_UNCOMPRESSED;
+    name.num_values_ = 3;
+    name.dict_offset_ = 0;
+    name.data_offset_ = file_.size();
+    append_page(ObParquetDef::PAGE_DATA, 3, ObParquetDef::ENC_PLAIN,
+                def_levels({1, 1, 1}) + byte_array("b") + byte_array("b") + byte_array("b"), name.codec_);
+    name.total_size_ = file_.size() - name.data_offset_;
+  }
+
+  ThriftWriter footer;
+  footer.i32(1, 1);
+  footer.list_begin(2, 12, 4);
+  footer.elem_begin();
+  footer.binary(4, "schema");
+  footer.i32(5, 3);
+  footer.struct_end();
+  footer.elem_begin();
+  footer.i32(1, ObParquetDef::PT_INT64);
+  footer.i32(3, ObParquetDef::REP_REQUIRED);
+  footer.binary(4, "id");
+  footer.struct_end();
+  footer.elem_begin();
+  footer.i32(1, ObParquetDef::PT_DOUBLE);
+  footer.i32(3, ObParquetDef::REP_OPTIONAL);
+  footer.binary(4, "score");
+  footer.struct_end();
+  footer.elem_begin();
+  footer.i32(1, ObParquetDef::PT_BYTE_ARRAY);
+  footer.i32(3, ObParquetDef::REP_OPTIONAL);
+  footer.binary(4, "name");
+  footer.i32(6, ObParquetDef::CT_UTF8);
+  footer.struct_end();
+  footer.i64(3, 8);
+  footer.list_begin(4, 12, row_groups_.size());
+  for (int64_t i = 0; i < static_cast<int64_t>(row_groups_.size()); ++i) {
+    footer.elem_begin();
+    footer.list_begin(1, 12, row_groups_[i].size());
+    for (int64_t j = 0; j < static_cast<int64_t>(row_groups_[i].size()); ++j) {
+      const TestChunk &chunk = row_groups_[i][j];
+      footer.elem_begin();
+      footer.i64(2, chunk.data_offset_);
+      footer.struct_begin(3);
+      footer.i32(1, chunk.physical_type_);
+      footer.list_begin(2, 5, 1);
+      footer.zigzag(ObParquetDef::ENC_PLAIN);
+      footer.list_begin(3, 8, 1);
+      footer.varint(2);
+      footer.buf_.append("c0");
+      footer.i32(4, chunk.codec_);
+      footer.i64(5, chunk.num_values_);
+      footer.i64(6, chunk.total_size_);
+      footer.i64(7, chunk.total_size_);
+      footer.i64(9, chunk.data_offset_);
+      if (chunk.dict_offset_ > 0) {
+        footer.i64(11, chunk.dict_offset_);
+      }
+      if (!chunk.min_.empty()) {
+        footer.struct_begin(12);
+        footer.i64(3, 0);
+        footer.binary(5, chunk.max_);
+        footer.binary(6, chunk.min_);
+        footer.struct_end();
+      }
+      footer.struct_end();
+      footer.struct_end();
+    }
+    footer.i64(2, 0);
+    footer.i64(3, row_groups_[i][0].num_values_);
+    footer.struct_end();
+  }
+  footer.byte(0);
+  const uint32_t footer_len = static_cast<uint32_t>(footer.buf_.size());
+  file_.append(footer.buf_);
+  file_.append(reinterpret_cast<const char *>(&footer_len), sizeof(footer_len));
+  file_.append(ObParquetDef::MAGIC);
+}
+
+TEST_F(TestParquetFileReader, parse_meta)
+{
+  const int64_t footer_len = *reinterpret_cast<const uint32_t *>(file_.data() + file_.size() - ObParquetDef::FOOTER_TAIL_LEN);
+  ASSERT_EQ(OB_SUCCESS, meta_.parse(file_.data() + file_.size() - ObParquetDef::FOOTER_TAIL_LEN - footer_len, footer_len));
+  ASSERT_EQ(3, meta_.get_column_count());
+  ASSERT_EQ(2, meta_.get_row_group_count());
+  ASSERT_EQ(8, meta_.get_row_count());
+  ASSERT_EQ(0, meta_.get_column(2).name_.compare("name"));
+  ASSERT_EQ(ObParquetDef::CT_UTF8, meta_.get_column(2).converted_type_);
+  ASSERT_EQ(0, meta_.get_column(0).max_def_level_);
+  ASSERT_EQ(1, meta_.get_column(1).max_def_level_);
+  ASSERT_EQ(5, meta_.get_row_group(1).first_row_idx_);
+  ASSERT_EQ(row_groups_[0][2].dict_offset_, meta_.get_chunk(0, 2).get_start_offset());
+  ASSERT_TRUE(meta_.get_chunk(1, 0).has_min_max_);
+  ASSERT_FALSE(meta_.get_chunk(1, 1).has_min_max_);
+  // truncated footer
+  ASSERT_NE(OB_SUCCESS, meta_.parse(file_.data() + file_.size() - ObParquetDef::FOOTER_TAIL_LEN - footer_len, footer_len / 2));
+}
+
+TEST_F(TestParquetFileReader, read_columns)
+{
+  const char *expect[8][3] = {
+    {"1", "1.5", "a"}, {"2", NULL, "b"}, {"3", "3.5", NULL}, {"4", "4.5", "a"}, {"5", NULL, "c"},
+    {"6", "6.5", "b"}, {"7", "7.5", "b"}, {"8", "8.5", "b"}};
+  const int64_t footer_len = *reinterpret_cast<const uint32_t *>(file_.data() + file_.size() - ObParquetDef::FOOTER_TAIL_LEN);
+  ASSERT_EQ(OB_SUCCESS, meta_.parse(file_.data() + file_.size() - ObParquetDef::FOOTER_TAIL_LEN - footer_len, footer_len));
+  for (int64_t col = 0; col < meta_.get_column_count(); ++col) {
+    for (int64_t rg = 0; rg < meta_.get_row_group_count(); ++rg) {
+      const ObParquetColumnChunkMeta &chunk = meta_.get_chunk(rg, col);
+      const int64_t first_row = meta_.get_row_group(rg).first_row_idx_;
+      const int64_t row_cnt = meta_.get_row_group(rg).num_rows_;
+      ObParquetColumnReader reader;
+      ObArenaAllocator text_allocator;
+      ObDatum datums[8];
+      ASSERT_EQ(OB_SUCCESS, reader.init(meta_.get_column(col), chunk, file_.data() + chunk.get_start_offset(),
+                                        chunk.total_compressed_size_, allocator_));
+      // batches cross pages
+      for (int64_t idx = 0; idx < row_cnt; idx += 2) {
+        const int64_t cnt = std::min(2L, row_cnt - idx);
+        ASSERT_EQ(OB_SUCCESS, reader.read_batch(cnt, datums + idx, text_allocator));
+      }
+      for (int64_t i = 0; i < row_cnt; ++i) {
+        const char *value = expect[first_row + i][col];
+        if (NULL == value) {
+          ASSERT_TRUE(datums[i].is_null()) << col << " " << first_row + i;
+        } else {
+          ASSERT_FALSE(datums[i].is_null()) << col << " " << first_row + i;
+          ASSERT_EQ(0, datums[i].get_string().compare(value)) << col << " " << first_row + i;
+        }
+      }
+      ASSERT_NE(OB_SUCCESS, reader.read_batch(1, datums, text_allocator));
+
+      // skip into the middle of the chunk
+      ASSERT_EQ(OB_SUCCESS, reader.init(meta_.get_column(col), chunk, file_.data() + chunk.get_start_offset(),
+                                        chunk.total_compressed_size_, allocator_));
+      ASSERT_EQ(OB_SUCCESS, reader.skip_rows(row_cnt - 1));
+      ASSERT_EQ(OB_SUCCESS, reader.read_batch(1, datums, text_allocator));
+      const char *last = expect[first_row + row_cnt - 1][col];
+      ASSERT_EQ(NULL == last, datums[0].is_null());
+      if (NULL != last) {
+        ASSERT_EQ(0, datums[0].get_string().compare(last));
+      }
+    }
+  }
+}
+
+TEST_F(TestParquetFileReader, read_native_columns)
+{
+  const int64_t ids[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+  const double scores[8] = {1.5, 0, 3.5, 4.5, 0, 6.5, 7.5, 8.5};
+  const bool score_nulls[8] = {false, true, false, false, true, false, false, false};
+  const int64_t footer_len = *reinterpret_cast<const uint32_t *>(file_.data() + file_.size() - ObParquetDef::FOOTER_TAIL_LEN);
+  ASSERT_EQ(OB_SUCCESS, meta_.parse(file_.data() + file_.size() - ObParquetDef::FOOTER_TAIL_LEN - footer_len, footer_len));
+  ASSERT_TRUE(ObParquetColumnReader::is_native_type(meta_.get_column(0), ObIntType, 0));
+  ASSERT_FALSE(ObParquetColumnReader::is_native_type(meta_.get_column(0), ObInt32Type, 0));
+  ASSERT_FALSE(ObParquetColumnReader::is_native_type(meta_.get_column(0), ObVarcharType, 0));
+  ASSERT_TRUE(ObParquetColumnReader::is_native_type(meta_.get_column(1), ObDoubleType, -1));
+  // double(m, d) is rounded by the cast
+  ASSERT_FALSE(ObParquetColumnReader::is_native_type(meta_.get_column(1), ObDoubleType, 2));
+  ASSERT_FALSE(ObParquetColumnReader::is_native_type(meta_.get_column(1), ObFloatType, -1));
+  ASSERT_FALSE(ObParquetColumnReader::is_native_type(meta_.get_column(2), ObVarcharType, 0));
+  for (int64_t col = 0; col < 2; ++col) {
+    for (int64_t rg = 0; rg < meta_.get_row_group_count(); ++rg) {
+      const ObParquetColumnChunkMeta &chunk = meta_.get_chunk(rg, col);
+      const int64_t first_row = meta_.get_row_group(rg).first_row_idx_;
+      const int64_t row_cnt = meta_.get_row_group(rg).num_rows_;
+      ObParquetColumnReader reader;
+      ObArenaAllocator text_allocator;
+      ObDatum datums[8];
+      int64_t bufs[8];
+      for (int64_t i = 0; i < 8; ++i) {
+        datums[i].ptr_ = reinterpret_cast<const char *>(&bufs[i]);
+      }
+      ASSERT_EQ(OB_SUCCESS, reader.init(meta_.get_column(col), chunk, file_.data() + chunk.get_start_offset(),
+                                        chunk.total_compressed_size_, allocator_, true));
+      ASSERT_EQ(OB_SUCCESS, reader.read_batch(row_cnt, datums, text_allocator));
+      // no text is printed
+      ASSERT_EQ(0, text_allocator.used());
+      for (int64_t i = 0; i < row_cnt; ++i) {
+        const int64_t row = first_row + i;
+        if (0 == col) {
+          ASSERT_EQ(ids[row], datums[i].get_int()) << row;
+        } else if (score_nulls[row]) {
+          ASSERT_TRUE(datums[i].is_null()) << row;
+        } else {
+          ASSERT_EQ(scores[row], datums[i].get_double()) << row;
+        }
+      }
+    }
+  }
+}
+
+TEST_F(TestParquetFileReader, read_native_nan)
+{
+  // a page of the score column with NaN and infinity, which can not be stored in double
+  std::string file;
+  file.swap(file_);
+  append_page(ObParquetDef::PAGE_DATA, 3, ObParquetDef::ENC_PLAIN,
+              def_levels({1, 1, 1}) + double_bytes(2.5) + double_bytes(NAN) + double_bytes(INFINITY),
+              ObParquetDef::CODEC_UNCOMPRESSED);
+  std::string page;
+  page.swap(file_);
+  file_.swap(file);
+  const int64_t footer_len = *reinterpret_cast<const uint32_t *>(file_.data() + file_.size() - ObParquetDef::FOOTER_TAIL_LEN);
+  ASSERT_EQ(OB_SUCCESS, meta_.parse(file_.data() + file_.size() - ObParquetDef::FOOTER_TAIL_LEN - footer_len, footer_len));
+  ObParquetColumnChunkMeta chunk = meta_.get_chunk(1, 1);
+  chunk.total_compressed_size_ = page.size();
+  ObParquetColumnReader reader;
+  ObArenaAllocator text_allocator;
+  ObDatum datums[3];
+  int64_t bufs[3];
+  for (int64_t i = 0; i < 3; ++i) {
+    datums[i].ptr_ = reinterpret_cast<const char *>(&bufs[i]);
+  }
+  ASSERT_EQ(OB_SUCCESS, reader.init(meta_.get_column(1), chunk, page.data(), page.size(),
+                                    allocator_, true));
+  ASSERT_EQ(OB_SUCCESS, reader.read_batch(1, datums, text_allocator));
+  ASSERT_EQ(2.5, datums[0].get_double());
+  ASSERT_EQ(OB_INVALID_NUMERIC, reader.read_batch(1, datums + 1, text_allocator));
+  ASSERT_EQ(OB_SUCCESS, reader.init(meta_.get_column(1), chunk, page.data(), page.size(),
+                                    allocator_, true));
+  ASSERT_EQ(OB_SUCCESS, reader.skip_rows(2));
+  ASSERT_EQ(OB_INVALID_NUMERIC, reader.read_batch(1, datums + 2, text_allocator));
+}
+
+TEST_F(TestParquetFileReader, skip_by_statistics)
+{
+  const int64_t footer_len = *reinterpret_cast<const uint32_t *>(file_.data() + file_.size() - ObParquetDef::FOOTER_TAIL_LEN);
+  ASSERT_EQ(OB_SUCCESS, meta_.parse(file_.data() + file_.size() - ObParquetDef::FOOTER_TAIL_LEN - footer_len, footer_len));
+  const ObParquetColumnSchema &id = meta_.get_column(0);
+  const ObParquetColumnChunkMeta &chunk = meta_.get_chunk(0, 0);
+  ObDatum value;
+  int64_t int_value = 0;
+  bool can_skip = false;
+  value.ptr_ = reinterpret_cast<const char *>(&int_value);
+  value.pack_ = sizeof(int64_t);
+  struct {
+    ObItemType cmp_type_;
+    int64_t value_;
+    bool can_skip_;
+  } cases[] = {
+    {T_OP_EQ, 0, true}, {T_OP_EQ, 1, false}, {T_OP_EQ, 5, false}, {T_OP_EQ, 6, true},
+    {T_OP_LT, 1, true}, {T_OP_LT, 2, false}, {T_OP_LE, 1, false}, {T_OP_LE, 0, true},
+    {T_OP_GT, 5, true}, {T_OP_GT, 4, false}, {T_OP_GE, 5, false}, {T_OP_GE, 6, true},
+  };
+  for (int64_t i = 0; i < sizeof(cases) / sizeof(cases[0]); ++i) {
+    int_value = cases[i].value_;
+    ASSERT_EQ(OB_SUCCESS, ObParquetFileMeta::can_skip_chunk(id, chunk, cases[i].cmp_type_, ObIntType, value, can_skip));
+    ASSERT_EQ(cases[i].can_skip_, can_skip) << i;
+  }
+  // statistics are not used for other types
+  int_value = 100;
+  ASSERT_EQ(OB_SUCCESS, ObParquetFileMeta::can_skip_chunk(id, chunk, T_OP_EQ, ObUInt64Type, value, can_skip));
+  ASSERT_FALSE(can_skip);
+  value.set_null();
+  ASSERT_EQ(OB_SUCCESS, ObParquetFileMeta::can_skip_chunk(id, chunk, T_OP_EQ, ObIntType, value, can_skip));
+  ASSERT_FALSE(can_skip);
+  // no statistics
+  int_value = 100;
+  value.ptr_ = reinterpret_cast<const char *>(&int_value);
+  value.pack_ = sizeof(int64_t);
+  ASSERT_EQ(OB_SUCCESS, ObParquetFileMeta::can_skip_chunk(meta_.get_column(1), meta_.get_chunk(1, 1),
+                                                          T_OP_EQ, ObDoubleType, value, can_skip));
+  ASSERT_FALSE(can_skip);
+  double double_value = 5.0;
+  value.ptr_ = reinterpret_cast<const char *>(&double_value);
+  value.pack_ = sizeof(double);
+  ASSERT_EQ(OB_SUCCESS, ObParquetFileMeta::can_skip_chunk(meta_.get_column(1), meta_.get_chunk(0, 1),
+                                                          T_OP_GT, ObDoubleType, value, can_skip));
+  ASSERT_TRUE(can_skip);
+  ASSERT_EQ(OB_SUCCESS, ObParquetFileMeta::can_skip_chunk(meta_.get_column(1), meta_.get_chunk(0, 1),
+                                                          T_OP_LT, ObDoubleType, value, can_skip));
+  ASSERT_FALSE(can_skip);
+}
+
+int main(int argc, char **argv)
+{
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
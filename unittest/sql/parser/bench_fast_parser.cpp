@@ -0,0 +1,128 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL_PC
+
+#include <gtest/gtest.h>
+#include <iostream>
+#include <string>
+#include "lib/allocator/page_arena.h"
+#include "lib/random/ob_random.h"
+#include "lib/time/ob_time_utility.h"
+#include "sql/parser/ob_fast_parser.h"
+
+// Microbenchmark of ObFastParser over query shapes of real workloads:
+// point select, long IN-list, batched multi-value insert and commented query.
+// It is not registered with ctest, the parse results are checked by test_fast_parser_scan.
+// usage: ./bench_fast_parser [-n in_list_size] [-l loop_count]
+namespace oceanbase
+{
+namespace sql
+{
+using namespace common;
+
+static int64_t LIST_SIZE = 1000;
+static int64_t LOOP_COUNT = 10000;
+
+class BenchFastParser : public ::testing::Test
+{
+public:
+  void run(const char *name, const std::string &sql, const int64_t expect_param_num)
+  {
+    ObCharsets4Parser charsets4parser;
+    FPContext fp_ctx(charsets4parser);
+    ObArenaAllocator allocator(ObModIds::TEST);
+    int64_t total_time = 0;
+    for (int64_t loop = 0; loop < LOOP_COUNT; loop++) {
+      char *no_param_sql = NULL;
+      int64_t no_param_sql_len = 0;
+      ParamList *param_list = NULL;
+      int64_t param_num = 0;
+      const int64_t start = ObTimeUtility::current_time();
+      ASSERT_EQ(OB_SUCCESS, ObFastParser::parse(ObString(sql.length(), sql.c_str()), fp_ctx,
+                                                allocator, no_param_sql, no_param_sql_len,
+                                                param_list, param_num));
+      total_time += ObTimeUtility::current_time() - start;
+      ASSERT_EQ(expect_param_num, param_num);
+      allocator.reuse();
+    }
+    std::cout << name << " sql len: " << sql.length()
+              << ", fast parse per query(ns): " << total_time * 1000 / LOOP_COUNT << std::endl;
+  }
+};
+
+TEST_F(BenchFastParser, point_select)
+{
+  run("point select", "select c, pad from sbtest1 where id = 1024", 1);
+}
+
+TEST_F(BenchFastParser, in_list)
+{
+  std::string sql = "select id, k, c from sbtest1 where id in (";
+  for (int64_t i = 0; i < LIST_SIZE; i++) {
+    sql += (0 == i ? "" : ", ") + std::to_string(ObRandom::rand(1, 100000000));
+  }
+  sql += ")";
+  run("int in list", sql, LIST_SIZE);
+
+  sql = "select id, k, c from sbtest1 where c in (";
+  for (int64_t i = 0; i < LIST_SIZE; i++) {
+    sql += (0 == i ? "'" : ", '") + std::to_string(ObRandom::rand(1, 100000000))
+           + "-68487932199-96439406143-93774651418-41631865787'";
+  }
+  sql += ")";
+  run("string in list", sql, LIST_SIZE);
+}
+
+TEST_F(BenchFastParser, multi_values_insert)
+{
+  std::string sql = "insert into sbtest1 (id, k, c, pad) values ";
+  for (int64_t i = 0; i < LIST_SIZE; i++) {
+    sql += (0 == i ? "(" : ", (") + std::to_string(i) + ", "
+           + std::to_string(ObRandom::rand(1, 100000000))
+           + ", '83868641912-28773972837-60736120486-75162659906-27563526494-20381887404',"
+           + " '67847967377-48000963322-62604785301-91415491898-96926520291')";
+  }
+  run("multi values insert", sql, LIST_SIZE * 4);
+}
+
+TEST_F(BenchFastParser, comment)
+{
+  run("comment",
+      "/* generated by the report service, do not edit, owner: trade platform, version 2.3.1 */"
+      " select /*+ index(t idx_k) */ sum(k) from sbtest1 t -- sum of k for the report page\n"
+      " where c = 'abcdefghijklmnopqrstuvwxyz' # the c column is the key of the report\n"
+      " and pad like 'abc%'", 2);
+}
+
+} // end namespace sql
+} // end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  OB_LOGGER.set_log_level("ERROR");
+  ::testing::InitGoogleTest(&argc, argv);
+  int c = 0;
+  while (-1 != (c = getopt(argc, argv, "n:l:"))) {
+    switch (c) {
+      case 'n':
+        oceanbase::sql::LIST_SIZE = atol(optarg);
+        break;
+      case 'l':
+        oceanbase::sql::LOOP_COUNT = atol(optarg);
+        break;
+      default:
+        break;
+    }
+  }
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,133 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL_PC
+
+#include <gtest/gtest.h>
+#include <string>
+#include "lib/allocator/page_arena.h"
+#include "lib/random/ob_random.h"
+#include "sql/parser/ob_fast_parser.h"
+
+// ObFastParser over query shapes of real workloads: point select, long IN-list,
+// batched multi-value insert and commented query.
+namespace oceanbase
+{
+namespace sql
+{
+using namespace common;
+
+class TestFastParserScan : public ::testing::Test
+{
+public:
+  static const int64_t LIST_SIZE = 1000;
+
+  TestFastParserScan() : allocator_(ObModIds::TEST) {}
+  virtual void TearDown() override
+  {
+    allocator_.reset();
+  }
+
+  void parse(const std::string &sql, const int64_t expect_param_num)
+  {
+    ObCharsets4Parser charsets4parser;
+    FPContext fp_ctx(charsets4parser);
+    char *no_param_sql = NULL;
+    int64_t no_param_sql_len = 0;
+    ParamList *param_list = NULL;
+    int64_t param_num = 0;
+    ASSERT_EQ(OB_SUCCESS, ObFastParser::parse(ObString(sql.length(), sql.c_str()), fp_ctx,
+                                              allocator_, no_param_sql, no_param_sql_len,
+                                              param_list, param_num));
+    ASSERT_EQ(expect_param_num, param_num);
+  }
+
+protected:
+  ObArenaAllocator allocator_;
+};
+
+TEST_F(TestFastParserScan, find_first_of)
+{
+  // compare with byte by byte search at every start position, including the 16 bytes tails
+  const int64_t len = 100;
+  char *buf = static_cast<char *>(allocator_.alloc(len));
+  ASSERT_TRUE(NULL != buf);
+  for (int64_t round = 0; round < 100; round++) {
+    for (int64_t i = 0; i < len; i++) {
+      buf[i] = 0 == ObRandom::rand(0, 20) ? '\'' : static_cast<char>(ObRandom::rand(-128, 127));
+    }
+    ObRawSql raw_sql;
+    raw_sql.init(buf, len);
+    for (int64_t pos = 0; pos < len; pos++) {
+      int64_t expect = pos;
+      while (expect < len && '\\' != buf[expect] && '\'' != buf[expect]
+             && INVALID_CHAR != buf[expect]) {
+        expect++;
+      }
+      ASSERT_EQ(expect, raw_sql.find_first_of(pos, '\\', '\'', INVALID_CHAR));
+    }
+  }
+}
+
+TEST_F(TestFastParserScan, point_select)
+{
+  parse("select c, pad from sbtest1 where id = 1024", 1);
+}
+
+TEST_F(TestFastParserScan, in_list)
+{
+  std::string sql = "select id, k, c from sbtest1 where id in (";
+  for (int64_t i = 0; i < LIST_SIZE; i++) {
+    sql += (0 == i ? "" : ", ") + std::to_string(ObRandom::rand(1, 100000000));
+  }
+  sql += ")";
+  parse(sql, LIST_SIZE);
+
+  sql = "select id, k, c from sbtest1 where c in (";
+  for (int64_t i = 0; i < LIST_SIZE; i++) {
+    sql += (0 == i ? "'" : ", '") + std::to_string(ObRandom::rand(1, 100000000))
+           + "-68487932199-96439406143-93774651418-41631865787'";
+  }
+  sql += ")";
+  parse(sql, LIST_SIZE);
+}
+
+TEST_F(TestFastParserScan, multi_values_insert)
+{
+  std::string sql = "insert into sbtest1 (id, k, c, pad) values ";
+  for (int64_t i = 0; i < LIST_SIZE; i++) {
+    sql += (0 == i ? "(" : ", (") + std::to_string(i) + ", "
+           + std::to_string(ObRandom::rand(1, 100000000))
+           + ", '83868641912-28773972837-60736120486-75162659906-27563526494-20381887404',"
+           + " '67847967377-48000963322-62604785301-91415491898-96926520291')";
+  }
+  parse(sql, LIST_SIZE * 4);
+}
+
+TEST_F(TestFastParserScan, comment)
+{
+  parse(
+      "/* generated by the report service, do not edit, owner: trade platform, version 2.3.1 */"
+      " select /*+ index(t idx_k) */ sum(k) from sbtest1 t -- sum of k for the report page\n"
+      " where c = 'abcdefghijklmnopqrstuvwxyz' # the c column is the key of the report\n"
+      " and pad like 'abc%'", 2);
+}
+
+} // end namespace sql
+} // end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  OB_LOGGER.set_log_level("ERROR");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
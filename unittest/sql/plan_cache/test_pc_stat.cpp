@@ -0,0 +1,92 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL_PC
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+#define private public
+#include "sql/plan_cache/ob_plan_cache_struct.h"
+#undef private
+
+namespace oceanbase
+{
+namespace sql
+{
+using namespace common;
+
+TEST(TestPCStat, slot_layout)
+{
+  ASSERT_EQ(CACHE_ALIGN_SIZE, static_cast<int64_t>(sizeof(ObPlanCacheStat::Slot)));
+  ASSERT_EQ(CACHE_ALIGN_SIZE, static_cast<int64_t>(alignof(ObPlanCacheStat::Slot)));
+  ObPlanCacheStat pc_stat;
+  ASSERT_EQ(0, pc_stat.get_access_count());
+  pc_stat.inc_hit_and_access_count();
+  ASSERT_EQ(0, pc_stat.get_access_count());
+  ASSERT_EQ(OB_SUCCESS, pc_stat.init(OB_SERVER_TENANT_ID));
+  ASSERT_EQ(0, reinterpret_cast<int64_t>(pc_stat.slots_) % CACHE_ALIGN_SIZE);
+  pc_stat.destroy();
+  ASSERT_TRUE(NULL == pc_stat.slots_);
+}
+
+TEST(TestPCStat, hit_and_access)
+{
+  ObPlanCacheStat pc_stat;
+  ASSERT_EQ(OB_SUCCESS, pc_stat.init(OB_SERVER_TENANT_ID));
+  ASSERT_EQ(0, pc_stat.get_access_count());
+  ASSERT_EQ(0, pc_stat.get_hit_count());
+  pc_stat.inc_access_count();
+  pc_stat.inc_hit_and_access_count();
+  pc_stat.inc_hit_and_access_count();
+  ASSERT_EQ(3, pc_stat.get_access_count());
+  ASSERT_EQ(2, pc_stat.get_hit_count());
+  pc_stat.reset();
+  ASSERT_EQ(0, pc_stat.get_access_count());
+  ASSERT_EQ(0, pc_stat.get_hit_count());
+}
+
+TEST(TestPCStat, concurrent_lookup)
+{
+  const int64_t thread_cnt = 8;
+  const int64_t lookup_cnt = 10000;
+  ObPlanCacheStat pc_stat;
+  ASSERT_EQ(OB_SUCCESS, pc_stat.init(OB_SERVER_TENANT_ID));
+  std::vector<std::thread> threads;
+  for (int64_t i = 0; i < thread_cnt; i++) {
+    threads.push_back(std::thread([&pc_stat, i]() {
+      for (int64_t j = 0; j < lookup_cnt; j++) {
+        // odd threads miss every lookup
+        if (0 == i % 2) {
+          pc_stat.inc_hit_and_access_count();
+        } else {
+          pc_stat.inc_access_count();
+        }
+      }
+    }));
+  }
+  for (int64_t i = 0; i < thread_cnt; i++) {
+    threads.at(i).join();
+  }
+  ASSERT_EQ(thread_cnt * lookup_cnt, pc_stat.get_access_count());
+  ASSERT_EQ(thread_cnt / 2 * lookup_cnt, pc_stat.get_hit_count());
+}
+
+} // end namespace sql
+} // end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
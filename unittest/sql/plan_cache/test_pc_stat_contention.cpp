@@ -0,0 +1,103 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL_PC
+
+#include <gtest/gtest.h>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include "lib/time/ob_time_utility.h"
+#include "sql/plan_cache/ob_plan_cache_struct.h"
+
+// Contention benchmark of the plan cache hit statistics, which are updated by every
+// lookup of the tenant: shared atomic counters vs counters by cpu.
+// It is not registered with ctest.
+// usage: ./bench_pc_stat_contention [-t thread_count] [-n lookup_count_per_thread]
+namespace oceanbase
+{
+namespace sql
+{
+using namespace common;
+
+static int64_t THREAD_COUNT = 32;
+static int64_t LOOKUP_COUNT = 1000000;
+
+// layout of the statistics before they were counted by cpu
+struct SharedStat
+{
+  uint64_t access_count_;
+  uint64_t hit_count_;
+};
+
+template <typename Func>
+int64_t run_threads(Func func)
+{
+  std::vector<std::thread> threads;
+  const int64_t start = ObTimeUtility::current_time();
+  for (int64_t i = 0; i < THREAD_COUNT; i++) {
+    threads.push_back(std::thread([&func]() {
+      for (int64_t j = 0; j < LOOKUP_COUNT; j++) {
+        func();
+      }
+    }));
+  }
+  for (int64_t i = 0; i < THREAD_COUNT; i++) {
+    threads.at(i).join();
+  }
+  return ObTimeUtility::current_time() - start;
+}
+
+TEST(TestPCStatContention, hit_and_access)
+{
+  SharedStat shared_stat = { 0, 0 };
+  ObPlanCacheStat pc_stat;
+  ASSERT_EQ(OB_SUCCESS, pc_stat.init(OB_SERVER_TENANT_ID));
+  const int64_t shared_time = run_threads([&shared_stat]() {
+    ATOMIC_INC(&shared_stat.hit_count_);
+    ATOMIC_INC(&shared_stat.access_count_);
+  });
+  const int64_t pc_time = run_threads([&pc_stat]() {
+    pc_stat.inc_hit_and_access_count();
+  });
+  const int64_t total = THREAD_COUNT * LOOKUP_COUNT;
+  ASSERT_EQ(total, static_cast<int64_t>(shared_stat.access_count_));
+  ASSERT_EQ(total, pc_stat.get_access_count());
+  ASSERT_EQ(total, pc_stat.get_hit_count());
+  std::cout << "threads: " << THREAD_COUNT << ", lookups: " << total
+            << ", shared counter per lookup(ns): " << shared_time * 1000 / LOOKUP_COUNT
+            << ", counter by cpu per lookup(ns): " << pc_time * 1000 / LOOKUP_COUNT
+            << std::endl;
+}
+
+} // end namespace sql
+} // end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  int c = 0;
+  while (-1 != (c = getopt(argc, argv, "t:n:"))) {
+    switch (c) {
+      case 't':
+        oceanbase::sql::THREAD_COUNT = atol(optarg);
+        break;
+      case 'n':
+        oceanbase::sql::LOOKUP_COUNT = atol(optarg);
+        break;
+      default:
+        break;
+    }
+  }
+  return RUN_ALL_TESTS();
+}
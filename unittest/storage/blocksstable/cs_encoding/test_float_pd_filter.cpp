@@ -0,0 +1,225 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include "ob_pd_filter_test_base.h"
+#include "storage/blocksstable/cs_encoding/ob_float_column_encoder.h"
+
+namespace oceanbase
+{
+namespace blocksstable
+{
+
+class TestFloatPdFilter : public ObPdFilterTestBase
+{
+};
+
+#define float_type_filter_normal_check(flag, op_type, round, ref_cnt, res_arr) \
+  need_check = flag & enable_check; \
+  if (need_check) { \
+    ObArray<ObObj> ref_objs; \
+    for (int64_t i = 0; i < round; ++i) { \
+      ref_objs.reset(); \
+      for (int64_t j = ref_cnt * i; j < ref_cnt * (i + 1); ++j) { \
+        ObObj ref_obj; \
+        if (is_double) { \
+          ref_obj.set_double(ref_arr[j]); \
+        } else { \
+          ref_obj.set_float(static_cast<float>(ref_arr[j])); \
+        } \
+        ASSERT_EQ(OB_SUCCESS, ref_objs.push_back(ref_obj)); \
+      } \
+      ASSERT_EQ(OB_SUCCESS, check_column_store_white_filter(op_type, row_cnt, col_cnt, \
+        col_offset, col_descs_[col_offset].col_type_, ref_objs, decoder, res_arr[i])) << "round: " << i << std::endl; \
+    } \
+  } \
+
+TEST_F(TestFloatPdFilter, test_float_decoder_filter)
+{
+  const int64_t rowkey_cnt = 1;
+  const int64_t col_cnt = 3;
+  const bool enable_check = ENABLE_CASE_CHECK;
+  ObObjType col_types[col_cnt] = {ObIntType, ObDoubleType, ObFloatType};
+  ASSERT_EQ(OB_SUCCESS, prepare(col_types, rowkey_cnt, col_cnt));
+  ctx_.column_encodings_[0] = ObCSColumnHeader::Type::INTEGER;
+  ctx_.column_encodings_[1] = ObCSColumnHeader::Type::FLOAT;
+  ctx_.column_encodings_[2] = ObCSColumnHeader::Type::FLOAT;
+
+  // [0, 100): (i - 50) * 0.25, [100, 110): null, 110: huge value, 111: -0.0, 112: NaN,
+  // the last three rows can not be encoded as integers and are stored as exceptions
+  const int64_t row_cnt = 113;
+  const double huge_double = 1e300;
+  const float huge_float = 3.0e38f;
+  ObMicroBlockCSEncoder encoder;
+  ASSERT_EQ(OB_SUCCESS, encoder.init(ctx_));
+  ObDatumRow row_arr[row_cnt];
+  for (int64_t i = 0; i < row_cnt; ++i) {
+    ASSERT_EQ(OB_SUCCESS, row_arr[i].init(allocator_, col_cnt));
+  }
+  for (int64_t i = 0; i < row_cnt; ++i) {
+    row_arr[i].storage_datums_[0].set_int(i);
+    if (i < 100) {
+      row_arr[i].storage_datums_[1].set_double((i - 50) * 0.25);
+      row_arr[i].storage_datums_[2].set_float((i - 50) * 0.25f);
+    } else if (i < 110) {
+      row_arr[i].storage_datums_[1].set_null();
+      row_arr[i].storage_datums_[2].set_null();
+    } else if (i == 110) {
+      row_arr[i].storage_datums_[1].set_double(huge_double);
+      row_arr[i].storage_datums_[2].set_float(huge_float);
+    } else if (i == 111) {
+      row_arr[i].storage_datums_[1].set_double(-0.0);
+      row_arr[i].storage_datums_[2].set_float(-0.0f);
+    } else {
+      row_arr[i].storage_datums_[1].set_double(NAN);
+      row_arr[i].storage_datums_[2].set_float(NAN);
+    }
+    ASSERT_EQ(OB_SUCCESS, encoder.append_row(row_arr[i]));
+  }
+
+  HANDLE_TRANSFORM();
+
+  for (int64_t col_offset = 1; col_offset < col_cnt; ++col_offset) {
+    const bool is_double = (1 == col_offset);
+    const double huge_value = is_double ? huge_double : huge_float;
+    bool need_check = true;
+
+    // check NU/NN
+    {
+      double ref_arr[1];
+      int64_t res_arr_nu[1] = {10};
+      float_type_filter_normal_check(true, ObWhiteFilterOperatorType::WHITE_OP_NU, 1, 0, res_arr_nu);
+      int64_t res_arr_nn[1] = {103};
+      float_type_filter_normal_check(true, ObWhiteFilterOperatorType::WHITE_OP_NN, 1, 0, res_arr_nn);
+    }
+
+    // check EQ/NE, -0.0 equals to 0.0 and NaN not equals to any number
+    {
+      double ref_arr[4] = {-12.5, 0.0, huge_value, 0.3};
+      int64_t res_arr_eq[4] = {1, 2, 1, 0};
+      float_type_filter_normal_check(true, ObWhiteFilterOperatorType::WHITE_OP_EQ, 4, 1, res_arr_eq);
+      int64_t res_arr_ne[4] = {102, 101, 102, 103};
+      float_type_filter_normal_check(true, ObWhiteFilterOperatorType::WHITE_OP_NE, 4, 1, res_arr_ne);
+    }
+
+    // check LT/LE/GT/GE, NaN is bigger than any number
+    {
+      double ref_arr[3] = {0.0, 100.0, -20.0};
+      int64_t res_arr_lt[3] = {50, 101, 0};
+      float_type_filter_normal_check(true, ObWhiteFilterOperatorType::WHITE_OP_LT, 3, 1, res_arr_lt);
+      int64_t res_arr_le[3] = {52, 101, 0};
+      float_type_filter_normal_check(true, ObWhiteFilterOperatorType::WHITE_OP_LE, 3, 1, res_arr_le);
+      int64_t res_arr_gt[3] = {51, 2, 103};
+      float_type_filter_normal_check(true, ObWhiteFilterOperatorType::WHITE_OP_GT, 3, 1, res_arr_gt);
+      int64_t res_arr_ge[3] = {53, 2, 103};
+      float_type_filter_normal_check(true, ObWhiteFilterOperatorType::WHITE_OP_GE, 3, 1, res_arr_ge);
+    }
+
+    // check BT/IN
+    {
+      double ref_arr[6] = {-1.0, 1.0, 1.0, -1.0, 1e30, huge_value};
+      int64_t res_arr[3] = {10, 0, 1};
+      float_type_filter_normal_check(true, ObWhiteFilterOperatorType::WHITE_OP_BT, 3, 2, res_arr);
+    }
+    {
+      double ref_arr[4] = {-12.5, 0.25, huge_value, 7.0};
+      int64_t res_arr[1] = {4};
+      float_type_filter_normal_check(true, ObWhiteFilterOperatorType::WHITE_OP_IN, 1, 4, res_arr);
+    }
+  }
+  LOG_INFO(">>>>>>>>>>FINISH PD FILTER<<<<<<<<<<<");
+}
+
+TEST_F(TestFloatPdFilter, test_choose_float_encoder)
+{
+  const int64_t rowkey_cnt = 1;
+  const int64_t col_cnt = 3;
+  ObObjType col_types[col_cnt] = {ObIntType, ObDoubleType, ObFloatType};
+  ASSERT_EQ(OB_SUCCESS, prepare(col_types, rowkey_cnt, col_cnt));
+
+  // [0, 100): i * 0.25, 100: huge value stored as exception
+  const int64_t row_cnt = 101;
+  const double huge_double = 1e300;
+  const float huge_float = 3.0e38f;
+  ObDatumRow row_arr[row_cnt];
+  for (int64_t i = 0; i < row_cnt; ++i) {
+    ASSERT_EQ(OB_SUCCESS, row_arr[i].init(allocator_, col_cnt));
+    row_arr[i].storage_datums_[0].set_int(i);
+    if (i < 100) {
+      row_arr[i].storage_datums_[1].set_double(i * 0.25);
+      row_arr[i].storage_datums_[2].set_float(i * 0.25f);
+    } else {
+      row_arr[i].storage_datums_[1].set_double(huge_double);
+      row_arr[i].storage_datums_[2].set_float(huge_float);
+    }
+  }
+
+  // float encoding is not chosen before data version 4.3.0.0
+  {
+    ctx_.major_working_cluster_version_ = DATA_VERSION_4_2_2_0;
+    ObMicroBlockCSEncoder encoder;
+    ASSERT_EQ(OB_SUCCESS, encoder.init(ctx_));
+    for (int64_t i = 0; i < row_cnt; ++i) {
+      ASSERT_EQ(OB_SUCCESS, encoder.append_row(row_arr[i]));
+    }
+    HANDLE_TRANSFORM();
+    ASSERT_NE(ObCSColumnHeader::Type::FLOAT, encoder.encoders_.at(1)->get_type());
+    ASSERT_NE(ObCSColumnHeader::Type::FLOAT, encoder.encoders_.at(2)->get_type());
+  }
+
+  {
+    ctx_.major_working_cluster_version_ = DATA_VERSION_4_3_0_0;
+    ObMicroBlockCSEncoder encoder;
+    ASSERT_EQ(OB_SUCCESS, encoder.init(ctx_));
+    for (int64_t i = 0; i < row_cnt; ++i) {
+      ASSERT_EQ(OB_SUCCESS, encoder.append_row(row_arr[i]));
+    }
+    HANDLE_TRANSFORM();
+    ASSERT_EQ(ObCSColumnHeader::Type::FLOAT, encoder.encoders_.at(1)->get_type());
+    ASSERT_EQ(ObCSColumnHeader::Type::FLOAT, encoder.encoders_.at(2)->get_type());
+
+    // the exception of float column only holds the 4 bytes of the float value
+    const ObFloatColumnEncoder *double_encoder =
+        static_cast<const ObFloatColumnEncoder *>(encoder.encoders_.at(1));
+    const ObFloatColumnEncoder *float_encoder =
+        static_cast<const ObFloatColumnEncoder *>(encoder.encoders_.at(2));
+    uint64_t double_bits = 0;
+    uint32_t float_bits = 0;
+    MEMCPY(&double_bits, &huge_double, sizeof(double));
+    MEMCPY(&float_bits, &huge_float, sizeof(float));
+    ASSERT_EQ(1, double_encoder->float_meta_.exception_cnt_);
+    ASSERT_EQ(100, double_encoder->exception_row_ids_[0]);
+    ASSERT_EQ(double_bits, double_encoder->exception_values_[0]);
+    ASSERT_EQ(1, float_encoder->float_meta_.exception_cnt_);
+    ASSERT_EQ(100, float_encoder->exception_row_ids_[0]);
+    ASSERT_EQ(static_cast<uint64_t>(float_bits), float_encoder->exception_values_[0]);
+
+    double ref_arr[2] = {0.25, huge_float};
+    int64_t res_arr[2] = {1, 1};
+    const bool enable_check = ENABLE_CASE_CHECK;
+    const bool is_double = false;
+    const int64_t col_offset = 2;
+    bool need_check = true;
+    float_type_filter_normal_check(true, ObWhiteFilterOperatorType::WHITE_OP_EQ, 2, 1, res_arr);
+  }
+}
+
+}
+}
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_float_pd_filter.log*");
+  OB_LOGGER.set_file_name("test_float_pd_filter.log", true, false);
+  oceanbase::common::ObLogger::get_logger().set_log_level("INFO");
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
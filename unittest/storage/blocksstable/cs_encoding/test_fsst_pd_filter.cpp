@@ -0,0 +1,352 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define private public
+#define protected public
+#include "ob_pd_filter_test_base.h"
+#include "storage/blocksstable/cs_encoding/ob_fsst_column_decoder.h"
+#undef private
+#undef protected
+
+namespace oceanbase
+{
+namespace blocksstable
+{
+
+class TestFsstPdFilter : public ObPdFilterTestBase
+{
+public:
+  // change the collation of a string column prepared by prepare() to binary
+  int set_binary_collation(const int64_t col_offset);
+};
+
+int TestFsstPdFilter::set_binary_collation(const int64_t col_offset)
+{
+  int ret = OB_SUCCESS;
+  col_descs_.at(col_offset).col_type_.set_collation_type(CS_TYPE_BINARY);
+  read_info_.reset();
+  if (OB_FAIL(read_info_.init(allocator_, row_generate_.get_schema().get_column_count(),
+      row_generate_.get_schema().get_rowkey_column_num(), lib::is_oracle_mode(), col_descs_, nullptr))) {
+    LOG_WARN("fail to init read_info", K(ret));
+  }
+  return ret;
+}
+
+#define fsst_type_filter_normal_check(flag, op_type, round, ref_cnt, res_arr) \
+  need_check = flag & enable_check; \
+  if (need_check) { \
+    ObArray<ObObj> ref_objs; \
+    for (int64_t i = 0; i < round; ++i) { \
+      ref_objs.reset(); \
+      for (int64_t j = ref_cnt * i; j < ref_cnt * (i + 1); ++j) { \
+        ObObj ref_obj; \
+        ref_obj.set_varchar(ref_arr[j]); \
+        set_obj_collation(ref_obj, ObVarcharType); \
+        ASSERT_EQ(OB_SUCCESS, ref_objs.push_back(ref_obj)); \
+      } \
+      ASSERT_EQ(OB_SUCCESS, check_column_store_white_filter(op_type, row_cnt, col_cnt, \
+        col_offset, col_descs_[col_offset].col_type_, ref_objs, decoder, res_arr[i])) << "round: " << i << std::endl; \
+    } \
+  } \
+
+TEST_F(TestFsstPdFilter, test_fsst_decoder_filter)
+{
+  const int64_t rowkey_cnt = 1;
+  const int64_t col_cnt = 2;
+  const bool enable_check = ENABLE_CASE_CHECK;
+  ObObjType col_types[col_cnt] = {ObIntType, ObVarcharType};
+  ASSERT_EQ(OB_SUCCESS, prepare(col_types, rowkey_cnt, col_cnt));
+  ctx_.column_encodings_[0] = ObCSColumnHeader::Type::INTEGER;
+  ctx_.column_encodings_[1] = ObCSColumnHeader::Type::FSST;
+
+  // [0, 100): https://www.example.com/path/{i % 20}/item, [100, 110): null,
+  // [110, 120): http://oceanbase.com/{i}
+  const int64_t row_cnt = 120;
+  const int64_t max_str_len = 64;
+  ObMicroBlockCSEncoder encoder;
+  ASSERT_EQ(OB_SUCCESS, encoder.init(ctx_));
+  ObDatumRow row_arr[row_cnt];
+  char *str_buf = static_cast<char *>(allocator_.alloc(row_cnt * max_str_len));
+  ASSERT_NE(nullptr, str_buf);
+  for (int64_t i = 0; i < row_cnt; ++i) {
+    ASSERT_EQ(OB_SUCCESS, row_arr[i].init(allocator_, col_cnt));
+  }
+  for (int64_t i = 0; i < row_cnt; ++i) {
+    char *str = str_buf + i * max_str_len;
+    int64_t len = 0;
+    row_arr[i].storage_datums_[0].set_int(i);
+    if (i < 100) {
+      len = snprintf(str, max_str_len, "https://www.example.com/path/%ld/item", i % 20);
+      row_arr[i].storage_datums_[1].set_string(str, len);
+    } else if (i < 110) {
+      row_arr[i].storage_datums_[1].set_null();
+    } else {
+      len = snprintf(str, max_str_len, "http://oceanbase.com/%ld", i);
+      row_arr[i].storage_datums_[1].set_string(str, len);
+    }
+    ASSERT_EQ(OB_SUCCESS, encoder.append_row(row_arr[i]));
+  }
+
+  HANDLE_TRANSFORM();
+
+  const int64_t col_offset = 1;
+  bool need_check = true;
+
+  // check NU/NN
+  {
+    const char *ref_arr[1];
+    int64_t res_arr_nu[1] = {10};
+    fsst_type_filter_normal_check(true, ObWhiteFilterOperatorType::WHITE_OP_NU, 1, 0, res_arr_nu);
+    int64_t res_arr_nn[1] = {110};
+    fsst_type_filter_normal_check(true, ObWhiteFilterOperatorType::WHITE_OP_NN, 1, 0, res_arr_nn);
+  }
+
+  // check EQ/NE, the collation is case insensitive
+  {
+    const char *ref_arr[3] = {"https://www.example.com/path/3/item",
+                              "HTTPS://WWW.EXAMPLE.COM/PATH/3/ITEM",
+                              "https://www.example.com/path/3"};
+    int64_t res_arr_eq[3] = {5, 5, 0};
+    fsst_type_filter_normal_check(true, ObWhiteFilterOperatorType::WHITE_OP_EQ, 3, 1, res_arr_eq);
+    int64_t res_arr_ne[3] = {105, 105, 110};
+    fsst_type_filter_normal_check(true, ObWhiteFilterOperatorType::WHITE_OP_NE, 3, 1, res_arr_ne);
+  }
+
+  // check LT/LE/GT/GE
+  {
+    const char *ref_arr[2] = {"http://oceanbase.com/115", "https://www.example.com/path/5/item"};
+    int64_t res_arr_lt[2] = {5, 85};
+    fsst_type_filter_normal_check(true, ObWhiteFilterOperatorType::WHITE_OP_LT, 2, 1, res_arr_lt);
+    int64_t res_arr_le[2] = {6, 90};
+    fsst_type_filter_normal_check(true, ObWhiteFilterOperatorType::WHITE_OP_LE, 2, 1, res_arr_le);
+    int64_t res_arr_gt[2] = {104, 20};
+    fsst_type_filter_normal_check(true, ObWhiteFilterOperatorType::WHITE_OP_GT, 2, 1, res_arr_gt);
+    int64_t res_arr_ge[2] = {105, 25};
+    fsst_type_filter_normal_check(true, ObWhiteFilterOperatorType::WHITE_OP_GE, 2, 1, res_arr_ge);
+  }
+
+  // check IN/BT
+  {
+    const char *ref_arr[3] = {"http://oceanbase.com/110", "https://www.example.com/path/0/item", "none"};
+    int64_t res_arr[1] = {6};
+    fsst_type_filter_normal_check(true, ObWhiteFilterOperatorType::WHITE_OP_IN, 1, 3, res_arr);
+  }
+  {
+    const char *ref_arr[2] = {"https://www.example.com/path/1/item", "https://www.example.com/path/2/item"};
+    int64_t res_arr[1] = {60};
+    fsst_type_filter_normal_check(true, ObWhiteFilterOperatorType::WHITE_OP_BT, 1, 2, res_arr);
+  }
+  LOG_INFO(">>>>>>>>>>FINISH PD FILTER<<<<<<<<<<<");
+}
+
+#define fsst_binary_filter_check(op_type, round, ref_cnt, res_arr) \
+  { \
+    ObArray<ObObj> ref_objs; \
+    for (int64_t i = 0; i < round; ++i) { \
+      ref_objs.reset(); \
+      for (int64_t j = ref_cnt * i; j < ref_cnt * (i + 1); ++j) { \
+        ObObj ref_obj; \
+        ref_obj.set_varbinary(ObString(ref_arr[j])); \
+        ASSERT_EQ(OB_SUCCESS, ref_objs.push_back(ref_obj)); \
+      } \
+      ASSERT_EQ(OB_SUCCESS, check_column_store_white_filter(op_type, row_cnt, col_cnt, \
+        col_offset, col_descs_[col_offset].col_type_, ref_objs, decoder, res_arr[i])) << "round: " << i << std::endl; \
+    } \
+  } \
+
+TEST_F(TestFsstPdFilter, test_fsst_binary_filter)
+{
+  const int64_t rowkey_cnt = 1;
+  const int64_t col_cnt = 2;
+  const int64_t col_offset = 1;
+  ObObjType col_types[col_cnt] = {ObIntType, ObVarcharType};
+  ASSERT_EQ(OB_SUCCESS, prepare(col_types, rowkey_cnt, col_cnt));
+  ASSERT_EQ(OB_SUCCESS, set_binary_collation(col_offset));
+  ctx_.column_encodings_[0] = ObCSColumnHeader::Type::INTEGER;
+  ctx_.column_encodings_[1] = ObCSColumnHeader::Type::FSST;
+
+  // [0, 80): https://www.example.com/path/{i % 20}/item, [80, 90): http, which is a prefix
+  // of symbols, [90, 100): null, [100, 120): bin\xff{i % 2}\xff, which contains the escape code
+  const int64_t row_cnt = 120;
+  const int64_t max_str_len = 64;
+  ObMicroBlockCSEncoder encoder;
+  ASSERT_EQ(OB_SUCCESS, encoder.init(ctx_));
+  ObDatumRow row_arr[row_cnt];
+  char *str_buf = static_cast<char *>(allocator_.alloc(row_cnt * max_str_len));
+  ASSERT_NE(nullptr, str_buf);
+  for (int64_t i = 0; i < row_cnt; ++i) {
+    ASSERT_EQ(OB_SUCCESS, row_arr[i].init(allocator_, col_cnt));
+  }
+  for (int64_t i = 0; i < row_cnt; ++i) {
+    char *str = str_buf + i * max_str_len;
+    int64_t len = 0;
+    row_arr[i].storage_datums_[0].set_int(i);
+    if (i < 80) {
+      len = snprintf(str, max_str_len, "https://www.example.com/path/%ld/item", i % 20);
+      row_arr[i].storage_datums_[1].set_string(str, len);
+    } else if (i < 90) {
+      len = snprintf(str, max_str_len, "http");
+      row_arr[i].storage_datums_[1].set_string(str, len);
+    } else if (i < 100) {
+      row_arr[i].storage_datums_[1].set_null();
+    } else {
+      len = snprintf(str, max_str_len, "bin\xff%ld\xff", i % 2);
+      row_arr[i].storage_datums_[1].set_string(str, len);
+    }
+    ASSERT_EQ(OB_SUCCESS, encoder.append_row(row_arr[i]));
+  }
+
+  HANDLE_TRANSFORM();
+  ASSERT_EQ(ObCSColumnHeader::Type::FSST, encoder.encoders_.at(col_offset)->get_type());
+
+  // check EQ/NE, the collation is case sensitive
+  {
+    const char *ref_arr[6] = {"https://www.example.com/path/3/item",
+                              "HTTPS://WWW.EXAMPLE.COM/PATH/3/ITEM",
+                              "http",
+                              "htt",
+                              "bin\xff" "1\xff",
+                              "bin\xff"};
+    int64_t res_arr_eq[6] = {4, 0, 10, 0, 10, 0};
+    fsst_binary_filter_check(ObWhiteFilterOperatorType::WHITE_OP_EQ, 6, 1, res_arr_eq);
+    int64_t res_arr_ne[6] = {106, 110, 100, 110, 100, 110};
+    fsst_binary_filter_check(ObWhiteFilterOperatorType::WHITE_OP_NE, 6, 1, res_arr_ne);
+  }
+
+  // check IN
+  {
+    const char *ref_arr[8] = {"http", "bin\xff" "0\xff", "https://www.example.com/path/0/item", "none",
+                              "https://www.example.com/path/1/item", "htt", "\xff", "HTTP"};
+    int64_t res_arr[2] = {24, 4};
+    fsst_binary_filter_check(ObWhiteFilterOperatorType::WHITE_OP_IN, 2, 4, res_arr);
+  }
+  LOG_INFO(">>>>>>>>>>FINISH PD FILTER<<<<<<<<<<<");
+}
+
+TEST_F(TestFsstPdFilter, test_can_compare_on_compressed)
+{
+  sql::ObExecContext exec_ctx(allocator_);
+  sql::ObEvalCtx eval_ctx(exec_ctx);
+  sql::ObPushdownExprSpec expr_spec(allocator_);
+  sql::ObPushdownOperator pd_operator(eval_ctx, expr_spec);
+  sql::ObPushdownWhiteFilterNode filter_node(allocator_);
+  sql::ObExpr filter_expr;
+  sql::ObExpr arg_exprs[3];
+  sql::ObExpr *args[3] = {&arg_exprs[0], &arg_exprs[1], &arg_exprs[2]};
+  arg_exprs[0].type_ = T_REF_COLUMN;
+  arg_exprs[0].obj_meta_.set_varbinary();
+  arg_exprs[1].obj_meta_.set_varbinary();
+  arg_exprs[2].obj_meta_.set_varbinary();
+  filter_expr.args_ = args;
+  filter_expr.arg_cnt_ = 2;
+  filter_node.expr_ = &filter_expr;
+  filter_node.op_type_ = sql::WHITE_OP_EQ;
+  sql::ObWhiteFilterExecutor filter(allocator_, filter_node, pd_operator);
+  ObColumnParam col_param(allocator_);
+  ObFsstColumnDecoderCtx ctx;
+
+  // binary column and binary value
+  ctx.obj_meta_.set_varbinary();
+  ASSERT_TRUE(ObFsstColumnDecoder::can_compare_on_compressed(ctx, filter));
+
+  // value of other collation or type class
+  arg_exprs[1].obj_meta_.set_varchar();
+  arg_exprs[1].obj_meta_.set_collation_type(CS_TYPE_UTF8MB4_GENERAL_CI);
+  ASSERT_FALSE(ObFsstColumnDecoder::can_compare_on_compressed(ctx, filter));
+  arg_exprs[1].obj_meta_.set_int();
+  ASSERT_FALSE(ObFsstColumnDecoder::can_compare_on_compressed(ctx, filter));
+  arg_exprs[1].obj_meta_.set_varbinary();
+
+  // column of case insensitive collation
+  ctx.obj_meta_.set_varchar();
+  ctx.obj_meta_.set_collation_type(CS_TYPE_UTF8MB4_GENERAL_CI);
+  ASSERT_FALSE(ObFsstColumnDecoder::can_compare_on_compressed(ctx, filter));
+
+  // binary char column needs padding
+  ctx.obj_meta_.set_binary();
+  ctx.col_param_ = &col_param;
+  ASSERT_FALSE(ObFsstColumnDecoder::can_compare_on_compressed(ctx, filter));
+  ctx.col_param_ = nullptr;
+  ctx.obj_meta_.set_varbinary();
+
+  // each value of IN is checked
+  filter_node.op_type_ = sql::WHITE_OP_IN;
+  filter_expr.arg_cnt_ = 3;
+  ASSERT_TRUE(ObFsstColumnDecoder::can_compare_on_compressed(ctx, filter));
+  arg_exprs[2].obj_meta_.set_varchar();
+  arg_exprs[2].obj_meta_.set_collation_type(CS_TYPE_UTF8MB4_BIN);
+  ASSERT_FALSE(ObFsstColumnDecoder::can_compare_on_compressed(ctx, filter));
+}
+
+TEST_F(TestFsstPdFilter, test_choose_fsst_encoder)
+{
+  const int64_t rowkey_cnt = 1;
+  const int64_t col_cnt = 2;
+  ObObjType col_types[col_cnt] = {ObIntType, ObVarcharType};
+  ASSERT_EQ(OB_SUCCESS, prepare(col_types, rowkey_cnt, col_cnt));
+
+  // distinct strings with long common substrings, which is not good for dict
+  const int64_t row_cnt = 100;
+  const int64_t max_str_len = 64;
+  ObDatumRow row_arr[row_cnt];
+  char *str_buf = static_cast<char *>(allocator_.alloc(row_cnt * max_str_len));
+  ASSERT_NE(nullptr, str_buf);
+  for (int64_t i = 0; i < row_cnt; ++i) {
+    char *str = str_buf + i * max_str_len;
+    ASSERT_EQ(OB_SUCCESS, row_arr[i].init(allocator_, col_cnt));
+    const int64_t len = snprintf(str, max_str_len, "https://www.example.com/path/%03ld/item", i);
+    row_arr[i].storage_datums_[0].set_int(i);
+    row_arr[i].storage_datums_[1].set_string(str, len);
+  }
+
+  // fsst encoding is not chosen before data version 4.3.0.0
+  {
+    ctx_.major_working_cluster_version_ = DATA_VERSION_4_2_2_0;
+    ObMicroBlockCSEncoder encoder;
+    ASSERT_EQ(OB_SUCCESS, encoder.init(ctx_));
+    for (int64_t i = 0; i < row_cnt; ++i) {
+      ASSERT_EQ(OB_SUCCESS, encoder.append_row(row_arr[i]));
+    }
+    HANDLE_TRANSFORM();
+    ASSERT_NE(ObCSColumnHeader::Type::FSST, encoder.encoders_.at(1)->get_type());
+  }
+
+  {
+    ctx_.major_working_cluster_version_ = DATA_VERSION_4_3_0_0;
+    ObMicroBlockCSEncoder encoder;
+    ASSERT_EQ(OB_SUCCESS, encoder.init(ctx_));
+    for (int64_t i = 0; i < row_cnt; ++i) {
+      ASSERT_EQ(OB_SUCCESS, encoder.append_row(row_arr[i]));
+    }
+    HANDLE_TRANSFORM();
+    ASSERT_EQ(ObCSColumnHeader::Type::FSST, encoder.encoders_.at(1)->get_type());
+
+    const char *ref_arr[2] = {"https://www.example.com/path/042/item", "https://www.example.com/path/1"};
+    int64_t res_arr[2] = {1, 0};
+    const bool enable_check = ENABLE_CASE_CHECK;
+    const int64_t col_offset = 1;
+    bool need_check = true;
+    fsst_type_filter_normal_check(true, ObWhiteFilterOperatorType::WHITE_OP_EQ, 2, 1, res_arr);
+  }
+}
+
+}
+}
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_fsst_pd_filter.log*");
+  OB_LOGGER.set_file_name("test_fsst_pd_filter.log", true, false);
+  oceanbase::common::ObLogger::get_logger().set_log_level("INFO");
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
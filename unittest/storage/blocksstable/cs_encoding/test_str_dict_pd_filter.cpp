@@ -511,6 +511,63 @@ TEST_F(TestStrDictPdFilter, test_string_dict_all_null_decoder)
   }
 }
 
+TEST_F(TestStrDictPdFilter, test_sorted_string_dict_in_filter)
+{
+  const int64_t rowkey_cnt = 1;
+  const int64_t col_cnt = 2;
+  const bool enable_check = ENABLE_CASE_CHECK;
+  ObObjType col_types[col_cnt] = {ObInt32Type, ObVarcharType};
+  ASSERT_EQ(OB_SUCCESS, prepare(col_types, rowkey_cnt, col_cnt));
+  ctx_.column_encodings_[0] = ObCSColumnHeader::Type::INT_DICT; // integer dict
+  ctx_.column_encodings_[1] = ObCSColumnHeader::Type::STR_DICT; // var string
+
+  // 200 distinct values and each value has 2 rows, the last 20 rows are null,
+  // IN params are binary searched in the sorted dict
+  const int64_t char_data_arr_cnt = 200;
+  const int64_t each_type_cnt = 2;
+  const int64_t null_cnt = 20;
+  const int64_t row_cnt = char_data_arr_cnt * each_type_cnt + null_cnt;
+  ObMicroBlockCSEncoder encoder;
+  ASSERT_EQ(OB_SUCCESS, encoder.init(ctx_));
+  ObDatumRow row_arr[row_cnt];
+  for (int64_t i = 0; i < row_cnt; ++i) {
+    ASSERT_EQ(OB_SUCCESS, row_arr[i].init(allocator_, col_cnt));
+  }
+  char **char_data_arr = static_cast<char **>(allocator_.alloc(sizeof(char *) * (char_data_arr_cnt + 1)));
+  for (int64_t i = 0; i <= char_data_arr_cnt; ++i) {
+    char_data_arr[i] = static_cast<char *>(allocator_.alloc(8));
+    ASSERT_TRUE(nullptr != char_data_arr[i]);
+    if (i < char_data_arr_cnt) {
+      snprintf(char_data_arr[i], 8, "v%03ld", i);
+    } else {
+      snprintf(char_data_arr[i], 8, "zzzz"); // not exist
+    }
+  }
+  for (int64_t i = 0; i < row_cnt; ++i) {
+    row_arr[i].storage_datums_[0].set_int32(i);
+    if (i < row_cnt - null_cnt) {
+      row_arr[i].storage_datums_[1].set_string(char_data_arr[i % char_data_arr_cnt], 4);
+    } else {
+      row_arr[i].storage_datums_[1].set_null();
+    }
+    ASSERT_EQ(OB_SUCCESS, encoder.append_row(row_arr[i]));
+  }
+
+  HANDLE_TRANSFORM();
+
+  const int64_t col_offset = 1;
+  bool need_check = true;
+
+  // continuous refs, discrete refs, duplicated params
+  {
+    std::pair<int64_t, int64_t> ref_arr[9] = {{10, 4}, {11, 4}, {12, 4},
+                                              {10, 4}, {100, 4}, {200, 4},
+                                              {5, 4}, {5, 4}, {200, 4}};
+    int64_t res_arr[3] = {3 * each_type_cnt, 2 * each_type_cnt, each_type_cnt};
+    string_type_filter_normal_check(true, ObWhiteFilterOperatorType::WHITE_OP_IN, 3, 3, res_arr);
+  }
+}
+
 }  // namespace blocksstable
 }  // namespace oceanbase
 
@@ -1196,6 +1196,66 @@ TEST_F(TestSkipIndexFilter, test_in)
 }
 
 
+TEST_F(TestSkipIndexFilter, test_sorted_in)
+{
+  // IN params of runtime filter are sorted, checked by binary search
+  sql::ObPushdownWhiteFilterNode white_filter(allocator_);
+  sql::ObExecContext exec_ctx(allocator_);
+  sql::ObEvalCtx eval_ctx(exec_ctx);
+  sql::ObPushdownExprSpec expr_spec(allocator_);
+  sql::ObPushdownOperator op(eval_ctx, expr_spec);
+  white_filter.op_type_ = sql::WHITE_OP_IN;
+  sql::ObWhiteFilterExecutor filter(allocator_, white_filter, op);
+  ObSkipIndexFilterExecutor skip_index_filter;
+  ObBoolMask fal_desc;
+
+  const int64_t values[] = { 10, 20, 30, 40 };
+  const int64_t count = sizeof(values) / sizeof(values[0]);
+  char datum_buf[count + 2][16];
+  ObDatum datums[count + 2];
+  ObObj obj;
+  OK(filter.datum_params_.init(count));
+  for (int64_t i = 0; i < count; ++i) {
+    obj.set_int(values[i]);
+    datums[i].ptr_ = datum_buf[i];
+    OK(datums[i].from_obj(obj));
+    OK(filter.datum_params_.push_back(datums[i]));
+  }
+  filter.cmp_func_ = get_datum_cmp_func(obj.get_meta(), obj.get_meta());
+  ObDatum &min_datum = datums[count];
+  ObDatum &max_datum = datums[count + 1];
+  min_datum.ptr_ = datum_buf[count];
+  max_datum.ptr_ = datum_buf[count + 1];
+
+  // {min, max, expected: 0 always false, 1 always true, 2 uncertain}
+  const int64_t cases[][3] = {
+    { 1, 5, 0 },    // before all params
+    { 41, 50, 0 },  // after all params
+    { 21, 29, 0 },  // between two params
+    { 15, 25, 2 },
+    { 5, 45, 2 },
+    { 10, 10, 1 },
+    { 30, 30, 1 },
+    { 40, 41, 2 },
+  };
+  const int64_t case_count = sizeof(cases) / sizeof(cases[0]);
+  for (int64_t i = 0; i < case_count; ++i) {
+    obj.set_int(cases[i][0]);
+    OK(min_datum.from_obj(obj));
+    obj.set_int(cases[i][1]);
+    OK(max_datum.from_obj(obj));
+    fal_desc.set_uncertain();
+    OK(skip_index_filter.sorted_in_operator(filter, min_datum, max_datum, fal_desc));
+    if (0 == cases[i][2]) {
+      ASSERT_TRUE(fal_desc.is_always_false()) << i;
+    } else if (1 == cases[i][2]) {
+      ASSERT_TRUE(fal_desc.is_always_true()) << i;
+    } else {
+      ASSERT_TRUE(fal_desc.is_uncertain()) << i;
+    }
+  }
+}
+
 TEST_F(TestSkipIndexFilter, test_has_null)
 {
   sql::ObPushdownWhiteFilterNode white_filter(allocator_);
@@ -1894,6 +1894,73 @@ TEST_F(TestTmpFile, test_tmp_file_sync)
   ObTmpFileManager::get_instance().remove(fd);
 }
 
+TEST_F(TestTmpFile, test_sequential_read_ahead)
+{
+  int ret = OB_SUCCESS;
+  int64_t dir = -1;
+  int64_t fd = -1;
+  ObTmpFileIOInfo io_info;
+  ObTmpFileIOHandle handle;
+  ret = ObTmpFileManager::get_instance().alloc_dir(dir);
+  ASSERT_EQ(OB_SUCCESS, ret);
+  ret = ObTmpFileManager::get_instance().open(fd, dir);
+  ASSERT_EQ(OB_SUCCESS, ret);
+  const int64_t write_size = 1024 * 1024;
+  const int64_t read_size = 64 * 1024;
+  char *write_buf = (char *)malloc(write_size);
+  char *read_buf = (char *)malloc(write_size);
+  for (int64_t i = 0; i < write_size; ++i) {
+    write_buf[i] = static_cast<char>(i % 256);
+  }
+  io_info.fd_ = fd;
+  io_info.tenant_id_ = 1;
+  io_info.io_desc_.set_group_id(THIS_WORKER.get_group_id());
+  io_info.io_desc_.set_wait_event(2);
+  io_info.buf_ = write_buf;
+  io_info.size_ = write_size;
+  io_info.io_timeout_ms_ = DEFAULT_IO_WAIT_TIME_MS;
+  ret = ObTmpFileManager::get_instance().write(io_info);
+  ASSERT_EQ(OB_SUCCESS, ret);
+  ret = ObTmpFileManager::get_instance().sync(fd, 5000);
+  ASSERT_EQ(OB_SUCCESS, ret);
+
+  // the first sequential read loads the rest of the extent in background.
+  io_info.buf_ = read_buf;
+  io_info.size_ = read_size;
+  ret = ObTmpFileManager::get_instance().read(io_info, handle);
+  ASSERT_EQ(OB_SUCCESS, ret);
+  ASSERT_EQ(0, MEMCMP(handle.get_buffer(), write_buf, read_size));
+  handle.reset();
+
+  ObTmpFileHandle file_handle;
+  ret = ObTmpFileManager::get_instance().get_tmp_file_handle(fd, file_handle);
+  ASSERT_EQ(OB_SUCCESS, ret);
+  ObTmpFile *file = file_handle.get_resource_ptr();
+  ASSERT_EQ(write_size, file->read_ahead_end_);
+  ASSERT_FALSE(file->read_ahead_handle_.is_empty());
+  ret = file->read_ahead_handle_.wait();
+  ASSERT_EQ(OB_SUCCESS, ret);
+  ObTmpFileExtent *extent = file->file_meta_.get_extents().at(0);
+  const int64_t page_id = extent->get_start_page_id()
+      + (write_size - 1) / ObTmpMacroBlock::get_default_page_size();
+  ObTmpPageCacheKey key(extent->get_block_id(), page_id, 1);
+  ObTmpPageValueHandle p_handle;
+  ret = ObTmpPageCache::get_instance().get_page(key, p_handle);
+  ASSERT_EQ(OB_SUCCESS, ret);
+  file_handle.reset();
+
+  // the rest is read from page cache.
+  io_info.size_ = write_size - read_size;
+  ret = ObTmpFileManager::get_instance().read(io_info, handle);
+  ASSERT_EQ(OB_SUCCESS, ret);
+  ASSERT_EQ(0, MEMCMP(handle.get_buffer(), write_buf + read_size, write_size - read_size));
+  handle.reset();
+
+  free(write_buf);
+  free(read_buf);
+  ObTmpFileManager::get_instance().remove(fd);
+}
+
 TEST_F(TestTmpFile, test_tmp_file_sync_same_block)
 {
   int ret = OB_SUCCESS;
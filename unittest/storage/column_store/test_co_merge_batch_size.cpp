@@ -0,0 +1,118 @@
+/**
+ * Copyright (c) 2022 OceanBase
+ * OceanBase is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX STORAGE
+#include <gtest/gtest.h>
+
+#include "storage/column_store/ob_co_merge_dag.h"
+#include "storage/compaction/ob_compaction_dag_ranker.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace compaction;
+using namespace storage;
+
+namespace unittest
+{
+
+static const int64_t MB = 1024L * 1024L;
+static const int64_t GB = 1024L * MB;
+static const int64_t CG_CNT = 256;
+static const int64_t MERGE_THREAD = 8;
+static const int64_t CONCURRENT_CNT = 4;
+static const int64_t SSTABLE_CNT = 2;
+
+static int64_t batch_size(const int64_t cg_cnt, const int64_t mem_allow_used,
+                          const int64_t merge_thread = MERGE_THREAD,
+                          const int64_t concurrent_cnt = CONCURRENT_CNT,
+                          const ObMergeType merge_type = MAJOR_MERGE)
+{
+  return ObCOMergeDagNet::calc_merge_batch_size(merge_type, cg_cnt, merge_thread,
+                                                concurrent_cnt, SSTABLE_CNT, mem_allow_used);
+}
+
+static int64_t batch_cnt(const int64_t cg_cnt, const int64_t size)
+{
+  return (cg_cnt + size - 1) / size;
+}
+
+TEST(TestCOMergeBatchSize, narrow_table)
+{
+  // less than two default batches, merged in one batch
+  ASSERT_EQ(1, batch_size(1, 0));
+  ASSERT_EQ(15, batch_size(15, 0));
+  ASSERT_EQ(19, batch_size(19, 100 * GB));
+}
+
+TEST(TestCOMergeBatchSize, memory_limit)
+{
+  // one merge thread can hold 40 cg writers of 4 concurrent tasks in 1GB:
+  // (1GB - 2MB - 14MB - 4MB * 4 * 2) / (6MB * 4)
+  ASSERT_EQ(40, ObCompactionEstimator::estimate_compaction_batch_size(
+      MAJOR_MERGE, GB, CONCURRENT_CNT, SSTABLE_CNT));
+  // no memory, the default batch size bounds the batch count
+  ASSERT_EQ(11, batch_size(CG_CNT, 0));
+  ASSERT_EQ(11, batch_size(CG_CNT, MERGE_THREAD * 64 * MB));
+  // 7 batches of at most 40 cgs
+  ASSERT_EQ(37, batch_size(CG_CNT, MERGE_THREAD * GB));
+  ASSERT_EQ(7, batch_cnt(CG_CNT, batch_size(CG_CNT, MERGE_THREAD * GB)));
+  // enough memory, batches only to keep the 8 merge threads busy
+  ASSERT_EQ(128, batch_size(CG_CNT, MERGE_THREAD * 10 * GB));
+  ASSERT_EQ(256, batch_size(CG_CNT, MERGE_THREAD * 100 * GB, MERGE_THREAD, MERGE_THREAD));
+  ASSERT_EQ(32, batch_size(CG_CNT, MERGE_THREAD * 10 * GB, 32));
+  ASSERT_EQ(32, batch_size(CG_CNT, MERGE_THREAD * 10 * GB, MERGE_THREAD, 1));
+  // wider table
+  ASSERT_EQ(10, batch_size(1000, MERGE_THREAD * 64 * MB));
+  ASSERT_EQ(500, batch_size(1000, MERGE_THREAD * 100 * GB));
+}
+
+TEST(TestCOMergeBatchSize, more_memory_larger_batch)
+{
+  for (int64_t cg_cnt = 200; cg_cnt <= 2000; cg_cnt += 150) {
+    int64_t last_size = 0;
+    for (int64_t mem = 0; mem <= MERGE_THREAD * 16 * GB; mem += MERGE_THREAD * 128 * MB) {
+      const int64_t size = batch_size(cg_cnt, mem);
+      const int64_t mem_allow_batch_size = ObCompactionEstimator::estimate_compaction_batch_size(
+          MAJOR_MERGE, mem / MERGE_THREAD, CONCURRENT_CNT, SSTABLE_CNT);
+      ASSERT_GE(size, last_size) << cg_cnt << " " << mem;
+      // never more batches than the default batch size gives
+      ASSERT_LE(batch_cnt(cg_cnt, size), cg_cnt / ObCOTabletMergeCtx::DEFAULT_CG_MERGE_BATCH_SIZE);
+      // never fewer batches than merge threads can run
+      ASSERT_GE(batch_cnt(cg_cnt, size), MERGE_THREAD / CONCURRENT_CNT);
+      // a batch is in the memory budget unless the batch count is bounded by the default size
+      if (size > mem_allow_batch_size) {
+        ASSERT_LE(size, batch_size(cg_cnt, 0)) << cg_cnt << " " << mem;
+      }
+      last_size = size;
+    }
+  }
+}
+
+TEST(TestCOMergeBatchSize, not_major_merge)
+{
+  // the memory of other merge types is not estimated, batches of the default size
+  ASSERT_EQ(11, batch_size(CG_CNT, MERGE_THREAD * 10 * GB, MERGE_THREAD, CONCURRENT_CNT,
+                           MINOR_MERGE));
+}
+
+} // namespace unittest
+} // namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -rf test_co_merge_batch_size.log");
+  OB_LOGGER.set_file_name("test_co_merge_batch_size.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,141 @@
+/**
+ * Copyright (c) 2023 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#define private public
+#define protected public
+#include "storage/compaction/ob_partition_merge_fuser.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace compaction;
+using namespace blocksstable;
+
+namespace unittest
+{
+static const int64_t COLUMN_CNT = 6;
+
+class TestMajorMergeFuser : public ::testing::Test
+{
+public:
+  TestMajorMergeFuser() : allocator_("MergeFuserTest") { MEMSET(trans_info_, 0, sizeof(trans_info_)); }
+  virtual void TearDown()
+  {
+    allocator_.reset();
+  }
+  // init the fuser as inner_init does, with default value 100 + i for column i
+  void init_fuser(ObMajorPartitionMergeFuser &fuser)
+  {
+    fuser.column_cnt_ = COLUMN_CNT;
+    ASSERT_EQ(OB_SUCCESS, fuser.default_row_.init(allocator_, COLUMN_CNT));
+    for (int64_t i = 0; i < COLUMN_CNT; ++i) {
+      fuser.default_row_.storage_datums_[i].set_int(100 + i);
+    }
+    fuser.default_row_.row_flag_.set_flag(ObDmlFlag::DF_UPDATE);
+    ASSERT_EQ(OB_SUCCESS, fuser.generated_cols_.init(COLUMN_CNT));
+    ASSERT_EQ(OB_SUCCESS, fuser.base_init());
+    fuser.is_inited_ = true;
+  }
+  void prepare_row(const ObDmlFlag flag, const int64_t nop_idx, ObDatumRow &row)
+  {
+    ASSERT_EQ(OB_SUCCESS, row.init(allocator_, COLUMN_CNT));
+    for (int64_t i = 0; i < COLUMN_CNT; ++i) {
+      if (i == nop_idx) {
+        row.storage_datums_[i].set_nop();
+      } else {
+        row.storage_datums_[i].set_int(i);
+      }
+    }
+    row.row_flag_.set_flag(flag);
+    row.trans_info_ = trans_info_;
+  }
+  void check_result_row(const ObDatumRow &expect, const ObDatumRow &result)
+  {
+    ASSERT_EQ(expect.count_, result.count_);
+    ASSERT_TRUE(expect == result);
+    ASSERT_EQ(expect.row_flag_.get_serialize_flag(), result.row_flag_.get_serialize_flag());
+    ASSERT_EQ(expect.mvcc_row_flag_.flag_, result.mvcc_row_flag_.flag_);
+    ASSERT_EQ(expect.trans_id_.get_id(), result.trans_id_.get_id());
+    ASSERT_TRUE(expect.trans_info_ == result.trans_info_);
+  }
+protected:
+  ObArenaAllocator allocator_;
+  char trans_info_[16];
+};
+
+TEST_F(TestMajorMergeFuser, fuse_single_row)
+{
+  ObDatumRow row;
+  prepare_row(ObDmlFlag::DF_UPDATE, -1, row);
+
+  ObMajorPartitionMergeFuser full_fuser(allocator_);
+  init_fuser(full_fuser);
+  ASSERT_EQ(OB_SUCCESS, full_fuser.fuse_rows(row));
+
+  ObMajorPartitionMergeFuser single_fuser(allocator_);
+  init_fuser(single_fuser);
+  // leftovers of the last fused row are overwritten
+  single_fuser.result_row_.mvcc_row_flag_.set_last_multi_version_row(true);
+  single_fuser.result_row_.trans_id_ = 1;
+  single_fuser.result_row_.row_flag_.set_flag(ObDmlFlag::DF_DELETE);
+  bool is_fused = false;
+  ASSERT_EQ(OB_SUCCESS, single_fuser.fuse_single_row(row, is_fused));
+  ASSERT_TRUE(is_fused);
+  ASSERT_EQ(0, single_fuser.nop_pos_.count());
+  ASSERT_TRUE(single_fuser.result_row_.row_flag_.is_insert());
+  check_result_row(full_fuser.get_result_row(), single_fuser.get_result_row());
+}
+
+TEST_F(TestMajorMergeFuser, fuse_single_row_with_nop)
+{
+  const int64_t nop_idx = 3;
+  ObDatumRow row;
+  prepare_row(ObDmlFlag::DF_UPDATE, nop_idx, row);
+
+  ObMajorPartitionMergeFuser full_fuser(allocator_);
+  init_fuser(full_fuser);
+  ASSERT_EQ(OB_SUCCESS, full_fuser.fuse_rows(row));
+  ASSERT_EQ(100 + nop_idx, full_fuser.get_result_row().storage_datums_[nop_idx].get_int());
+
+  // nop column needs the default value, fall back to the full fuse
+  ObMajorPartitionMergeFuser single_fuser(allocator_);
+  init_fuser(single_fuser);
+  bool is_fused = true;
+  ASSERT_EQ(OB_SUCCESS, single_fuser.fuse_single_row(row, is_fused));
+  ASSERT_FALSE(is_fused);
+  ASSERT_EQ(OB_SUCCESS, single_fuser.fuse_rows(row));
+  check_result_row(full_fuser.get_result_row(), single_fuser.get_result_row());
+}
+
+TEST_F(TestMajorMergeFuser, fuse_single_delete_row)
+{
+  ObDatumRow row;
+  prepare_row(ObDmlFlag::DF_DELETE, -1, row);
+  ObMajorPartitionMergeFuser fuser(allocator_);
+  init_fuser(fuser);
+  bool is_fused = true;
+  ASSERT_EQ(OB_SUCCESS, fuser.fuse_single_row(row, is_fused));
+  ASSERT_FALSE(is_fused);
+}
+
+}//end namespace unittest
+}//end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_major_merge_fuser.log*");
+  OB_LOGGER.set_file_name("test_major_merge_fuser.log");
+  OB_LOGGER.set_log_level("INFO");
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,215 @@
+/**
+ * Copyright (c) 2023 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#define private public
+#define protected public
+#include "storage/direct_load/ob_direct_load_mem_sample.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace blocksstable;
+using namespace storage;
+using namespace share::schema;
+
+namespace unittest
+{
+
+class TestDirectLoadMemSample : public ::testing::Test
+{
+public:
+  typedef ObDirectLoadConstExternalMultiPartitionRow RowType;
+  typedef ObDirectLoadExternalMultiPartitionRowChunk ChunkType;
+  typedef ObDirectLoadExternalMultiPartitionRowRange RangeType;
+  typedef ObDirectLoadExternalMultiPartitionRowCompare CompareType;
+
+  TestDirectLoadMemSample() : allocator_("TLD_SampleTest"), seq_no_(0) {}
+  virtual void SetUp()
+  {
+    ObSEArray<ObColDesc, 1> col_descs;
+    ObColDesc col_desc;
+    col_desc.col_id_ = OB_APP_MIN_COLUMN_ID;
+    col_desc.col_type_.set_int();
+    ASSERT_EQ(OB_SUCCESS, col_descs.push_back(col_desc));
+    ASSERT_EQ(OB_SUCCESS, datum_utils_.init(col_descs, 1, false /*is_oracle_mode*/, allocator_));
+    mem_ctx_.datum_utils_ = &datum_utils_;
+    mem_ctx_.dup_action_ = sql::ObLoadDupActionType::LOAD_STOP_ON_DUP;
+  }
+  virtual void TearDown()
+  {
+    for (int64_t i = 0; i < all_chunks_.count(); ++i) {
+      all_chunks_.at(i)->~ChunkType();
+    }
+    all_chunks_.reset();
+    mem_ctx_.datum_utils_ = nullptr;
+    datum_utils_.reset();
+    allocator_.reset();
+  }
+  // chunk of rows with the rowkeys %keys, which must be in order
+  ChunkType *make_chunk(const int64_t *keys, const int64_t count)
+  {
+    ChunkType *chunk = new (allocator_.alloc(sizeof(ChunkType))) ChunkType();
+    for (int64_t i = 0; i < count; ++i) {
+      ObStorageDatum *datum = new (allocator_.alloc(sizeof(ObStorageDatum))) ObStorageDatum();
+      RowType *row = new (allocator_.alloc(sizeof(RowType))) RowType();
+      datum->set_int(keys[i]);
+      row->tablet_id_ = ObTabletID(1);
+      row->rowkey_datum_array_.datums_ = datum;
+      row->rowkey_datum_array_.count_ = 1;
+      row->seq_no_ = seq_no_++;
+      row->buf_size_ = sizeof(buf_);
+      row->buf_ = buf_;
+      OB_ASSERT(OB_SUCCESS == chunk->item_list_.push_back(row));
+    }
+    OB_ASSERT(OB_SUCCESS == all_chunks_.push_back(chunk));
+    return chunk;
+  }
+  // every row is in exactly one of the left-open right-closed ranges, and the ranges are in order
+  void check_ranges(ObIArray<ChunkType *> &chunks, const int64_t range_count)
+  {
+    ObDirectLoadMemSample sample(&mem_ctx_);
+    sample.range_count_ = range_count;
+    ObArray<RangeType> ranges;
+    ASSERT_EQ(OB_SUCCESS, sample.gen_sorted_ranges(chunks, ranges));
+    ASSERT_EQ(range_count, ranges.count());
+    ASSERT_TRUE(nullptr == ranges.at(0).start_);
+    ASSERT_TRUE(nullptr == ranges.at(range_count - 1).end_);
+
+    ObArray<int64_t> expect_keys;
+    for (int64_t i = 0; i < chunks.count(); ++i) {
+      for (int64_t j = 0; j < chunks.at(i)->get_size(); ++j) {
+        ASSERT_EQ(OB_SUCCESS, expect_keys.push_back(
+            chunks.at(i)->get_item(j)->rowkey_datum_array_.datums_[0].get_int()));
+      }
+    }
+    // same compare as the mem dump scans chunks with
+    CompareType compare;
+    ASSERT_EQ(OB_SUCCESS, compare.init(datum_utils_, mem_ctx_.dup_action_, true /*ignore_seq_no*/));
+    ObArray<int64_t> keys;
+    for (int64_t i = 0; i < ranges.count(); ++i) {
+      for (int64_t j = 0; j < chunks.count(); ++j) {
+        auto iter = chunks.at(j)->scan(ranges.at(i).start_, ranges.at(i).end_, compare);
+        const RowType *row = nullptr;
+        while (OB_SUCCESS == iter.get_next_item(row)) {
+          ASSERT_EQ(OB_SUCCESS, keys.push_back(row->rowkey_datum_array_.datums_[0].get_int()));
+        }
+      }
+    }
+    ASSERT_EQ(OB_SUCCESS, compare.get_error_code());
+    ASSERT_EQ(expect_keys.count(), keys.count());
+    for (int64_t i = 0; i < keys.count(); ++i) {
+      ASSERT_EQ(expect_keys.at(i), keys.at(i));
+    }
+  }
+protected:
+  ObArenaAllocator allocator_;
+  ObStorageDatumUtils datum_utils_;
+  ObDirectLoadMemContext mem_ctx_;
+  ObArray<ChunkType *> all_chunks_;
+  int64_t seq_no_;
+  char buf_[8];
+};
+
+TEST_F(TestDirectLoadMemSample, sorted)
+{
+  const int64_t keys1[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+  const int64_t keys2[] = {11, 12, 13, 14, 15, 16, 17, 18, 19, 20};
+  const int64_t keys3[] = {21, 22, 23, 24, 25};
+  ObArray<ChunkType *> chunks;
+  // chunks arrive out of order
+  ASSERT_EQ(OB_SUCCESS, chunks.push_back(make_chunk(keys2, ARRAYSIZEOF(keys2))));
+  ASSERT_EQ(OB_SUCCESS, chunks.push_back(make_chunk(keys3, ARRAYSIZEOF(keys3))));
+  ASSERT_EQ(OB_SUCCESS, chunks.push_back(make_chunk(keys1, ARRAYSIZEOF(keys1))));
+  ObDirectLoadMemSample sample(&mem_ctx_);
+  bool is_sorted = false;
+  ASSERT_EQ(OB_SUCCESS, sample.check_sorted(chunks, is_sorted));
+  ASSERT_TRUE(is_sorted);
+  ASSERT_EQ(1, chunks.at(0)->get_item(0)->rowkey_datum_array_.datums_[0].get_int());
+  ASSERT_EQ(11, chunks.at(1)->get_item(0)->rowkey_datum_array_.datums_[0].get_int());
+  ASSERT_EQ(21, chunks.at(2)->get_item(0)->rowkey_datum_array_.datums_[0].get_int());
+  for (int64_t range_count = 1; range_count <= 8; ++range_count) {
+    check_ranges(chunks, range_count);
+  }
+}
+
+TEST_F(TestDirectLoadMemSample, overlapping)
+{
+  const int64_t keys1[] = {1, 5, 9};
+  const int64_t keys2[] = {3, 7, 11};
+  ObArray<ChunkType *> chunks;
+  ASSERT_EQ(OB_SUCCESS, chunks.push_back(make_chunk(keys1, ARRAYSIZEOF(keys1))));
+  ASSERT_EQ(OB_SUCCESS, chunks.push_back(make_chunk(keys2, ARRAYSIZEOF(keys2))));
+  ObDirectLoadMemSample sample(&mem_ctx_);
+  bool is_sorted = true;
+  ASSERT_EQ(OB_SUCCESS, sample.check_sorted(chunks, is_sorted));
+  ASSERT_FALSE(is_sorted);
+
+  // an empty chunk is never taken as sorted
+  ChunkType *empty_chunk = make_chunk(keys1, 0);
+  ObArray<ChunkType *> chunks2;
+  ASSERT_EQ(OB_SUCCESS, chunks2.push_back(empty_chunk));
+  ASSERT_EQ(OB_SUCCESS, sample.check_sorted(chunks2, is_sorted));
+  ASSERT_FALSE(is_sorted);
+}
+
+TEST_F(TestDirectLoadMemSample, equal_boundary_key)
+{
+  // the same rowkey at the end of one chunk and the start of the next one
+  const int64_t keys1[] = {1, 2, 3};
+  const int64_t keys2[] = {3, 4, 5};
+  ObArray<ChunkType *> chunks;
+  ASSERT_EQ(OB_SUCCESS, chunks.push_back(make_chunk(keys1, ARRAYSIZEOF(keys1))));
+  ASSERT_EQ(OB_SUCCESS, chunks.push_back(make_chunk(keys2, ARRAYSIZEOF(keys2))));
+  ObDirectLoadMemSample sample(&mem_ctx_);
+  bool is_sorted = true;
+  ASSERT_EQ(OB_SUCCESS, sample.check_sorted(chunks, is_sorted));
+  ASSERT_FALSE(is_sorted);
+
+  // duplicated rowkeys inside one chunk, range boundaries may fall on them
+  const int64_t keys3[] = {1, 2, 2, 2, 2, 3};
+  const int64_t keys4[] = {4, 5, 5, 6};
+  ObArray<ChunkType *> chunks2;
+  ASSERT_EQ(OB_SUCCESS, chunks2.push_back(make_chunk(keys3, ARRAYSIZEOF(keys3))));
+  ASSERT_EQ(OB_SUCCESS, chunks2.push_back(make_chunk(keys4, ARRAYSIZEOF(keys4))));
+  ASSERT_EQ(OB_SUCCESS, sample.check_sorted(chunks2, is_sorted));
+  ASSERT_TRUE(is_sorted);
+  for (int64_t range_count = 1; range_count <= 6; ++range_count) {
+    check_ranges(chunks2, range_count);
+  }
+}
+
+TEST_F(TestDirectLoadMemSample, fewer_rows_than_ranges)
+{
+  const int64_t keys1[] = {1};
+  const int64_t keys2[] = {2};
+  ObArray<ChunkType *> chunks;
+  ASSERT_EQ(OB_SUCCESS, chunks.push_back(make_chunk(keys1, ARRAYSIZEOF(keys1))));
+  ASSERT_EQ(OB_SUCCESS, chunks.push_back(make_chunk(keys2, ARRAYSIZEOF(keys2))));
+  ObDirectLoadMemSample sample(&mem_ctx_);
+  bool is_sorted = false;
+  ASSERT_EQ(OB_SUCCESS, sample.check_sorted(chunks, is_sorted));
+  ASSERT_TRUE(is_sorted);
+  check_ranges(chunks, 5);
+}
+
+}//end namespace unittest
+}//end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_direct_load_mem_sample.log*");
+  OB_LOGGER.set_file_name("test_direct_load_mem_sample.log");
+  OB_LOGGER.set_log_level("INFO");
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -1097,6 +1097,66 @@ TEST_F(TestCompactionPolicy, test_minor_dag_intersect)
   ASSERT_EQ(false, (dag1 == dag2));
 }
 
+TEST_F(TestCompactionPolicy, check_tiered_minor_merge_refine)
+{
+  const int64_t table_cnt = 5;
+  const int64_t scns[table_cnt + 1] = {1, 150, 200, 250, 300, 350};
+  const int64_t sizes[table_cnt] = {1000, 100, 60, 30, 20};
+  ObTablesHandleArray tables;
+  for (int64_t i = 0; i < table_cnt; ++i) {
+    ObTableHandleV2 table_handle;
+    ASSERT_EQ(OB_SUCCESS, TestCompactionPolicy::mock_sstable(allocator_, ObITable::MINI_SSTABLE,
+        scns[i], scns[i + 1], scns[i + 1], scns[i + 1], table_handle));
+    static_cast<ObSSTable *>(table_handle.get_table())->meta_cache_.occupy_size_ = sizes[i];
+    ASSERT_EQ(OB_SUCCESS, tables.add_table(table_handle));
+  }
+
+  // the largest sstable is left out of the newest tier
+  ObGetMergeTablesResult result;
+  ASSERT_EQ(OB_SUCCESS, result.handle_.assign(tables));
+  ASSERT_EQ(OB_SUCCESS, ObPartitionMergePolicy::refine_tiered_minor_merge_result(2, 100, result));
+  ASSERT_EQ(4, result.handle_.get_count());
+  ASSERT_EQ(scns[1], result.scn_range_.start_scn_.get_val_for_tx());
+  ASSERT_EQ(scns[table_cnt], result.scn_range_.end_scn_.get_val_for_tx());
+
+  // only the newest sstable is in the tier with small size ratio
+  result.reset();
+  ASSERT_EQ(OB_SUCCESS, result.handle_.assign(tables));
+  ASSERT_EQ(OB_NO_NEED_MERGE, ObPartitionMergePolicy::refine_tiered_minor_merge_result(2, 10, result));
+
+  // all sstables are in the tier with large size ratio
+  result.reset();
+  ASSERT_EQ(OB_SUCCESS, result.handle_.assign(tables));
+  ASSERT_EQ(OB_SUCCESS, ObPartitionMergePolicy::refine_tiered_minor_merge_result(2, 1000, result));
+  ASSERT_EQ(table_cnt, result.handle_.get_count());
+}
+
+TEST_F(TestCompactionPolicy, check_minor_merge_refine_after_large_sstable)
+{
+  const int64_t table_cnt = 5;
+  const int64_t scns[table_cnt + 1] = {1, 150, 200, 250, 300, 350};
+  ObTablesHandleArray tables;
+  for (int64_t i = 0; i < table_cnt; ++i) {
+    ObTableHandleV2 table_handle;
+    ASSERT_EQ(OB_SUCCESS, TestCompactionPolicy::mock_sstable(allocator_, ObITable::MINI_SSTABLE,
+        scns[i], scns[i + 1], scns[i + 1], scns[i + 1], table_handle));
+    ASSERT_EQ(OB_SUCCESS, tables.add_table(table_handle));
+  }
+  // the second sstable is large, only the mini sstables after it are merged
+  static_cast<ObSSTable *>(tables.get_table(1))->meta_cache_.row_count_ =
+      ObPartitionMergePolicy::OB_LARGE_MINOR_SSTABLE_ROW_COUNT + 1;
+
+  ObGetMergeTablesResult result;
+  ASSERT_EQ(OB_SUCCESS, result.handle_.assign(tables));
+  ASSERT_EQ(OB_SUCCESS, ObPartitionMergePolicy::refine_minor_merge_result(MINOR_MERGE, 2, result));
+  ASSERT_EQ(3, result.handle_.get_count());
+  for (int64_t i = 0; i < result.handle_.get_count(); ++i) {
+    ASSERT_EQ(tables.get_table(i + 2), result.handle_.get_table(i));
+  }
+  ASSERT_EQ(scns[2], result.scn_range_.start_scn_.get_val_for_tx());
+  ASSERT_EQ(scns[table_cnt], result.scn_range_.end_scn_.get_val_for_tx());
+}
+
 } //unittest
 } //oceanbase
 